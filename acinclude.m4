@@ -4,7 +4,8 @@ dnl Version: 20240413
 
 dnl Function to detect if libfcrypto dependencies are available
 AC_DEFUN([AX_LIBFCRYPTO_CHECK_LOCAL],
-  [dnl No additional checks.
+  [dnl Functions used in libfcrypto/libfcrypto_cpu.c
+  AC_CHECK_FUNCS([getenv])
   ])
 
 dnl Function to check if DLL support is needed
@@ -25,9 +25,15 @@
 #include <types.h>
 
 #include "libfcrypto_blowfish_context.h"
+#include "libfcrypto_cpu.h"
+#include "libfcrypto_ctr.h"
 #include "libfcrypto_definitions.h"
 #include "libfcrypto_libcerror.h"
 
+#if defined( LIBFCRYPTO_BLOWFISH_CONTEXT_HAVE_AVX2 )
+#include <immintrin.h>
+#endif
+
 /* The initial permutation values (P-array)
  */
 static uint32_t libfcrypto_blowfish_initial_permutation_values[ 18 ] = {
@@ -297,6 +303,15 @@ static uint32_t libfcrypto_blowfish_initial_sboxes[ 4 ][ 256 ] = {
 	  0x90d4f869L, 0xa65cdea0L, 0x3f09252dL, 0xc208e69fL,
 	  0xb74e6132L, 0xce77e25bL, 0x578fdfe3L, 0x3ac372e6L } };
 
+/* Calculates a Blowfish round
+ */
+#define libfcrypto_blowfish_calculate_round( value_left, value_right, permutation_value ) \
+	value_left  ^= permutation_value; \
+	value_right ^= ( ( internal_context->sboxes[ 0 ][ value_left >> 24 ] \
+	               + internal_context->sboxes[ 1 ][ ( value_left >> 16 ) & 0x000000ffUL ] ) \
+	               ^ internal_context->sboxes[ 2 ][ ( value_left >> 8 ) & 0x000000ffUL ] ) \
+	               + internal_context->sboxes[ 3 ][ value_left & 0x000000ffUL ];
+
 /* Creates a Blowfish context
  * Make sure the value context is referencing, is set to NULL
  * Returns 1 if successful or -1 on error
@@ -358,6 +373,15 @@ int libfcrypto_blowfish_context_initialize(
 
 		goto on_error;
 	}
+#if defined( LIBFCRYPTO_BLOWFISH_CONTEXT_HAVE_AVX2 )
+	/* The multi-block function is selected once per context
+	 */
+	if( libfcrypto_cpu_get_level() >= LIBFCRYPTO_CPU_LEVEL_AVX2 )
+	{
+		internal_context->crypt_blocks_function = libfcrypto_internal_blowfish_context_crypt_blocks_avx2;
+		internal_context->crypt_blocks_size     = 64;
+	}
+#endif
 	*context = (libfcrypto_blowfish_context_t *) internal_context;
 
 	return( 1 );
@@ -920,8 +944,949 @@ int libfcrypto_internal_blowfish_context_decrypt_block(
 	return( 1 );
 }
 
+/* De- or encrypts multiple blocks of data using Blowfish
+ * The blocks are processed 8 or 4 at a time with their rounds interleaved, so that
+ * the S-box lookups of the independent blocks can overlap, or by the vector
+ * multi-block function selected for the context
+ * If an initialization vector is provided the blocks are decrypted using CBC and
+ * the initialization vector is updated to the last encrypted input block
+ * The size must be a multitude of 4 times the Blowfish block size (32 bytes)
+ * Returns 1 if successful or -1 on error
+ */
+int libfcrypto_internal_blowfish_context_crypt_blocks(
+     libfcrypto_internal_blowfish_context_t *internal_context,
+     int mode,
+     uint8_t *initialization_vector,
+     const uint8_t *input_data,
+     size_t input_data_size,
+     uint8_t *output_data,
+     size_t output_data_size,
+     libcerror_error_t **error )
+{
+	uint32_t permutation_values[ 18 ];
+
+	static char *function       = "libfcrypto_internal_blowfish_context_crypt_blocks";
+	size_t data_offset          = 0;
+	uint32_t next_vector_left   = 0;
+	uint32_t next_vector_right  = 0;
+	uint32_t permutation_value  = 0;
+	uint32_t value_32bit        = 0;
+	uint32_t value_left1        = 0;
+	uint32_t value_left2        = 0;
+	uint32_t value_left3        = 0;
+	uint32_t value_left4        = 0;
+	uint32_t value_left5        = 0;
+	uint32_t value_left6        = 0;
+	uint32_t value_left7        = 0;
+	uint32_t value_left8        = 0;
+	uint32_t value_right1       = 0;
+	uint32_t value_right2       = 0;
+	uint32_t value_right3       = 0;
+	uint32_t value_right4       = 0;
+	uint32_t value_right5       = 0;
+	uint32_t value_right6       = 0;
+	uint32_t value_right7       = 0;
+	uint32_t value_right8       = 0;
+	uint32_t vector_left        = 0;
+	uint32_t vector_right       = 0;
+	uint8_t round_index         = 0;
+
+	if( internal_context == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid context.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( mode != LIBFCRYPTO_BLOWFISH_CRYPT_MODE_ENCRYPT )
+	 && ( mode != LIBFCRYPTO_BLOWFISH_CRYPT_MODE_DECRYPT ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported mode.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( initialization_vector != NULL )
+	 && ( mode != LIBFCRYPTO_BLOWFISH_CRYPT_MODE_DECRYPT ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported mode, initialization vector is only supported for decryption.",
+		 function );
+
+		return( -1 );
+	}
+	if( input_data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid input data.",
+		 function );
+
+		return( -1 );
+	}
+	/* Check if the input data size is a multitude of 32-byte
+	 */
+	if( ( ( input_data_size & (size_t) 0x1f ) != 0 )
+	 || ( input_data_size < 32 )
+	 || ( input_data_size > (size_t) SSIZE_MAX ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid input data size value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( output_data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid output data.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( output_data_size < input_data_size )
+	 || ( output_data_size > (size_t) SSIZE_MAX ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid output data size value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	/* Decryption uses the permutation values in reverse order
+	 */
+	for( round_index = 0;
+	     round_index < 18;
+	     round_index++ )
+	{
+		if( mode == LIBFCRYPTO_BLOWFISH_CRYPT_MODE_ENCRYPT )
+		{
+			permutation_values[ round_index ] = internal_context->permutation_values[ round_index ];
+		}
+		else
+		{
+			permutation_values[ round_index ] = internal_context->permutation_values[ 17 - round_index ];
+		}
+	}
+	if( ( internal_context->crypt_blocks_function != NULL )
+	 && ( input_data_size >= internal_context->crypt_blocks_size ) )
+	{
+		data_offset = input_data_size - ( input_data_size % internal_context->crypt_blocks_size );
+
+		if( internal_context->crypt_blocks_function(
+		     internal_context,
+		     mode,
+		     initialization_vector,
+		     input_data,
+		     data_offset,
+		     output_data,
+		     data_offset,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_ENCRYPTION,
+			 LIBCERROR_ENCRYPTION_ERROR_GENERIC,
+			 "%s: unable to de- or encrypt input data using vector multi-block function.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	if( initialization_vector != NULL )
+	{
+		byte_stream_copy_to_uint32_big_endian(
+		 &( initialization_vector[ 0 ] ),
+		 vector_left );
+
+		byte_stream_copy_to_uint32_big_endian(
+		 &( initialization_vector[ 4 ] ),
+		 vector_right );
+	}
+	/* The rounds are calculated 2 at a time to remove the swap of the left and right values
+	 */
+	while( ( input_data_size - data_offset ) >= 64 )
+	{
+		byte_stream_copy_to_uint32_big_endian(
+		 &( input_data[ data_offset ] ),
+		 value_left1 );
+
+		byte_stream_copy_to_uint32_big_endian(
+		 &( input_data[ data_offset + 4 ] ),
+		 value_right1 );
+
+		byte_stream_copy_to_uint32_big_endian(
+		 &( input_data[ data_offset + 8 ] ),
+		 value_left2 );
+
+		byte_stream_copy_to_uint32_big_endian(
+		 &( input_data[ data_offset + 12 ] ),
+		 value_right2 );
+
+		byte_stream_copy_to_uint32_big_endian(
+		 &( input_data[ data_offset + 16 ] ),
+		 value_left3 );
+
+		byte_stream_copy_to_uint32_big_endian(
+		 &( input_data[ data_offset + 20 ] ),
+		 value_right3 );
+
+		byte_stream_copy_to_uint32_big_endian(
+		 &( input_data[ data_offset + 24 ] ),
+		 value_left4 );
+
+		byte_stream_copy_to_uint32_big_endian(
+		 &( input_data[ data_offset + 28 ] ),
+		 value_right4 );
+
+		byte_stream_copy_to_uint32_big_endian(
+		 &( input_data[ data_offset + 32 ] ),
+		 value_left5 );
+
+		byte_stream_copy_to_uint32_big_endian(
+		 &( input_data[ data_offset + 36 ] ),
+		 value_right5 );
+
+		byte_stream_copy_to_uint32_big_endian(
+		 &( input_data[ data_offset + 40 ] ),
+		 value_left6 );
+
+		byte_stream_copy_to_uint32_big_endian(
+		 &( input_data[ data_offset + 44 ] ),
+		 value_right6 );
+
+		byte_stream_copy_to_uint32_big_endian(
+		 &( input_data[ data_offset + 48 ] ),
+		 value_left7 );
+
+		byte_stream_copy_to_uint32_big_endian(
+		 &( input_data[ data_offset + 52 ] ),
+		 value_right7 );
+
+		byte_stream_copy_to_uint32_big_endian(
+		 &( input_data[ data_offset + 56 ] ),
+		 value_left8 );
+
+		byte_stream_copy_to_uint32_big_endian(
+		 &( input_data[ data_offset + 60 ] ),
+		 value_right8 );
+
+		for( round_index = 0;
+		     round_index < 16;
+		     round_index += 2 )
+		{
+			permutation_value = permutation_values[ round_index ];
+
+			libfcrypto_blowfish_calculate_round( value_left1, value_right1, permutation_value );
+			libfcrypto_blowfish_calculate_round( value_left2, value_right2, permutation_value );
+			libfcrypto_blowfish_calculate_round( value_left3, value_right3, permutation_value );
+			libfcrypto_blowfish_calculate_round( value_left4, value_right4, permutation_value );
+			libfcrypto_blowfish_calculate_round( value_left5, value_right5, permutation_value );
+			libfcrypto_blowfish_calculate_round( value_left6, value_right6, permutation_value );
+			libfcrypto_blowfish_calculate_round( value_left7, value_right7, permutation_value );
+			libfcrypto_blowfish_calculate_round( value_left8, value_right8, permutation_value );
+
+			permutation_value = permutation_values[ round_index + 1 ];
+
+			libfcrypto_blowfish_calculate_round( value_right1, value_left1, permutation_value );
+			libfcrypto_blowfish_calculate_round( value_right2, value_left2, permutation_value );
+			libfcrypto_blowfish_calculate_round( value_right3, value_left3, permutation_value );
+			libfcrypto_blowfish_calculate_round( value_right4, value_left4, permutation_value );
+			libfcrypto_blowfish_calculate_round( value_right5, value_left5, permutation_value );
+			libfcrypto_blowfish_calculate_round( value_right6, value_left6, permutation_value );
+			libfcrypto_blowfish_calculate_round( value_right7, value_left7, permutation_value );
+			libfcrypto_blowfish_calculate_round( value_right8, value_left8, permutation_value );
+		}
+		value_left1  ^= permutation_values[ 16 ];
+		value_right1 ^= permutation_values[ 17 ];
+		value_left2  ^= permutation_values[ 16 ];
+		value_right2 ^= permutation_values[ 17 ];
+		value_left3  ^= permutation_values[ 16 ];
+		value_right3 ^= permutation_values[ 17 ];
+		value_left4  ^= permutation_values[ 16 ];
+		value_right4 ^= permutation_values[ 17 ];
+		value_left5  ^= permutation_values[ 16 ];
+		value_right5 ^= permutation_values[ 17 ];
+		value_left6  ^= permutation_values[ 16 ];
+		value_right6 ^= permutation_values[ 17 ];
+		value_left7  ^= permutation_values[ 16 ];
+		value_right7 ^= permutation_values[ 17 ];
+		value_left8  ^= permutation_values[ 16 ];
+		value_right8 ^= permutation_values[ 17 ];
+
+		if( initialization_vector != NULL )
+		{
+			byte_stream_copy_to_uint32_big_endian(
+			 &( input_data[ data_offset + 56 ] ),
+			 next_vector_left );
+
+			byte_stream_copy_to_uint32_big_endian(
+			 &( input_data[ data_offset + 60 ] ),
+			 next_vector_right );
+
+			byte_stream_copy_to_uint32_big_endian(
+			 &( input_data[ data_offset + 48 ] ),
+			 value_32bit );
+
+			value_right8 ^= value_32bit;
+
+			byte_stream_copy_to_uint32_big_endian(
+			 &( input_data[ data_offset + 52 ] ),
+			 value_32bit );
+
+			value_left8 ^= value_32bit;
+
+			byte_stream_copy_to_uint32_big_endian(
+			 &( input_data[ data_offset + 40 ] ),
+			 value_32bit );
+
+			value_right7 ^= value_32bit;
+
+			byte_stream_copy_to_uint32_big_endian(
+			 &( input_data[ data_offset + 44 ] ),
+			 value_32bit );
+
+			value_left7 ^= value_32bit;
+
+			byte_stream_copy_to_uint32_big_endian(
+			 &( input_data[ data_offset + 32 ] ),
+			 value_32bit );
+
+			value_right6 ^= value_32bit;
+
+			byte_stream_copy_to_uint32_big_endian(
+			 &( input_data[ data_offset + 36 ] ),
+			 value_32bit );
+
+			value_left6 ^= value_32bit;
+
+			byte_stream_copy_to_uint32_big_endian(
+			 &( input_data[ data_offset + 24 ] ),
+			 value_32bit );
+
+			value_right5 ^= value_32bit;
+
+			byte_stream_copy_to_uint32_big_endian(
+			 &( input_data[ data_offset + 28 ] ),
+			 value_32bit );
+
+			value_left5 ^= value_32bit;
+
+			byte_stream_copy_to_uint32_big_endian(
+			 &( input_data[ data_offset + 16 ] ),
+			 value_32bit );
+
+			value_right4 ^= value_32bit;
+
+			byte_stream_copy_to_uint32_big_endian(
+			 &( input_data[ data_offset + 20 ] ),
+			 value_32bit );
+
+			value_left4 ^= value_32bit;
+
+			byte_stream_copy_to_uint32_big_endian(
+			 &( input_data[ data_offset + 8 ] ),
+			 value_32bit );
+
+			value_right3 ^= value_32bit;
+
+			byte_stream_copy_to_uint32_big_endian(
+			 &( input_data[ data_offset + 12 ] ),
+			 value_32bit );
+
+			value_left3 ^= value_32bit;
+
+			byte_stream_copy_to_uint32_big_endian(
+			 &( input_data[ data_offset ] ),
+			 value_32bit );
+
+			value_right2 ^= value_32bit;
+
+			byte_stream_copy_to_uint32_big_endian(
+			 &( input_data[ data_offset + 4 ] ),
+			 value_32bit );
+
+			value_left2 ^= value_32bit;
+
+			value_right1 ^= vector_left;
+			value_left1  ^= vector_right;
+
+			vector_left  = next_vector_left;
+			vector_right = next_vector_right;
+		}
+		byte_stream_copy_from_uint32_big_endian(
+		 &( output_data[ data_offset + 56 ] ),
+		 value_right8 );
+
+		byte_stream_copy_from_uint32_big_endian(
+		 &( output_data[ data_offset + 60 ] ),
+		 value_left8 );
+
+		byte_stream_copy_from_uint32_big_endian(
+		 &( output_data[ data_offset + 48 ] ),
+		 value_right7 );
+
+		byte_stream_copy_from_uint32_big_endian(
+		 &( output_data[ data_offset + 52 ] ),
+		 value_left7 );
+
+		byte_stream_copy_from_uint32_big_endian(
+		 &( output_data[ data_offset + 40 ] ),
+		 value_right6 );
+
+		byte_stream_copy_from_uint32_big_endian(
+		 &( output_data[ data_offset + 44 ] ),
+		 value_left6 );
+
+		byte_stream_copy_from_uint32_big_endian(
+		 &( output_data[ data_offset + 32 ] ),
+		 value_right5 );
+
+		byte_stream_copy_from_uint32_big_endian(
+		 &( output_data[ data_offset + 36 ] ),
+		 value_left5 );
+
+		byte_stream_copy_from_uint32_big_endian(
+		 &( output_data[ data_offset + 24 ] ),
+		 value_right4 );
+
+		byte_stream_copy_from_uint32_big_endian(
+		 &( output_data[ data_offset + 28 ] ),
+		 value_left4 );
+
+		byte_stream_copy_from_uint32_big_endian(
+		 &( output_data[ data_offset + 16 ] ),
+		 value_right3 );
+
+		byte_stream_copy_from_uint32_big_endian(
+		 &( output_data[ data_offset + 20 ] ),
+		 value_left3 );
+
+		byte_stream_copy_from_uint32_big_endian(
+		 &( output_data[ data_offset + 8 ] ),
+		 value_right2 );
+
+		byte_stream_copy_from_uint32_big_endian(
+		 &( output_data[ data_offset + 12 ] ),
+		 value_left2 );
+
+		byte_stream_copy_from_uint32_big_endian(
+		 &( output_data[ data_offset ] ),
+		 value_right1 );
+
+		byte_stream_copy_from_uint32_big_endian(
+		 &( output_data[ data_offset + 4 ] ),
+		 value_left1 );
+
+		data_offset += 64;
+	}
+
+	while( ( input_data_size - data_offset ) >= 32 )
+	{
+		byte_stream_copy_to_uint32_big_endian(
+		 &( input_data[ data_offset ] ),
+		 value_left1 );
+
+		byte_stream_copy_to_uint32_big_endian(
+		 &( input_data[ data_offset + 4 ] ),
+		 value_right1 );
+
+		byte_stream_copy_to_uint32_big_endian(
+		 &( input_data[ data_offset + 8 ] ),
+		 value_left2 );
+
+		byte_stream_copy_to_uint32_big_endian(
+		 &( input_data[ data_offset + 12 ] ),
+		 value_right2 );
+
+		byte_stream_copy_to_uint32_big_endian(
+		 &( input_data[ data_offset + 16 ] ),
+		 value_left3 );
+
+		byte_stream_copy_to_uint32_big_endian(
+		 &( input_data[ data_offset + 20 ] ),
+		 value_right3 );
+
+		byte_stream_copy_to_uint32_big_endian(
+		 &( input_data[ data_offset + 24 ] ),
+		 value_left4 );
+
+		byte_stream_copy_to_uint32_big_endian(
+		 &( input_data[ data_offset + 28 ] ),
+		 value_right4 );
+
+		for( round_index = 0;
+		     round_index < 16;
+		     round_index += 2 )
+		{
+			permutation_value = permutation_values[ round_index ];
+
+			libfcrypto_blowfish_calculate_round( value_left1, value_right1, permutation_value );
+			libfcrypto_blowfish_calculate_round( value_left2, value_right2, permutation_value );
+			libfcrypto_blowfish_calculate_round( value_left3, value_right3, permutation_value );
+			libfcrypto_blowfish_calculate_round( value_left4, value_right4, permutation_value );
+
+			permutation_value = permutation_values[ round_index + 1 ];
+
+			libfcrypto_blowfish_calculate_round( value_right1, value_left1, permutation_value );
+			libfcrypto_blowfish_calculate_round( value_right2, value_left2, permutation_value );
+			libfcrypto_blowfish_calculate_round( value_right3, value_left3, permutation_value );
+			libfcrypto_blowfish_calculate_round( value_right4, value_left4, permutation_value );
+		}
+		value_left1  ^= permutation_values[ 16 ];
+		value_right1 ^= permutation_values[ 17 ];
+		value_left2  ^= permutation_values[ 16 ];
+		value_right2 ^= permutation_values[ 17 ];
+		value_left3  ^= permutation_values[ 16 ];
+		value_right3 ^= permutation_values[ 17 ];
+		value_left4  ^= permutation_values[ 16 ];
+		value_right4 ^= permutation_values[ 17 ];
+
+		if( initialization_vector != NULL )
+		{
+			byte_stream_copy_to_uint32_big_endian(
+			 &( input_data[ data_offset + 24 ] ),
+			 next_vector_left );
+
+			byte_stream_copy_to_uint32_big_endian(
+			 &( input_data[ data_offset + 28 ] ),
+			 next_vector_right );
+
+			byte_stream_copy_to_uint32_big_endian(
+			 &( input_data[ data_offset + 16 ] ),
+			 value_32bit );
+
+			value_right4 ^= value_32bit;
+
+			byte_stream_copy_to_uint32_big_endian(
+			 &( input_data[ data_offset + 20 ] ),
+			 value_32bit );
+
+			value_left4 ^= value_32bit;
+
+			byte_stream_copy_to_uint32_big_endian(
+			 &( input_data[ data_offset + 8 ] ),
+			 value_32bit );
+
+			value_right3 ^= value_32bit;
+
+			byte_stream_copy_to_uint32_big_endian(
+			 &( input_data[ data_offset + 12 ] ),
+			 value_32bit );
+
+			value_left3 ^= value_32bit;
+
+			byte_stream_copy_to_uint32_big_endian(
+			 &( input_data[ data_offset ] ),
+			 value_32bit );
+
+			value_right2 ^= value_32bit;
+
+			byte_stream_copy_to_uint32_big_endian(
+			 &( input_data[ data_offset + 4 ] ),
+			 value_32bit );
+
+			value_left2 ^= value_32bit;
+
+			value_right1 ^= vector_left;
+			value_left1  ^= vector_right;
+
+			vector_left  = next_vector_left;
+			vector_right = next_vector_right;
+		}
+		byte_stream_copy_from_uint32_big_endian(
+		 &( output_data[ data_offset + 24 ] ),
+		 value_right4 );
+
+		byte_stream_copy_from_uint32_big_endian(
+		 &( output_data[ data_offset + 28 ] ),
+		 value_left4 );
+
+		byte_stream_copy_from_uint32_big_endian(
+		 &( output_data[ data_offset + 16 ] ),
+		 value_right3 );
+
+		byte_stream_copy_from_uint32_big_endian(
+		 &( output_data[ data_offset + 20 ] ),
+		 value_left3 );
+
+		byte_stream_copy_from_uint32_big_endian(
+		 &( output_data[ data_offset + 8 ] ),
+		 value_right2 );
+
+		byte_stream_copy_from_uint32_big_endian(
+		 &( output_data[ data_offset + 12 ] ),
+		 value_left2 );
+
+		byte_stream_copy_from_uint32_big_endian(
+		 &( output_data[ data_offset ] ),
+		 value_right1 );
+
+		byte_stream_copy_from_uint32_big_endian(
+		 &( output_data[ data_offset + 4 ] ),
+		 value_left1 );
+
+		data_offset += 32;
+	}
+
+
+	if( initialization_vector != NULL )
+	{
+		byte_stream_copy_from_uint32_big_endian(
+		 &( initialization_vector[ 0 ] ),
+		 vector_left );
+
+		byte_stream_copy_from_uint32_big_endian(
+		 &( initialization_vector[ 4 ] ),
+		 vector_right );
+	}
+	memory_set(
+	 permutation_values,
+	 0,
+	 sizeof( uint32_t ) * 18 );
+
+	return( 1 );
+}
+
+#if defined( LIBFCRYPTO_BLOWFISH_CONTEXT_HAVE_AVX2 )
+
+/* Calculates a Blowfish round on 8 blocks using AVX2 gathers for the S-box lookups
+ */
+#define libfcrypto_blowfish_calculate_round_avx2( value_left, value_right, permutation_value, value_32bit ) \
+	value_left  = _mm256_xor_si256( value_left, permutation_value ); \
+	value_32bit = _mm256_add_epi32( \
+	               _mm256_i32gather_epi32( (const int *) internal_context->sboxes[ 0 ], _mm256_srli_epi32( value_left, 24 ), 4 ), \
+	               _mm256_i32gather_epi32( (const int *) internal_context->sboxes[ 1 ], _mm256_and_si256( _mm256_srli_epi32( value_left, 16 ), byte_mask ), 4 ) ); \
+	value_32bit = _mm256_xor_si256( \
+	               value_32bit, \
+	               _mm256_i32gather_epi32( (const int *) internal_context->sboxes[ 2 ], _mm256_and_si256( _mm256_srli_epi32( value_left, 8 ), byte_mask ), 4 ) ); \
+	value_32bit = _mm256_add_epi32( \
+	               value_32bit, \
+	               _mm256_i32gather_epi32( (const int *) internal_context->sboxes[ 3 ], _mm256_and_si256( value_left, byte_mask ), 4 ) ); \
+	value_right = _mm256_xor_si256( value_right, value_32bit );
+
+/* Converts 8 big-endian blocks in 2 input vectors into a vector of left and a vector of right values
+ */
+#define libfcrypto_blowfish_avx2_unpack_values( input_vector1, input_vector2, value_left, value_right, vector1, vector2 ) \
+	vector1     = _mm256_permutevar8x32_epi32( _mm256_shuffle_epi8( input_vector1, byte_swap_mask ), deinterleave_mask ); \
+	vector2     = _mm256_permutevar8x32_epi32( _mm256_shuffle_epi8( input_vector2, byte_swap_mask ), deinterleave_mask ); \
+	value_left  = _mm256_permute2x128_si256( vector1, vector2, 0x20 ); \
+	value_right = _mm256_permute2x128_si256( vector1, vector2, 0x31 );
+
+/* Converts a vector of left and a vector of right values back into 8 big-endian blocks in 2 output vectors,
+ * where the right value is stored first
+ */
+#define libfcrypto_blowfish_avx2_pack_values( value_left, value_right, vector1, vector2 ) \
+	vector1 = _mm256_shuffle_epi8( _mm256_permutevar8x32_epi32( _mm256_permute2x128_si256( value_right, value_left, 0x20 ), interleave_mask ), byte_swap_mask ); \
+	vector2 = _mm256_shuffle_epi8( _mm256_permutevar8x32_epi32( _mm256_permute2x128_si256( value_right, value_left, 0x31 ), interleave_mask ), byte_swap_mask );
+
+/* XORs 8 decrypted blocks with their preceding encrypted block for CBC, where the preceding
+ * encrypted blocks are taken from the input vectors so that the input and output data can overlap
+ */
+#define libfcrypto_blowfish_avx2_xor_preceding_blocks( input_vector1, input_vector2, vector1, vector2, vector ) \
+	vector1 = _mm256_xor_si256( vector1, _mm256_blend_epi32( _mm256_permute4x64_epi64( input_vector1, 0x90 ), vector, 0x03 ) ); \
+	vector2 = _mm256_xor_si256( vector2, _mm256_blend_epi32( _mm256_permute4x64_epi64( input_vector2, 0x90 ), _mm256_permute4x64_epi64( input_vector1, 0xff ), 0x03 ) ); \
+	vector  = _mm256_permute4x64_epi64( input_vector2, 0xff );
+
+/* De- or encrypts multiple blocks of data using Blowfish and AVX2
+ * Every 32-bit lane of a vector contains the left or right value of a block, so that the S-box lookups
+ * of 8 blocks are done by a single gather. 2 vectors of blocks are processed at a time, to overlap
+ * the latency of the gathers
+ * If an initialization vector is provided the blocks are decrypted using CBC and
+ * the initialization vector is updated to the last encrypted input block
+ * The size must be a multitude of 8 times the Blowfish block size (64 bytes)
+ * Returns 1 if successful or -1 on error
+ */
+__attribute__ (( target( "avx2" ) )) \
+int libfcrypto_internal_blowfish_context_crypt_blocks_avx2(
+     libfcrypto_internal_blowfish_context_t *internal_context,
+     int mode,
+     uint8_t *initialization_vector,
+     const uint8_t *input_data,
+     size_t input_data_size,
+     uint8_t *output_data,
+     size_t output_data_size,
+     libcerror_error_t **error )
+{
+	uint32_t permutation_values[ 18 ];
+
+	static char *function     = "libfcrypto_internal_blowfish_context_crypt_blocks_avx2";
+	__m256i byte_mask         = _mm256_set1_epi32( 0x000000ff );
+	__m256i byte_swap_mask    = _mm256_set_epi8( 12, 13, 14, 15, 8, 9, 10, 11, 4, 5, 6, 7, 0, 1, 2, 3, 12, 13, 14, 15, 8, 9, 10, 11, 4, 5, 6, 7, 0, 1, 2, 3 );
+	__m256i deinterleave_mask = _mm256_set_epi32( 7, 5, 3, 1, 6, 4, 2, 0 );
+	__m256i interleave_mask   = _mm256_set_epi32( 7, 3, 6, 2, 5, 1, 4, 0 );
+	__m256i permutation_value = _mm256_setzero_si256();
+	__m256i input_vector1     = _mm256_setzero_si256();
+	__m256i input_vector2     = _mm256_setzero_si256();
+	__m256i input_vector3     = _mm256_setzero_si256();
+	__m256i input_vector4     = _mm256_setzero_si256();
+	__m256i value_32bit       = _mm256_setzero_si256();
+	__m256i value_left1       = _mm256_setzero_si256();
+	__m256i value_left2       = _mm256_setzero_si256();
+	__m256i value_right1      = _mm256_setzero_si256();
+	__m256i value_right2      = _mm256_setzero_si256();
+	__m256i vector            = _mm256_setzero_si256();
+	__m256i vector1           = _mm256_setzero_si256();
+	__m256i vector2           = _mm256_setzero_si256();
+	__m256i vector3           = _mm256_setzero_si256();
+	__m256i vector4           = _mm256_setzero_si256();
+	size_t data_offset        = 0;
+	uint8_t round_index       = 0;
+
+	if( internal_context == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid context.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( mode != LIBFCRYPTO_BLOWFISH_CRYPT_MODE_ENCRYPT )
+	 && ( mode != LIBFCRYPTO_BLOWFISH_CRYPT_MODE_DECRYPT ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported mode.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( initialization_vector != NULL )
+	 && ( mode != LIBFCRYPTO_BLOWFISH_CRYPT_MODE_DECRYPT ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported mode, initialization vector is only supported for decryption.",
+		 function );
+
+		return( -1 );
+	}
+	if( input_data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid input data.",
+		 function );
+
+		return( -1 );
+	}
+	/* Check if the input data size is a multitude of 64-byte
+	 */
+	if( ( ( input_data_size & (size_t) 0x3f ) != 0 )
+	 || ( input_data_size < 64 )
+	 || ( input_data_size > (size_t) SSIZE_MAX ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid input data size value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( output_data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid output data.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( output_data_size < input_data_size )
+	 || ( output_data_size > (size_t) SSIZE_MAX ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid output data size value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	/* Decryption uses the permutation values in reverse order
+	 */
+	for( round_index = 0;
+	     round_index < 18;
+	     round_index++ )
+	{
+		if( mode == LIBFCRYPTO_BLOWFISH_CRYPT_MODE_ENCRYPT )
+		{
+			permutation_values[ round_index ] = internal_context->permutation_values[ round_index ];
+		}
+		else
+		{
+			permutation_values[ round_index ] = internal_context->permutation_values[ 17 - round_index ];
+		}
+	}
+	if( initialization_vector != NULL )
+	{
+		vector = _mm256_castsi128_si256(
+		          _mm_loadl_epi64(
+		           (const __m128i *) initialization_vector ) );
+	}
+	while( ( input_data_size - data_offset ) >= 128 )
+	{
+		input_vector1 = _mm256_loadu_si256(
+		                 (const __m256i *) &( input_data[ data_offset ] ) );
+
+		input_vector2 = _mm256_loadu_si256(
+		                 (const __m256i *) &( input_data[ data_offset + 32 ] ) );
+
+		input_vector3 = _mm256_loadu_si256(
+		                 (const __m256i *) &( input_data[ data_offset + 64 ] ) );
+
+		input_vector4 = _mm256_loadu_si256(
+		                 (const __m256i *) &( input_data[ data_offset + 96 ] ) );
+
+		libfcrypto_blowfish_avx2_unpack_values( input_vector1, input_vector2, value_left1, value_right1, vector1, vector2 );
+		libfcrypto_blowfish_avx2_unpack_values( input_vector3, input_vector4, value_left2, value_right2, vector3, vector4 );
+
+		/* The rounds are calculated 2 at a time to remove the swap of the left and right values
+		 */
+		for( round_index = 0;
+		     round_index < 16;
+		     round_index += 2 )
+		{
+			permutation_value = _mm256_set1_epi32( (int) permutation_values[ round_index ] );
+
+			libfcrypto_blowfish_calculate_round_avx2( value_left1, value_right1, permutation_value, value_32bit );
+			libfcrypto_blowfish_calculate_round_avx2( value_left2, value_right2, permutation_value, value_32bit );
+
+			permutation_value = _mm256_set1_epi32( (int) permutation_values[ round_index + 1 ] );
+
+			libfcrypto_blowfish_calculate_round_avx2( value_right1, value_left1, permutation_value, value_32bit );
+			libfcrypto_blowfish_calculate_round_avx2( value_right2, value_left2, permutation_value, value_32bit );
+		}
+		permutation_value = _mm256_set1_epi32( (int) permutation_values[ 16 ] );
+
+		value_left1 = _mm256_xor_si256( value_left1, permutation_value );
+		value_left2 = _mm256_xor_si256( value_left2, permutation_value );
+
+		permutation_value = _mm256_set1_epi32( (int) permutation_values[ 17 ] );
+
+		value_right1 = _mm256_xor_si256( value_right1, permutation_value );
+		value_right2 = _mm256_xor_si256( value_right2, permutation_value );
+
+		libfcrypto_blowfish_avx2_pack_values( value_left1, value_right1, vector1, vector2 );
+		libfcrypto_blowfish_avx2_pack_values( value_left2, value_right2, vector3, vector4 );
+
+		if( initialization_vector != NULL )
+		{
+			libfcrypto_blowfish_avx2_xor_preceding_blocks( input_vector1, input_vector2, vector1, vector2, vector );
+			libfcrypto_blowfish_avx2_xor_preceding_blocks( input_vector3, input_vector4, vector3, vector4, vector );
+		}
+		_mm256_storeu_si256(
+		 (__m256i *) &( output_data[ data_offset ] ),
+		 vector1 );
+
+		_mm256_storeu_si256(
+		 (__m256i *) &( output_data[ data_offset + 32 ] ),
+		 vector2 );
+
+		_mm256_storeu_si256(
+		 (__m256i *) &( output_data[ data_offset + 64 ] ),
+		 vector3 );
+
+		_mm256_storeu_si256(
+		 (__m256i *) &( output_data[ data_offset + 96 ] ),
+		 vector4 );
+
+		data_offset += 128;
+	}
+	if( data_offset < input_data_size )
+	{
+		input_vector1 = _mm256_loadu_si256(
+		                 (const __m256i *) &( input_data[ data_offset ] ) );
+
+		input_vector2 = _mm256_loadu_si256(
+		                 (const __m256i *) &( input_data[ data_offset + 32 ] ) );
+
+		libfcrypto_blowfish_avx2_unpack_values( input_vector1, input_vector2, value_left1, value_right1, vector1, vector2 );
+
+		for( round_index = 0;
+		     round_index < 16;
+		     round_index += 2 )
+		{
+			permutation_value = _mm256_set1_epi32( (int) permutation_values[ round_index ] );
+
+			libfcrypto_blowfish_calculate_round_avx2( value_left1, value_right1, permutation_value, value_32bit );
+
+			permutation_value = _mm256_set1_epi32( (int) permutation_values[ round_index + 1 ] );
+
+			libfcrypto_blowfish_calculate_round_avx2( value_right1, value_left1, permutation_value, value_32bit );
+		}
+		value_left1  = _mm256_xor_si256( value_left1, _mm256_set1_epi32( (int) permutation_values[ 16 ] ) );
+		value_right1 = _mm256_xor_si256( value_right1, _mm256_set1_epi32( (int) permutation_values[ 17 ] ) );
+
+		libfcrypto_blowfish_avx2_pack_values( value_left1, value_right1, vector1, vector2 );
+
+		if( initialization_vector != NULL )
+		{
+			libfcrypto_blowfish_avx2_xor_preceding_blocks( input_vector1, input_vector2, vector1, vector2, vector );
+		}
+		_mm256_storeu_si256(
+		 (__m256i *) &( output_data[ data_offset ] ),
+		 vector1 );
+
+		_mm256_storeu_si256(
+		 (__m256i *) &( output_data[ data_offset + 32 ] ),
+		 vector2 );
+	}
+	if( initialization_vector != NULL )
+	{
+		_mm_storel_epi64(
+		 (__m128i *) initialization_vector,
+		 _mm256_castsi256_si128( vector ) );
+	}
+	memory_set(
+	 permutation_values,
+	 0,
+	 sizeof( uint32_t ) * 18 );
+
+	return( 1 );
+}
+
+#endif /* defined( LIBFCRYPTO_BLOWFISH_CONTEXT_HAVE_AVX2 ) */
+
 /* De- or encrypts a block of data using Blowfish-CBC (Cipher Block Chaining)
  * The size must be a multitude of the Blowfish block size (8 byte)
+ * The input and output data can be the same buffer
  * Returns 1 if successful or -1 on error
  */
 int libfcrypto_blowfish_crypt_cbc(
@@ -1053,6 +2018,33 @@ int libfcrypto_blowfish_crypt_cbc(
 
 		goto on_error;
 	}
+	/* In CBC decryption the blocks are independent of each other and can be decrypted interleaved
+	 */
+	if( ( mode == LIBFCRYPTO_BLOWFISH_CRYPT_MODE_DECRYPT )
+	 && ( input_data_size >= 32 ) )
+	{
+		data_offset = input_data_size & ~( (size_t) 0x1f );
+
+		if( libfcrypto_internal_blowfish_context_crypt_blocks(
+		     (libfcrypto_internal_blowfish_context_t *) context,
+		     mode,
+		     internal_initialization_vector,
+		     input_data,
+		     data_offset,
+		     output_data,
+		     data_offset,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_ENCRYPTION,
+			 LIBCERROR_ENCRYPTION_ERROR_GENERIC,
+			 "%s: unable to decrypt input data.",
+			 function );
+
+			goto on_error;
+		}
+	}
 	while( data_offset < input_data_size )
 	{
 		if( mode == LIBFCRYPTO_BLOWFISH_CRYPT_MODE_ENCRYPT )
@@ -1110,6 +2102,23 @@ int libfcrypto_blowfish_crypt_cbc(
 		}
 		else
 		{
+			/* The encrypted input block is the initialization vector of the next block
+			 * and is stored before the output data can overwrite it
+			 */
+			if( memory_copy(
+			     block_data,
+			     &( input_data[ data_offset ] ),
+			     8 ) == NULL )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_MEMORY,
+				 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+				 "%s: unable to copy encrypted input data to block data.",
+				 function );
+
+				goto on_error;
+			}
 			if( libfcrypto_internal_blowfish_context_decrypt_block(
 			     (libfcrypto_internal_blowfish_context_t *) context,
 			     &( input_data[ data_offset ] ),
@@ -1148,14 +2157,14 @@ int libfcrypto_blowfish_crypt_cbc(
 
 			if( memory_copy(
 			     internal_initialization_vector,
-			     &( input_data[ data_offset ] ),
+			     block_data,
 			     8 ) == NULL )
 			{
 				libcerror_error_set(
 				 error,
 				 LIBCERROR_ERROR_DOMAIN_MEMORY,
 				 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
-				 "%s: unable to copy encrypted input data to initialization vector.",
+				 "%s: unable to copy block data to initialization vector.",
 				 function );
 
 				goto on_error;
@@ -1207,6 +2216,100 @@ on_error:
 	return( -1 );
 }
 
+/* Encrypts counter blocks using Blowfish-ECB
+ * Callback function for libfcrypto_ctr_crypt
+ * Returns 1 if successful or -1 on error
+ */
+int libfcrypto_internal_blowfish_context_encrypt_counter_blocks(
+     intptr_t *context,
+     const uint8_t *input_data,
+     size_t input_data_size,
+     uint8_t *output_data,
+     size_t output_data_size,
+     libcerror_error_t **error )
+{
+	return( libfcrypto_blowfish_crypt_ecb(
+	         (libfcrypto_blowfish_context_t *) context,
+	         LIBFCRYPTO_BLOWFISH_CRYPT_MODE_ENCRYPT,
+	         input_data,
+	         input_data_size,
+	         output_data,
+	         output_data_size,
+	         error ) );
+}
+
+/* De- or encrypts a block of data using Blowfish-CTR (Counter)
+ * The key stream is the encryption of consecutive counter blocks, that start with the initial counter block
+ * The counter is stored in the last counter size bytes of the counter block if big-endian
+ * and in the first counter size bytes if little-endian, and wraps around
+ * The offset is the byte offset of the input data relative to the start of the key stream,
+ * which allows to de- or encrypt data at any offset without processing the preceding data
+ * Since de- and encryption are the same operation no mode is required
+ * Returns 1 if successful or -1 on error
+ */
+int libfcrypto_blowfish_crypt_ctr(
+     libfcrypto_blowfish_context_t *context,
+     const uint8_t *initial_counter_block,
+     size_t initial_counter_block_size,
+     size_t counter_size,
+     int counter_byte_order,
+     uint64_t offset,
+     const uint8_t *input_data,
+     size_t input_data_size,
+     uint8_t *output_data,
+     size_t output_data_size,
+     libcerror_error_t **error )
+{
+	static char *function = "libfcrypto_blowfish_crypt_ctr";
+
+	if( context == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid context.",
+		 function );
+
+		return( -1 );
+	}
+	if( initial_counter_block_size != 8 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid initial counter block size value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( libfcrypto_ctr_crypt(
+	     (intptr_t *) context,
+	     &libfcrypto_internal_blowfish_context_encrypt_counter_blocks,
+	     8,
+	     initial_counter_block,
+	     counter_size,
+	     counter_byte_order,
+	     offset,
+	     input_data,
+	     input_data_size,
+	     output_data,
+	     output_data_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ENCRYPTION,
+		 LIBCERROR_ENCRYPTION_ERROR_GENERIC,
+		 "%s: unable to de/encrypt data.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
 /* De- or encrypts a block of data using Blowfish-ECB (Electronic CodeBook)
  * The size must be a multitude of the Blowfish block size (8 byte)
  * Returns 1 if successful or -1 on error
@@ -1295,6 +2398,30 @@ int libfcrypto_blowfish_crypt_ecb(
 
 		return( -1 );
 	}
+	if( input_data_size >= 32 )
+	{
+		data_offset = input_data_size & ~( (size_t) 0x1f );
+
+		if( libfcrypto_internal_blowfish_context_crypt_blocks(
+		     (libfcrypto_internal_blowfish_context_t *) context,
+		     mode,
+		     NULL,
+		     input_data,
+		     data_offset,
+		     output_data,
+		     data_offset,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_ENCRYPTION,
+			 LIBCERROR_ENCRYPTION_ERROR_GENERIC,
+			 "%s: unable to de- or encrypt input data.",
+			 function );
+
+			return( -1 );
+		}
+	}
 	while( data_offset < input_data_size )
 	{
 		if( mode == LIBFCRYPTO_BLOWFISH_CRYPT_MODE_ENCRYPT )
@@ -33,6 +33,10 @@
 extern "C" {
 #endif
 
+#if ( defined( __clang__ ) || ( defined( __GNUC__ ) && ( __GNUC__ >= 5 ) ) ) && ( defined( __i386__ ) || defined( __x86_64__ ) )
+#define LIBFCRYPTO_BLOWFISH_CONTEXT_HAVE_AVX2	1
+#endif
+
 typedef struct libfcrypto_internal_blowfish_context libfcrypto_internal_blowfish_context_t;
 
 struct libfcrypto_internal_blowfish_context
@@ -44,6 +48,22 @@ struct libfcrypto_internal_blowfish_context
 	/* The 4 substitution-boxes (S-boxes)
 	 */
 	uint32_t sboxes[ 4 ][ 256 ];
+
+	/* The vector multi-block function selected by CPU level or NULL if not available
+	 */
+	int (*crypt_blocks_function)(
+	       libfcrypto_internal_blowfish_context_t *internal_context,
+	       int mode,
+	       uint8_t *initialization_vector,
+	       const uint8_t *input_data,
+	       size_t input_data_size,
+	       uint8_t *output_data,
+	       size_t output_data_size,
+	       libcerror_error_t **error );
+
+	/* The number of bytes processed at once by the vector multi-block function
+	 */
+	size_t crypt_blocks_size;
 };
 
 LIBFCRYPTO_EXTERN \
@@ -85,6 +105,30 @@ int libfcrypto_internal_blowfish_context_decrypt_block(
      size_t output_data_size,
      libcerror_error_t **error );
 
+int libfcrypto_internal_blowfish_context_crypt_blocks(
+     libfcrypto_internal_blowfish_context_t *internal_context,
+     int mode,
+     uint8_t *initialization_vector,
+     const uint8_t *input_data,
+     size_t input_data_size,
+     uint8_t *output_data,
+     size_t output_data_size,
+     libcerror_error_t **error );
+
+#if defined( LIBFCRYPTO_BLOWFISH_CONTEXT_HAVE_AVX2 )
+
+int libfcrypto_internal_blowfish_context_crypt_blocks_avx2(
+     libfcrypto_internal_blowfish_context_t *internal_context,
+     int mode,
+     uint8_t *initialization_vector,
+     const uint8_t *input_data,
+     size_t input_data_size,
+     uint8_t *output_data,
+     size_t output_data_size,
+     libcerror_error_t **error );
+
+#endif /* defined( LIBFCRYPTO_BLOWFISH_CONTEXT_HAVE_AVX2 ) */
+
 LIBFCRYPTO_EXTERN \
 int libfcrypto_blowfish_crypt_cbc(
      libfcrypto_blowfish_context_t *context,
@@ -97,6 +141,28 @@ int libfcrypto_blowfish_crypt_cbc(
      size_t output_data_size,
      libcerror_error_t **error );
 
+int libfcrypto_internal_blowfish_context_encrypt_counter_blocks(
+     intptr_t *context,
+     const uint8_t *input_data,
+     size_t input_data_size,
+     uint8_t *output_data,
+     size_t output_data_size,
+     libcerror_error_t **error );
+
+LIBFCRYPTO_EXTERN \
+int libfcrypto_blowfish_crypt_ctr(
+     libfcrypto_blowfish_context_t *context,
+     const uint8_t *initial_counter_block,
+     size_t initial_counter_block_size,
+     size_t counter_size,
+     int counter_byte_order,
+     uint64_t offset,
+     const uint8_t *input_data,
+     size_t input_data_size,
+     uint8_t *output_data,
+     size_t output_data_size,
+     libcerror_error_t **error );
+
 LIBFCRYPTO_EXTERN \
 int libfcrypto_blowfish_crypt_ecb(
      libfcrypto_blowfish_context_t *context,
@@ -0,0 +1,850 @@
+/*
+ * CBC stream functions
+ *
+ * Copyright (C) 2017-2024, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <memory.h>
+#include <types.h>
+
+#include "libfcrypto_cbc_stream.h"
+#include "libfcrypto_cipher.h"
+#include "libfcrypto_definitions.h"
+#include "libfcrypto_libcerror.h"
+#include "libfcrypto_types.h"
+
+/* Creates a CBC stream
+ * Make sure the value stream is referencing, is set to NULL
+ * The cipher must use the CBC mode and is referenced by the stream,
+ * hence it must remain available while the stream is used
+ * Returns 1 if successful or -1 on error
+ */
+int libfcrypto_cbc_stream_initialize(
+     libfcrypto_cbc_stream_t **stream,
+     libfcrypto_cipher_t *cipher,
+     int mode,
+     const uint8_t *initialization_vector,
+     size_t initialization_vector_size,
+     libcerror_error_t **error )
+{
+	libfcrypto_internal_cbc_stream_t *internal_stream = NULL;
+	libfcrypto_internal_cipher_t *internal_cipher     = NULL;
+	static char *function                             = "libfcrypto_cbc_stream_initialize";
+
+	if( stream == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid stream.",
+		 function );
+
+		return( -1 );
+	}
+	if( *stream != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid stream value already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( cipher == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid cipher.",
+		 function );
+
+		return( -1 );
+	}
+	internal_cipher = (libfcrypto_internal_cipher_t *) cipher;
+
+	if( ( internal_cipher->mode != LIBFCRYPTO_CIPHER_MODE_CBC )
+	 || ( internal_cipher->block_size > 16 ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported cipher mode.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( mode != LIBFCRYPTO_CRYPT_MODE_DECRYPT )
+	 && ( mode != LIBFCRYPTO_CRYPT_MODE_ENCRYPT ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported mode.",
+		 function );
+
+		return( -1 );
+	}
+	internal_stream = memory_allocate_structure(
+	                   libfcrypto_internal_cbc_stream_t );
+
+	if( internal_stream == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create stream.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     internal_stream,
+	     0,
+	     sizeof( libfcrypto_internal_cbc_stream_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear stream.",
+		 function );
+
+		memory_free(
+		 internal_stream );
+
+		return( -1 );
+	}
+	internal_stream->cipher     = internal_cipher;
+	internal_stream->mode       = mode;
+	internal_stream->block_size = internal_cipher->block_size;
+
+	if( libfcrypto_cbc_stream_set_initialization_vector(
+	     (libfcrypto_cbc_stream_t *) internal_stream,
+	     initialization_vector,
+	     initialization_vector_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to set initialization vector.",
+		 function );
+
+		goto on_error;
+	}
+	*stream = (libfcrypto_cbc_stream_t *) internal_stream;
+
+	return( 1 );
+
+on_error:
+	if( internal_stream != NULL )
+	{
+		memory_free(
+		 internal_stream );
+	}
+	return( -1 );
+}
+
+/* Frees a CBC stream
+ * The cipher referenced by the stream is not freed
+ * Returns 1 if successful or -1 on error
+ */
+int libfcrypto_cbc_stream_free(
+     libfcrypto_cbc_stream_t **stream,
+     libcerror_error_t **error )
+{
+	libfcrypto_internal_cbc_stream_t *internal_stream = NULL;
+	static char *function                             = "libfcrypto_cbc_stream_free";
+	int result                                        = 1;
+
+	if( stream == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid stream.",
+		 function );
+
+		return( -1 );
+	}
+	if( *stream != NULL )
+	{
+		internal_stream = (libfcrypto_internal_cbc_stream_t *) *stream;
+		*stream         = NULL;
+
+		if( memory_set(
+		     internal_stream,
+		     0,
+		     sizeof( libfcrypto_internal_cbc_stream_t ) ) == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+			 "%s: unable to clear stream.",
+			 function );
+
+			result = -1;
+		}
+		memory_free(
+		 internal_stream );
+	}
+	return( result );
+}
+
+/* Sets the initialization vector
+ * This discards the partial block data, if any, so the stream can be reused for a new message
+ * Returns 1 if successful or -1 on error
+ */
+int libfcrypto_cbc_stream_set_initialization_vector(
+     libfcrypto_cbc_stream_t *stream,
+     const uint8_t *initialization_vector,
+     size_t initialization_vector_size,
+     libcerror_error_t **error )
+{
+	libfcrypto_internal_cbc_stream_t *internal_stream = NULL;
+	static char *function                             = "libfcrypto_cbc_stream_set_initialization_vector";
+
+	if( stream == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid stream.",
+		 function );
+
+		return( -1 );
+	}
+	internal_stream = (libfcrypto_internal_cbc_stream_t *) stream;
+
+	if( initialization_vector == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid initialization vector.",
+		 function );
+
+		return( -1 );
+	}
+	if( initialization_vector_size != internal_stream->block_size )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid initialization vector size value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( memory_copy(
+	     internal_stream->chaining_value,
+	     initialization_vector,
+	     initialization_vector_size ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+		 "%s: unable to copy initialization vector.",
+		 function );
+
+		return( -1 );
+	}
+	if( memory_set(
+	     internal_stream->block_data,
+	     0,
+	     16 ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear block data.",
+		 function );
+
+		return( -1 );
+	}
+	internal_stream->block_data_size = 0;
+
+	return( 1 );
+}
+
+/* Retrieves the size of the partial block data that is buffered until the block is complete
+ * Returns 1 if successful or -1 on error
+ */
+int libfcrypto_cbc_stream_get_buffered_data_size(
+     libfcrypto_cbc_stream_t *stream,
+     size_t *buffered_data_size,
+     libcerror_error_t **error )
+{
+	libfcrypto_internal_cbc_stream_t *internal_stream = NULL;
+	static char *function                             = "libfcrypto_cbc_stream_get_buffered_data_size";
+
+	if( stream == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid stream.",
+		 function );
+
+		return( -1 );
+	}
+	internal_stream = (libfcrypto_internal_cbc_stream_t *) stream;
+
+	if( buffered_data_size == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid buffered data size.",
+		 function );
+
+		return( -1 );
+	}
+	*buffered_data_size = internal_stream->block_data_size;
+
+	return( 1 );
+}
+
+/* De- or encrypts complete blocks of data and updates the chaining value
+ * The input and output data can be the same buffer
+ * Returns 1 if successful or -1 on error
+ */
+int libfcrypto_internal_cbc_stream_crypt_blocks(
+     libfcrypto_internal_cbc_stream_t *internal_stream,
+     const uint8_t *input_data,
+     uint8_t *output_data,
+     size_t data_size,
+     libcerror_error_t **error )
+{
+	static char *function = "libfcrypto_internal_cbc_stream_crypt_blocks";
+
+	if( internal_stream == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid stream.",
+		 function );
+
+		return( -1 );
+	}
+	if( libfcrypto_internal_cipher_crypt_chained(
+	     internal_stream->cipher,
+	     internal_stream->mode,
+	     NULL,
+	     internal_stream->chaining_value,
+	     0,
+	     input_data,
+	     output_data,
+	     data_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ENCRYPTION,
+		 LIBCERROR_ENCRYPTION_ERROR_GENERIC,
+		 "%s: unable to crypt data.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* De- or encrypts data
+ * The data is processed in complete blocks, the remaining data of a partial block
+ * is buffered and processed by a successive call
+ * The output data size must be at least the size of the buffered data and the input data,
+ * rounded down to a multiple of the block size
+ * The input and output data can be the same buffer, but must not overlap otherwise
+ * Returns the number of bytes written or -1 on error
+ */
+ssize_t libfcrypto_cbc_stream_update(
+         libfcrypto_cbc_stream_t *stream,
+         const uint8_t *input_data,
+         size_t input_data_size,
+         uint8_t *output_data,
+         size_t output_data_size,
+         libcerror_error_t **error )
+{
+	uint8_t input_buffer[ LIBFCRYPTO_CBC_STREAM_BUFFER_SIZE ];
+	uint8_t output_buffer[ LIBFCRYPTO_CBC_STREAM_BUFFER_SIZE ];
+	uint8_t first_block_data[ 16 ];
+	uint8_t remainder_data[ 16 ];
+
+	libfcrypto_internal_cbc_stream_t *internal_stream = NULL;
+	static char *function                             = "libfcrypto_cbc_stream_update";
+	size_t fill_size                                  = 0;
+	size_t input_data_offset                          = 0;
+	size_t next_segment_size                          = 0;
+	size_t output_data_offset                         = 0;
+	size_t remainder_size                             = 0;
+	size_t remaining_data_size                        = 0;
+	size_t segment_size                               = 0;
+	size_t write_size                                 = 0;
+
+	if( stream == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid stream.",
+		 function );
+
+		return( -1 );
+	}
+	internal_stream = (libfcrypto_internal_cbc_stream_t *) stream;
+
+	if( input_data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid input data.",
+		 function );
+
+		return( -1 );
+	}
+	if( input_data_size > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid input data size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( output_data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid output data.",
+		 function );
+
+		return( -1 );
+	}
+	write_size  = internal_stream->block_data_size + input_data_size;
+	write_size -= write_size % internal_stream->block_size;
+
+	if( ( write_size > (size_t) SSIZE_MAX )
+	 || ( output_data_size < write_size )
+	 || ( output_data_size > (size_t) SSIZE_MAX ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid output data size value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( write_size == 0 )
+	{
+		if( input_data_size > 0 )
+		{
+			if( memory_copy(
+			     &( internal_stream->block_data[ internal_stream->block_data_size ] ),
+			     input_data,
+			     input_data_size ) == NULL )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_MEMORY,
+				 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+				 "%s: unable to copy input data to block data.",
+				 function );
+
+				return( -1 );
+			}
+			internal_stream->block_data_size += input_data_size;
+		}
+		return( 0 );
+	}
+	if( internal_stream->block_data_size > 0 )
+	{
+		fill_size = internal_stream->block_size - internal_stream->block_data_size;
+
+		if( memory_copy(
+		     &( internal_stream->block_data[ internal_stream->block_data_size ] ),
+		     input_data,
+		     fill_size ) == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+			 "%s: unable to copy input data to block data.",
+			 function );
+
+			goto on_error;
+		}
+		output_data_offset = internal_stream->block_size;
+	}
+	input_data_offset   = fill_size;
+	remaining_data_size = write_size - output_data_offset;
+	remainder_size      = input_data_size - ( fill_size + remaining_data_size );
+
+	/* The remainder is retrieved first since it can be overwritten
+	 * by the output data when the input and output data are the same buffer
+	 */
+	if( remainder_size > 0 )
+	{
+		if( memory_copy(
+		     remainder_data,
+		     &( input_data[ input_data_size - remainder_size ] ),
+		     remainder_size ) == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+			 "%s: unable to copy remainder data.",
+			 function );
+
+			goto on_error;
+		}
+	}
+	if( internal_stream->block_data_size > 0 )
+	{
+		if( libfcrypto_internal_cbc_stream_crypt_blocks(
+		     internal_stream,
+		     internal_stream->block_data,
+		     first_block_data,
+		     internal_stream->block_size,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_ENCRYPTION,
+			 LIBCERROR_ENCRYPTION_ERROR_GENERIC,
+			 "%s: unable to crypt block data.",
+			 function );
+
+			goto on_error;
+		}
+	}
+	/* When the input and output data are the same buffer, the output data is ahead of the input data
+	 * by the size of the buffered data, hence each segment of input data is read before the preceding
+	 * output data is written
+	 */
+	if( ( internal_stream->block_data_size > 0 )
+	 && ( input_data == output_data )
+	 && ( remaining_data_size > 0 ) )
+	{
+		segment_size = remaining_data_size;
+
+		if( segment_size > LIBFCRYPTO_CBC_STREAM_BUFFER_SIZE )
+		{
+			segment_size = LIBFCRYPTO_CBC_STREAM_BUFFER_SIZE;
+		}
+		if( memory_copy(
+		     input_buffer,
+		     &( input_data[ input_data_offset ] ),
+		     segment_size ) == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+			 "%s: unable to copy input data to buffer.",
+			 function );
+
+			goto on_error;
+		}
+		if( memory_copy(
+		     output_data,
+		     first_block_data,
+		     internal_stream->block_size ) == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+			 "%s: unable to copy block data to output data.",
+			 function );
+
+			goto on_error;
+		}
+		while( segment_size > 0 )
+		{
+			if( libfcrypto_internal_cbc_stream_crypt_blocks(
+			     internal_stream,
+			     input_buffer,
+			     output_buffer,
+			     segment_size,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_ENCRYPTION,
+				 LIBCERROR_ENCRYPTION_ERROR_GENERIC,
+				 "%s: unable to crypt input data.",
+				 function );
+
+				goto on_error;
+			}
+			input_data_offset   += segment_size;
+			remaining_data_size -= segment_size;
+
+			next_segment_size = remaining_data_size;
+
+			if( next_segment_size > LIBFCRYPTO_CBC_STREAM_BUFFER_SIZE )
+			{
+				next_segment_size = LIBFCRYPTO_CBC_STREAM_BUFFER_SIZE;
+			}
+			if( next_segment_size > 0 )
+			{
+				if( memory_copy(
+				     input_buffer,
+				     &( input_data[ input_data_offset ] ),
+				     next_segment_size ) == NULL )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_MEMORY,
+					 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+					 "%s: unable to copy input data to buffer.",
+					 function );
+
+					goto on_error;
+				}
+			}
+			if( memory_copy(
+			     &( output_data[ output_data_offset ] ),
+			     output_buffer,
+			     segment_size ) == NULL )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_MEMORY,
+				 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+				 "%s: unable to copy buffer to output data.",
+				 function );
+
+				goto on_error;
+			}
+			output_data_offset += segment_size;
+
+			segment_size = next_segment_size;
+		}
+		if( memory_set(
+		     input_buffer,
+		     0,
+		     LIBFCRYPTO_CBC_STREAM_BUFFER_SIZE ) == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+			 "%s: unable to clear input buffer.",
+			 function );
+
+			goto on_error;
+		}
+		if( memory_set(
+		     output_buffer,
+		     0,
+		     LIBFCRYPTO_CBC_STREAM_BUFFER_SIZE ) == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+			 "%s: unable to clear output buffer.",
+			 function );
+
+			goto on_error;
+		}
+	}
+	else
+	{
+		if( internal_stream->block_data_size > 0 )
+		{
+			if( memory_copy(
+			     output_data,
+			     first_block_data,
+			     internal_stream->block_size ) == NULL )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_MEMORY,
+				 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+				 "%s: unable to copy block data to output data.",
+				 function );
+
+				goto on_error;
+			}
+		}
+		if( remaining_data_size > 0 )
+		{
+			if( libfcrypto_internal_cbc_stream_crypt_blocks(
+			     internal_stream,
+			     &( input_data[ input_data_offset ] ),
+			     &( output_data[ output_data_offset ] ),
+			     remaining_data_size,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_ENCRYPTION,
+				 LIBCERROR_ENCRYPTION_ERROR_GENERIC,
+				 "%s: unable to crypt input data.",
+				 function );
+
+				goto on_error;
+			}
+		}
+	}
+	if( remainder_size > 0 )
+	{
+		if( memory_copy(
+		     internal_stream->block_data,
+		     remainder_data,
+		     remainder_size ) == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+			 "%s: unable to copy remainder data to block data.",
+			 function );
+
+			goto on_error;
+		}
+	}
+	internal_stream->block_data_size = remainder_size;
+
+	if( memory_set(
+	     first_block_data,
+	     0,
+	     16 ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear first block data.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     remainder_data,
+	     0,
+	     16 ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear remainder data.",
+		 function );
+
+		goto on_error;
+	}
+	return( (ssize_t) write_size );
+
+on_error:
+	memory_set(
+	 input_buffer,
+	 0,
+	 LIBFCRYPTO_CBC_STREAM_BUFFER_SIZE );
+
+	memory_set(
+	 output_buffer,
+	 0,
+	 LIBFCRYPTO_CBC_STREAM_BUFFER_SIZE );
+
+	memory_set(
+	 first_block_data,
+	 0,
+	 16 );
+
+	memory_set(
+	 remainder_data,
+	 0,
+	 16 );
+
+	return( -1 );
+}
+
+/* Finalizes the stream
+ * CBC does not define padding, hence the stream must not contain a partial block
+ * The chaining value is retained, so the stream can be used to continue the data
+ * Returns 1 if successful or -1 on error
+ */
+int libfcrypto_cbc_stream_finalize(
+     libfcrypto_cbc_stream_t *stream,
+     libcerror_error_t **error )
+{
+	libfcrypto_internal_cbc_stream_t *internal_stream = NULL;
+	static char *function                             = "libfcrypto_cbc_stream_finalize";
+
+	if( stream == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid stream.",
+		 function );
+
+		return( -1 );
+	}
+	internal_stream = (libfcrypto_internal_cbc_stream_t *) stream;
+
+	if( internal_stream->block_data_size != 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid stream - partial block remaining.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
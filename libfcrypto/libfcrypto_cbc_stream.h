@@ -0,0 +1,123 @@
+/*
+ * CBC stream functions
+ *
+ * Copyright (C) 2017-2024, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _LIBFCRYPTO_CBC_STREAM_H )
+#define _LIBFCRYPTO_CBC_STREAM_H
+
+#include <common.h>
+#include <types.h>
+
+#include "libfcrypto_cipher.h"
+#include "libfcrypto_extern.h"
+#include "libfcrypto_libcerror.h"
+#include "libfcrypto_types.h"
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+/* The size of the buffers used to (de/en)crypt data that is shifted in place
+ */
+#define LIBFCRYPTO_CBC_STREAM_BUFFER_SIZE	2048
+
+typedef struct libfcrypto_internal_cbc_stream libfcrypto_internal_cbc_stream_t;
+
+struct libfcrypto_internal_cbc_stream
+{
+	/* The cipher
+	 */
+	libfcrypto_internal_cipher_t *cipher;
+
+	/* The crypt mode
+	 */
+	int mode;
+
+	/* The block size
+	 */
+	size_t block_size;
+
+	/* The chaining value, which is the initialization vector of the next block
+	 */
+	uint8_t chaining_value[ 16 ];
+
+	/* The partial block data
+	 */
+	uint8_t block_data[ 16 ];
+
+	/* The partial block data size
+	 */
+	size_t block_data_size;
+};
+
+LIBFCRYPTO_EXTERN \
+int libfcrypto_cbc_stream_initialize(
+     libfcrypto_cbc_stream_t **stream,
+     libfcrypto_cipher_t *cipher,
+     int mode,
+     const uint8_t *initialization_vector,
+     size_t initialization_vector_size,
+     libcerror_error_t **error );
+
+LIBFCRYPTO_EXTERN \
+int libfcrypto_cbc_stream_free(
+     libfcrypto_cbc_stream_t **stream,
+     libcerror_error_t **error );
+
+LIBFCRYPTO_EXTERN \
+int libfcrypto_cbc_stream_set_initialization_vector(
+     libfcrypto_cbc_stream_t *stream,
+     const uint8_t *initialization_vector,
+     size_t initialization_vector_size,
+     libcerror_error_t **error );
+
+LIBFCRYPTO_EXTERN \
+int libfcrypto_cbc_stream_get_buffered_data_size(
+     libfcrypto_cbc_stream_t *stream,
+     size_t *buffered_data_size,
+     libcerror_error_t **error );
+
+int libfcrypto_internal_cbc_stream_crypt_blocks(
+     libfcrypto_internal_cbc_stream_t *internal_stream,
+     const uint8_t *input_data,
+     uint8_t *output_data,
+     size_t data_size,
+     libcerror_error_t **error );
+
+LIBFCRYPTO_EXTERN \
+ssize_t libfcrypto_cbc_stream_update(
+         libfcrypto_cbc_stream_t *stream,
+         const uint8_t *input_data,
+         size_t input_data_size,
+         uint8_t *output_data,
+         size_t output_data_size,
+         libcerror_error_t **error );
+
+LIBFCRYPTO_EXTERN \
+int libfcrypto_cbc_stream_finalize(
+     libfcrypto_cbc_stream_t *stream,
+     libcerror_error_t **error );
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _LIBFCRYPTO_CBC_STREAM_H ) */
+
@@ -0,0 +1,2898 @@
+/*
+ * Cipher functions
+ *
+ * Copyright (C) 2017-2024, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <memory.h>
+#include <types.h>
+
+#include "libfcrypto_blowfish_context.h"
+#include "libfcrypto_cipher.h"
+#include "libfcrypto_ctr.h"
+#include "libfcrypto_definitions.h"
+#include "libfcrypto_des3_context.h"
+#include "libfcrypto_libcerror.h"
+#include "libfcrypto_rc4_context.h"
+#include "libfcrypto_serpent_context.h"
+#include "libfcrypto_types.h"
+#include "libfcrypto_unused.h"
+
+/* Creates a cipher
+ * Make sure the value cipher is referencing, is set to NULL
+ * The function that (de/en)crypts data is selected here so that no algorithm or mode
+ * specific branching is needed when (de/en)crypting data
+ * Returns 1 if successful or -1 on error
+ */
+int libfcrypto_cipher_initialize(
+     libfcrypto_cipher_t **cipher,
+     int algorithm,
+     int mode,
+     libcerror_error_t **error )
+{
+	libfcrypto_internal_cipher_t *internal_cipher = NULL;
+	static char *function                         = "libfcrypto_cipher_initialize";
+	int result                                    = 0;
+
+	if( cipher == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid cipher.",
+		 function );
+
+		return( -1 );
+	}
+	if( *cipher != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid cipher value already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( algorithm != LIBFCRYPTO_CIPHER_ALGORITHM_BLOWFISH )
+	 && ( algorithm != LIBFCRYPTO_CIPHER_ALGORITHM_DES3 )
+	 && ( algorithm != LIBFCRYPTO_CIPHER_ALGORITHM_RC4 )
+	 && ( algorithm != LIBFCRYPTO_CIPHER_ALGORITHM_SERPENT ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported algorithm.",
+		 function );
+
+		return( -1 );
+	}
+	/* RC4 is a stream cipher and only supports the stream mode
+	 */
+	if( algorithm == LIBFCRYPTO_CIPHER_ALGORITHM_RC4 )
+	{
+		if( mode != LIBFCRYPTO_CIPHER_MODE_STREAM )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+			 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+			 "%s: unsupported mode.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	else if( ( mode != LIBFCRYPTO_CIPHER_MODE_CBC )
+	      && ( mode != LIBFCRYPTO_CIPHER_MODE_CTR )
+	      && ( mode != LIBFCRYPTO_CIPHER_MODE_ECB ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported mode.",
+		 function );
+
+		return( -1 );
+	}
+	internal_cipher = memory_allocate_structure(
+	                   libfcrypto_internal_cipher_t );
+
+	if( internal_cipher == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create cipher.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     internal_cipher,
+	     0,
+	     sizeof( libfcrypto_internal_cipher_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear cipher.",
+		 function );
+
+		memory_free(
+		 internal_cipher );
+
+		return( -1 );
+	}
+	switch( algorithm )
+	{
+		case LIBFCRYPTO_CIPHER_ALGORITHM_BLOWFISH:
+			result = libfcrypto_blowfish_context_initialize(
+			          (libfcrypto_blowfish_context_t **) &( internal_cipher->context ),
+			          error );
+
+			internal_cipher->block_size = 8;
+
+			if( mode == LIBFCRYPTO_CIPHER_MODE_CBC )
+			{
+				internal_cipher->crypt_function = &libfcrypto_internal_cipher_crypt_blowfish_cbc;
+			}
+			else if( mode == LIBFCRYPTO_CIPHER_MODE_CTR )
+			{
+				internal_cipher->crypt_function = &libfcrypto_internal_cipher_crypt_blowfish_ctr;
+			}
+			else
+			{
+				internal_cipher->crypt_function = &libfcrypto_internal_cipher_crypt_blowfish_ecb;
+			}
+			internal_cipher->ecb_crypt_function = &libfcrypto_internal_cipher_crypt_blowfish_ecb;
+
+			break;
+
+		case LIBFCRYPTO_CIPHER_ALGORITHM_DES3:
+			result = libfcrypto_des3_context_initialize(
+			          (libfcrypto_des3_context_t **) &( internal_cipher->context ),
+			          error );
+
+			internal_cipher->block_size = 8;
+
+			if( mode == LIBFCRYPTO_CIPHER_MODE_CBC )
+			{
+				internal_cipher->crypt_function = &libfcrypto_internal_cipher_crypt_des3_cbc;
+			}
+			else if( mode == LIBFCRYPTO_CIPHER_MODE_CTR )
+			{
+				internal_cipher->crypt_function = &libfcrypto_internal_cipher_crypt_des3_ctr;
+			}
+			else
+			{
+				internal_cipher->crypt_function = &libfcrypto_internal_cipher_crypt_des3_ecb;
+			}
+			internal_cipher->ecb_crypt_function = &libfcrypto_internal_cipher_crypt_des3_ecb;
+
+			break;
+
+		case LIBFCRYPTO_CIPHER_ALGORITHM_RC4:
+			result = libfcrypto_rc4_context_initialize(
+			          (libfcrypto_rc4_context_t **) &( internal_cipher->context ),
+			          error );
+
+			internal_cipher->block_size = 1;
+
+			internal_cipher->crypt_function = &libfcrypto_internal_cipher_crypt_rc4_stream;
+
+			break;
+
+		case LIBFCRYPTO_CIPHER_ALGORITHM_SERPENT:
+			result = libfcrypto_serpent_context_initialize(
+			          (libfcrypto_serpent_context_t **) &( internal_cipher->context ),
+			          error );
+
+			internal_cipher->block_size = 16;
+
+			if( mode == LIBFCRYPTO_CIPHER_MODE_CBC )
+			{
+				internal_cipher->crypt_function = &libfcrypto_internal_cipher_crypt_serpent_cbc;
+			}
+			else if( mode == LIBFCRYPTO_CIPHER_MODE_CTR )
+			{
+				internal_cipher->crypt_function = &libfcrypto_internal_cipher_crypt_serpent_ctr;
+			}
+			else
+			{
+				internal_cipher->crypt_function = &libfcrypto_internal_cipher_crypt_serpent_ecb;
+			}
+			internal_cipher->ecb_crypt_function = &libfcrypto_internal_cipher_crypt_serpent_ecb;
+
+			break;
+	}
+	if( result != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create context.",
+		 function );
+
+		goto on_error;
+	}
+	internal_cipher->algorithm = algorithm;
+	internal_cipher->mode      = mode;
+
+	*cipher = (libfcrypto_cipher_t *) internal_cipher;
+
+	return( 1 );
+
+on_error:
+	if( internal_cipher != NULL )
+	{
+		memory_free(
+		 internal_cipher );
+	}
+	return( -1 );
+}
+
+/* Frees a cipher
+ * Returns 1 if successful or -1 on error
+ */
+int libfcrypto_cipher_free(
+     libfcrypto_cipher_t **cipher,
+     libcerror_error_t **error )
+{
+	libfcrypto_internal_cipher_t *internal_cipher = NULL;
+	static char *function                         = "libfcrypto_cipher_free";
+	int result                                    = 1;
+
+	if( cipher == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid cipher.",
+		 function );
+
+		return( -1 );
+	}
+	if( *cipher != NULL )
+	{
+		internal_cipher = (libfcrypto_internal_cipher_t *) *cipher;
+		*cipher         = NULL;
+
+		if( internal_cipher->context != NULL )
+		{
+			switch( internal_cipher->algorithm )
+			{
+				case LIBFCRYPTO_CIPHER_ALGORITHM_BLOWFISH:
+					result = libfcrypto_blowfish_context_free(
+					          (libfcrypto_blowfish_context_t **) &( internal_cipher->context ),
+					          error );
+					break;
+
+				case LIBFCRYPTO_CIPHER_ALGORITHM_DES3:
+					result = libfcrypto_des3_context_free(
+					          (libfcrypto_des3_context_t **) &( internal_cipher->context ),
+					          error );
+					break;
+
+				case LIBFCRYPTO_CIPHER_ALGORITHM_RC4:
+					result = libfcrypto_rc4_context_free(
+					          (libfcrypto_rc4_context_t **) &( internal_cipher->context ),
+					          error );
+					break;
+
+				case LIBFCRYPTO_CIPHER_ALGORITHM_SERPENT:
+					result = libfcrypto_serpent_context_free(
+					          (libfcrypto_serpent_context_t **) &( internal_cipher->context ),
+					          error );
+					break;
+			}
+			if( result != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+				 "%s: unable to free context.",
+				 function );
+
+				result = -1;
+			}
+		}
+		memory_free(
+		 internal_cipher );
+	}
+	return( result );
+}
+
+/* Sets the key
+ * Returns 1 if successful or -1 on error
+ */
+int libfcrypto_cipher_set_key(
+     libfcrypto_cipher_t *cipher,
+     const uint8_t *key,
+     size_t key_bit_size,
+     libcerror_error_t **error )
+{
+	libfcrypto_internal_cipher_t *internal_cipher = NULL;
+	static char *function                         = "libfcrypto_cipher_set_key";
+	int result                                    = 0;
+
+	if( cipher == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid cipher.",
+		 function );
+
+		return( -1 );
+	}
+	internal_cipher = (libfcrypto_internal_cipher_t *) cipher;
+
+	switch( internal_cipher->algorithm )
+	{
+		case LIBFCRYPTO_CIPHER_ALGORITHM_BLOWFISH:
+			result = libfcrypto_blowfish_context_set_key(
+			          (libfcrypto_blowfish_context_t *) internal_cipher->context,
+			          key,
+			          key_bit_size,
+			          error );
+			break;
+
+		case LIBFCRYPTO_CIPHER_ALGORITHM_DES3:
+			result = libfcrypto_des3_context_set_key(
+			          (libfcrypto_des3_context_t *) internal_cipher->context,
+			          key,
+			          key_bit_size,
+			          error );
+			break;
+
+		case LIBFCRYPTO_CIPHER_ALGORITHM_RC4:
+			result = libfcrypto_rc4_context_set_key(
+			          (libfcrypto_rc4_context_t *) internal_cipher->context,
+			          key,
+			          key_bit_size,
+			          error );
+			break;
+
+		case LIBFCRYPTO_CIPHER_ALGORITHM_SERPENT:
+			result = libfcrypto_serpent_context_set_key(
+			          (libfcrypto_serpent_context_t *) internal_cipher->context,
+			          key,
+			          key_bit_size,
+			          error );
+			break;
+	}
+	if( result != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to set key.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Retrieves the block size
+ * The block size of a stream cipher is 1
+ * Returns 1 if successful or -1 on error
+ */
+int libfcrypto_cipher_get_block_size(
+     libfcrypto_cipher_t *cipher,
+     size_t *block_size,
+     libcerror_error_t **error )
+{
+	libfcrypto_internal_cipher_t *internal_cipher = NULL;
+	static char *function                         = "libfcrypto_cipher_get_block_size";
+
+	if( cipher == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid cipher.",
+		 function );
+
+		return( -1 );
+	}
+	internal_cipher = (libfcrypto_internal_cipher_t *) cipher;
+
+	if( block_size == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid block size.",
+		 function );
+
+		return( -1 );
+	}
+	*block_size = internal_cipher->block_size;
+
+	return( 1 );
+}
+
+/* Sets the thread pool that is used to (de/en)crypt large amounts of data in parallel
+ * The thread pool is referenced by the cipher, hence it must remain available while the cipher is used
+ * Data is only split over multiple threads when it is at least twice the minimum chunk size
+ * ECB, CTR, CBC decryption and CBC data units are (de/en)crypted in parallel,
+ * CBC encryption and stream mode are sequential
+ * A thread pool of NULL disables parallel (de/en)cryption
+ * Returns 1 if successful or -1 on error
+ */
+int libfcrypto_cipher_set_thread_pool(
+     libfcrypto_cipher_t *cipher,
+     libfcrypto_thread_pool_t *thread_pool,
+     size_t minimum_chunk_size,
+     libcerror_error_t **error )
+{
+	libfcrypto_internal_cipher_t *internal_cipher = NULL;
+	static char *function                         = "libfcrypto_cipher_set_thread_pool";
+
+	if( cipher == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid cipher.",
+		 function );
+
+		return( -1 );
+	}
+	internal_cipher = (libfcrypto_internal_cipher_t *) cipher;
+
+	if( ( minimum_chunk_size < internal_cipher->block_size )
+	 || ( minimum_chunk_size > (size_t) SSIZE_MAX ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid minimum chunk size value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	internal_cipher->thread_pool        = (libfcrypto_internal_thread_pool_t *) thread_pool;
+	internal_cipher->minimum_chunk_size = minimum_chunk_size;
+
+	return( 1 );
+}
+
+/* Determines the number of jobs to split data into for parallel (de/en)cryption
+ * The job data size is a multitude of the alignment size, where the last job contains the remainder
+ * Returns 1 if successful or -1 on error
+ */
+int libfcrypto_internal_cipher_get_number_of_jobs(
+     libfcrypto_internal_cipher_t *internal_cipher,
+     size_t data_size,
+     size_t alignment_size,
+     int *number_of_jobs,
+     size_t *job_data_size,
+     libcerror_error_t **error )
+{
+	static char *function         = "libfcrypto_internal_cipher_get_number_of_jobs";
+	size_t maximum_number_of_jobs = 0;
+	int safe_number_of_jobs       = 1;
+
+	if( internal_cipher == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid cipher.",
+		 function );
+
+		return( -1 );
+	}
+	if( alignment_size == 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid alignment size value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( number_of_jobs == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid number of jobs.",
+		 function );
+
+		return( -1 );
+	}
+	if( job_data_size == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid job data size.",
+		 function );
+
+		return( -1 );
+	}
+	*job_data_size = data_size;
+
+	if( ( internal_cipher->thread_pool != NULL )
+	 && ( internal_cipher->minimum_chunk_size > 0 ) )
+	{
+		/* The calling thread runs jobs as well
+		 */
+		safe_number_of_jobs    = internal_cipher->thread_pool->number_of_threads + 1;
+		maximum_number_of_jobs = data_size / internal_cipher->minimum_chunk_size;
+
+		if( maximum_number_of_jobs < (size_t) safe_number_of_jobs )
+		{
+			safe_number_of_jobs = (int) maximum_number_of_jobs;
+		}
+		if( safe_number_of_jobs > 1 )
+		{
+			*job_data_size  = data_size / safe_number_of_jobs;
+			*job_data_size -= *job_data_size % alignment_size;
+		}
+		if( ( safe_number_of_jobs <= 1 )
+		 || ( *job_data_size == 0 ) )
+		{
+			safe_number_of_jobs = 1;
+			*job_data_size      = data_size;
+		}
+	}
+	*number_of_jobs = safe_number_of_jobs;
+
+	return( 1 );
+}
+
+/* Runs a job that (de/en)crypts data using the algorithm and mode of the cipher
+ * Returns 1 if successful or -1 on error
+ */
+int libfcrypto_internal_cipher_crypt_job(
+     intptr_t *job,
+     libcerror_error_t **error )
+{
+	libfcrypto_internal_cipher_job_t *cipher_job = NULL;
+	static char *function                        = "libfcrypto_internal_cipher_crypt_job";
+
+	if( job == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid job.",
+		 function );
+
+		return( -1 );
+	}
+	cipher_job = (libfcrypto_internal_cipher_job_t *) job;
+
+	if( cipher_job->internal_cipher->crypt_function(
+	     cipher_job->internal_cipher->context,
+	     cipher_job->mode,
+	     cipher_job->initialization_vector,
+	     cipher_job->internal_cipher->block_size,
+	     cipher_job->input_data,
+	     cipher_job->data_size,
+	     cipher_job->output_data,
+	     cipher_job->data_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ENCRYPTION,
+		 LIBCERROR_ENCRYPTION_ERROR_GENERIC,
+		 "%s: unable to crypt data.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* De- or encrypts data using the algorithm and mode of the cipher split over the threads of the thread pool
+ * Falls back to (de/en)crypting the data at once if it cannot be split
+ * Returns 1 if successful or -1 on error
+ */
+int libfcrypto_internal_cipher_crypt_parallel(
+     libfcrypto_internal_cipher_t *internal_cipher,
+     int mode,
+     const uint8_t *initialization_vector,
+     size_t initialization_vector_size,
+     const uint8_t *input_data,
+     size_t input_data_size,
+     uint8_t *output_data,
+     size_t output_data_size,
+     libcerror_error_t **error )
+{
+	libfcrypto_internal_cipher_job_t *jobs = NULL;
+	const uint8_t *chaining_value          = NULL;
+	static char *function                  = "libfcrypto_internal_cipher_crypt_parallel";
+	size_t data_offset                     = 0;
+	size_t job_data_size                   = 0;
+	int job_index                          = 0;
+	int number_of_jobs                     = 1;
+
+	if( internal_cipher == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid cipher.",
+		 function );
+
+		return( -1 );
+	}
+	/* CBC encryption and stream mode cannot be split and invalid arguments
+	 * are reported by the crypt function
+	 */
+	if( ( internal_cipher->mode != LIBFCRYPTO_CIPHER_MODE_STREAM )
+	 && ( ( internal_cipher->mode != LIBFCRYPTO_CIPHER_MODE_CBC )
+	  || ( mode == LIBFCRYPTO_CRYPT_MODE_DECRYPT ) )
+	 && ( ( internal_cipher->mode == LIBFCRYPTO_CIPHER_MODE_ECB )
+	  || ( ( initialization_vector != NULL )
+	   && ( initialization_vector_size == internal_cipher->block_size ) ) )
+	 && ( input_data != NULL )
+	 && ( input_data_size <= (size_t) SSIZE_MAX )
+	 && ( output_data != NULL )
+	 && ( output_data_size >= input_data_size ) )
+	{
+		if( libfcrypto_internal_cipher_get_number_of_jobs(
+		     internal_cipher,
+		     input_data_size,
+		     internal_cipher->block_size,
+		     &number_of_jobs,
+		     &job_data_size,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to determine number of jobs.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	if( number_of_jobs <= 1 )
+	{
+		return( internal_cipher->crypt_function(
+		         internal_cipher->context,
+		         mode,
+		         initialization_vector,
+		         initialization_vector_size,
+		         input_data,
+		         input_data_size,
+		         output_data,
+		         output_data_size,
+		         error ) );
+	}
+	jobs = (libfcrypto_internal_cipher_job_t *) memory_allocate(
+	                                             sizeof( libfcrypto_internal_cipher_job_t ) * number_of_jobs );
+
+	if( jobs == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create jobs.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     jobs,
+	     0,
+	     sizeof( libfcrypto_internal_cipher_job_t ) * number_of_jobs ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear jobs.",
+		 function );
+
+		goto on_error;
+	}
+	/* The initialization vectors of the jobs are determined before any data is (de/en)crypted
+	 * since for in-place CBC decryption the preceding encrypted block is overwritten
+	 */
+	for( job_index = 0;
+	     job_index < number_of_jobs;
+	     job_index++ )
+	{
+		jobs[ job_index ].internal_cipher = internal_cipher;
+		jobs[ job_index ].mode            = mode;
+		jobs[ job_index ].input_data      = &( input_data[ data_offset ] );
+		jobs[ job_index ].output_data     = &( output_data[ data_offset ] );
+		jobs[ job_index ].data_size       = job_data_size;
+
+		if( job_index == ( number_of_jobs - 1 ) )
+		{
+			jobs[ job_index ].data_size = input_data_size - data_offset;
+		}
+		if( internal_cipher->mode == LIBFCRYPTO_CIPHER_MODE_CTR )
+		{
+			if( libfcrypto_ctr_set_counter_block(
+			     jobs[ job_index ].initialization_vector,
+			     initialization_vector,
+			     internal_cipher->block_size,
+			     internal_cipher->block_size,
+			     LIBFCRYPTO_ENDIAN_BIG,
+			     (uint64_t) ( data_offset / internal_cipher->block_size ),
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+				 "%s: unable to set counter block of job: %d.",
+				 function,
+				 job_index );
+
+				goto on_error;
+			}
+		}
+		else if( internal_cipher->mode == LIBFCRYPTO_CIPHER_MODE_CBC )
+		{
+			if( job_index == 0 )
+			{
+				chaining_value = initialization_vector;
+			}
+			else
+			{
+				chaining_value = &( input_data[ data_offset - internal_cipher->block_size ] );
+			}
+			if( memory_copy(
+			     jobs[ job_index ].initialization_vector,
+			     chaining_value,
+			     internal_cipher->block_size ) == NULL )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_MEMORY,
+				 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+				 "%s: unable to copy initialization vector of job: %d.",
+				 function,
+				 job_index );
+
+				goto on_error;
+			}
+		}
+		data_offset += job_data_size;
+	}
+	if( libfcrypto_internal_thread_pool_run_jobs(
+	     internal_cipher->thread_pool,
+	     &libfcrypto_internal_cipher_crypt_job,
+	     (uint8_t *) jobs,
+	     sizeof( libfcrypto_internal_cipher_job_t ),
+	     number_of_jobs,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ENCRYPTION,
+		 LIBCERROR_ENCRYPTION_ERROR_GENERIC,
+		 "%s: unable to crypt data.",
+		 function );
+
+		goto on_error;
+	}
+	memory_free(
+	 jobs );
+
+	return( 1 );
+
+on_error:
+	if( jobs != NULL )
+	{
+		memory_free(
+		 jobs );
+	}
+	return( -1 );
+}
+
+/* De- or encrypts data using the algorithm and mode of the cipher
+ * The initialization vector is used by CBC and is the initial counter block for CTR,
+ * where the entire counter block is a big-endian counter
+ * The initialization vector is ignored by ECB and stream mode
+ * Returns 1 if successful or -1 on error
+ */
+int libfcrypto_cipher_crypt(
+     libfcrypto_cipher_t *cipher,
+     int mode,
+     const uint8_t *initialization_vector,
+     size_t initialization_vector_size,
+     const uint8_t *input_data,
+     size_t input_data_size,
+     uint8_t *output_data,
+     size_t output_data_size,
+     libcerror_error_t **error )
+{
+	libfcrypto_internal_cipher_t *internal_cipher = NULL;
+	static char *function                         = "libfcrypto_cipher_crypt";
+	int result                                    = 0;
+
+	if( cipher == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid cipher.",
+		 function );
+
+		return( -1 );
+	}
+	internal_cipher = (libfcrypto_internal_cipher_t *) cipher;
+
+	if( internal_cipher->thread_pool != NULL )
+	{
+		result = libfcrypto_internal_cipher_crypt_parallel(
+		          internal_cipher,
+		          mode,
+		          initialization_vector,
+		          initialization_vector_size,
+		          input_data,
+		          input_data_size,
+		          output_data,
+		          output_data_size,
+		          error );
+	}
+	else
+	{
+		result = internal_cipher->crypt_function(
+		          internal_cipher->context,
+		          mode,
+		          initialization_vector,
+		          initialization_vector_size,
+		          input_data,
+		          input_data_size,
+		          output_data,
+		          output_data_size,
+		          error );
+	}
+	if( result != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ENCRYPTION,
+		 LIBCERROR_ENCRYPTION_ERROR_GENERIC,
+		 "%s: unable to crypt data.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* De- or encrypts contiguous data and updates the chaining value
+ * For CBC the chaining value is the initialization vector of the next block
+ * For CTR the chaining value is set to the counter block of the block number
+ * The data size must be a multitude of the block size except for CTR and stream mode
+ * Returns 1 if successful or -1 on error
+ */
+int libfcrypto_internal_cipher_crypt_chained(
+     libfcrypto_internal_cipher_t *internal_cipher,
+     int mode,
+     const uint8_t *initialization_vector,
+     uint8_t *chaining_value,
+     uint64_t block_number,
+     const uint8_t *input_data,
+     uint8_t *output_data,
+     size_t data_size,
+     libcerror_error_t **error )
+{
+	uint8_t next_chaining_value[ 16 ];
+
+	const uint8_t *crypt_initialization_vector = NULL;
+	static char *function                      = "libfcrypto_internal_cipher_crypt_chained";
+	size_t block_offset                        = 0;
+
+	if( internal_cipher == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid cipher.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( data_size == 0 )
+	 || ( data_size > (size_t) SSIZE_MAX ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid data size value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( internal_cipher->mode == LIBFCRYPTO_CIPHER_MODE_CBC )
+	 || ( internal_cipher->mode == LIBFCRYPTO_CIPHER_MODE_CTR ) )
+	{
+		if( chaining_value == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+			 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+			 "%s: invalid chaining value.",
+			 function );
+
+			return( -1 );
+		}
+		crypt_initialization_vector = chaining_value;
+	}
+	else
+	{
+		crypt_initialization_vector = initialization_vector;
+	}
+	if( internal_cipher->mode == LIBFCRYPTO_CIPHER_MODE_CTR )
+	{
+		if( libfcrypto_ctr_set_counter_block(
+		     chaining_value,
+		     initialization_vector,
+		     internal_cipher->block_size,
+		     internal_cipher->block_size,
+		     LIBFCRYPTO_ENDIAN_BIG,
+		     block_number,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to set counter block.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	else if( ( internal_cipher->mode == LIBFCRYPTO_CIPHER_MODE_CBC )
+	      && ( mode == LIBFCRYPTO_CRYPT_MODE_DECRYPT ) )
+	{
+		if( data_size < internal_cipher->block_size )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+			 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+			 "%s: invalid data size value out of bounds.",
+			 function );
+
+			return( -1 );
+		}
+		block_offset = data_size - internal_cipher->block_size;
+
+		/* The last encrypted input block is the next chaining value
+		 * and is stored before the output data can overwrite it
+		 */
+		if( memory_copy(
+		     next_chaining_value,
+		     &( input_data[ block_offset ] ),
+		     internal_cipher->block_size ) == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+			 "%s: unable to copy next chaining value.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	if( internal_cipher->crypt_function(
+	     internal_cipher->context,
+	     mode,
+	     crypt_initialization_vector,
+	     internal_cipher->block_size,
+	     input_data,
+	     data_size,
+	     output_data,
+	     data_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ENCRYPTION,
+		 LIBCERROR_ENCRYPTION_ERROR_GENERIC,
+		 "%s: unable to crypt data.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_cipher->mode == LIBFCRYPTO_CIPHER_MODE_CBC )
+	{
+		if( mode == LIBFCRYPTO_CRYPT_MODE_ENCRYPT )
+		{
+			block_offset = data_size - internal_cipher->block_size;
+
+			if( memory_copy(
+			     chaining_value,
+			     &( output_data[ block_offset ] ),
+			     internal_cipher->block_size ) == NULL )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_MEMORY,
+				 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+				 "%s: unable to copy chaining value.",
+				 function );
+
+				return( -1 );
+			}
+		}
+		else
+		{
+			if( memory_copy(
+			     chaining_value,
+			     next_chaining_value,
+			     internal_cipher->block_size ) == NULL )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_MEMORY,
+				 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+				 "%s: unable to copy chaining value.",
+				 function );
+
+				return( -1 );
+			}
+		}
+	}
+	return( 1 );
+}
+
+/* De- or encrypts data that is stored in multiple segments
+ * The input and output segments can differ in number and size, but their total sizes must be equal,
+ * blocks that straddle segment boundaries are gathered and scattered and the chaining state
+ * of CBC and CTR is maintained across segments
+ * The initialization vector is used as in libfcrypto_cipher_crypt
+ * Returns 1 if successful or -1 on error
+ */
+int libfcrypto_cipher_crypt_segments(
+     libfcrypto_cipher_t *cipher,
+     int mode,
+     const uint8_t *initialization_vector,
+     size_t initialization_vector_size,
+     const uint8_t **input_segments,
+     const size_t *input_segment_sizes,
+     int number_of_input_segments,
+     uint8_t **output_segments,
+     const size_t *output_segment_sizes,
+     int number_of_output_segments,
+     libcerror_error_t **error )
+{
+	uint8_t block_data[ 16 ];
+	uint8_t chaining_value[ 16 ];
+
+	libfcrypto_internal_cipher_t *internal_cipher = NULL;
+	static char *function                         = "libfcrypto_cipher_crypt_segments";
+	size_t block_data_offset                      = 0;
+	size_t data_size                              = 0;
+	size_t input_data_size                        = 0;
+	size_t input_segment_offset                   = 0;
+	size_t output_data_size                       = 0;
+	size_t output_segment_offset                  = 0;
+	size_t read_size                              = 0;
+	size_t remaining_data_size                    = 0;
+	uint64_t block_number                         = 0;
+	int input_segment_index                       = 0;
+	int output_segment_index                      = 0;
+	int segment_index                             = 0;
+
+	if( cipher == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid cipher.",
+		 function );
+
+		return( -1 );
+	}
+	internal_cipher = (libfcrypto_internal_cipher_t *) cipher;
+
+	if( ( mode != LIBFCRYPTO_CRYPT_MODE_DECRYPT )
+	 && ( mode != LIBFCRYPTO_CRYPT_MODE_ENCRYPT ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported mode.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( internal_cipher->mode == LIBFCRYPTO_CIPHER_MODE_CBC )
+	 || ( internal_cipher->mode == LIBFCRYPTO_CIPHER_MODE_CTR ) )
+	{
+		if( initialization_vector == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+			 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+			 "%s: invalid initialization vector.",
+			 function );
+
+			return( -1 );
+		}
+		if( initialization_vector_size != internal_cipher->block_size )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+			 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+			 "%s: invalid initialization vector size value out of bounds.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	if( input_segments == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid input segments.",
+		 function );
+
+		return( -1 );
+	}
+	if( input_segment_sizes == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid input segment sizes.",
+		 function );
+
+		return( -1 );
+	}
+	if( number_of_input_segments < 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_LESS_THAN_ZERO,
+		 "%s: invalid number of input segments value less than zero.",
+		 function );
+
+		return( -1 );
+	}
+	if( output_segments == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid output segments.",
+		 function );
+
+		return( -1 );
+	}
+	if( output_segment_sizes == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid output segment sizes.",
+		 function );
+
+		return( -1 );
+	}
+	if( number_of_output_segments < 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_LESS_THAN_ZERO,
+		 "%s: invalid number of output segments value less than zero.",
+		 function );
+
+		return( -1 );
+	}
+	/* Validate all the segments before any data is processed
+	 */
+	for( segment_index = 0;
+	     segment_index < number_of_input_segments;
+	     segment_index++ )
+	{
+		if( input_segments[ segment_index ] == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+			 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+			 "%s: invalid input segment: %d.",
+			 function,
+			 segment_index );
+
+			return( -1 );
+		}
+		if( input_segment_sizes[ segment_index ] > ( (size_t) SSIZE_MAX - input_data_size ) )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+			 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+			 "%s: invalid input segment: %d size value out of bounds.",
+			 function,
+			 segment_index );
+
+			return( -1 );
+		}
+		input_data_size += input_segment_sizes[ segment_index ];
+	}
+	for( segment_index = 0;
+	     segment_index < number_of_output_segments;
+	     segment_index++ )
+	{
+		if( output_segments[ segment_index ] == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+			 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+			 "%s: invalid output segment: %d.",
+			 function,
+			 segment_index );
+
+			return( -1 );
+		}
+		if( output_segment_sizes[ segment_index ] > ( (size_t) SSIZE_MAX - output_data_size ) )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+			 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+			 "%s: invalid output segment: %d size value out of bounds.",
+			 function,
+			 segment_index );
+
+			return( -1 );
+		}
+		output_data_size += output_segment_sizes[ segment_index ];
+	}
+	if( output_data_size != input_data_size )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid output data size value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( ( internal_cipher->mode == LIBFCRYPTO_CIPHER_MODE_CBC )
+	  || ( internal_cipher->mode == LIBFCRYPTO_CIPHER_MODE_ECB ) )
+	 && ( ( input_data_size % internal_cipher->block_size ) != 0 ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid input data size value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( internal_cipher->mode == LIBFCRYPTO_CIPHER_MODE_CBC )
+	 || ( internal_cipher->mode == LIBFCRYPTO_CIPHER_MODE_CTR ) )
+	{
+		if( memory_copy(
+		     chaining_value,
+		     initialization_vector,
+		     initialization_vector_size ) == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+			 "%s: unable to copy initialization vector.",
+			 function );
+
+			goto on_error;
+		}
+	}
+	remaining_data_size = input_data_size;
+
+	while( remaining_data_size > 0 )
+	{
+		while( input_segment_offset >= input_segment_sizes[ input_segment_index ] )
+		{
+			input_segment_index++;
+			input_segment_offset = 0;
+		}
+		while( output_segment_offset >= output_segment_sizes[ output_segment_index ] )
+		{
+			output_segment_index++;
+			output_segment_offset = 0;
+		}
+		/* Blocks that are contiguous in both the input and output segment are processed at once
+		 */
+		data_size = input_segment_sizes[ input_segment_index ] - input_segment_offset;
+
+		if( data_size > ( output_segment_sizes[ output_segment_index ] - output_segment_offset ) )
+		{
+			data_size = output_segment_sizes[ output_segment_index ] - output_segment_offset;
+		}
+		data_size -= data_size % internal_cipher->block_size;
+
+		if( data_size > 0 )
+		{
+			if( libfcrypto_internal_cipher_crypt_chained(
+			     internal_cipher,
+			     mode,
+			     initialization_vector,
+			     chaining_value,
+			     block_number,
+			     &( ( input_segments[ input_segment_index ] )[ input_segment_offset ] ),
+			     &( ( output_segments[ output_segment_index ] )[ output_segment_offset ] ),
+			     data_size,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_ENCRYPTION,
+				 LIBCERROR_ENCRYPTION_ERROR_GENERIC,
+				 "%s: unable to crypt input segment: %d data.",
+				 function,
+				 input_segment_index );
+
+				goto on_error;
+			}
+			input_segment_offset  += data_size;
+			output_segment_offset += data_size;
+			remaining_data_size   -= data_size;
+			block_number          += data_size / internal_cipher->block_size;
+
+			continue;
+		}
+		/* A block that straddles a segment boundary is gathered from the input segments
+		 * and scattered over the output segments, for CTR the last block can be incomplete
+		 */
+		data_size = internal_cipher->block_size;
+
+		if( data_size > remaining_data_size )
+		{
+			data_size = remaining_data_size;
+		}
+		block_data_offset = 0;
+
+		while( block_data_offset < data_size )
+		{
+			while( input_segment_offset >= input_segment_sizes[ input_segment_index ] )
+			{
+				input_segment_index++;
+				input_segment_offset = 0;
+			}
+			read_size = input_segment_sizes[ input_segment_index ] - input_segment_offset;
+
+			if( read_size > ( data_size - block_data_offset ) )
+			{
+				read_size = data_size - block_data_offset;
+			}
+			if( memory_copy(
+			     &( block_data[ block_data_offset ] ),
+			     &( ( input_segments[ input_segment_index ] )[ input_segment_offset ] ),
+			     read_size ) == NULL )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_MEMORY,
+				 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+				 "%s: unable to copy input segment: %d data to block data.",
+				 function,
+				 input_segment_index );
+
+				goto on_error;
+			}
+			input_segment_offset += read_size;
+			block_data_offset    += read_size;
+		}
+		if( libfcrypto_internal_cipher_crypt_chained(
+		     internal_cipher,
+		     mode,
+		     initialization_vector,
+		     chaining_value,
+		     block_number,
+		     block_data,
+		     block_data,
+		     data_size,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_ENCRYPTION,
+			 LIBCERROR_ENCRYPTION_ERROR_GENERIC,
+			 "%s: unable to crypt block data.",
+			 function );
+
+			goto on_error;
+		}
+		block_data_offset = 0;
+
+		while( block_data_offset < data_size )
+		{
+			while( output_segment_offset >= output_segment_sizes[ output_segment_index ] )
+			{
+				output_segment_index++;
+				output_segment_offset = 0;
+			}
+			read_size = output_segment_sizes[ output_segment_index ] - output_segment_offset;
+
+			if( read_size > ( data_size - block_data_offset ) )
+			{
+				read_size = data_size - block_data_offset;
+			}
+			if( memory_copy(
+			     &( ( output_segments[ output_segment_index ] )[ output_segment_offset ] ),
+			     &( block_data[ block_data_offset ] ),
+			     read_size ) == NULL )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_MEMORY,
+				 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+				 "%s: unable to copy block data to output segment: %d data.",
+				 function,
+				 output_segment_index );
+
+				goto on_error;
+			}
+			output_segment_offset += read_size;
+			block_data_offset     += read_size;
+		}
+		remaining_data_size -= data_size;
+		block_number        += 1;
+	}
+	if( memory_set(
+	     block_data,
+	     0,
+	     16 ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear block data.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     chaining_value,
+	     0,
+	     16 ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear chaining value.",
+		 function );
+
+		goto on_error;
+	}
+	return( 1 );
+
+on_error:
+	memory_set(
+	 block_data,
+	 0,
+	 16 );
+
+	memory_set(
+	 chaining_value,
+	 0,
+	 16 );
+
+	return( -1 );
+}
+
+/* Retrieves the initialization vector of a data unit
+ * The initialization vector is either retrieved from the initialization vectors
+ * or generated by the initialization vector function into the initialization vector buffer
+ * Returns 1 if successful or -1 on error
+ */
+int libfcrypto_internal_cipher_get_data_unit_initialization_vector(
+     libfcrypto_internal_cipher_t *internal_cipher,
+     const uint8_t *initialization_vectors,
+     int (*initialization_vector_function)(
+            intptr_t *function_data,
+            uint64_t data_unit_number,
+            uint8_t *initialization_vector,
+            size_t initialization_vector_size,
+            libcerror_error_t **error ),
+     intptr_t *function_data,
+     uint64_t data_unit_number,
+     size_t data_unit_index,
+     uint8_t *initialization_vector,
+     const uint8_t **data_unit_initialization_vector,
+     libcerror_error_t **error )
+{
+	static char *function = "libfcrypto_internal_cipher_get_data_unit_initialization_vector";
+
+	if( internal_cipher == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid cipher.",
+		 function );
+
+		return( -1 );
+	}
+	if( data_unit_initialization_vector == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid data unit initialization vector.",
+		 function );
+
+		return( -1 );
+	}
+	if( initialization_vectors != NULL )
+	{
+		*data_unit_initialization_vector = &( initialization_vectors[ data_unit_index * internal_cipher->block_size ] );
+
+		return( 1 );
+	}
+	if( initialization_vector_function == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid initialization vector function.",
+		 function );
+
+		return( -1 );
+	}
+	if( initialization_vector_function(
+	     function_data,
+	     data_unit_number + (uint64_t) data_unit_index,
+	     initialization_vector,
+	     internal_cipher->block_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to generate initialization vector of data unit: %" PRIu64 ".",
+		 function,
+		 data_unit_number + (uint64_t) data_unit_index );
+
+		return( -1 );
+	}
+	*data_unit_initialization_vector = initialization_vector;
+
+	return( 1 );
+}
+
+/* De- or encrypts consecutive data units (sectors) using CBC where every data unit has its own initialization vector
+ * The arguments are expected to be validated by the caller
+ * Returns 1 if successful or -1 on error
+ */
+int libfcrypto_internal_cipher_crypt_cbc_data_units(
+     libfcrypto_internal_cipher_t *internal_cipher,
+     int mode,
+     uint64_t data_unit_number,
+     size_t data_unit_size,
+     const uint8_t *initialization_vectors,
+     int (*initialization_vector_function)(
+            intptr_t *function_data,
+            uint64_t data_unit_number,
+            uint8_t *initialization_vector,
+            size_t initialization_vector_size,
+            libcerror_error_t **error ),
+     intptr_t *function_data,
+     const uint8_t *input_data,
+     uint8_t *output_data,
+     size_t data_size,
+     libcerror_error_t **error )
+{
+	uint8_t encrypted_data_buffer[ LIBFCRYPTO_CIPHER_DATA_UNITS_BUFFER_SIZE ];
+	uint8_t initialization_vector[ 16 ];
+
+	const uint8_t *chaining_value                  = NULL;
+	const uint8_t *data_unit_initialization_vector = NULL;
+	const uint8_t *encrypted_data                  = NULL;
+	static char *function                          = "libfcrypto_internal_cipher_crypt_cbc_data_units";
+	size_t block_index                             = 0;
+	size_t block_offset                            = 0;
+	size_t chunk_size                              = 0;
+	size_t data_offset                             = 0;
+	size_t data_unit_index                         = 0;
+	size_t data_unit_offset                        = 0;
+
+	if( internal_cipher == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid cipher.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( data_unit_size == 0 )
+	 || ( ( data_size % data_unit_size ) != 0 ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid data unit size value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	while( data_offset < data_size )
+	{
+		/* CBC encryption is sequential within a data unit. Decryption of a data unit
+		 * that is larger than the buffer cannot be done in-place using the buffer.
+		 * In both cases the data unit is (de/en)crypted on its own
+		 */
+		if( ( mode == LIBFCRYPTO_CRYPT_MODE_ENCRYPT )
+		 || ( ( input_data == output_data )
+		  && ( data_unit_size > LIBFCRYPTO_CIPHER_DATA_UNITS_BUFFER_SIZE ) ) )
+		{
+			if( libfcrypto_internal_cipher_get_data_unit_initialization_vector(
+			     internal_cipher,
+			     initialization_vectors,
+			     initialization_vector_function,
+			     function_data,
+			     data_unit_number,
+			     data_unit_index,
+			     initialization_vector,
+			     &data_unit_initialization_vector,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+				 "%s: unable to retrieve initialization vector of data unit: %" PRIzd ".",
+				 function,
+				 data_unit_index );
+
+				return( -1 );
+			}
+			if( internal_cipher->crypt_function(
+			     internal_cipher->context,
+			     mode,
+			     data_unit_initialization_vector,
+			     internal_cipher->block_size,
+			     &( input_data[ data_offset ] ),
+			     data_unit_size,
+			     &( output_data[ data_offset ] ),
+			     data_unit_size,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_ENCRYPTION,
+				 LIBCERROR_ENCRYPTION_ERROR_GENERIC,
+				 "%s: unable to crypt data unit: %" PRIzd ".",
+				 function,
+				 data_unit_index );
+
+				return( -1 );
+			}
+			data_offset     += data_unit_size;
+			data_unit_index += 1;
+
+			continue;
+		}
+		/* The blocks of multiple data units are independent when decrypting
+		 * and are decrypted at once using ECB after which the CBC chaining is applied
+		 */
+		chunk_size = data_size - data_offset;
+
+		if( input_data == output_data )
+		{
+			if( chunk_size > LIBFCRYPTO_CIPHER_DATA_UNITS_BUFFER_SIZE )
+			{
+				chunk_size = LIBFCRYPTO_CIPHER_DATA_UNITS_BUFFER_SIZE - ( LIBFCRYPTO_CIPHER_DATA_UNITS_BUFFER_SIZE % data_unit_size );
+			}
+			if( memory_copy(
+			     encrypted_data_buffer,
+			     &( input_data[ data_offset ] ),
+			     chunk_size ) == NULL )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_MEMORY,
+				 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+				 "%s: unable to copy encrypted data.",
+				 function );
+
+				return( -1 );
+			}
+			encrypted_data = encrypted_data_buffer;
+		}
+		else
+		{
+			encrypted_data = &( input_data[ data_offset ] );
+		}
+		if( internal_cipher->ecb_crypt_function(
+		     internal_cipher->context,
+		     LIBFCRYPTO_CRYPT_MODE_DECRYPT,
+		     NULL,
+		     0,
+		     encrypted_data,
+		     chunk_size,
+		     &( output_data[ data_offset ] ),
+		     chunk_size,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_ENCRYPTION,
+			 LIBCERROR_ENCRYPTION_ERROR_DECRYPT_FAILED,
+			 "%s: unable to decrypt data.",
+			 function );
+
+			return( -1 );
+		}
+		for( data_unit_offset = 0;
+		     data_unit_offset < chunk_size;
+		     data_unit_offset += data_unit_size )
+		{
+			if( libfcrypto_internal_cipher_get_data_unit_initialization_vector(
+			     internal_cipher,
+			     initialization_vectors,
+			     initialization_vector_function,
+			     function_data,
+			     data_unit_number,
+			     data_unit_index,
+			     initialization_vector,
+			     &data_unit_initialization_vector,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+				 "%s: unable to retrieve initialization vector of data unit: %" PRIzd ".",
+				 function,
+				 data_unit_index );
+
+				return( -1 );
+			}
+			chaining_value = data_unit_initialization_vector;
+
+			for( block_offset = data_unit_offset;
+			     block_offset < ( data_unit_offset + data_unit_size );
+			     block_offset += internal_cipher->block_size )
+			{
+				for( block_index = 0;
+				     block_index < internal_cipher->block_size;
+				     block_index++ )
+				{
+					output_data[ data_offset + block_offset + block_index ] ^= chaining_value[ block_index ];
+				}
+				chaining_value = &( encrypted_data[ block_offset ] );
+			}
+			data_unit_index += 1;
+		}
+		data_offset += chunk_size;
+	}
+	return( 1 );
+}
+
+/* Runs a job that de- or encrypts data units using CBC
+ * Returns 1 if successful or -1 on error
+ */
+int libfcrypto_internal_cipher_crypt_cbc_data_units_job(
+     intptr_t *job,
+     libcerror_error_t **error )
+{
+	libfcrypto_internal_cipher_job_t *cipher_job = NULL;
+	static char *function                        = "libfcrypto_internal_cipher_crypt_cbc_data_units_job";
+
+	if( job == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid job.",
+		 function );
+
+		return( -1 );
+	}
+	cipher_job = (libfcrypto_internal_cipher_job_t *) job;
+
+	if( libfcrypto_internal_cipher_crypt_cbc_data_units(
+	     cipher_job->internal_cipher,
+	     cipher_job->mode,
+	     cipher_job->data_unit_number,
+	     cipher_job->data_unit_size,
+	     cipher_job->initialization_vectors,
+	     cipher_job->initialization_vector_function,
+	     cipher_job->function_data,
+	     cipher_job->input_data,
+	     cipher_job->output_data,
+	     cipher_job->data_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ENCRYPTION,
+		 LIBCERROR_ENCRYPTION_ERROR_GENERIC,
+		 "%s: unable to crypt data units.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* De- or encrypts consecutive data units (sectors) using CBC split over the threads of the thread pool
+ * Since every data unit has its own initialization vector both decryption and encryption are split
+ * The initialization vector function can be called from multiple threads at the same time
+ * The arguments are expected to be validated by the caller
+ * Returns 1 if successful or -1 on error
+ */
+int libfcrypto_internal_cipher_crypt_cbc_data_units_parallel(
+     libfcrypto_internal_cipher_t *internal_cipher,
+     int mode,
+     uint64_t data_unit_number,
+     size_t data_unit_size,
+     const uint8_t *initialization_vectors,
+     int (*initialization_vector_function)(
+            intptr_t *function_data,
+            uint64_t data_unit_number,
+            uint8_t *initialization_vector,
+            size_t initialization_vector_size,
+            libcerror_error_t **error ),
+     intptr_t *function_data,
+     const uint8_t *input_data,
+     uint8_t *output_data,
+     size_t data_size,
+     libcerror_error_t **error )
+{
+	libfcrypto_internal_cipher_job_t *jobs = NULL;
+	static char *function                  = "libfcrypto_internal_cipher_crypt_cbc_data_units_parallel";
+	size_t data_offset                     = 0;
+	size_t data_unit_index                 = 0;
+	size_t job_data_size                   = 0;
+	int job_index                          = 0;
+	int number_of_jobs                     = 1;
+
+	if( libfcrypto_internal_cipher_get_number_of_jobs(
+	     internal_cipher,
+	     data_size,
+	     data_unit_size,
+	     &number_of_jobs,
+	     &job_data_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to determine number of jobs.",
+		 function );
+
+		return( -1 );
+	}
+	if( number_of_jobs <= 1 )
+	{
+		return( libfcrypto_internal_cipher_crypt_cbc_data_units(
+		         internal_cipher,
+		         mode,
+		         data_unit_number,
+		         data_unit_size,
+		         initialization_vectors,
+		         initialization_vector_function,
+		         function_data,
+		         input_data,
+		         output_data,
+		         data_size,
+		         error ) );
+	}
+	jobs = (libfcrypto_internal_cipher_job_t *) memory_allocate(
+	                                             sizeof( libfcrypto_internal_cipher_job_t ) * number_of_jobs );
+
+	if( jobs == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create jobs.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     jobs,
+	     0,
+	     sizeof( libfcrypto_internal_cipher_job_t ) * number_of_jobs ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear jobs.",
+		 function );
+
+		goto on_error;
+	}
+	for( job_index = 0;
+	     job_index < number_of_jobs;
+	     job_index++ )
+	{
+		jobs[ job_index ].internal_cipher                = internal_cipher;
+		jobs[ job_index ].mode                           = mode;
+		jobs[ job_index ].data_unit_number               = data_unit_number + (uint64_t) data_unit_index;
+		jobs[ job_index ].data_unit_size                 = data_unit_size;
+		jobs[ job_index ].initialization_vector_function = initialization_vector_function;
+		jobs[ job_index ].function_data                  = function_data;
+		jobs[ job_index ].input_data                     = &( input_data[ data_offset ] );
+		jobs[ job_index ].output_data                    = &( output_data[ data_offset ] );
+		jobs[ job_index ].data_size                      = job_data_size;
+
+		if( initialization_vectors != NULL )
+		{
+			jobs[ job_index ].initialization_vectors = &( initialization_vectors[ data_unit_index * internal_cipher->block_size ] );
+		}
+		if( job_index == ( number_of_jobs - 1 ) )
+		{
+			jobs[ job_index ].data_size = data_size - data_offset;
+		}
+		data_offset     += job_data_size;
+		data_unit_index += job_data_size / data_unit_size;
+	}
+	if( libfcrypto_internal_thread_pool_run_jobs(
+	     internal_cipher->thread_pool,
+	     &libfcrypto_internal_cipher_crypt_cbc_data_units_job,
+	     (uint8_t *) jobs,
+	     sizeof( libfcrypto_internal_cipher_job_t ),
+	     number_of_jobs,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ENCRYPTION,
+		 LIBCERROR_ENCRYPTION_ERROR_GENERIC,
+		 "%s: unable to crypt data units.",
+		 function );
+
+		goto on_error;
+	}
+	memory_free(
+	 jobs );
+
+	return( 1 );
+
+on_error:
+	if( jobs != NULL )
+	{
+		memory_free(
+		 jobs );
+	}
+	return( -1 );
+}
+
+/* De- or encrypts consecutive data units (sectors) using CBC where every data unit has its own initialization vector
+ * The initialization vectors contain an initialization vector per data unit, if NULL the initialization vector
+ * function is used to generate the initialization vector from the data unit number, e.g. a plain sector number or ESSIV
+ * The data unit number is that of the first data unit
+ * The data unit size must be a multitude of the block size and the size a multitude of the data unit size
+ * On decryption the blocks of multiple data units are decrypted at once
+ * The input and output data can be the same buffer
+ * Returns 1 if successful or -1 on error
+ */
+int libfcrypto_cipher_crypt_cbc_data_units(
+     libfcrypto_cipher_t *cipher,
+     int mode,
+     uint64_t data_unit_number,
+     size_t data_unit_size,
+     const uint8_t *initialization_vectors,
+     size_t initialization_vectors_size,
+     int (*initialization_vector_function)(
+            intptr_t *function_data,
+            uint64_t data_unit_number,
+            uint8_t *initialization_vector,
+            size_t initialization_vector_size,
+            libcerror_error_t **error ),
+     intptr_t *function_data,
+     const uint8_t *input_data,
+     size_t input_data_size,
+     uint8_t *output_data,
+     size_t output_data_size,
+     libcerror_error_t **error )
+{
+	libfcrypto_internal_cipher_t *internal_cipher = NULL;
+	static char *function                         = "libfcrypto_cipher_crypt_cbc_data_units";
+	size_t number_of_data_units                   = 0;
+	int result                                    = 0;
+
+	if( cipher == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid cipher.",
+		 function );
+
+		return( -1 );
+	}
+	internal_cipher = (libfcrypto_internal_cipher_t *) cipher;
+
+	if( internal_cipher->mode != LIBFCRYPTO_CIPHER_MODE_CBC )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+		 "%s: invalid cipher - unsupported mode.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( mode != LIBFCRYPTO_CRYPT_MODE_DECRYPT )
+	 && ( mode != LIBFCRYPTO_CRYPT_MODE_ENCRYPT ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported mode.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( data_unit_size == 0 )
+	 || ( data_unit_size > (size_t) SSIZE_MAX )
+	 || ( ( data_unit_size % internal_cipher->block_size ) != 0 ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid data unit size value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( input_data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid input data.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( input_data_size > (size_t) SSIZE_MAX )
+	 || ( ( input_data_size % data_unit_size ) != 0 ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid input data size value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( output_data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid output data.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( output_data_size > (size_t) SSIZE_MAX )
+	 || ( output_data_size < input_data_size ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid output data size value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	number_of_data_units = input_data_size / data_unit_size;
+
+	if( initialization_vectors != NULL )
+	{
+		if( ( initialization_vectors_size / internal_cipher->block_size ) < number_of_data_units )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+			 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+			 "%s: invalid initialization vectors size value out of bounds.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	else if( initialization_vector_function == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid initialization vectors and initialization vector function.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_cipher->thread_pool != NULL )
+	{
+		result = libfcrypto_internal_cipher_crypt_cbc_data_units_parallel(
+		          internal_cipher,
+		          mode,
+		          data_unit_number,
+		          data_unit_size,
+		          initialization_vectors,
+		          initialization_vector_function,
+		          function_data,
+		          input_data,
+		          output_data,
+		          input_data_size,
+		          error );
+	}
+	else
+	{
+		result = libfcrypto_internal_cipher_crypt_cbc_data_units(
+		          internal_cipher,
+		          mode,
+		          data_unit_number,
+		          data_unit_size,
+		          initialization_vectors,
+		          initialization_vector_function,
+		          function_data,
+		          input_data,
+		          output_data,
+		          input_data_size,
+		          error );
+	}
+	if( result != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ENCRYPTION,
+		 LIBCERROR_ENCRYPTION_ERROR_GENERIC,
+		 "%s: unable to crypt data units.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* De- or encrypts multiple independent buffers of data using CBC each with its own initialization vector
+ * On encryption the blocks of the buffers are encrypted at once in turns, since CBC encryption
+ * of a single buffer is sequential
+ * The sizes of the data must be a multitude of the block size
+ * The input and output data can be the same buffer
+ * Returns 1 if successful or -1 on error
+ */
+int libfcrypto_cipher_crypt_cbc_multiple(
+     libfcrypto_cipher_t *cipher,
+     int mode,
+     const uint8_t **initialization_vectors,
+     size_t initialization_vector_size,
+     const uint8_t **input_data,
+     const size_t *input_data_sizes,
+     uint8_t **output_data,
+     const size_t *output_data_sizes,
+     int number_of_streams,
+     libcerror_error_t **error )
+{
+	uint8_t decrypted_data[ LIBFCRYPTO_CIPHER_MULTIPLE_BUFFER_SIZE ];
+	uint8_t encrypted_data[ LIBFCRYPTO_CIPHER_MULTIPLE_BUFFER_SIZE ];
+
+	libfcrypto_internal_cipher_t *internal_cipher = NULL;
+	const uint8_t *chaining_value                 = NULL;
+	static char *function                         = "libfcrypto_cipher_crypt_cbc_multiple";
+	size_t block_index                            = 0;
+	size_t block_offset                           = 0;
+	size_t buffer_offset                          = 0;
+	size_t data_size                              = 0;
+	size_t group_data_size                        = 0;
+	int first_stream_index                        = 0;
+	int last_stream_index                         = 0;
+	int maximum_number_of_streams                 = 0;
+	int stream_index                              = 0;
+
+	if( cipher == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid cipher.",
+		 function );
+
+		return( -1 );
+	}
+	internal_cipher = (libfcrypto_internal_cipher_t *) cipher;
+
+	if( internal_cipher->mode != LIBFCRYPTO_CIPHER_MODE_CBC )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+		 "%s: invalid cipher - unsupported mode.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( mode != LIBFCRYPTO_CRYPT_MODE_DECRYPT )
+	 && ( mode != LIBFCRYPTO_CRYPT_MODE_ENCRYPT ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported mode.",
+		 function );
+
+		return( -1 );
+	}
+	if( initialization_vectors == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid initialization vectors.",
+		 function );
+
+		return( -1 );
+	}
+	if( initialization_vector_size != internal_cipher->block_size )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid initialization vector size value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( input_data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid input data.",
+		 function );
+
+		return( -1 );
+	}
+	if( input_data_sizes == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid input data sizes.",
+		 function );
+
+		return( -1 );
+	}
+	if( output_data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid output data.",
+		 function );
+
+		return( -1 );
+	}
+	if( output_data_sizes == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid output data sizes.",
+		 function );
+
+		return( -1 );
+	}
+	if( number_of_streams < 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_LESS_THAN_ZERO,
+		 "%s: invalid number of streams value less than zero.",
+		 function );
+
+		return( -1 );
+	}
+	/* Validate all the streams before any data is processed
+	 */
+	for( stream_index = 0;
+	     stream_index < number_of_streams;
+	     stream_index++ )
+	{
+		if( initialization_vectors[ stream_index ] == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+			 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+			 "%s: invalid stream: %d initialization vector.",
+			 function,
+			 stream_index );
+
+			return( -1 );
+		}
+		if( input_data[ stream_index ] == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+			 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+			 "%s: invalid stream: %d input data.",
+			 function,
+			 stream_index );
+
+			return( -1 );
+		}
+		if( ( input_data_sizes[ stream_index ] > (size_t) SSIZE_MAX )
+		 || ( ( input_data_sizes[ stream_index ] % internal_cipher->block_size ) != 0 ) )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+			 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+			 "%s: invalid stream: %d input data size value out of bounds.",
+			 function,
+			 stream_index );
+
+			return( -1 );
+		}
+		if( output_data[ stream_index ] == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+			 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+			 "%s: invalid stream: %d output data.",
+			 function,
+			 stream_index );
+
+			return( -1 );
+		}
+		if( ( output_data_sizes[ stream_index ] > (size_t) SSIZE_MAX )
+		 || ( output_data_sizes[ stream_index ] < input_data_sizes[ stream_index ] ) )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+			 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+			 "%s: invalid stream: %d output data size value out of bounds.",
+			 function,
+			 stream_index );
+
+			return( -1 );
+		}
+	}
+	/* CBC decryption of a single buffer already decrypts multiple blocks at once
+	 */
+	if( mode == LIBFCRYPTO_CRYPT_MODE_DECRYPT )
+	{
+		for( stream_index = 0;
+		     stream_index < number_of_streams;
+		     stream_index++ )
+		{
+			if( input_data_sizes[ stream_index ] == 0 )
+			{
+				continue;
+			}
+			if( internal_cipher->crypt_function(
+			     internal_cipher->context,
+			     mode,
+			     initialization_vectors[ stream_index ],
+			     initialization_vector_size,
+			     input_data[ stream_index ],
+			     input_data_sizes[ stream_index ],
+			     output_data[ stream_index ],
+			     output_data_sizes[ stream_index ],
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_ENCRYPTION,
+				 LIBCERROR_ENCRYPTION_ERROR_DECRYPT_FAILED,
+				 "%s: unable to decrypt stream: %d data.",
+				 function,
+				 stream_index );
+
+				return( -1 );
+			}
+		}
+		return( 1 );
+	}
+	/* The streams are encrypted in groups where a block of every stream in the group
+	 * is encrypted at once, the chaining value of a stream is its previous encrypted block
+	 */
+	maximum_number_of_streams = (int) ( LIBFCRYPTO_CIPHER_MULTIPLE_BUFFER_SIZE / internal_cipher->block_size );
+
+	for( first_stream_index = 0;
+	     first_stream_index < number_of_streams;
+	     first_stream_index = last_stream_index )
+	{
+		last_stream_index = number_of_streams;
+
+		if( ( last_stream_index - first_stream_index ) > maximum_number_of_streams )
+		{
+			last_stream_index = first_stream_index + maximum_number_of_streams;
+		}
+		group_data_size = 0;
+
+		for( stream_index = first_stream_index;
+		     stream_index < last_stream_index;
+		     stream_index++ )
+		{
+			if( input_data_sizes[ stream_index ] > group_data_size )
+			{
+				group_data_size = input_data_sizes[ stream_index ];
+			}
+		}
+		for( block_offset = 0;
+		     block_offset < group_data_size;
+		     block_offset += internal_cipher->block_size )
+		{
+			buffer_offset = 0;
+
+			for( stream_index = first_stream_index;
+			     stream_index < last_stream_index;
+			     stream_index++ )
+			{
+				if( block_offset >= input_data_sizes[ stream_index ] )
+				{
+					continue;
+				}
+				if( block_offset == 0 )
+				{
+					chaining_value = initialization_vectors[ stream_index ];
+				}
+				else
+				{
+					chaining_value = &( ( output_data[ stream_index ] )[ block_offset - internal_cipher->block_size ] );
+				}
+				for( block_index = 0;
+				     block_index < internal_cipher->block_size;
+				     block_index++ )
+				{
+					decrypted_data[ buffer_offset++ ] = ( input_data[ stream_index ] )[ block_offset + block_index ] ^ chaining_value[ block_index ];
+				}
+			}
+			data_size = buffer_offset;
+
+			if( internal_cipher->ecb_crypt_function(
+			     internal_cipher->context,
+			     LIBFCRYPTO_CRYPT_MODE_ENCRYPT,
+			     NULL,
+			     0,
+			     decrypted_data,
+			     data_size,
+			     encrypted_data,
+			     data_size,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_ENCRYPTION,
+				 LIBCERROR_ENCRYPTION_ERROR_ENCRYPT_FAILED,
+				 "%s: unable to encrypt data.",
+				 function );
+
+				goto on_error;
+			}
+			buffer_offset = 0;
+
+			for( stream_index = first_stream_index;
+			     stream_index < last_stream_index;
+			     stream_index++ )
+			{
+				if( block_offset >= input_data_sizes[ stream_index ] )
+				{
+					continue;
+				}
+				if( memory_copy(
+				     &( ( output_data[ stream_index ] )[ block_offset ] ),
+				     &( encrypted_data[ buffer_offset ] ),
+				     internal_cipher->block_size ) == NULL )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_MEMORY,
+					 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+					 "%s: unable to copy encrypted data.",
+					 function );
+
+					goto on_error;
+				}
+				buffer_offset += internal_cipher->block_size;
+			}
+		}
+	}
+	if( memory_set(
+	     decrypted_data,
+	     0,
+	     LIBFCRYPTO_CIPHER_MULTIPLE_BUFFER_SIZE ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear decrypted data.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+
+on_error:
+	memory_set(
+	 decrypted_data,
+	 0,
+	 LIBFCRYPTO_CIPHER_MULTIPLE_BUFFER_SIZE );
+
+	return( -1 );
+}
+
+/* De- or encrypts data using Blowfish-CBC
+ * Returns 1 if successful or -1 on error
+ */
+int libfcrypto_internal_cipher_crypt_blowfish_cbc(
+     intptr_t *context,
+     int mode,
+     const uint8_t *initialization_vector,
+     size_t initialization_vector_size,
+     const uint8_t *input_data,
+     size_t input_data_size,
+     uint8_t *output_data,
+     size_t output_data_size,
+     libcerror_error_t **error )
+{
+	return( libfcrypto_blowfish_crypt_cbc(
+	         (libfcrypto_blowfish_context_t *) context,
+	         mode,
+	         initialization_vector,
+	         initialization_vector_size,
+	         input_data,
+	         input_data_size,
+	         output_data,
+	         output_data_size,
+	         error ) );
+}
+
+/* De- or encrypts data using Blowfish-CTR
+ * Returns 1 if successful or -1 on error
+ */
+int libfcrypto_internal_cipher_crypt_blowfish_ctr(
+     intptr_t *context,
+     int mode LIBFCRYPTO_ATTRIBUTE_UNUSED,
+     const uint8_t *initialization_vector,
+     size_t initialization_vector_size,
+     const uint8_t *input_data,
+     size_t input_data_size,
+     uint8_t *output_data,
+     size_t output_data_size,
+     libcerror_error_t **error )
+{
+	LIBFCRYPTO_UNREFERENCED_PARAMETER( mode )
+
+	return( libfcrypto_blowfish_crypt_ctr(
+	         (libfcrypto_blowfish_context_t *) context,
+	         initialization_vector,
+	         initialization_vector_size,
+	         8,
+	         LIBFCRYPTO_ENDIAN_BIG,
+	         0,
+	         input_data,
+	         input_data_size,
+	         output_data,
+	         output_data_size,
+	         error ) );
+}
+
+/* De- or encrypts data using Blowfish-ECB
+ * Returns 1 if successful or -1 on error
+ */
+int libfcrypto_internal_cipher_crypt_blowfish_ecb(
+     intptr_t *context,
+     int mode,
+     const uint8_t *initialization_vector LIBFCRYPTO_ATTRIBUTE_UNUSED,
+     size_t initialization_vector_size LIBFCRYPTO_ATTRIBUTE_UNUSED,
+     const uint8_t *input_data,
+     size_t input_data_size,
+     uint8_t *output_data,
+     size_t output_data_size,
+     libcerror_error_t **error )
+{
+	LIBFCRYPTO_UNREFERENCED_PARAMETER( initialization_vector )
+	LIBFCRYPTO_UNREFERENCED_PARAMETER( initialization_vector_size )
+
+	return( libfcrypto_blowfish_crypt_ecb(
+	         (libfcrypto_blowfish_context_t *) context,
+	         mode,
+	         input_data,
+	         input_data_size,
+	         output_data,
+	         output_data_size,
+	         error ) );
+}
+
+/* De- or encrypts data using DES3-CBC
+ * Returns 1 if successful or -1 on error
+ */
+int libfcrypto_internal_cipher_crypt_des3_cbc(
+     intptr_t *context,
+     int mode,
+     const uint8_t *initialization_vector,
+     size_t initialization_vector_size,
+     const uint8_t *input_data,
+     size_t input_data_size,
+     uint8_t *output_data,
+     size_t output_data_size,
+     libcerror_error_t **error )
+{
+	return( libfcrypto_des3_crypt_cbc(
+	         (libfcrypto_des3_context_t *) context,
+	         mode,
+	         initialization_vector,
+	         initialization_vector_size,
+	         input_data,
+	         input_data_size,
+	         output_data,
+	         output_data_size,
+	         error ) );
+}
+
+/* De- or encrypts data using DES3-CTR
+ * Returns 1 if successful or -1 on error
+ */
+int libfcrypto_internal_cipher_crypt_des3_ctr(
+     intptr_t *context,
+     int mode LIBFCRYPTO_ATTRIBUTE_UNUSED,
+     const uint8_t *initialization_vector,
+     size_t initialization_vector_size,
+     const uint8_t *input_data,
+     size_t input_data_size,
+     uint8_t *output_data,
+     size_t output_data_size,
+     libcerror_error_t **error )
+{
+	LIBFCRYPTO_UNREFERENCED_PARAMETER( mode )
+
+	return( libfcrypto_des3_crypt_ctr(
+	         (libfcrypto_des3_context_t *) context,
+	         initialization_vector,
+	         initialization_vector_size,
+	         8,
+	         LIBFCRYPTO_ENDIAN_BIG,
+	         0,
+	         input_data,
+	         input_data_size,
+	         output_data,
+	         output_data_size,
+	         error ) );
+}
+
+/* De- or encrypts data using DES3-ECB
+ * Returns 1 if successful or -1 on error
+ */
+int libfcrypto_internal_cipher_crypt_des3_ecb(
+     intptr_t *context,
+     int mode,
+     const uint8_t *initialization_vector LIBFCRYPTO_ATTRIBUTE_UNUSED,
+     size_t initialization_vector_size LIBFCRYPTO_ATTRIBUTE_UNUSED,
+     const uint8_t *input_data,
+     size_t input_data_size,
+     uint8_t *output_data,
+     size_t output_data_size,
+     libcerror_error_t **error )
+{
+	LIBFCRYPTO_UNREFERENCED_PARAMETER( initialization_vector )
+	LIBFCRYPTO_UNREFERENCED_PARAMETER( initialization_vector_size )
+
+	return( libfcrypto_des3_crypt_ecb(
+	         (libfcrypto_des3_context_t *) context,
+	         mode,
+	         input_data,
+	         input_data_size,
+	         output_data,
+	         output_data_size,
+	         error ) );
+}
+
+/* De- or encrypts data using RC4
+ * Returns 1 if successful or -1 on error
+ */
+int libfcrypto_internal_cipher_crypt_rc4_stream(
+     intptr_t *context,
+     int mode LIBFCRYPTO_ATTRIBUTE_UNUSED,
+     const uint8_t *initialization_vector LIBFCRYPTO_ATTRIBUTE_UNUSED,
+     size_t initialization_vector_size LIBFCRYPTO_ATTRIBUTE_UNUSED,
+     const uint8_t *input_data,
+     size_t input_data_size,
+     uint8_t *output_data,
+     size_t output_data_size,
+     libcerror_error_t **error )
+{
+	LIBFCRYPTO_UNREFERENCED_PARAMETER( mode )
+	LIBFCRYPTO_UNREFERENCED_PARAMETER( initialization_vector )
+	LIBFCRYPTO_UNREFERENCED_PARAMETER( initialization_vector_size )
+
+	return( libfcrypto_rc4_crypt(
+	         (libfcrypto_rc4_context_t *) context,
+	         input_data,
+	         input_data_size,
+	         output_data,
+	         output_data_size,
+	         error ) );
+}
+
+/* De- or encrypts data using Serpent-CBC
+ * Returns 1 if successful or -1 on error
+ */
+int libfcrypto_internal_cipher_crypt_serpent_cbc(
+     intptr_t *context,
+     int mode,
+     const uint8_t *initialization_vector,
+     size_t initialization_vector_size,
+     const uint8_t *input_data,
+     size_t input_data_size,
+     uint8_t *output_data,
+     size_t output_data_size,
+     libcerror_error_t **error )
+{
+	return( libfcrypto_serpent_crypt_cbc(
+	         (libfcrypto_serpent_context_t *) context,
+	         mode,
+	         initialization_vector,
+	         initialization_vector_size,
+	         input_data,
+	         input_data_size,
+	         output_data,
+	         output_data_size,
+	         error ) );
+}
+
+/* De- or encrypts data using Serpent-CTR
+ * Returns 1 if successful or -1 on error
+ */
+int libfcrypto_internal_cipher_crypt_serpent_ctr(
+     intptr_t *context,
+     int mode LIBFCRYPTO_ATTRIBUTE_UNUSED,
+     const uint8_t *initialization_vector,
+     size_t initialization_vector_size,
+     const uint8_t *input_data,
+     size_t input_data_size,
+     uint8_t *output_data,
+     size_t output_data_size,
+     libcerror_error_t **error )
+{
+	LIBFCRYPTO_UNREFERENCED_PARAMETER( mode )
+
+	return( libfcrypto_serpent_crypt_ctr(
+	         (libfcrypto_serpent_context_t *) context,
+	         initialization_vector,
+	         initialization_vector_size,
+	         16,
+	         LIBFCRYPTO_ENDIAN_BIG,
+	         0,
+	         input_data,
+	         input_data_size,
+	         output_data,
+	         output_data_size,
+	         error ) );
+}
+
+/* De- or encrypts data using Serpent-ECB
+ * Returns 1 if successful or -1 on error
+ */
+int libfcrypto_internal_cipher_crypt_serpent_ecb(
+     intptr_t *context,
+     int mode,
+     const uint8_t *initialization_vector LIBFCRYPTO_ATTRIBUTE_UNUSED,
+     size_t initialization_vector_size LIBFCRYPTO_ATTRIBUTE_UNUSED,
+     const uint8_t *input_data,
+     size_t input_data_size,
+     uint8_t *output_data,
+     size_t output_data_size,
+     libcerror_error_t **error )
+{
+	LIBFCRYPTO_UNREFERENCED_PARAMETER( initialization_vector )
+	LIBFCRYPTO_UNREFERENCED_PARAMETER( initialization_vector_size )
+
+	return( libfcrypto_serpent_crypt_ecb(
+	         (libfcrypto_serpent_context_t *) context,
+	         mode,
+	         input_data,
+	         input_data_size,
+	         output_data,
+	         output_data_size,
+	         error ) );
+}
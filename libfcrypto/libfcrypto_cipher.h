@@ -0,0 +1,456 @@
+/*
+ * Cipher functions
+ *
+ * Copyright (C) 2017-2024, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _LIBFCRYPTO_CIPHER_H )
+#define _LIBFCRYPTO_CIPHER_H
+
+#include <common.h>
+#include <types.h>
+
+#include "libfcrypto_extern.h"
+#include "libfcrypto_libcerror.h"
+#include "libfcrypto_thread_pool.h"
+#include "libfcrypto_types.h"
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+/* The size of the buffer used to decrypt multiple data units in-place
+ */
+#define LIBFCRYPTO_CIPHER_DATA_UNITS_BUFFER_SIZE	4096
+
+/* The size of the buffers used to encrypt the blocks of multiple streams at once
+ */
+#define LIBFCRYPTO_CIPHER_MULTIPLE_BUFFER_SIZE		4096
+
+typedef struct libfcrypto_internal_cipher libfcrypto_internal_cipher_t;
+
+struct libfcrypto_internal_cipher
+{
+	/* The algorithm
+	 */
+	int algorithm;
+
+	/* The (chaining) mode
+	 */
+	int mode;
+
+	/* The block size
+	 */
+	size_t block_size;
+
+	/* The algorithm specific context
+	 */
+	intptr_t *context;
+
+	/* The function that (de/en)crypts data using the algorithm and mode
+	 * which is selected when the cipher is created
+	 */
+	int (*crypt_function)(
+	       intptr_t *context,
+	       int mode,
+	       const uint8_t *initialization_vector,
+	       size_t initialization_vector_size,
+	       const uint8_t *input_data,
+	       size_t input_data_size,
+	       uint8_t *output_data,
+	       size_t output_data_size,
+	       libcerror_error_t **error );
+
+	/* The function that (de/en)crypts data using the algorithm in ECB mode
+	 * which is used to (de/en)crypt independent blocks at once
+	 * or NULL for a stream cipher
+	 */
+	int (*ecb_crypt_function)(
+	       intptr_t *context,
+	       int mode,
+	       const uint8_t *initialization_vector,
+	       size_t initialization_vector_size,
+	       const uint8_t *input_data,
+	       size_t input_data_size,
+	       uint8_t *output_data,
+	       size_t output_data_size,
+	       libcerror_error_t **error );
+
+	/* The thread pool that is used to (de/en)crypt large amounts of data in parallel
+	 * or NULL if not set
+	 */
+	libfcrypto_internal_thread_pool_t *thread_pool;
+
+	/* The minimum size of the data that is (de/en)crypted by a single thread
+	 */
+	size_t minimum_chunk_size;
+};
+
+typedef struct libfcrypto_internal_cipher_job libfcrypto_internal_cipher_job_t;
+
+struct libfcrypto_internal_cipher_job
+{
+	/* The cipher
+	 */
+	libfcrypto_internal_cipher_t *internal_cipher;
+
+	/* The crypt mode
+	 */
+	int mode;
+
+	/* The initialization vector, which for CBC is the encrypted block that precedes
+	 * the input data and for CTR the counter block of the first block of the input data
+	 */
+	uint8_t initialization_vector[ 16 ];
+
+	/* The data unit number of the first data unit
+	 */
+	uint64_t data_unit_number;
+
+	/* The data unit size
+	 */
+	size_t data_unit_size;
+
+	/* The initialization vectors of the data units
+	 */
+	const uint8_t *initialization_vectors;
+
+	/* The function that generates the initialization vector of a data unit
+	 */
+	int (*initialization_vector_function)(
+	       intptr_t *function_data,
+	       uint64_t data_unit_number,
+	       uint8_t *initialization_vector,
+	       size_t initialization_vector_size,
+	       libcerror_error_t **error );
+
+	/* The initialization vector function data
+	 */
+	intptr_t *function_data;
+
+	/* The input data
+	 */
+	const uint8_t *input_data;
+
+	/* The output data
+	 */
+	uint8_t *output_data;
+
+	/* The data size
+	 */
+	size_t data_size;
+};
+
+LIBFCRYPTO_EXTERN \
+int libfcrypto_cipher_initialize(
+     libfcrypto_cipher_t **cipher,
+     int algorithm,
+     int mode,
+     libcerror_error_t **error );
+
+LIBFCRYPTO_EXTERN \
+int libfcrypto_cipher_free(
+     libfcrypto_cipher_t **cipher,
+     libcerror_error_t **error );
+
+LIBFCRYPTO_EXTERN \
+int libfcrypto_cipher_set_key(
+     libfcrypto_cipher_t *cipher,
+     const uint8_t *key,
+     size_t key_bit_size,
+     libcerror_error_t **error );
+
+LIBFCRYPTO_EXTERN \
+int libfcrypto_cipher_get_block_size(
+     libfcrypto_cipher_t *cipher,
+     size_t *block_size,
+     libcerror_error_t **error );
+
+LIBFCRYPTO_EXTERN \
+int libfcrypto_cipher_set_thread_pool(
+     libfcrypto_cipher_t *cipher,
+     libfcrypto_thread_pool_t *thread_pool,
+     size_t minimum_chunk_size,
+     libcerror_error_t **error );
+
+int libfcrypto_internal_cipher_get_number_of_jobs(
+     libfcrypto_internal_cipher_t *internal_cipher,
+     size_t data_size,
+     size_t alignment_size,
+     int *number_of_jobs,
+     size_t *job_data_size,
+     libcerror_error_t **error );
+
+int libfcrypto_internal_cipher_crypt_job(
+     intptr_t *job,
+     libcerror_error_t **error );
+
+int libfcrypto_internal_cipher_crypt_parallel(
+     libfcrypto_internal_cipher_t *internal_cipher,
+     int mode,
+     const uint8_t *initialization_vector,
+     size_t initialization_vector_size,
+     const uint8_t *input_data,
+     size_t input_data_size,
+     uint8_t *output_data,
+     size_t output_data_size,
+     libcerror_error_t **error );
+
+LIBFCRYPTO_EXTERN \
+int libfcrypto_cipher_crypt(
+     libfcrypto_cipher_t *cipher,
+     int mode,
+     const uint8_t *initialization_vector,
+     size_t initialization_vector_size,
+     const uint8_t *input_data,
+     size_t input_data_size,
+     uint8_t *output_data,
+     size_t output_data_size,
+     libcerror_error_t **error );
+
+int libfcrypto_internal_cipher_crypt_chained(
+     libfcrypto_internal_cipher_t *internal_cipher,
+     int mode,
+     const uint8_t *initialization_vector,
+     uint8_t *chaining_value,
+     uint64_t block_number,
+     const uint8_t *input_data,
+     uint8_t *output_data,
+     size_t data_size,
+     libcerror_error_t **error );
+
+LIBFCRYPTO_EXTERN \
+int libfcrypto_cipher_crypt_segments(
+     libfcrypto_cipher_t *cipher,
+     int mode,
+     const uint8_t *initialization_vector,
+     size_t initialization_vector_size,
+     const uint8_t **input_segments,
+     const size_t *input_segment_sizes,
+     int number_of_input_segments,
+     uint8_t **output_segments,
+     const size_t *output_segment_sizes,
+     int number_of_output_segments,
+     libcerror_error_t **error );
+
+int libfcrypto_internal_cipher_get_data_unit_initialization_vector(
+     libfcrypto_internal_cipher_t *internal_cipher,
+     const uint8_t *initialization_vectors,
+     int (*initialization_vector_function)(
+            intptr_t *function_data,
+            uint64_t data_unit_number,
+            uint8_t *initialization_vector,
+            size_t initialization_vector_size,
+            libcerror_error_t **error ),
+     intptr_t *function_data,
+     uint64_t data_unit_number,
+     size_t data_unit_index,
+     uint8_t *initialization_vector,
+     const uint8_t **data_unit_initialization_vector,
+     libcerror_error_t **error );
+
+int libfcrypto_internal_cipher_crypt_cbc_data_units(
+     libfcrypto_internal_cipher_t *internal_cipher,
+     int mode,
+     uint64_t data_unit_number,
+     size_t data_unit_size,
+     const uint8_t *initialization_vectors,
+     int (*initialization_vector_function)(
+            intptr_t *function_data,
+            uint64_t data_unit_number,
+            uint8_t *initialization_vector,
+            size_t initialization_vector_size,
+            libcerror_error_t **error ),
+     intptr_t *function_data,
+     const uint8_t *input_data,
+     uint8_t *output_data,
+     size_t data_size,
+     libcerror_error_t **error );
+
+int libfcrypto_internal_cipher_crypt_cbc_data_units_job(
+     intptr_t *job,
+     libcerror_error_t **error );
+
+int libfcrypto_internal_cipher_crypt_cbc_data_units_parallel(
+     libfcrypto_internal_cipher_t *internal_cipher,
+     int mode,
+     uint64_t data_unit_number,
+     size_t data_unit_size,
+     const uint8_t *initialization_vectors,
+     int (*initialization_vector_function)(
+            intptr_t *function_data,
+            uint64_t data_unit_number,
+            uint8_t *initialization_vector,
+            size_t initialization_vector_size,
+            libcerror_error_t **error ),
+     intptr_t *function_data,
+     const uint8_t *input_data,
+     uint8_t *output_data,
+     size_t data_size,
+     libcerror_error_t **error );
+
+LIBFCRYPTO_EXTERN \
+int libfcrypto_cipher_crypt_cbc_data_units(
+     libfcrypto_cipher_t *cipher,
+     int mode,
+     uint64_t data_unit_number,
+     size_t data_unit_size,
+     const uint8_t *initialization_vectors,
+     size_t initialization_vectors_size,
+     int (*initialization_vector_function)(
+            intptr_t *function_data,
+            uint64_t data_unit_number,
+            uint8_t *initialization_vector,
+            size_t initialization_vector_size,
+            libcerror_error_t **error ),
+     intptr_t *function_data,
+     const uint8_t *input_data,
+     size_t input_data_size,
+     uint8_t *output_data,
+     size_t output_data_size,
+     libcerror_error_t **error );
+
+LIBFCRYPTO_EXTERN \
+int libfcrypto_cipher_crypt_cbc_multiple(
+     libfcrypto_cipher_t *cipher,
+     int mode,
+     const uint8_t **initialization_vectors,
+     size_t initialization_vector_size,
+     const uint8_t **input_data,
+     const size_t *input_data_sizes,
+     uint8_t **output_data,
+     const size_t *output_data_sizes,
+     int number_of_streams,
+     libcerror_error_t **error );
+
+int libfcrypto_internal_cipher_crypt_blowfish_cbc(
+     intptr_t *context,
+     int mode,
+     const uint8_t *initialization_vector,
+     size_t initialization_vector_size,
+     const uint8_t *input_data,
+     size_t input_data_size,
+     uint8_t *output_data,
+     size_t output_data_size,
+     libcerror_error_t **error );
+
+int libfcrypto_internal_cipher_crypt_blowfish_ctr(
+     intptr_t *context,
+     int mode,
+     const uint8_t *initialization_vector,
+     size_t initialization_vector_size,
+     const uint8_t *input_data,
+     size_t input_data_size,
+     uint8_t *output_data,
+     size_t output_data_size,
+     libcerror_error_t **error );
+
+int libfcrypto_internal_cipher_crypt_blowfish_ecb(
+     intptr_t *context,
+     int mode,
+     const uint8_t *initialization_vector,
+     size_t initialization_vector_size,
+     const uint8_t *input_data,
+     size_t input_data_size,
+     uint8_t *output_data,
+     size_t output_data_size,
+     libcerror_error_t **error );
+
+int libfcrypto_internal_cipher_crypt_des3_cbc(
+     intptr_t *context,
+     int mode,
+     const uint8_t *initialization_vector,
+     size_t initialization_vector_size,
+     const uint8_t *input_data,
+     size_t input_data_size,
+     uint8_t *output_data,
+     size_t output_data_size,
+     libcerror_error_t **error );
+
+int libfcrypto_internal_cipher_crypt_des3_ctr(
+     intptr_t *context,
+     int mode,
+     const uint8_t *initialization_vector,
+     size_t initialization_vector_size,
+     const uint8_t *input_data,
+     size_t input_data_size,
+     uint8_t *output_data,
+     size_t output_data_size,
+     libcerror_error_t **error );
+
+int libfcrypto_internal_cipher_crypt_des3_ecb(
+     intptr_t *context,
+     int mode,
+     const uint8_t *initialization_vector,
+     size_t initialization_vector_size,
+     const uint8_t *input_data,
+     size_t input_data_size,
+     uint8_t *output_data,
+     size_t output_data_size,
+     libcerror_error_t **error );
+
+int libfcrypto_internal_cipher_crypt_rc4_stream(
+     intptr_t *context,
+     int mode,
+     const uint8_t *initialization_vector,
+     size_t initialization_vector_size,
+     const uint8_t *input_data,
+     size_t input_data_size,
+     uint8_t *output_data,
+     size_t output_data_size,
+     libcerror_error_t **error );
+
+int libfcrypto_internal_cipher_crypt_serpent_cbc(
+     intptr_t *context,
+     int mode,
+     const uint8_t *initialization_vector,
+     size_t initialization_vector_size,
+     const uint8_t *input_data,
+     size_t input_data_size,
+     uint8_t *output_data,
+     size_t output_data_size,
+     libcerror_error_t **error );
+
+int libfcrypto_internal_cipher_crypt_serpent_ctr(
+     intptr_t *context,
+     int mode,
+     const uint8_t *initialization_vector,
+     size_t initialization_vector_size,
+     const uint8_t *input_data,
+     size_t input_data_size,
+     uint8_t *output_data,
+     size_t output_data_size,
+     libcerror_error_t **error );
+
+int libfcrypto_internal_cipher_crypt_serpent_ecb(
+     intptr_t *context,
+     int mode,
+     const uint8_t *initialization_vector,
+     size_t initialization_vector_size,
+     const uint8_t *input_data,
+     size_t input_data_size,
+     uint8_t *output_data,
+     size_t output_data_size,
+     libcerror_error_t **error );
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _LIBFCRYPTO_CIPHER_H ) */
+
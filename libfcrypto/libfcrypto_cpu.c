@@ -0,0 +1,281 @@
+/*
+ * CPU level functions
+ *
+ * Copyright (C) 2017-2024, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <narrow_string.h>
+#include <types.h>
+
+#if defined( HAVE_MULTI_THREAD_SUPPORT ) && defined( HAVE_PTHREAD_H ) && !defined( WINAPI )
+#include <pthread.h>
+#endif
+
+#include "libfcrypto_cpu.h"
+#include "libfcrypto_definitions.h"
+#include "libfcrypto_libcerror.h"
+
+#if defined( HAVE_MULTI_THREAD_SUPPORT ) && defined( HAVE_PTHREAD_H ) && !defined( WINAPI )
+#define LIBFCRYPTO_CPU_HAVE_PTHREAD	1
+#endif
+
+/* The CPU level that is used by contexts that are created, -1 if not yet determined
+ */
+static int libfcrypto_cpu_level = -1;
+
+#if defined( LIBFCRYPTO_CPU_HAVE_PTHREAD )
+
+/* Guard to determine the CPU level only once when contexts are created by multiple threads
+ */
+static pthread_once_t libfcrypto_cpu_level_once = PTHREAD_ONCE_INIT;
+
+#endif
+
+/* Determines the highest CPU level that is supported by both the CPU and the compiler
+ * Returns the CPU level
+ */
+int libfcrypto_cpu_get_supported_level(
+     void )
+{
+#if ( defined( __clang__ ) || ( defined( __GNUC__ ) && ( __GNUC__ >= 5 ) ) ) && ( defined( __i386__ ) || defined( __x86_64__ ) )
+	/* The CPU features are determined using the CPUID instruction
+	 */
+	__builtin_cpu_init();
+
+	if( ( __builtin_cpu_supports( "avx512f" ) )
+	 && ( __builtin_cpu_supports( "avx2" ) ) )
+	{
+		return( LIBFCRYPTO_CPU_LEVEL_AVX512 );
+	}
+	if( __builtin_cpu_supports( "avx2" ) )
+	{
+		return( LIBFCRYPTO_CPU_LEVEL_AVX2 );
+	}
+	if( __builtin_cpu_supports( "ssse3" ) )
+	{
+		return( LIBFCRYPTO_CPU_LEVEL_SSSE3 );
+	}
+	if( __builtin_cpu_supports( "sse2" ) )
+	{
+		return( LIBFCRYPTO_CPU_LEVEL_SSE2 );
+	}
+#endif
+	return( LIBFCRYPTO_CPU_LEVEL_SCALAR );
+}
+
+/* Determines the CPU level from a string
+ * The supported strings are: "scalar", "sse2", "ssse3", "avx2" and "avx512"
+ * Returns 1 if successful, 0 if the string is not supported or -1 on error
+ */
+int libfcrypto_cpu_get_level_from_string(
+     const char *string,
+     size_t string_length,
+     int *cpu_level,
+     libcerror_error_t **error )
+{
+	static char *function = "libfcrypto_cpu_get_level_from_string";
+
+	if( string == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid string.",
+		 function );
+
+		return( -1 );
+	}
+	if( string_length > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid string length value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( cpu_level == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid CPU level.",
+		 function );
+
+		return( -1 );
+	}
+	if( string_length == 4 )
+	{
+		if( narrow_string_compare(
+		     string,
+		     "avx2",
+		     4 ) == 0 )
+		{
+			*cpu_level = LIBFCRYPTO_CPU_LEVEL_AVX2;
+
+			return( 1 );
+		}
+		else if( narrow_string_compare(
+		          string,
+		          "sse2",
+		          4 ) == 0 )
+		{
+			*cpu_level = LIBFCRYPTO_CPU_LEVEL_SSE2;
+
+			return( 1 );
+		}
+	}
+	else if( string_length == 5 )
+	{
+		if( narrow_string_compare(
+		     string,
+		     "ssse3",
+		     5 ) == 0 )
+		{
+			*cpu_level = LIBFCRYPTO_CPU_LEVEL_SSSE3;
+
+			return( 1 );
+		}
+	}
+	else if( string_length == 6 )
+	{
+		if( narrow_string_compare(
+		     string,
+		     "avx512",
+		     6 ) == 0 )
+		{
+			*cpu_level = LIBFCRYPTO_CPU_LEVEL_AVX512;
+
+			return( 1 );
+		}
+		else if( narrow_string_compare(
+		          string,
+		          "scalar",
+		          6 ) == 0 )
+		{
+			*cpu_level = LIBFCRYPTO_CPU_LEVEL_SCALAR;
+
+			return( 1 );
+		}
+	}
+	return( 0 );
+}
+
+/* Determines the CPU level that is used by contexts that are created
+ * This is the supported CPU level unless a lower CPU level is forced
+ * by the LIBFCRYPTO_CPU_LEVEL environment variable
+ */
+void libfcrypto_cpu_determine_level(
+      void )
+{
+	const char *environment_value = NULL;
+	int cpu_level                 = 0;
+	int supported_cpu_level       = 0;
+
+	supported_cpu_level = libfcrypto_cpu_get_supported_level();
+
+#if defined( HAVE_GETENV ) || defined( WINAPI )
+	environment_value = getenv(
+	                     "LIBFCRYPTO_CPU_LEVEL" );
+#endif
+	if( environment_value != NULL )
+	{
+		if( libfcrypto_cpu_get_level_from_string(
+		     environment_value,
+		     narrow_string_length(
+		      environment_value ),
+		     &cpu_level,
+		     NULL ) == 1 )
+		{
+			if( cpu_level < supported_cpu_level )
+			{
+				supported_cpu_level = cpu_level;
+			}
+		}
+	}
+	libfcrypto_cpu_level = supported_cpu_level;
+}
+
+/* Retrieves the CPU level that is used by contexts that are created
+ * On first use the CPU level is determined once
+ * Returns the CPU level
+ */
+int libfcrypto_cpu_get_level(
+     void )
+{
+#if defined( LIBFCRYPTO_CPU_HAVE_PTHREAD )
+	pthread_once(
+	 &libfcrypto_cpu_level_once,
+	 &libfcrypto_cpu_determine_level );
+#else
+	if( libfcrypto_cpu_level == -1 )
+	{
+		libfcrypto_cpu_determine_level();
+	}
+#endif
+	return( libfcrypto_cpu_level );
+}
+
+/* Sets the CPU level that is used by contexts that are created
+ * Contexts that were created before keep using the functions of the previous CPU level
+ * This function must not be called while other threads use the library
+ * Returns 1 if successful or -1 on error
+ */
+int libfcrypto_cpu_set_level(
+     int cpu_level,
+     libcerror_error_t **error )
+{
+	static char *function = "libfcrypto_cpu_set_level";
+
+	if( ( cpu_level < LIBFCRYPTO_CPU_LEVEL_SCALAR )
+	 || ( cpu_level > LIBFCRYPTO_CPU_LEVEL_AVX512 ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported CPU level.",
+		 function );
+
+		return( -1 );
+	}
+	if( cpu_level > libfcrypto_cpu_get_supported_level() )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+		 "%s: CPU level not supported by CPU.",
+		 function );
+
+		return( -1 );
+	}
+	/* Make sure a later first use does not overwrite the CPU level
+	 */
+	libfcrypto_cpu_get_level();
+
+	libfcrypto_cpu_level = cpu_level;
+
+	return( 1 );
+}
+
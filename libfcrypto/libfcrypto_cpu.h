@@ -0,0 +1,59 @@
+/*
+ * CPU level functions
+ *
+ * Copyright (C) 2017-2024, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+
+#if !defined( _LIBFCRYPTO_CPU_H )
+#define _LIBFCRYPTO_CPU_H
+
+#include <common.h>
+#include <types.h>
+
+#include "libfcrypto_libcerror.h"
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+int libfcrypto_cpu_get_supported_level(
+     void );
+
+int libfcrypto_cpu_get_level_from_string(
+     const char *string,
+     size_t string_length,
+     int *cpu_level,
+     libcerror_error_t **error );
+
+void libfcrypto_cpu_determine_level(
+      void );
+
+int libfcrypto_cpu_get_level(
+     void );
+
+int libfcrypto_cpu_set_level(
+     int cpu_level,
+     libcerror_error_t **error );
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _LIBFCRYPTO_CPU_H ) */
+
@@ -0,0 +1,508 @@
+/*
+ * Counter (CTR) mode functions
+ *
+ * Copyright (C) 2017-2024, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <memory.h>
+#include <types.h>
+
+#include "libfcrypto_ctr.h"
+#include "libfcrypto_definitions.h"
+#include "libfcrypto_libcerror.h"
+
+/* Sets the counter block of a specific block number
+ * The counter block is the initial counter block with the block number added to its counter,
+ * where a big-endian counter is stored in the last counter size bytes of the block and
+ * a little-endian counter in the first counter size bytes. The counter wraps around without
+ * affecting the other bytes of the block
+ * Returns 1 if successful or -1 on error
+ */
+int libfcrypto_ctr_set_counter_block(
+     uint8_t *counter_block,
+     const uint8_t *initial_counter_block,
+     size_t block_size,
+     size_t counter_size,
+     int counter_byte_order,
+     uint64_t block_number,
+     libcerror_error_t **error )
+{
+	static char *function = "libfcrypto_ctr_set_counter_block";
+	size_t byte_index     = 0;
+	size_t counter_index  = 0;
+	uint16_t value_16bit  = 0;
+
+	if( counter_block == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid counter block.",
+		 function );
+
+		return( -1 );
+	}
+	if( initial_counter_block == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid initial counter block.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( block_size == 0 )
+	 || ( block_size > 16 ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid block size value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( counter_size == 0 )
+	 || ( counter_size > block_size ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid counter size value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( counter_byte_order != LIBFCRYPTO_ENDIAN_BIG )
+	 && ( counter_byte_order != LIBFCRYPTO_ENDIAN_LITTLE ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported counter byte order.",
+		 function );
+
+		return( -1 );
+	}
+	if( memory_copy(
+	     counter_block,
+	     initial_counter_block,
+	     block_size ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+		 "%s: unable to copy initial counter block.",
+		 function );
+
+		return( -1 );
+	}
+	for( counter_index = 0;
+	     counter_index < counter_size;
+	     counter_index++ )
+	{
+		if( counter_byte_order == LIBFCRYPTO_ENDIAN_BIG )
+		{
+			byte_index = block_size - 1 - counter_index;
+		}
+		else
+		{
+			byte_index = counter_index;
+		}
+		value_16bit += (uint16_t) counter_block[ byte_index ] + (uint16_t) ( block_number & 0xff );
+
+		counter_block[ byte_index ] = (uint8_t) ( value_16bit & 0xff );
+
+		value_16bit  >>= 8;
+		block_number >>= 8;
+	}
+	return( 1 );
+}
+
+/* Fills the counter blocks data with consecutive counter blocks, starting with the counter block
+ * The counter block is updated to the counter block that follows the last one
+ * The counter blocks data size must be a multitude of the block size
+ * Returns 1 if successful or -1 on error
+ */
+int libfcrypto_ctr_fill_counter_blocks(
+     uint8_t *counter_block,
+     size_t block_size,
+     size_t counter_size,
+     int counter_byte_order,
+     uint8_t *counter_blocks_data,
+     size_t counter_blocks_data_size,
+     libcerror_error_t **error )
+{
+	static char *function = "libfcrypto_ctr_fill_counter_blocks";
+	size_t byte_index     = 0;
+	size_t counter_index  = 0;
+	size_t data_offset    = 0;
+
+	if( counter_block == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid counter block.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( block_size == 0 )
+	 || ( block_size > 16 ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid block size value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( counter_size == 0 )
+	 || ( counter_size > block_size ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid counter size value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( counter_byte_order != LIBFCRYPTO_ENDIAN_BIG )
+	 && ( counter_byte_order != LIBFCRYPTO_ENDIAN_LITTLE ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported counter byte order.",
+		 function );
+
+		return( -1 );
+	}
+	if( counter_blocks_data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid counter blocks data.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( ( counter_blocks_data_size % block_size ) != 0 )
+	 || ( counter_blocks_data_size > (size_t) SSIZE_MAX ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid counter blocks data size value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	for( data_offset = 0;
+	     data_offset < counter_blocks_data_size;
+	     data_offset += block_size )
+	{
+		if( memory_copy(
+		     &( counter_blocks_data[ data_offset ] ),
+		     counter_block,
+		     block_size ) == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+			 "%s: unable to copy counter block.",
+			 function );
+
+			return( -1 );
+		}
+		/* Increment the counter, where the carry stops at the first byte that does not overflow
+		 */
+		for( counter_index = 0;
+		     counter_index < counter_size;
+		     counter_index++ )
+		{
+			if( counter_byte_order == LIBFCRYPTO_ENDIAN_BIG )
+			{
+				byte_index = block_size - 1 - counter_index;
+			}
+			else
+			{
+				byte_index = counter_index;
+			}
+			counter_block[ byte_index ] += 1;
+
+			if( counter_block[ byte_index ] != 0 )
+			{
+				break;
+			}
+		}
+	}
+	return( 1 );
+}
+
+/* De- or encrypts data using CTR (Counter) mode of a block cipher
+ * The key stream is the encryption of consecutive counter blocks, that start with the initial counter block,
+ * where the encrypt blocks function encrypts the counter blocks using the block cipher context
+ * The offset is the byte offset of the input data relative to the start of the key stream
+ * Returns 1 if successful or -1 on error
+ */
+int libfcrypto_ctr_crypt(
+     intptr_t *context,
+     int (*encrypt_blocks_function)(
+            intptr_t *context,
+            const uint8_t *input_data,
+            size_t input_data_size,
+            uint8_t *output_data,
+            size_t output_data_size,
+            libcerror_error_t **error ),
+     size_t block_size,
+     const uint8_t *initial_counter_block,
+     size_t counter_size,
+     int counter_byte_order,
+     uint64_t offset,
+     const uint8_t *input_data,
+     size_t input_data_size,
+     uint8_t *output_data,
+     size_t output_data_size,
+     libcerror_error_t **error )
+{
+	uint8_t counter_block[ 16 ];
+	uint8_t key_stream_data[ LIBFCRYPTO_CTR_KEY_STREAM_BUFFER_SIZE ];
+
+	static char *function         = "libfcrypto_ctr_crypt";
+	size_t data_offset            = 0;
+	size_t key_stream_data_offset = 0;
+	size_t key_stream_data_size   = 0;
+
+	if( context == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid context.",
+		 function );
+
+		return( -1 );
+	}
+	if( encrypt_blocks_function == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid encrypt blocks function.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( block_size == 0 )
+	 || ( block_size > 16 )
+	 || ( ( LIBFCRYPTO_CTR_KEY_STREAM_BUFFER_SIZE % block_size ) != 0 ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid block size value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( initial_counter_block == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid initial counter block.",
+		 function );
+
+		return( -1 );
+	}
+	if( input_data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid input data.",
+		 function );
+
+		return( -1 );
+	}
+	if( input_data_size > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid input data size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( output_data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid output data.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( output_data_size < input_data_size )
+	 || ( output_data_size > (size_t) SSIZE_MAX ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid output data size value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( libfcrypto_ctr_set_counter_block(
+	     counter_block,
+	     initial_counter_block,
+	     block_size,
+	     counter_size,
+	     counter_byte_order,
+	     offset / block_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to set counter block.",
+		 function );
+
+		goto on_error;
+	}
+	/* The key stream of the first block is used starting at the offset within the block
+	 */
+	key_stream_data_offset = (size_t) ( offset % block_size );
+
+	while( data_offset < input_data_size )
+	{
+		/* The counter blocks are encrypted together so that the multi-block functions can be used
+		 */
+		key_stream_data_size = key_stream_data_offset + ( input_data_size - data_offset );
+
+		if( key_stream_data_size > LIBFCRYPTO_CTR_KEY_STREAM_BUFFER_SIZE )
+		{
+			key_stream_data_size = LIBFCRYPTO_CTR_KEY_STREAM_BUFFER_SIZE;
+		}
+		else if( ( key_stream_data_size % block_size ) != 0 )
+		{
+			key_stream_data_size += block_size - ( key_stream_data_size % block_size );
+		}
+		if( libfcrypto_ctr_fill_counter_blocks(
+		     counter_block,
+		     block_size,
+		     counter_size,
+		     counter_byte_order,
+		     key_stream_data,
+		     key_stream_data_size,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to fill counter blocks.",
+			 function );
+
+			goto on_error;
+		}
+		if( encrypt_blocks_function(
+		     context,
+		     key_stream_data,
+		     key_stream_data_size,
+		     key_stream_data,
+		     key_stream_data_size,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_ENCRYPTION,
+			 LIBCERROR_ENCRYPTION_ERROR_GENERIC,
+			 "%s: unable to encrypt counter blocks.",
+			 function );
+
+			goto on_error;
+		}
+		while( ( key_stream_data_offset < key_stream_data_size )
+		    && ( data_offset < input_data_size ) )
+		{
+			output_data[ data_offset ] = input_data[ data_offset ] ^ key_stream_data[ key_stream_data_offset ];
+
+			data_offset++;
+			key_stream_data_offset++;
+		}
+		key_stream_data_offset = 0;
+	}
+	memory_set(
+	 counter_block,
+	 0,
+	 16 );
+
+	memory_set(
+	 key_stream_data,
+	 0,
+	 LIBFCRYPTO_CTR_KEY_STREAM_BUFFER_SIZE );
+
+	return( 1 );
+
+on_error:
+	memory_set(
+	 counter_block,
+	 0,
+	 16 );
+
+	memory_set(
+	 key_stream_data,
+	 0,
+	 LIBFCRYPTO_CTR_KEY_STREAM_BUFFER_SIZE );
+
+	return( -1 );
+}
+
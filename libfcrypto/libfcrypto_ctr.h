@@ -0,0 +1,82 @@
+/*
+ * Counter (CTR) mode functions
+ *
+ * Copyright (C) 2017-2024, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+
+#if !defined( _LIBFCRYPTO_CTR_H )
+#define _LIBFCRYPTO_CTR_H
+
+#include <common.h>
+#include <types.h>
+
+#include "libfcrypto_libcerror.h"
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+/* The size of the buffer of counter blocks that are encrypted at once
+ */
+#define LIBFCRYPTO_CTR_KEY_STREAM_BUFFER_SIZE	2048
+
+int libfcrypto_ctr_set_counter_block(
+     uint8_t *counter_block,
+     const uint8_t *initial_counter_block,
+     size_t block_size,
+     size_t counter_size,
+     int counter_byte_order,
+     uint64_t block_number,
+     libcerror_error_t **error );
+
+int libfcrypto_ctr_fill_counter_blocks(
+     uint8_t *counter_block,
+     size_t block_size,
+     size_t counter_size,
+     int counter_byte_order,
+     uint8_t *counter_blocks_data,
+     size_t counter_blocks_data_size,
+     libcerror_error_t **error );
+
+int libfcrypto_ctr_crypt(
+     intptr_t *context,
+     int (*encrypt_blocks_function)(
+            intptr_t *context,
+            const uint8_t *input_data,
+            size_t input_data_size,
+            uint8_t *output_data,
+            size_t output_data_size,
+            libcerror_error_t **error ),
+     size_t block_size,
+     const uint8_t *initial_counter_block,
+     size_t counter_size,
+     int counter_byte_order,
+     uint64_t offset,
+     const uint8_t *input_data,
+     size_t input_data_size,
+     uint8_t *output_data,
+     size_t output_data_size,
+     libcerror_error_t **error );
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _LIBFCRYPTO_CTR_H ) */
+
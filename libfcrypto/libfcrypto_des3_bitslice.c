@@ -0,0 +1,1574 @@
+/*
+ * Bitsliced DES3 (de/en)crypt functions
+ *
+ * Copyright (C) 2017-2024, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <memory.h>
+#include <types.h>
+
+#include "libfcrypto_des3_bitslice.h"
+#include "libfcrypto_des3_context.h"
+#include "libfcrypto_definitions.h"
+#include "libfcrypto_libcerror.h"
+
+/* In the bitsliced representation slice N contains bit N of the DES block,
+ * where bit 0 is the most significant bit, of 64 blocks. Every boolean
+ * operation on a slice therefore operates on 64 blocks at once, the
+ * permutations (IP, FP, E and P) become a renaming of slices and the
+ * substitution boxes (S-boxes) are evaluated as boolean circuits without
+ * any data dependent memory access.
+ */
+
+#if defined( LIBFCRYPTO_DES3_BITSLICE_HAVE_AVX2 )
+
+/* A vector of 4 slices, that represents 256 blocks
+ */
+typedef uint64_t libfcrypto_des3_bitslice_vector_t __attribute__ (( vector_size( 32 ) ));
+
+#endif /* defined( LIBFCRYPTO_DES3_BITSLICE_HAVE_AVX2 ) */
+
+/* Retrieves a slice mask of the bit of the sub key
+ */
+#define libfcrypto_des3_bitslice_get_key_mask( sub_key, bit_index ) \
+	( (uint64_t) 0 - ( ( ( sub_key ) >> ( bit_index ) ) & 1 ) )
+
+/* The substitution-boxes (S-boxes) as boolean circuits, where input0 is the
+ * most significant input bit and the outputs are XOR-ed with output0 as the
+ * most significant output bit
+ */
+#define libfcrypto_des3_bitslice_calculate_substitution1( slice_type, input0, input1, input2, input3, input4, input5, output0, output1, output2, output3 ) \
+	{ \
+		slice_type value0, value1, value2, value3, value4, value5, value6, value7; \
+		slice_type value8, value9, value10, value11, value12, value13, value14, value15; \
+		slice_type value16, value17, value18; \
+		value0 = input1 ^ input4; \
+		value1 = ~value0; \
+		value2 = value1 ^ input4; \
+		value3 = value2 & input2; \
+		value4 = value1 ^ value3; \
+		value5 = input4 & input2; \
+		value6 = value1 ^ value5; \
+		value6 ^= value4; \
+		value6 &= input3; \
+		value6 ^= value4; \
+		value7 = ~input4; \
+		value8 = value0 ^ value3; \
+		value9 = value7 & input2; \
+		value10 = input1 ^ value9; \
+		value11 = value8 ^ value10; \
+		value11 &= input3; \
+		value11 ^= value8; \
+		value11 ^= value6; \
+		value11 &= input5; \
+		value6 ^= value11; \
+		value11 = input1 & input4; \
+		value12 = ~value11; \
+		value13 = input4 & value2; \
+		value14 = value12 ^ value9; \
+		value15 = value10 ^ value14; \
+		value16 = value15 & input3; \
+		value10 ^= value16; \
+		value17 = value15 ^ value0; \
+		value18 = value17 & input2; \
+		value15 ^= value18; \
+		value11 ^= value1; \
+		value11 &= input2; \
+		value11 ^= value1; \
+		value11 ^= value15; \
+		value11 &= input3; \
+		value11 ^= value15; \
+		value11 ^= value10; \
+		value11 &= input5; \
+		value10 ^= value11; \
+		value10 ^= value6; \
+		value10 &= input0; \
+		value6 ^= value10; \
+		value2 ^= value9; \
+		value9 ^= value17; \
+		value10 = value2 ^ value9; \
+		value11 = value10 & input3; \
+		value2 ^= value11; \
+		value3 ^= input4; \
+		value0 &= input2; \
+		value0 ^= value12; \
+		value9 &= input3; \
+		value3 ^= value9; \
+		value3 ^= value2; \
+		value3 &= input5; \
+		value2 ^= value3; \
+		value3 = value10 & input2; \
+		value9 = value17 ^ value3; \
+		value7 &= input1; \
+		value11 = value1 ^ value18; \
+		value15 = value9 ^ value11; \
+		value15 &= input3; \
+		value15 ^= value9; \
+		value0 ^= input3; \
+		value0 ^= value15; \
+		value0 &= input5; \
+		value0 ^= value15; \
+		value0 ^= value2; \
+		value0 &= input0; \
+		value0 ^= value2; \
+		value2 = value4 & input3; \
+		value2 ^= value9; \
+		value4 = value10 ^ value18; \
+		value9 = value12 & input3; \
+		value4 ^= value9; \
+		value4 ^= value2; \
+		value4 &= input5; \
+		value2 ^= value4; \
+		value4 = value7 ^ value5; \
+		value7 = value17 & input3; \
+		value7 ^= value4; \
+		value10 = value14 & input3; \
+		value10 ^= value11; \
+		value10 ^= value7; \
+		value10 &= input5; \
+		value7 ^= value10; \
+		value7 ^= value2; \
+		value7 &= input0; \
+		value2 ^= value7; \
+		value4 ^= value9; \
+		value3 ^= value13; \
+		value3 ^= value16; \
+		value3 ^= value4; \
+		value3 &= input5; \
+		value3 ^= value4; \
+		value4 = input1 ^ value5; \
+		value4 ^= value8; \
+		value4 &= input3; \
+		value4 ^= value8; \
+		value5 = value17 ^ input2; \
+		value1 &= input3; \
+		value1 ^= value5; \
+		value1 ^= value4; \
+		value1 &= input5; \
+		value1 ^= value4; \
+		value1 ^= value3; \
+		value1 &= input0; \
+		value1 ^= value3; \
+		output0 ^= value6; \
+		output1 ^= value0; \
+		output2 ^= value2; \
+		output3 ^= value1; \
+	}
+
+
+#define libfcrypto_des3_bitslice_calculate_substitution2( slice_type, input0, input1, input2, input3, input4, input5, output0, output1, output2, output3 ) \
+	{ \
+		slice_type value0, value1, value2, value3, value4, value5, value6, value7; \
+		slice_type value8, value9, value10, value11, value12, value13, value14, value15; \
+		slice_type value16, value17, value18; \
+		value0 = input0 ^ input4; \
+		value1 = ~value0; \
+		value2 = input0 & ~input4; \
+		value3 = ~value2; \
+		value4 = value3 ^ value0; \
+		value5 = value4 & input1; \
+		value6 = value3 ^ value5; \
+		value6 ^= value1; \
+		value6 &= input3; \
+		value7 = value1 ^ value6; \
+		value8 = ~input4; \
+		value9 = value0 ^ value8; \
+		value10 = value9 & input1; \
+		value11 = value0 ^ value10; \
+		value12 = value2 ^ input4; \
+		value13 = value12 & input1; \
+		value14 = value2 ^ value13; \
+		value6 ^= value11; \
+		value6 ^= value7; \
+		value6 &= input2; \
+		value6 ^= value7; \
+		value3 &= input1; \
+		value7 = value12 ^ value3; \
+		value11 = value7 ^ value14; \
+		value11 &= input3; \
+		value7 ^= value11; \
+		value14 = input4 & value9; \
+		value3 ^= value1; \
+		value11 ^= value3; \
+		value11 ^= value7; \
+		value15 = value11 & input2; \
+		value7 ^= value15; \
+		value7 ^= value6; \
+		value7 &= input5; \
+		value6 ^= value7; \
+		value7 = value1 ^ input1; \
+		value15 = value0 ^ value12; \
+		value15 &= input1; \
+		value16 = value0 ^ value15; \
+		value16 ^= value7; \
+		value16 &= input3; \
+		value7 ^= value16; \
+		value17 = ~value12; \
+		value15 ^= value1; \
+		value18 = value0 ^ input1; \
+		value15 ^= value16; \
+		value15 ^= value7; \
+		value16 = value15 & input2; \
+		value7 ^= value16; \
+		value8 &= input3; \
+		value8 ^= value18; \
+		value1 ^= input3; \
+		value1 ^= value8; \
+		value1 &= input2; \
+		value1 ^= value8; \
+		value1 ^= value7; \
+		value1 &= input5; \
+		value1 ^= value7; \
+		value7 = value12 ^ value15; \
+		value7 ^= value3; \
+		value7 &= input3; \
+		value3 ^= value7; \
+		value7 = value11 ^ input1; \
+		value8 = value0 & input3; \
+		value7 ^= value8; \
+		value7 ^= value3; \
+		value7 &= input2; \
+		value3 ^= value7; \
+		value5 ^= value17; \
+		value0 ^= value5; \
+		value0 &= input3; \
+		value0 ^= value5; \
+		value5 = ~value13; \
+		value7 = input4 ^ input1; \
+		value8 = value5 ^ value7; \
+		value8 &= input3; \
+		value5 ^= value8; \
+		value5 ^= value0; \
+		value5 &= input2; \
+		value0 ^= value5; \
+		value0 ^= value3; \
+		value0 &= input5; \
+		value0 ^= value3; \
+		value2 &= input1; \
+		value2 ^= value9; \
+		value3 = input0 ^ value13; \
+		value3 ^= value2; \
+		value3 &= input3; \
+		value2 ^= value3; \
+		value5 = value14 ^ value13; \
+		value3 ^= value5; \
+		value3 ^= value2; \
+		value3 &= input2; \
+		value2 ^= value3; \
+		value3 = value11 ^ value10; \
+		value5 = value3 ^ value7; \
+		value5 &= input3; \
+		value3 ^= value5; \
+		value4 ^= value15; \
+		value4 ^= value5; \
+		value4 ^= value3; \
+		value4 &= input2; \
+		value3 ^= value4; \
+		value3 ^= value2; \
+		value3 &= input5; \
+		value2 ^= value3; \
+		output0 ^= value6; \
+		output1 ^= value1; \
+		output2 ^= value0; \
+		output3 ^= value2; \
+	}
+
+
+#define libfcrypto_des3_bitslice_calculate_substitution3( slice_type, input0, input1, input2, input3, input4, input5, output0, output1, output2, output3 ) \
+	{ \
+		slice_type value0, value1, value2, value3, value4, value5, value6, value7; \
+		slice_type value8, value9, value10, value11, value12, value13, value14, value15; \
+		slice_type value16; \
+		value0 = ~input4; \
+		value1 = value0 ^ input1; \
+		value2 = input4 & ~input5; \
+		value3 = ~value2; \
+		value4 = value3 & input1; \
+		value5 = value1 ^ value4; \
+		value5 &= input2; \
+		value1 ^= value5; \
+		value5 = input5 & value0; \
+		value6 = ~value5; \
+		value7 = input4 ^ input5; \
+		value8 = ~value7; \
+		value9 = value2 & input1; \
+		value9 ^= value6; \
+		value10 = value8 ^ input1; \
+		value11 = value9 ^ value10; \
+		value12 = value11 & input2; \
+		value9 ^= value12; \
+		value9 ^= value1; \
+		value9 &= input3; \
+		value1 ^= value9; \
+		value9 = value8 ^ value12; \
+		value9 ^= input3; \
+		value9 ^= value1; \
+		value9 &= input0; \
+		value1 ^= value9; \
+		value9 = input5 ^ value2; \
+		value9 &= input1; \
+		value12 = input5 ^ value9; \
+		value10 ^= value12; \
+		value10 &= input2; \
+		value10 ^= value12; \
+		value12 = input4 & input5; \
+		value13 = ~value12; \
+		value5 ^= value13; \
+		value14 = value5 & input1; \
+		value15 = value13 ^ value14; \
+		value15 ^= value11; \
+		value16 = value15 & input2; \
+		value11 ^= value16; \
+		value11 ^= value10; \
+		value11 &= input3; \
+		value10 ^= value11; \
+		value5 ^= input1; \
+		value11 = value0 & input2; \
+		value5 ^= value11; \
+		value11 = value0 ^ value14; \
+		value3 &= input2; \
+		value3 ^= value11; \
+		value3 ^= value5; \
+		value3 &= input3; \
+		value3 ^= value5; \
+		value3 ^= value10; \
+		value3 &= input0; \
+		value3 ^= value10; \
+		value5 = value8 ^ value4; \
+		value10 = value13 ^ value9; \
+		value10 ^= value5; \
+		value10 &= input2; \
+		value5 ^= value10; \
+		value10 = value12 & input1; \
+		value2 ^= value10; \
+		value2 ^= input2; \
+		value2 ^= value5; \
+		value2 &= input3; \
+		value2 ^= value5; \
+		value5 = input4 ^ value14; \
+		value10 = value5 ^ value7; \
+		value10 &= input2; \
+		value5 ^= value10; \
+		value10 = value8 ^ value9; \
+		value10 ^= value4; \
+		value10 &= input2; \
+		value4 ^= value10; \
+		value4 ^= value5; \
+		value4 &= input3; \
+		value4 ^= value5; \
+		value4 ^= value2; \
+		value4 &= input0; \
+		value2 ^= value4; \
+		value4 = input5 ^ input1; \
+		value5 = input4 & input2; \
+		value4 ^= value5; \
+		value0 &= input3; \
+		value0 ^= value4; \
+		value4 = value13 & input1; \
+		value4 ^= input4; \
+		value4 ^= value15; \
+		value4 &= input2; \
+		value4 ^= value15; \
+		value5 = value7 ^ value9; \
+		value6 &= input1; \
+		value6 ^= value8; \
+		value6 ^= value5; \
+		value6 &= input2; \
+		value5 ^= value6; \
+		value5 ^= value4; \
+		value5 &= input3; \
+		value4 ^= value5; \
+		value4 ^= value0; \
+		value4 &= input0; \
+		value0 ^= value4; \
+		output0 ^= value1; \
+		output1 ^= value3; \
+		output2 ^= value2; \
+		output3 ^= value0; \
+	}
+
+
+#define libfcrypto_des3_bitslice_calculate_substitution4( slice_type, input0, input1, input2, input3, input4, input5, output0, output1, output2, output3 ) \
+	{ \
+		slice_type value0, value1, value2, value3, value4, value5, value6, value7; \
+		slice_type value8, value9, value10, value11, value12, value13, value14, value15; \
+		value0 = input2 ^ input3; \
+		value1 = ~value0; \
+		value2 = input3 ^ value1; \
+		value3 = value2 & input4; \
+		value4 = input3 ^ value3; \
+		value5 = input3 & input4; \
+		value5 ^= value0; \
+		value6 = value4 ^ value5; \
+		value6 &= input1; \
+		value4 ^= value6; \
+		value7 = input2 & input3; \
+		value7 = ~value7; \
+		value8 = value7 ^ input2; \
+		value9 = value8 & input4; \
+		value10 = value7 ^ value9; \
+		value11 = input3 & value2; \
+		value9 ^= value1; \
+		value9 ^= value10; \
+		value9 &= input1; \
+		value9 ^= value10; \
+		value9 ^= value4; \
+		value9 &= input0; \
+		value4 ^= value9; \
+		value10 = ~input3; \
+		value0 &= input4; \
+		value12 = value2 ^ value0; \
+		value8 &= input1; \
+		value8 ^= value12; \
+		value12 = value10 & input4; \
+		value13 = input2 ^ value12; \
+		value14 = value10 ^ input4; \
+		value14 ^= value13; \
+		value15 = value14 & input1; \
+		value15 ^= value13; \
+		value15 ^= value8; \
+		value15 &= input0; \
+		value8 ^= value15; \
+		value15 = value4 ^ value8; \
+		value15 &= input5; \
+		value4 ^= value15; \
+		value3 ^= value10; \
+		value3 ^= value6; \
+		value6 = ~value11; \
+		value3 ^= value9; \
+		value3 ^= value8; \
+		value3 &= input5; \
+		value3 ^= value8; \
+		value8 = value6 & input4; \
+		value8 ^= value2; \
+		value7 &= input1; \
+		value7 ^= value8; \
+		value8 = input2 & input4; \
+		value1 ^= value8; \
+		value2 ^= value12; \
+		value2 ^= value1; \
+		value2 &= input1; \
+		value1 ^= value2; \
+		value1 ^= value7; \
+		value1 &= input0; \
+		value1 ^= value7; \
+		value2 = value13 & input1; \
+		value5 ^= value2; \
+		value0 ^= value10; \
+		value6 &= input1; \
+		value0 ^= value6; \
+		value0 ^= value5; \
+		value0 &= input0; \
+		value5 ^= value0; \
+		value5 ^= value1; \
+		value5 &= input5; \
+		value5 ^= value1; \
+		value2 ^= value14; \
+		value0 ^= value2; \
+		value1 ^= value0; \
+		value1 &= input5; \
+		value0 ^= value1; \
+		output0 ^= value4; \
+		output1 ^= value3; \
+		output2 ^= value5; \
+		output3 ^= value0; \
+	}
+
+
+#define libfcrypto_des3_bitslice_calculate_substitution5( slice_type, input0, input1, input2, input3, input4, input5, output0, output1, output2, output3 ) \
+	{ \
+		slice_type value0, value1, value2, value3, value4, value5, value6, value7; \
+		slice_type value8, value9, value10, value11, value12, value13, value14, value15; \
+		slice_type value16, value17; \
+		value0 = input1 ^ input4; \
+		value1 = input4 & input0; \
+		value1 ^= value0; \
+		value2 = ~input1; \
+		value3 = value0 ^ value2; \
+		value4 = value3 & input0; \
+		value5 = input0 & input2; \
+		value1 ^= value5; \
+		value5 = input1 & value3; \
+		value6 = ~value5; \
+		value7 = value2 ^ value6; \
+		value8 = value7 & input0; \
+		value9 = value2 ^ value8; \
+		value10 = value7 ^ value0; \
+		value11 = value10 & input0; \
+		value12 = value7 ^ value11; \
+		value13 = value9 ^ value12; \
+		value13 &= input2; \
+		value9 ^= value13; \
+		value9 ^= value1; \
+		value9 &= input5; \
+		value1 ^= value9; \
+		value9 = input4 & value2; \
+		value9 = ~value9; \
+		value13 = value9 ^ input4; \
+		value13 &= input0; \
+		value14 = value9 ^ value13; \
+		value14 ^= value12; \
+		value15 = value14 & input2; \
+		value12 ^= value15; \
+		value15 = ~value0; \
+		value16 = value10 ^ value13; \
+		value6 &= input2; \
+		value16 ^= value6; \
+		value16 ^= value12; \
+		value16 &= input5; \
+		value12 ^= value16; \
+		value12 ^= value1; \
+		value12 &= input3; \
+		value1 ^= value12; \
+		value12 = input4 ^ input0; \
+		value16 = value2 & input0; \
+		value16 ^= value3; \
+		value16 ^= value12; \
+		value16 &= input2; \
+		value12 ^= value16; \
+		value16 = value0 & input2; \
+		value14 ^= value16; \
+		value14 ^= value12; \
+		value14 &= input5; \
+		value12 ^= value14; \
+		value14 = value15 ^ value4; \
+		value16 = value0 ^ input0; \
+		value17 = value14 ^ value16; \
+		value17 &= input2; \
+		value14 ^= value17; \
+		value14 ^= input5; \
+		value14 ^= value12; \
+		value14 &= input3; \
+		value12 ^= value14; \
+		value14 = ~value10; \
+		value13 ^= value14; \
+		value14 = value2 ^ value11; \
+		value17 = value13 ^ value14; \
+		value17 &= input2; \
+		value13 ^= value17; \
+		value0 ^= value14; \
+		value0 &= input2; \
+		value14 ^= value0; \
+		value14 ^= value13; \
+		value14 &= input5; \
+		value13 ^= value14; \
+		value14 = input1 ^ value11; \
+		value6 ^= value14; \
+		value14 = value9 ^ input0; \
+		value0 ^= value14; \
+		value0 ^= value6; \
+		value0 &= input5; \
+		value0 ^= value6; \
+		value0 ^= value13; \
+		value0 &= input3; \
+		value0 ^= value13; \
+		value6 = value5 & input0; \
+		value6 ^= value7; \
+		value3 ^= input0; \
+		value3 ^= value6; \
+		value3 &= input2; \
+		value3 ^= value6; \
+		value6 = value7 & input2; \
+		value6 ^= value16; \
+		value6 ^= value3; \
+		value6 &= input5; \
+		value3 ^= value6; \
+		value4 ^= value10; \
+		value6 = value15 ^ value8; \
+		value6 ^= value4; \
+		value6 &= input2; \
+		value4 ^= value6; \
+		value5 ^= value11; \
+		value6 = value9 & input0; \
+		value2 ^= value6; \
+		value2 ^= value5; \
+		value2 &= input2; \
+		value2 ^= value5; \
+		value2 ^= value4; \
+		value2 &= input5; \
+		value2 ^= value4; \
+		value2 ^= value3; \
+		value2 &= input3; \
+		value2 ^= value3; \
+		output0 ^= value1; \
+		output1 ^= value12; \
+		output2 ^= value0; \
+		output3 ^= value2; \
+	}
+
+
+#define libfcrypto_des3_bitslice_calculate_substitution6( slice_type, input0, input1, input2, input3, input4, input5, output0, output1, output2, output3 ) \
+	{ \
+		slice_type value0, value1, value2, value3, value4, value5, value6, value7; \
+		slice_type value8, value9, value10, value11, value12, value13, value14, value15; \
+		value0 = ~input1; \
+		value1 = input1 ^ input5; \
+		value2 = value0 ^ value1; \
+		value3 = value2 & input4; \
+		value4 = value0 ^ value3; \
+		value5 = value2 ^ input4; \
+		value5 ^= value4; \
+		value5 &= input2; \
+		value4 ^= value5; \
+		value5 = ~value1; \
+		value6 = input5 & value0; \
+		value7 = ~value6; \
+		value8 = value6 ^ input4; \
+		value8 ^= value5; \
+		value8 &= input2; \
+		value9 = value5 ^ value8; \
+		value9 ^= value4; \
+		value9 &= input3; \
+		value4 ^= value9; \
+		value9 = value6 ^ value2; \
+		value9 &= input4; \
+		value6 ^= value9; \
+		value6 ^= value5; \
+		value6 &= input2; \
+		value6 ^= value5; \
+		value10 = input1 | input5; \
+		value11 = ~value10; \
+		value11 ^= value9; \
+		value3 = ~value3; \
+		value3 ^= value11; \
+		value3 &= input2; \
+		value3 ^= value11; \
+		value3 ^= value6; \
+		value3 &= input3; \
+		value3 ^= value6; \
+		value3 ^= value4; \
+		value3 &= input0; \
+		value3 ^= value4; \
+		value4 = value5 ^ input4; \
+		value6 = value4 ^ value1; \
+		value6 &= input2; \
+		value4 ^= value6; \
+		value11 = input5 ^ value9; \
+		value11 ^= input2; \
+		value11 ^= value4; \
+		value11 &= input3; \
+		value4 ^= value11; \
+		value11 = value1 ^ input4; \
+		value12 = input1 & input5; \
+		value13 = value10 & input4; \
+		value14 = value12 ^ value13; \
+		value14 ^= value11; \
+		value14 &= input2; \
+		value11 ^= value14; \
+		value14 = input1 & value2; \
+		value14 = ~value14; \
+		value2 ^= value13; \
+		value13 = value0 ^ input4; \
+		value15 = value2 ^ value13; \
+		value15 &= input2; \
+		value15 ^= value2; \
+		value15 ^= value11; \
+		value15 &= input3; \
+		value11 ^= value15; \
+		value11 ^= value4; \
+		value11 &= input0; \
+		value4 ^= value11; \
+		value11 = value12 & input4; \
+		value12 = input5 ^ value11; \
+		value14 &= input4; \
+		value1 ^= value14; \
+		value1 ^= value12; \
+		value1 &= input2; \
+		value12 ^= value1; \
+		value14 = value7 & input4; \
+		value1 ^= value2; \
+		value1 ^= value12; \
+		value1 &= input3; \
+		value1 ^= value12; \
+		value9 ^= input1; \
+		value2 &= input2; \
+		value9 ^= value2; \
+		value2 ^= value13; \
+		value2 ^= value9; \
+		value2 &= input3; \
+		value2 ^= value9; \
+		value2 ^= value1; \
+		value2 &= input0; \
+		value1 ^= value2; \
+		value0 &= input2; \
+		value0 ^= input4; \
+		value2 = input1 ^ value14; \
+		value9 = value10 ^ value11; \
+		value9 ^= value2; \
+		value9 &= input2; \
+		value2 ^= value9; \
+		value2 ^= value0; \
+		value2 &= input3; \
+		value0 ^= value2; \
+		value2 = value7 ^ input4; \
+		value2 ^= value8; \
+		value5 ^= value6; \
+		value5 ^= value2; \
+		value5 &= input3; \
+		value2 ^= value5; \
+		value2 ^= value0; \
+		value2 &= input0; \
+		value0 ^= value2; \
+		output0 ^= value3; \
+		output1 ^= value4; \
+		output2 ^= value1; \
+		output3 ^= value0; \
+	}
+
+
+#define libfcrypto_des3_bitslice_calculate_substitution7( slice_type, input0, input1, input2, input3, input4, input5, output0, output1, output2, output3 ) \
+	{ \
+		slice_type value0, value1, value2, value3, value4, value5, value6, value7; \
+		slice_type value8, value9, value10, value11, value12, value13, value14, value15; \
+		slice_type value16, value17; \
+		value0 = input4 & ~input3; \
+		value1 = ~value0; \
+		value2 = input4 ^ value1; \
+		value3 = value2 & input2; \
+		value4 = input4 ^ value3; \
+		value5 = input3 ^ input4; \
+		value6 = value5 ^ value0; \
+		value7 = value6 & input2; \
+		value8 = value5 ^ value7; \
+		value8 ^= value4; \
+		value8 &= input1; \
+		value4 ^= value8; \
+		value8 = ~value5; \
+		value9 = input3 ^ value8; \
+		value10 = value9 & input2; \
+		value10 ^= input3; \
+		value11 = ~value6; \
+		value12 = value11 ^ input2; \
+		value13 = value10 ^ value12; \
+		value13 &= input1; \
+		value10 ^= value13; \
+		value10 ^= value4; \
+		value10 &= input0; \
+		value10 ^= value4; \
+		value9 ^= input2; \
+		value14 = input3 & input1; \
+		value14 ^= value9; \
+		value15 = input3 | input4; \
+		value16 = input4 & input2; \
+		value17 = value15 ^ value16; \
+		value13 ^= value17; \
+		value13 ^= value14; \
+		value13 &= input0; \
+		value13 ^= value14; \
+		value13 ^= value10; \
+		value13 &= input5; \
+		value10 ^= value13; \
+		value13 = input4 ^ input2; \
+		value13 ^= value8; \
+		value14 = value13 & input1; \
+		value14 ^= value8; \
+		value4 ^= value14; \
+		value4 &= input0; \
+		value4 ^= value14; \
+		value14 = ~value15; \
+		value14 ^= value8; \
+		value14 &= input2; \
+		value14 ^= value8; \
+		value3 ^= value1; \
+		value3 ^= value14; \
+		value3 &= input1; \
+		value3 ^= value14; \
+		value8 ^= input4; \
+		value8 &= input2; \
+		value8 ^= input4; \
+		value8 ^= value9; \
+		value8 &= input1; \
+		value9 ^= value8; \
+		value9 ^= value3; \
+		value9 &= input0; \
+		value3 ^= value9; \
+		value3 ^= value4; \
+		value3 &= input5; \
+		value3 ^= value4; \
+		value4 = value15 ^ input2; \
+		value9 = value2 & input1; \
+		value4 ^= value9; \
+		value6 ^= value16; \
+		value2 ^= input2; \
+		value2 ^= value6; \
+		value2 &= input1; \
+		value2 ^= value6; \
+		value2 ^= value4; \
+		value2 &= input0; \
+		value2 ^= value4; \
+		value4 = input3 ^ value7; \
+		value4 ^= value8; \
+		value6 = value11 & input1; \
+		value6 ^= value13; \
+		value6 ^= value4; \
+		value6 &= input0; \
+		value4 ^= value6; \
+		value4 ^= value2; \
+		value4 &= input5; \
+		value2 ^= value4; \
+		value4 = value11 & input2; \
+		value0 ^= value4; \
+		value6 = value1 ^ value7; \
+		value6 ^= value0; \
+		value6 &= input1; \
+		value0 ^= value6; \
+		value4 ^= value1; \
+		value0 ^= input0; \
+		value6 = value12 & input1; \
+		value4 ^= value6; \
+		value5 ^= input2; \
+		value1 &= input1; \
+		value1 ^= value5; \
+		value1 ^= value4; \
+		value1 &= input0; \
+		value1 ^= value4; \
+		value1 ^= value0; \
+		value1 &= input5; \
+		value0 ^= value1; \
+		output0 ^= value10; \
+		output1 ^= value3; \
+		output2 ^= value2; \
+		output3 ^= value0; \
+	}
+
+
+#define libfcrypto_des3_bitslice_calculate_substitution8( slice_type, input0, input1, input2, input3, input4, input5, output0, output1, output2, output3 ) \
+	{ \
+		slice_type value0, value1, value2, value3, value4, value5, value6, value7; \
+		slice_type value8, value9, value10, value11, value12, value13, value14, value15; \
+		slice_type value16, value17, value18; \
+		value0 = input1 & input3; \
+		value1 = ~value0; \
+		value2 = value1 ^ input3; \
+		value3 = value2 & input2; \
+		value4 = value1 ^ value3; \
+		value5 = input1 | input3; \
+		value6 = ~value5; \
+		value7 = input1 ^ value3; \
+		value7 ^= value4; \
+		value8 = value7 & input4; \
+		value4 ^= value8; \
+		value8 = input1 ^ input3; \
+		value9 = ~value8; \
+		value10 = value8 ^ input2; \
+		value11 = input1 & ~input3; \
+		value12 = value7 ^ input2; \
+		value13 = value2 & input4; \
+		value14 = value10 ^ value13; \
+		value14 ^= value4; \
+		value14 &= input5; \
+		value4 ^= value14; \
+		value14 = value0 ^ input2; \
+		value15 = value14 ^ value9; \
+		value15 &= input4; \
+		value14 ^= value15; \
+		value16 = input1 & input2; \
+		value5 ^= value16; \
+		value11 ^= input2; \
+		value11 ^= value5; \
+		value11 &= input4; \
+		value5 ^= value11; \
+		value5 ^= value14; \
+		value5 &= input5; \
+		value5 ^= value14; \
+		value5 ^= value4; \
+		value5 &= input0; \
+		value4 ^= value5; \
+		value5 = value6 ^ value16; \
+		value6 = value12 & input4; \
+		value6 ^= value5; \
+		value12 = ~input3; \
+		value8 ^= value12; \
+		value14 = value8 & input2; \
+		value14 ^= value12; \
+		value6 ^= input5; \
+		value3 ^= value8; \
+		value17 = value3 ^ input4; \
+		value18 = input2 & input4; \
+		value10 ^= value18; \
+		value10 ^= value17; \
+		value10 &= input5; \
+		value10 ^= value17; \
+		value10 ^= value6; \
+		value10 &= input0; \
+		value6 ^= value10; \
+		value10 = input1 ^ input2; \
+		value17 = value10 ^ value9; \
+		value17 &= input4; \
+		value10 ^= value17; \
+		value7 &= input2; \
+		value17 = value0 ^ value7; \
+		value15 ^= value17; \
+		value15 ^= value10; \
+		value15 &= input5; \
+		value10 ^= value15; \
+		value15 = value9 ^ input2; \
+		value14 ^= value15; \
+		value14 &= input4; \
+		value14 ^= value15; \
+		value1 ^= value7; \
+		value7 = value12 & input4; \
+		value1 ^= value7; \
+		value1 ^= value14; \
+		value1 &= input5; \
+		value1 ^= value14; \
+		value1 ^= value10; \
+		value1 &= input0; \
+		value1 ^= value10; \
+		value7 = value15 ^ value13; \
+		value9 &= input2; \
+		value8 ^= value9; \
+		value2 ^= value16; \
+		value2 ^= value8; \
+		value2 &= input4; \
+		value2 ^= value8; \
+		value2 ^= value7; \
+		value2 &= input5; \
+		value2 ^= value7; \
+		value5 ^= value11; \
+		value0 &= input2; \
+		value0 ^= input1; \
+		value3 ^= value0; \
+		value3 &= input4; \
+		value0 ^= value3; \
+		value0 ^= value5; \
+		value0 &= input5; \
+		value0 ^= value5; \
+		value0 ^= value2; \
+		value0 &= input0; \
+		value0 ^= value2; \
+		output0 ^= value4; \
+		output1 ^= value6; \
+		output2 ^= value1; \
+		output3 ^= value0; \
+	}
+
+/* Calculates a DES round, where the expansion (E) of the right slices and
+ * the post S-box permutation (P) are applied by the choice of the slices
+ */
+
+#define libfcrypto_des3_bitslice_calculate_round( slice_type, left, right, sub_key ) \
+	{ \
+		slice_type input0, input1, input2, input3, input4, input5; \
+		input0 = right[ 31 ] ^ libfcrypto_des3_bitslice_get_key_mask( sub_key, 47 ); \
+		input1 = right[ 0 ] ^ libfcrypto_des3_bitslice_get_key_mask( sub_key, 46 ); \
+		input2 = right[ 1 ] ^ libfcrypto_des3_bitslice_get_key_mask( sub_key, 45 ); \
+		input3 = right[ 2 ] ^ libfcrypto_des3_bitslice_get_key_mask( sub_key, 44 ); \
+		input4 = right[ 3 ] ^ libfcrypto_des3_bitslice_get_key_mask( sub_key, 43 ); \
+		input5 = right[ 4 ] ^ libfcrypto_des3_bitslice_get_key_mask( sub_key, 42 ); \
+		libfcrypto_des3_bitslice_calculate_substitution1( slice_type, input0, input1, input2, input3, input4, input5, left[ 8 ], left[ 16 ], left[ 22 ], left[ 30 ] ); \
+		input0 = right[ 3 ] ^ libfcrypto_des3_bitslice_get_key_mask( sub_key, 41 ); \
+		input1 = right[ 4 ] ^ libfcrypto_des3_bitslice_get_key_mask( sub_key, 40 ); \
+		input2 = right[ 5 ] ^ libfcrypto_des3_bitslice_get_key_mask( sub_key, 39 ); \
+		input3 = right[ 6 ] ^ libfcrypto_des3_bitslice_get_key_mask( sub_key, 38 ); \
+		input4 = right[ 7 ] ^ libfcrypto_des3_bitslice_get_key_mask( sub_key, 37 ); \
+		input5 = right[ 8 ] ^ libfcrypto_des3_bitslice_get_key_mask( sub_key, 36 ); \
+		libfcrypto_des3_bitslice_calculate_substitution2( slice_type, input0, input1, input2, input3, input4, input5, left[ 12 ], left[ 27 ], left[ 1 ], left[ 17 ] ); \
+		input0 = right[ 7 ] ^ libfcrypto_des3_bitslice_get_key_mask( sub_key, 35 ); \
+		input1 = right[ 8 ] ^ libfcrypto_des3_bitslice_get_key_mask( sub_key, 34 ); \
+		input2 = right[ 9 ] ^ libfcrypto_des3_bitslice_get_key_mask( sub_key, 33 ); \
+		input3 = right[ 10 ] ^ libfcrypto_des3_bitslice_get_key_mask( sub_key, 32 ); \
+		input4 = right[ 11 ] ^ libfcrypto_des3_bitslice_get_key_mask( sub_key, 31 ); \
+		input5 = right[ 12 ] ^ libfcrypto_des3_bitslice_get_key_mask( sub_key, 30 ); \
+		libfcrypto_des3_bitslice_calculate_substitution3( slice_type, input0, input1, input2, input3, input4, input5, left[ 23 ], left[ 15 ], left[ 29 ], left[ 5 ] ); \
+		input0 = right[ 11 ] ^ libfcrypto_des3_bitslice_get_key_mask( sub_key, 29 ); \
+		input1 = right[ 12 ] ^ libfcrypto_des3_bitslice_get_key_mask( sub_key, 28 ); \
+		input2 = right[ 13 ] ^ libfcrypto_des3_bitslice_get_key_mask( sub_key, 27 ); \
+		input3 = right[ 14 ] ^ libfcrypto_des3_bitslice_get_key_mask( sub_key, 26 ); \
+		input4 = right[ 15 ] ^ libfcrypto_des3_bitslice_get_key_mask( sub_key, 25 ); \
+		input5 = right[ 16 ] ^ libfcrypto_des3_bitslice_get_key_mask( sub_key, 24 ); \
+		libfcrypto_des3_bitslice_calculate_substitution4( slice_type, input0, input1, input2, input3, input4, input5, left[ 25 ], left[ 19 ], left[ 9 ], left[ 0 ] ); \
+		input0 = right[ 15 ] ^ libfcrypto_des3_bitslice_get_key_mask( sub_key, 23 ); \
+		input1 = right[ 16 ] ^ libfcrypto_des3_bitslice_get_key_mask( sub_key, 22 ); \
+		input2 = right[ 17 ] ^ libfcrypto_des3_bitslice_get_key_mask( sub_key, 21 ); \
+		input3 = right[ 18 ] ^ libfcrypto_des3_bitslice_get_key_mask( sub_key, 20 ); \
+		input4 = right[ 19 ] ^ libfcrypto_des3_bitslice_get_key_mask( sub_key, 19 ); \
+		input5 = right[ 20 ] ^ libfcrypto_des3_bitslice_get_key_mask( sub_key, 18 ); \
+		libfcrypto_des3_bitslice_calculate_substitution5( slice_type, input0, input1, input2, input3, input4, input5, left[ 7 ], left[ 13 ], left[ 24 ], left[ 2 ] ); \
+		input0 = right[ 19 ] ^ libfcrypto_des3_bitslice_get_key_mask( sub_key, 17 ); \
+		input1 = right[ 20 ] ^ libfcrypto_des3_bitslice_get_key_mask( sub_key, 16 ); \
+		input2 = right[ 21 ] ^ libfcrypto_des3_bitslice_get_key_mask( sub_key, 15 ); \
+		input3 = right[ 22 ] ^ libfcrypto_des3_bitslice_get_key_mask( sub_key, 14 ); \
+		input4 = right[ 23 ] ^ libfcrypto_des3_bitslice_get_key_mask( sub_key, 13 ); \
+		input5 = right[ 24 ] ^ libfcrypto_des3_bitslice_get_key_mask( sub_key, 12 ); \
+		libfcrypto_des3_bitslice_calculate_substitution6( slice_type, input0, input1, input2, input3, input4, input5, left[ 3 ], left[ 28 ], left[ 10 ], left[ 18 ] ); \
+		input0 = right[ 23 ] ^ libfcrypto_des3_bitslice_get_key_mask( sub_key, 11 ); \
+		input1 = right[ 24 ] ^ libfcrypto_des3_bitslice_get_key_mask( sub_key, 10 ); \
+		input2 = right[ 25 ] ^ libfcrypto_des3_bitslice_get_key_mask( sub_key, 9 ); \
+		input3 = right[ 26 ] ^ libfcrypto_des3_bitslice_get_key_mask( sub_key, 8 ); \
+		input4 = right[ 27 ] ^ libfcrypto_des3_bitslice_get_key_mask( sub_key, 7 ); \
+		input5 = right[ 28 ] ^ libfcrypto_des3_bitslice_get_key_mask( sub_key, 6 ); \
+		libfcrypto_des3_bitslice_calculate_substitution7( slice_type, input0, input1, input2, input3, input4, input5, left[ 31 ], left[ 11 ], left[ 21 ], left[ 6 ] ); \
+		input0 = right[ 27 ] ^ libfcrypto_des3_bitslice_get_key_mask( sub_key, 5 ); \
+		input1 = right[ 28 ] ^ libfcrypto_des3_bitslice_get_key_mask( sub_key, 4 ); \
+		input2 = right[ 29 ] ^ libfcrypto_des3_bitslice_get_key_mask( sub_key, 3 ); \
+		input3 = right[ 30 ] ^ libfcrypto_des3_bitslice_get_key_mask( sub_key, 2 ); \
+		input4 = right[ 31 ] ^ libfcrypto_des3_bitslice_get_key_mask( sub_key, 1 ); \
+		input5 = right[ 0 ] ^ libfcrypto_des3_bitslice_get_key_mask( sub_key, 0 ); \
+		libfcrypto_des3_bitslice_calculate_substitution8( slice_type, input0, input1, input2, input3, input4, input5, left[ 4 ], left[ 26 ], left[ 14 ], left[ 20 ] ); \
+	}
+
+/* Calculates the initial permutation (IP) of the slices into the left and right slices
+ */
+
+#define libfcrypto_des3_bitslice_calculate_initial_permutation( slices, left, right ) \
+	left[ 0 ] = slices[ 57 ]; \
+	left[ 1 ] = slices[ 49 ]; \
+	left[ 2 ] = slices[ 41 ]; \
+	left[ 3 ] = slices[ 33 ]; \
+	left[ 4 ] = slices[ 25 ]; \
+	left[ 5 ] = slices[ 17 ]; \
+	left[ 6 ] = slices[ 9 ]; \
+	left[ 7 ] = slices[ 1 ]; \
+	left[ 8 ] = slices[ 59 ]; \
+	left[ 9 ] = slices[ 51 ]; \
+	left[ 10 ] = slices[ 43 ]; \
+	left[ 11 ] = slices[ 35 ]; \
+	left[ 12 ] = slices[ 27 ]; \
+	left[ 13 ] = slices[ 19 ]; \
+	left[ 14 ] = slices[ 11 ]; \
+	left[ 15 ] = slices[ 3 ]; \
+	left[ 16 ] = slices[ 61 ]; \
+	left[ 17 ] = slices[ 53 ]; \
+	left[ 18 ] = slices[ 45 ]; \
+	left[ 19 ] = slices[ 37 ]; \
+	left[ 20 ] = slices[ 29 ]; \
+	left[ 21 ] = slices[ 21 ]; \
+	left[ 22 ] = slices[ 13 ]; \
+	left[ 23 ] = slices[ 5 ]; \
+	left[ 24 ] = slices[ 63 ]; \
+	left[ 25 ] = slices[ 55 ]; \
+	left[ 26 ] = slices[ 47 ]; \
+	left[ 27 ] = slices[ 39 ]; \
+	left[ 28 ] = slices[ 31 ]; \
+	left[ 29 ] = slices[ 23 ]; \
+	left[ 30 ] = slices[ 15 ]; \
+	left[ 31 ] = slices[ 7 ]; \
+	right[ 0 ] = slices[ 56 ]; \
+	right[ 1 ] = slices[ 48 ]; \
+	right[ 2 ] = slices[ 40 ]; \
+	right[ 3 ] = slices[ 32 ]; \
+	right[ 4 ] = slices[ 24 ]; \
+	right[ 5 ] = slices[ 16 ]; \
+	right[ 6 ] = slices[ 8 ]; \
+	right[ 7 ] = slices[ 0 ]; \
+	right[ 8 ] = slices[ 58 ]; \
+	right[ 9 ] = slices[ 50 ]; \
+	right[ 10 ] = slices[ 42 ]; \
+	right[ 11 ] = slices[ 34 ]; \
+	right[ 12 ] = slices[ 26 ]; \
+	right[ 13 ] = slices[ 18 ]; \
+	right[ 14 ] = slices[ 10 ]; \
+	right[ 15 ] = slices[ 2 ]; \
+	right[ 16 ] = slices[ 60 ]; \
+	right[ 17 ] = slices[ 52 ]; \
+	right[ 18 ] = slices[ 44 ]; \
+	right[ 19 ] = slices[ 36 ]; \
+	right[ 20 ] = slices[ 28 ]; \
+	right[ 21 ] = slices[ 20 ]; \
+	right[ 22 ] = slices[ 12 ]; \
+	right[ 23 ] = slices[ 4 ]; \
+	right[ 24 ] = slices[ 62 ]; \
+	right[ 25 ] = slices[ 54 ]; \
+	right[ 26 ] = slices[ 46 ]; \
+	right[ 27 ] = slices[ 38 ]; \
+	right[ 28 ] = slices[ 30 ]; \
+	right[ 29 ] = slices[ 22 ]; \
+	right[ 30 ] = slices[ 14 ]; \
+	right[ 31 ] = slices[ 6 ];
+
+/* Calculates the final permutation (FP) of the left and right slices into the slices
+ */
+
+#define libfcrypto_des3_bitslice_calculate_final_permutation( slices, left, right ) \
+	slices[ 0 ] = right[ 7 ]; \
+	slices[ 1 ] = left[ 7 ]; \
+	slices[ 2 ] = right[ 15 ]; \
+	slices[ 3 ] = left[ 15 ]; \
+	slices[ 4 ] = right[ 23 ]; \
+	slices[ 5 ] = left[ 23 ]; \
+	slices[ 6 ] = right[ 31 ]; \
+	slices[ 7 ] = left[ 31 ]; \
+	slices[ 8 ] = right[ 6 ]; \
+	slices[ 9 ] = left[ 6 ]; \
+	slices[ 10 ] = right[ 14 ]; \
+	slices[ 11 ] = left[ 14 ]; \
+	slices[ 12 ] = right[ 22 ]; \
+	slices[ 13 ] = left[ 22 ]; \
+	slices[ 14 ] = right[ 30 ]; \
+	slices[ 15 ] = left[ 30 ]; \
+	slices[ 16 ] = right[ 5 ]; \
+	slices[ 17 ] = left[ 5 ]; \
+	slices[ 18 ] = right[ 13 ]; \
+	slices[ 19 ] = left[ 13 ]; \
+	slices[ 20 ] = right[ 21 ]; \
+	slices[ 21 ] = left[ 21 ]; \
+	slices[ 22 ] = right[ 29 ]; \
+	slices[ 23 ] = left[ 29 ]; \
+	slices[ 24 ] = right[ 4 ]; \
+	slices[ 25 ] = left[ 4 ]; \
+	slices[ 26 ] = right[ 12 ]; \
+	slices[ 27 ] = left[ 12 ]; \
+	slices[ 28 ] = right[ 20 ]; \
+	slices[ 29 ] = left[ 20 ]; \
+	slices[ 30 ] = right[ 28 ]; \
+	slices[ 31 ] = left[ 28 ]; \
+	slices[ 32 ] = right[ 3 ]; \
+	slices[ 33 ] = left[ 3 ]; \
+	slices[ 34 ] = right[ 11 ]; \
+	slices[ 35 ] = left[ 11 ]; \
+	slices[ 36 ] = right[ 19 ]; \
+	slices[ 37 ] = left[ 19 ]; \
+	slices[ 38 ] = right[ 27 ]; \
+	slices[ 39 ] = left[ 27 ]; \
+	slices[ 40 ] = right[ 2 ]; \
+	slices[ 41 ] = left[ 2 ]; \
+	slices[ 42 ] = right[ 10 ]; \
+	slices[ 43 ] = left[ 10 ]; \
+	slices[ 44 ] = right[ 18 ]; \
+	slices[ 45 ] = left[ 18 ]; \
+	slices[ 46 ] = right[ 26 ]; \
+	slices[ 47 ] = left[ 26 ]; \
+	slices[ 48 ] = right[ 1 ]; \
+	slices[ 49 ] = left[ 1 ]; \
+	slices[ 50 ] = right[ 9 ]; \
+	slices[ 51 ] = left[ 9 ]; \
+	slices[ 52 ] = right[ 17 ]; \
+	slices[ 53 ] = left[ 17 ]; \
+	slices[ 54 ] = right[ 25 ]; \
+	slices[ 55 ] = left[ 25 ]; \
+	slices[ 56 ] = right[ 0 ]; \
+	slices[ 57 ] = left[ 0 ]; \
+	slices[ 58 ] = right[ 8 ]; \
+	slices[ 59 ] = left[ 8 ]; \
+	slices[ 60 ] = right[ 16 ]; \
+	slices[ 61 ] = left[ 16 ]; \
+	slices[ 62 ] = right[ 24 ]; \
+	slices[ 63 ] = left[ 24 ];
+
+/* Transposes 64 values of 64-bit into 64 slices or vice versa
+ * Returns 1 if successful or -1 on error
+ */
+int libfcrypto_des3_bitslice_transpose(
+     uint64_t *values,
+     libcerror_error_t **error )
+{
+	static char *function = "libfcrypto_des3_bitslice_transpose";
+	uint64_t bit_mask     = 0x00000000ffffffffUL;
+	uint64_t value_64bit  = 0;
+	int bit_shift         = 32;
+	int value_index       = 0;
+
+	if( values == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid values.",
+		 function );
+
+		return( -1 );
+	}
+	/* Swap the upper right and lower left quadrants of successively smaller bit matrices
+	 */
+	while( bit_shift > 0 )
+	{
+		for( value_index = 0;
+		     value_index < 64;
+		     value_index = ( value_index + bit_shift + 1 ) & ~bit_shift )
+		{
+			value_64bit = ( values[ value_index ] ^ ( values[ value_index + bit_shift ] >> bit_shift ) ) & bit_mask;
+
+			values[ value_index ]             ^= value_64bit;
+			values[ value_index + bit_shift ] ^= value_64bit << bit_shift;
+		}
+		bit_shift >>= 1;
+		bit_mask   ^= bit_mask << bit_shift;
+	}
+	return( 1 );
+}
+
+/* De- or encrypts 64 blocks in slices using DES3
+ * The sub keys contain the sub keys sets in the order they are applied
+ * Returns 1 if successful or -1 on error
+ */
+int libfcrypto_des3_bitslice_crypt_slices(
+     const uint64_t **sub_keys,
+     int number_of_sub_keys,
+     uint64_t *slices,
+     libcerror_error_t **error )
+{
+	uint64_t values[ 64 ];
+
+	static char *function = "libfcrypto_des3_bitslice_crypt_slices";
+	uint64_t *left        = NULL;
+	uint64_t *right       = NULL;
+	uint64_t *swap        = NULL;
+	uint64_t sub_key      = 0;
+	int key_index         = 0;
+	int round_index       = 0;
+
+	if( sub_keys == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid sub keys.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( number_of_sub_keys != 1 )
+	 && ( number_of_sub_keys != 3 ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported number of sub keys.",
+		 function );
+
+		return( -1 );
+	}
+	if( slices == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid slices.",
+		 function );
+
+		return( -1 );
+	}
+	left  = values;
+	right = &( values[ 32 ] );
+
+	libfcrypto_des3_bitslice_calculate_initial_permutation(
+	 slices,
+	 left,
+	 right );
+
+	for( key_index = 0;
+	     key_index < number_of_sub_keys;
+	     key_index++ )
+	{
+		for( round_index = 0;
+		     round_index < 16;
+		     round_index++ )
+		{
+			sub_key = sub_keys[ key_index ][ round_index ];
+
+			libfcrypto_des3_bitslice_calculate_round(
+			 uint64_t,
+			 left,
+			 right,
+			 sub_key );
+
+			swap  = left;
+			left  = right;
+			right = swap;
+		}
+		/* The final and initial permutation between the DES operations cancel out
+		 * so only the last round swap needs to be undone
+		 */
+		swap  = left;
+		left  = right;
+		right = swap;
+	}
+	libfcrypto_des3_bitslice_calculate_final_permutation(
+	 slices,
+	 left,
+	 right );
+
+	memory_set(
+	 values,
+	 0,
+	 sizeof( uint64_t ) * 64 );
+
+	return( 1 );
+}
+
+#if defined( LIBFCRYPTO_DES3_BITSLICE_HAVE_AVX2 )
+
+/* De- or encrypts 256 blocks in 4 groups of 64 slices using DES3 and AVX2
+ * The sub keys contain the sub keys sets in the order they are applied
+ * Returns 1 if successful or -1 on error
+ */
+__attribute__ (( target( "avx2" ) )) \
+int libfcrypto_des3_bitslice_crypt_slices_avx2(
+     const uint64_t **sub_keys,
+     int number_of_sub_keys,
+     uint64_t *slices,
+     libcerror_error_t **error )
+{
+	libfcrypto_des3_bitslice_vector_t vector_slices[ 64 ];
+	libfcrypto_des3_bitslice_vector_t values[ 64 ];
+
+	static char *function                    = "libfcrypto_des3_bitslice_crypt_slices_avx2";
+	libfcrypto_des3_bitslice_vector_t *left  = NULL;
+	libfcrypto_des3_bitslice_vector_t *right = NULL;
+	libfcrypto_des3_bitslice_vector_t *swap  = NULL;
+	uint64_t sub_key                         = 0;
+	int key_index                            = 0;
+	int round_index                          = 0;
+	int slice_index                          = 0;
+
+	if( sub_keys == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid sub keys.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( number_of_sub_keys != 1 )
+	 && ( number_of_sub_keys != 3 ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported number of sub keys.",
+		 function );
+
+		return( -1 );
+	}
+	if( slices == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid slices.",
+		 function );
+
+		return( -1 );
+	}
+	for( slice_index = 0;
+	     slice_index < 64;
+	     slice_index++ )
+	{
+		vector_slices[ slice_index ][ 0 ] = slices[ slice_index ];
+		vector_slices[ slice_index ][ 1 ] = slices[ 64 + slice_index ];
+		vector_slices[ slice_index ][ 2 ] = slices[ 128 + slice_index ];
+		vector_slices[ slice_index ][ 3 ] = slices[ 192 + slice_index ];
+	}
+	left  = values;
+	right = &( values[ 32 ] );
+
+	libfcrypto_des3_bitslice_calculate_initial_permutation(
+	 vector_slices,
+	 left,
+	 right );
+
+	for( key_index = 0;
+	     key_index < number_of_sub_keys;
+	     key_index++ )
+	{
+		for( round_index = 0;
+		     round_index < 16;
+		     round_index++ )
+		{
+			sub_key = sub_keys[ key_index ][ round_index ];
+
+			libfcrypto_des3_bitslice_calculate_round(
+			 libfcrypto_des3_bitslice_vector_t,
+			 left,
+			 right,
+			 sub_key );
+
+			swap  = left;
+			left  = right;
+			right = swap;
+		}
+		swap  = left;
+		left  = right;
+		right = swap;
+	}
+	libfcrypto_des3_bitslice_calculate_final_permutation(
+	 vector_slices,
+	 left,
+	 right );
+
+	for( slice_index = 0;
+	     slice_index < 64;
+	     slice_index++ )
+	{
+		slices[ slice_index ]       = vector_slices[ slice_index ][ 0 ];
+		slices[ 64 + slice_index ]  = vector_slices[ slice_index ][ 1 ];
+		slices[ 128 + slice_index ] = vector_slices[ slice_index ][ 2 ];
+		slices[ 192 + slice_index ] = vector_slices[ slice_index ][ 3 ];
+	}
+	memory_set(
+	 vector_slices,
+	 0,
+	 sizeof( libfcrypto_des3_bitslice_vector_t ) * 64 );
+
+	memory_set(
+	 values,
+	 0,
+	 sizeof( libfcrypto_des3_bitslice_vector_t ) * 64 );
+
+	return( 1 );
+}
+
+#endif /* defined( LIBFCRYPTO_DES3_BITSLICE_HAVE_AVX2 ) */
+
+/* De- or encrypts blocks using bitsliced DES3
+ * The number of values must be a multitude of 64, the values are (de/en)crypted in place
+ * Returns 1 if successful or -1 on error
+ */
+int libfcrypto_des3_bitslice_crypt_blocks(
+     libfcrypto_internal_des3_context_t *internal_context,
+     int mode,
+     uint64_t *values,
+     size_t number_of_values,
+     libcerror_error_t **error )
+{
+	const uint64_t *sub_keys[ 3 ];
+
+	static char *function   = "libfcrypto_des3_bitslice_crypt_blocks";
+	size_t group_index      = 0;
+	size_t number_of_groups = 0;
+	size_t value_index      = 0;
+	int number_of_sub_keys  = 0;
+	int result              = 0;
+
+	if( values == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid values.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( ( number_of_values % LIBFCRYPTO_DES3_BITSLICE_NUMBER_OF_BLOCKS ) != 0 )
+	 || ( number_of_values > (size_t) ( SSIZE_MAX / sizeof( uint64_t ) ) ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid number of values value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( libfcrypto_internal_des3_context_get_sub_keys(
+	     internal_context,
+	     mode,
+	     sub_keys,
+	     &number_of_sub_keys,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve sub keys.",
+		 function );
+
+		return( -1 );
+	}
+	while( value_index < number_of_values )
+	{
+		number_of_groups = 1;
+
+		if( ( internal_context->bitslice_crypt_slices_function != NULL )
+		 && ( ( number_of_values - value_index ) >= internal_context->bitslice_number_of_blocks ) )
+		{
+			number_of_groups = internal_context->bitslice_number_of_blocks / LIBFCRYPTO_DES3_BITSLICE_NUMBER_OF_BLOCKS;
+		}
+		for( group_index = 0;
+		     group_index < number_of_groups;
+		     group_index++ )
+		{
+			if( libfcrypto_des3_bitslice_transpose(
+			     &( values[ value_index + ( group_index * LIBFCRYPTO_DES3_BITSLICE_NUMBER_OF_BLOCKS ) ] ),
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+				 "%s: unable to transpose values into slices.",
+				 function );
+
+				return( -1 );
+			}
+		}
+		if( number_of_groups > 1 )
+		{
+			result = internal_context->bitslice_crypt_slices_function(
+			          sub_keys,
+			          number_of_sub_keys,
+			          &( values[ value_index ] ),
+			          error );
+		}
+		else
+		{
+			result = libfcrypto_des3_bitslice_crypt_slices(
+			          sub_keys,
+			          number_of_sub_keys,
+			          &( values[ value_index ] ),
+			          error );
+		}
+		if( result != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_ENCRYPTION,
+			 LIBCERROR_ENCRYPTION_ERROR_GENERIC,
+			 "%s: unable to crypt slices.",
+			 function );
+
+			return( -1 );
+		}
+		for( group_index = 0;
+		     group_index < number_of_groups;
+		     group_index++ )
+		{
+			if( libfcrypto_des3_bitslice_transpose(
+			     &( values[ value_index + ( group_index * LIBFCRYPTO_DES3_BITSLICE_NUMBER_OF_BLOCKS ) ] ),
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+				 "%s: unable to transpose slices into values.",
+				 function );
+
+				return( -1 );
+			}
+		}
+		value_index += number_of_groups * LIBFCRYPTO_DES3_BITSLICE_NUMBER_OF_BLOCKS;
+	}
+	return( 1 );
+}
+
@@ -0,0 +1,79 @@
+/*
+ * Bitsliced DES3 (de/en)crypt functions
+ *
+ * Copyright (C) 2017-2024, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _LIBFCRYPTO_DES3_BITSLICE_H )
+#define _LIBFCRYPTO_DES3_BITSLICE_H
+
+#include <common.h>
+#include <types.h>
+
+#include "libfcrypto_des3_context.h"
+#include "libfcrypto_libcerror.h"
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+/* The number of blocks that are processed at once by the bitsliced functions
+ */
+#define LIBFCRYPTO_DES3_BITSLICE_NUMBER_OF_BLOCKS		64
+
+/* The maximum number of blocks that are processed at once by the bitsliced functions
+ */
+#define LIBFCRYPTO_DES3_BITSLICE_MAXIMUM_NUMBER_OF_BLOCKS	256
+
+#if ( defined( __clang__ ) || ( defined( __GNUC__ ) && ( __GNUC__ >= 5 ) ) ) && ( defined( __i386__ ) || defined( __x86_64__ ) )
+#define LIBFCRYPTO_DES3_BITSLICE_HAVE_AVX2			1
+#endif
+
+int libfcrypto_des3_bitslice_transpose(
+     uint64_t *values,
+     libcerror_error_t **error );
+
+int libfcrypto_des3_bitslice_crypt_slices(
+     const uint64_t **sub_keys,
+     int number_of_sub_keys,
+     uint64_t *slices,
+     libcerror_error_t **error );
+
+#if defined( LIBFCRYPTO_DES3_BITSLICE_HAVE_AVX2 )
+
+int libfcrypto_des3_bitslice_crypt_slices_avx2(
+     const uint64_t **sub_keys,
+     int number_of_sub_keys,
+     uint64_t *slices,
+     libcerror_error_t **error );
+
+#endif /* defined( LIBFCRYPTO_DES3_BITSLICE_HAVE_AVX2 ) */
+
+int libfcrypto_des3_bitslice_crypt_blocks(
+     libfcrypto_internal_des3_context_t *internal_context,
+     int mode,
+     uint64_t *values,
+     size_t number_of_values,
+     libcerror_error_t **error );
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _LIBFCRYPTO_DES3_BITSLICE_H ) */
+
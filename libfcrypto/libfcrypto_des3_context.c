@@ -24,64 +24,145 @@
 #include <memory.h>
 #include <types.h>
 
+#include "libfcrypto_cpu.h"
+#include "libfcrypto_ctr.h"
+#include "libfcrypto_des3_bitslice.h"
 #include "libfcrypto_des3_context.h"
 #include "libfcrypto_definitions.h"
 #include "libfcrypto_libcerror.h"
 
-static uint8_t libfcrypto_des3_permutation_table[ 64 ] = {
-	58, 50, 42, 34, 26, 18, 10, 2, 60, 52, 44, 36, 28, 20, 12, 4, 
-	62, 54, 46, 38, 30, 22, 14, 6, 64, 56, 48, 40, 32, 24, 16, 8, 
-	57, 49, 41, 33, 25, 17, 9, 1, 59, 51, 43, 35, 27, 19, 11, 3, 
-	61, 53, 45, 37, 29, 21, 13, 5, 63, 55, 47, 39, 31, 23, 15, 7 };
-
-static uint8_t libfcrypto_des3_inverse_permutation_table[ 64 ] = {
-	40, 8, 48, 16, 56, 24, 64, 32, 39, 7, 47, 15, 55, 23, 63, 31, 
-	38, 6, 46, 14, 54, 22, 62, 30, 37, 5, 45, 13, 53, 21, 61, 29, 
-	36, 4, 44, 12, 52, 20, 60, 28, 35, 3, 43, 11, 51, 19, 59, 27, 
-	34, 2, 42, 10, 50, 18, 58, 26, 33, 1, 41, 9, 49, 17, 57, 25 };
-
-static uint8_t libfcrypto_des3_expansion_table[ 48 ] = {
-	32, 1, 2, 3, 4, 5, 4, 5, 6, 7, 8, 9, 8, 9, 10, 11,
-	12, 13, 12, 13, 14, 15, 16, 17, 16, 17, 18, 19, 20, 21, 20, 21,
-	22, 23, 24, 25, 24, 25, 26, 27, 28, 29, 28, 29, 30, 31, 32, 1 };
-
-static uint8_t libfcrypto_des3_post_sbox_permulation[ 32 ] = {
-	16, 7, 20, 21, 29, 12, 28, 17, 1, 15, 23, 26, 5, 18, 31, 10, 
-	2, 8, 24, 14, 32, 27, 3, 9, 19, 13, 30, 6, 22, 11, 4, 25 };
-
-static uint8_t libfcrypto_des3_sboxes[ 8 ][ 64 ] = {
-	{ 14, 4, 13, 1, 2, 15, 11, 8, 3, 10, 6, 12, 5, 9, 0, 7, 
-	  0, 15, 7, 4, 14, 2, 13, 1, 10, 6, 12, 11, 9, 5, 3, 8, 
-	  4, 1, 14, 8, 13, 6, 2, 11, 15, 12, 9, 7, 3, 10, 5, 0, 
-	  15, 12, 8, 2, 4, 9, 1, 7, 5, 11, 3, 14, 10, 0, 6, 13 },
-	{ 15, 1, 8, 14, 6, 11, 3, 4, 9, 7, 2, 13, 12, 0, 5, 10, 
-	  3, 13, 4, 7, 15, 2, 8, 14, 12, 0, 1, 10, 6, 9, 11, 5, 
-	  0, 14, 7, 11, 10, 4, 13, 1, 5, 8, 12, 6, 9, 3, 2, 15, 
-	  13, 8, 10, 1, 3, 15, 4, 2, 11, 6, 7, 12, 0, 5, 14, 9 },
-	{ 10, 0, 9, 14, 6, 3, 15, 5, 1, 13, 12, 7, 11, 4, 2, 8, 
-	  13, 7, 0, 9, 3, 4, 6, 10, 2, 8, 5, 14, 12, 11, 15, 1, 
-	  13, 6, 4, 9, 8, 15, 3, 0, 11, 1, 2, 12, 5, 10, 14, 7,
-	  1, 10, 13, 0, 6, 9, 8, 7, 4, 15, 14, 3, 11, 5, 2, 12 },
-	{ 7, 13, 14, 3, 0, 6, 9, 10, 1, 2, 8, 5, 11, 12, 4, 15, 
-	  13, 8, 11, 5, 6, 15, 0, 3, 4, 7, 2, 12, 1, 10, 14, 9, 
-	  10, 6, 9, 0, 12, 11, 7, 13, 15, 1, 3, 14, 5, 2, 8, 4,
-	  3, 15, 0, 6, 10, 1, 13, 8, 9, 4, 5, 11, 12, 7, 2, 14 },
-	{ 2, 12, 4, 1, 7, 10, 11, 6, 8, 5, 3, 15, 13, 0, 14, 9, 
-	  14, 11, 2, 12, 4, 7, 13, 1, 5, 0, 15, 10, 3, 9, 8, 6, 
-	  4, 2, 1, 11, 10, 13, 7, 8, 15, 9, 12, 5, 6, 3, 0, 14, 
-	  11, 8, 12, 7, 1, 14, 2, 13, 6, 15, 0, 9, 10, 4, 5, 3 },
-	{ 12, 1, 10, 15, 9, 2, 6, 8, 0, 13, 3, 4, 14, 7, 5, 11,
-	  10, 15, 4, 2, 7, 12, 9, 5, 6, 1, 13, 14, 0, 11, 3, 8,
-	  9, 14, 15, 5, 2, 8, 12, 3, 7, 0, 4, 10, 1, 13, 11, 6,
-	  4, 3, 2, 12, 9, 5, 15, 10, 11, 14, 1, 7, 6, 0, 8, 13 },
-	{ 4, 11, 2, 14, 15, 0, 8, 13, 3, 12, 9, 7, 5, 10, 6, 1,
-	  13, 0, 11, 7, 4, 9, 1, 10, 14, 3, 5, 12, 2, 15, 8, 6,
-	  1, 4, 11, 13, 12, 3, 7, 14, 10, 15, 6, 8, 0, 5, 9, 2,
-	  6, 11, 13, 8, 1, 4, 10, 7, 9, 5, 0, 15, 14, 2, 3, 12 },
-	{ 13, 2, 8, 4, 6, 15, 11, 1, 10, 9, 3, 14, 5, 0, 12, 7,
-	  1, 15, 13, 8, 10, 3, 7, 4, 12, 5, 6, 11, 0, 14, 9, 2,
-	  7, 11, 4, 1, 9, 12, 14, 2, 0, 6, 10, 13, 15, 3, 5, 8,
-	  2, 1, 14, 7, 4, 10, 8, 13, 15, 12, 9, 0, 3, 5, 6, 11 } };
+/* The combined substitution-boxes (S-boxes) and post S-box permutation (P) values
+ * indexed by the 6-bit input of the S-box
+ */
+static const uint32_t libfcrypto_des3_sbox_permutation_table[ 8 ][ 64 ] = {
+	{ 0x00808200UL, 0x00000000UL, 0x00008000UL, 0x00808202UL,
+	  0x00808002UL, 0x00008202UL, 0x00000002UL, 0x00008000UL,
+	  0x00000200UL, 0x00808200UL, 0x00808202UL, 0x00000200UL,
+	  0x00800202UL, 0x00808002UL, 0x00800000UL, 0x00000002UL,
+	  0x00000202UL, 0x00800200UL, 0x00800200UL, 0x00008200UL,
+	  0x00008200UL, 0x00808000UL, 0x00808000UL, 0x00800202UL,
+	  0x00008002UL, 0x00800002UL, 0x00800002UL, 0x00008002UL,
+	  0x00000000UL, 0x00000202UL, 0x00008202UL, 0x00800000UL,
+	  0x00008000UL, 0x00808202UL, 0x00000002UL, 0x00808000UL,
+	  0x00808200UL, 0x00800000UL, 0x00800000UL, 0x00000200UL,
+	  0x00808002UL, 0x00008000UL, 0x00008200UL, 0x00800002UL,
+	  0x00000200UL, 0x00000002UL, 0x00800202UL, 0x00008202UL,
+	  0x00808202UL, 0x00008002UL, 0x00808000UL, 0x00800202UL,
+	  0x00800002UL, 0x00000202UL, 0x00008202UL, 0x00808200UL,
+	  0x00000202UL, 0x00800200UL, 0x00800200UL, 0x00000000UL,
+	  0x00008002UL, 0x00008200UL, 0x00000000UL, 0x00808002UL },
+	{ 0x40084010UL, 0x40004000UL, 0x00004000UL, 0x00084010UL,
+	  0x00080000UL, 0x00000010UL, 0x40080010UL, 0x40004010UL,
+	  0x40000010UL, 0x40084010UL, 0x40084000UL, 0x40000000UL,
+	  0x40004000UL, 0x00080000UL, 0x00000010UL, 0x40080010UL,
+	  0x00084000UL, 0x00080010UL, 0x40004010UL, 0x00000000UL,
+	  0x40000000UL, 0x00004000UL, 0x00084010UL, 0x40080000UL,
+	  0x00080010UL, 0x40000010UL, 0x00000000UL, 0x00084000UL,
+	  0x00004010UL, 0x40084000UL, 0x40080000UL, 0x00004010UL,
+	  0x00000000UL, 0x00084010UL, 0x40080010UL, 0x00080000UL,
+	  0x40004010UL, 0x40080000UL, 0x40084000UL, 0x00004000UL,
+	  0x40080000UL, 0x40004000UL, 0x00000010UL, 0x40084010UL,
+	  0x00084010UL, 0x00000010UL, 0x00004000UL, 0x40000000UL,
+	  0x00004010UL, 0x40084000UL, 0x00080000UL, 0x40000010UL,
+	  0x00080010UL, 0x40004010UL, 0x40000010UL, 0x00080010UL,
+	  0x00084000UL, 0x00000000UL, 0x40004000UL, 0x00004010UL,
+	  0x40000000UL, 0x40080010UL, 0x40084010UL, 0x00084000UL },
+	{ 0x00000104UL, 0x04010100UL, 0x00000000UL, 0x04010004UL,
+	  0x04000100UL, 0x00000000UL, 0x00010104UL, 0x04000100UL,
+	  0x00010004UL, 0x04000004UL, 0x04000004UL, 0x00010000UL,
+	  0x04010104UL, 0x00010004UL, 0x04010000UL, 0x00000104UL,
+	  0x04000000UL, 0x00000004UL, 0x04010100UL, 0x00000100UL,
+	  0x00010100UL, 0x04010000UL, 0x04010004UL, 0x00010104UL,
+	  0x04000104UL, 0x00010100UL, 0x00010000UL, 0x04000104UL,
+	  0x00000004UL, 0x04010104UL, 0x00000100UL, 0x04000000UL,
+	  0x04010100UL, 0x04000000UL, 0x00010004UL, 0x00000104UL,
+	  0x00010000UL, 0x04010100UL, 0x04000100UL, 0x00000000UL,
+	  0x00000100UL, 0x00010004UL, 0x04010104UL, 0x04000100UL,
+	  0x04000004UL, 0x00000100UL, 0x00000000UL, 0x04010004UL,
+	  0x04000104UL, 0x00010000UL, 0x04000000UL, 0x04010104UL,
+	  0x00000004UL, 0x00010104UL, 0x00010100UL, 0x04000004UL,
+	  0x04010000UL, 0x04000104UL, 0x00000104UL, 0x04010000UL,
+	  0x00010104UL, 0x00000004UL, 0x04010004UL, 0x00010100UL },
+	{ 0x80401000UL, 0x80001040UL, 0x80001040UL, 0x00000040UL,
+	  0x00401040UL, 0x80400040UL, 0x80400000UL, 0x80001000UL,
+	  0x00000000UL, 0x00401000UL, 0x00401000UL, 0x80401040UL,
+	  0x80000040UL, 0x00000000UL, 0x00400040UL, 0x80400000UL,
+	  0x80000000UL, 0x00001000UL, 0x00400000UL, 0x80401000UL,
+	  0x00000040UL, 0x00400000UL, 0x80001000UL, 0x00001040UL,
+	  0x80400040UL, 0x80000000UL, 0x00001040UL, 0x00400040UL,
+	  0x00001000UL, 0x00401040UL, 0x80401040UL, 0x80000040UL,
+	  0x00400040UL, 0x80400000UL, 0x00401000UL, 0x80401040UL,
+	  0x80000040UL, 0x00000000UL, 0x00000000UL, 0x00401000UL,
+	  0x00001040UL, 0x00400040UL, 0x80400040UL, 0x80000000UL,
+	  0x80401000UL, 0x80001040UL, 0x80001040UL, 0x00000040UL,
+	  0x80401040UL, 0x80000040UL, 0x80000000UL, 0x00001000UL,
+	  0x80400000UL, 0x80001000UL, 0x00401040UL, 0x80400040UL,
+	  0x80001000UL, 0x00001040UL, 0x00400000UL, 0x80401000UL,
+	  0x00000040UL, 0x00400000UL, 0x00001000UL, 0x00401040UL },
+	{ 0x00000080UL, 0x01040080UL, 0x01040000UL, 0x21000080UL,
+	  0x00040000UL, 0x00000080UL, 0x20000000UL, 0x01040000UL,
+	  0x20040080UL, 0x00040000UL, 0x01000080UL, 0x20040080UL,
+	  0x21000080UL, 0x21040000UL, 0x00040080UL, 0x20000000UL,
+	  0x01000000UL, 0x20040000UL, 0x20040000UL, 0x00000000UL,
+	  0x20000080UL, 0x21040080UL, 0x21040080UL, 0x01000080UL,
+	  0x21040000UL, 0x20000080UL, 0x00000000UL, 0x21000000UL,
+	  0x01040080UL, 0x01000000UL, 0x21000000UL, 0x00040080UL,
+	  0x00040000UL, 0x21000080UL, 0x00000080UL, 0x01000000UL,
+	  0x20000000UL, 0x01040000UL, 0x21000080UL, 0x20040080UL,
+	  0x01000080UL, 0x20000000UL, 0x21040000UL, 0x01040080UL,
+	  0x20040080UL, 0x00000080UL, 0x01000000UL, 0x21040000UL,
+	  0x21040080UL, 0x00040080UL, 0x21000000UL, 0x21040080UL,
+	  0x01040000UL, 0x00000000UL, 0x20040000UL, 0x21000000UL,
+	  0x00040080UL, 0x01000080UL, 0x20000080UL, 0x00040000UL,
+	  0x00000000UL, 0x20040000UL, 0x01040080UL, 0x20000080UL },
+	{ 0x10000008UL, 0x10200000UL, 0x00002000UL, 0x10202008UL,
+	  0x10200000UL, 0x00000008UL, 0x10202008UL, 0x00200000UL,
+	  0x10002000UL, 0x00202008UL, 0x00200000UL, 0x10000008UL,
+	  0x00200008UL, 0x10002000UL, 0x10000000UL, 0x00002008UL,
+	  0x00000000UL, 0x00200008UL, 0x10002008UL, 0x00002000UL,
+	  0x00202000UL, 0x10002008UL, 0x00000008UL, 0x10200008UL,
+	  0x10200008UL, 0x00000000UL, 0x00202008UL, 0x10202000UL,
+	  0x00002008UL, 0x00202000UL, 0x10202000UL, 0x10000000UL,
+	  0x10002000UL, 0x00000008UL, 0x10200008UL, 0x00202000UL,
+	  0x10202008UL, 0x00200000UL, 0x00002008UL, 0x10000008UL,
+	  0x00200000UL, 0x10002000UL, 0x10000000UL, 0x00002008UL,
+	  0x10000008UL, 0x10202008UL, 0x00202000UL, 0x10200000UL,
+	  0x00202008UL, 0x10202000UL, 0x00000000UL, 0x10200008UL,
+	  0x00000008UL, 0x00002000UL, 0x10200000UL, 0x00202008UL,
+	  0x00002000UL, 0x00200008UL, 0x10002008UL, 0x00000000UL,
+	  0x10202000UL, 0x10000000UL, 0x00200008UL, 0x10002008UL },
+	{ 0x00100000UL, 0x02100001UL, 0x02000401UL, 0x00000000UL,
+	  0x00000400UL, 0x02000401UL, 0x00100401UL, 0x02100400UL,
+	  0x02100401UL, 0x00100000UL, 0x00000000UL, 0x02000001UL,
+	  0x00000001UL, 0x02000000UL, 0x02100001UL, 0x00000401UL,
+	  0x02000400UL, 0x00100401UL, 0x00100001UL, 0x02000400UL,
+	  0x02000001UL, 0x02100000UL, 0x02100400UL, 0x00100001UL,
+	  0x02100000UL, 0x00000400UL, 0x00000401UL, 0x02100401UL,
+	  0x00100400UL, 0x00000001UL, 0x02000000UL, 0x00100400UL,
+	  0x02000000UL, 0x00100400UL, 0x00100000UL, 0x02000401UL,
+	  0x02000401UL, 0x02100001UL, 0x02100001UL, 0x00000001UL,
+	  0x00100001UL, 0x02000000UL, 0x02000400UL, 0x00100000UL,
+	  0x02100400UL, 0x00000401UL, 0x00100401UL, 0x02100400UL,
+	  0x00000401UL, 0x02000001UL, 0x02100401UL, 0x02100000UL,
+	  0x00100400UL, 0x00000000UL, 0x00000001UL, 0x02100401UL,
+	  0x00000000UL, 0x00100401UL, 0x02100000UL, 0x00000400UL,
+	  0x02000001UL, 0x02000400UL, 0x00000400UL, 0x00100001UL },
+	{ 0x08000820UL, 0x00000800UL, 0x00020000UL, 0x08020820UL,
+	  0x08000000UL, 0x08000820UL, 0x00000020UL, 0x08000000UL,
+	  0x00020020UL, 0x08020000UL, 0x08020820UL, 0x00020800UL,
+	  0x08020800UL, 0x00020820UL, 0x00000800UL, 0x00000020UL,
+	  0x08020000UL, 0x08000020UL, 0x08000800UL, 0x00000820UL,
+	  0x00020800UL, 0x00020020UL, 0x08020020UL, 0x08020800UL,
+	  0x00000820UL, 0x00000000UL, 0x00000000UL, 0x08020020UL,
+	  0x08000020UL, 0x08000800UL, 0x00020820UL, 0x00020000UL,
+	  0x00020820UL, 0x00020000UL, 0x08020800UL, 0x00000800UL,
+	  0x00000020UL, 0x08020020UL, 0x00000800UL, 0x00020820UL,
+	  0x08000800UL, 0x00000020UL, 0x08000020UL, 0x08020000UL,
+	  0x08020020UL, 0x08000000UL, 0x00020000UL, 0x08000820UL,
+	  0x00000000UL, 0x08020820UL, 0x00020020UL, 0x08000020UL,
+	  0x08020000UL, 0x08000800UL, 0x08000820UL, 0x00000000UL,
+	  0x08020820UL, 0x00020800UL, 0x00020800UL, 0x00000820UL,
+	  0x00000820UL, 0x00020020UL, 0x08000000UL, 0x08020800UL } };
 
 static uint8_t libfcrypto_des3_permuted_choice_table1[ 56 ] = {
 	57, 49, 41, 33, 25, 17, 9, 1, 58, 50, 42, 34, 26, 18, 10, 2,
@@ -97,6 +178,58 @@ static uint8_t libfcrypto_des3_permuted_choice_table2[ 48 ] = {
 static uint8_t libfcrypto_des3_iteration_shift[ 16 ] = {
 	1, 1, 2, 2, 2, 2, 2, 2, 1, 2, 2, 2, 2, 2, 2, 1 };
 
+/* Calculates the initial permutation (IP) as a sequence of bit swaps
+ */
+#define libfcrypto_des3_calculate_initial_permutation( value_left, value_right, value_32bit ) \
+	value_32bit  = ( ( value_left >> 4 ) ^ value_right ) & 0x0f0f0f0fUL; \
+	value_right ^= value_32bit; \
+	value_left  ^= value_32bit << 4; \
+	value_32bit  = ( ( value_left >> 16 ) ^ value_right ) & 0x0000ffffUL; \
+	value_right ^= value_32bit; \
+	value_left  ^= value_32bit << 16; \
+	value_32bit  = ( ( value_right >> 2 ) ^ value_left ) & 0x33333333UL; \
+	value_left  ^= value_32bit; \
+	value_right ^= value_32bit << 2; \
+	value_32bit  = ( ( value_right >> 8 ) ^ value_left ) & 0x00ff00ffUL; \
+	value_left  ^= value_32bit; \
+	value_right ^= value_32bit << 8; \
+	value_32bit  = ( ( value_left >> 1 ) ^ value_right ) & 0x55555555UL; \
+	value_right ^= value_32bit; \
+	value_left  ^= value_32bit << 1;
+
+/* Calculates the final permutation (FP), the inverse of the initial permutation
+ */
+#define libfcrypto_des3_calculate_final_permutation( value_left, value_right, value_32bit ) \
+	value_32bit  = ( ( value_left >> 1 ) ^ value_right ) & 0x55555555UL; \
+	value_right ^= value_32bit; \
+	value_left  ^= value_32bit << 1; \
+	value_32bit  = ( ( value_right >> 8 ) ^ value_left ) & 0x00ff00ffUL; \
+	value_left  ^= value_32bit; \
+	value_right ^= value_32bit << 8; \
+	value_32bit  = ( ( value_right >> 2 ) ^ value_left ) & 0x33333333UL; \
+	value_left  ^= value_32bit; \
+	value_right ^= value_32bit << 2; \
+	value_32bit  = ( ( value_left >> 16 ) ^ value_right ) & 0x0000ffffUL; \
+	value_right ^= value_32bit; \
+	value_left  ^= value_32bit << 16; \
+	value_32bit  = ( ( value_left >> 4 ) ^ value_right ) & 0x0f0f0f0fUL; \
+	value_right ^= value_32bit; \
+	value_left  ^= value_32bit << 4;
+
+/* Calculates a DES round, where the expansion (E) of the right value is
+ * done by taking overlapping 6-bit groups from the rotated right value
+ */
+#define libfcrypto_des3_calculate_round( value_left, value_right, sub_key, value_32bit ) \
+	value_32bit  = libfcrypto_des3_sbox_permutation_table[ 0 ][ ( ( byte_stream_bit_rotate_right_32bit( value_right, 1 ) >> 26 ) ^ ( sub_key >> 42 ) ) & 0x3f ]; \
+	value_32bit |= libfcrypto_des3_sbox_permutation_table[ 1 ][ ( ( value_right >> 23 ) ^ ( sub_key >> 36 ) ) & 0x3f ]; \
+	value_32bit |= libfcrypto_des3_sbox_permutation_table[ 2 ][ ( ( value_right >> 19 ) ^ ( sub_key >> 30 ) ) & 0x3f ]; \
+	value_32bit |= libfcrypto_des3_sbox_permutation_table[ 3 ][ ( ( value_right >> 15 ) ^ ( sub_key >> 24 ) ) & 0x3f ]; \
+	value_32bit |= libfcrypto_des3_sbox_permutation_table[ 4 ][ ( ( value_right >> 11 ) ^ ( sub_key >> 18 ) ) & 0x3f ]; \
+	value_32bit |= libfcrypto_des3_sbox_permutation_table[ 5 ][ ( ( value_right >> 7 ) ^ ( sub_key >> 12 ) ) & 0x3f ]; \
+	value_32bit |= libfcrypto_des3_sbox_permutation_table[ 6 ][ ( ( value_right >> 3 ) ^ ( sub_key >> 6 ) ) & 0x3f ]; \
+	value_32bit |= libfcrypto_des3_sbox_permutation_table[ 7 ][ ( ( byte_stream_bit_rotate_left_32bit( value_right, 1 ) ) ^ sub_key ) & 0x3f ]; \
+	value_left  ^= value_32bit;
+
 /* Creates a DES3 context
  * Make sure the value context is referencing, is set to NULL
  * Returns 1 if successful or -1 on error
@@ -158,6 +291,15 @@ int libfcrypto_des3_context_initialize(
 
 		goto on_error;
 	}
+#if defined( LIBFCRYPTO_DES3_BITSLICE_HAVE_AVX2 )
+	/* The bitsliced function is selected once per context
+	 */
+	if( libfcrypto_cpu_get_level() >= LIBFCRYPTO_CPU_LEVEL_AVX2 )
+	{
+		internal_context->bitslice_crypt_slices_function = libfcrypto_des3_bitslice_crypt_slices_avx2;
+		internal_context->bitslice_number_of_blocks      = LIBFCRYPTO_DES3_BITSLICE_MAXIMUM_NUMBER_OF_BLOCKS;
+	}
+#endif
 	*context = (libfcrypto_des3_context_t *) internal_context;
 
 	return( 1 );
@@ -230,6 +372,7 @@ int libfcrypto_des3_context_set_key(
 	libfcrypto_internal_des3_context_t *internal_context = NULL;
 	static char *function                                = "libfcrypto_des3_context_set_key";
 	uint64_t value_64bit                                 = 0;
+	int key_index                                        = 0;
 
 	if( context == NULL )
 	{
@@ -332,40 +475,89 @@ int libfcrypto_des3_context_set_key(
 	}
 	internal_context->keys[ 2 ] = value_64bit;
 
+	for( key_index = 0;
+	     key_index < 3;
+	     key_index++ )
+	{
+		if( libfcrypto_internal_des3_context_expand_key(
+		     internal_context,
+		     key_index,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to expand key: %d.",
+			 function,
+			 key_index );
+
+			goto on_error;
+		}
+	}
+	/* When 2 consecutive keys are the same their DES operations cancel out
+	 * and DES3 reduces to single DES with the remaining key
+	 */
+	internal_context->is_single_des        = 0;
+	internal_context->single_des_key_index = 0;
+
+	if( memory_compare(
+	     internal_context->encryption_sub_keys[ 0 ],
+	     internal_context->encryption_sub_keys[ 1 ],
+	     sizeof( uint64_t ) * 16 ) == 0 )
+	{
+		internal_context->is_single_des        = 1;
+		internal_context->single_des_key_index = 2;
+	}
+	else if( memory_compare(
+	          internal_context->encryption_sub_keys[ 1 ],
+	          internal_context->encryption_sub_keys[ 2 ],
+	          sizeof( uint64_t ) * 16 ) == 0 )
+	{
+		internal_context->is_single_des        = 1;
+		internal_context->single_des_key_index = 0;
+	}
 	return( 1 );
+
+on_error:
+	/* Only clear the key material, the CPU specific functions remain valid
+	 */
+	memory_set(
+	 internal_context->keys,
+	 0,
+	 sizeof( uint64_t ) * 3 );
+
+	memory_set(
+	 internal_context->encryption_sub_keys,
+	 0,
+	 sizeof( uint64_t ) * 3 * 16 );
+
+	memory_set(
+	 internal_context->decryption_sub_keys,
+	 0,
+	 sizeof( uint64_t ) * 3 * 16 );
+
+	internal_context->is_single_des        = 0;
+	internal_context->single_des_key_index = 0;
+
+	return( -1 );
 }
 
-/* De- or encrypts a block of data using DES3
- * The size must be a multitude of the DES3 block size (8 byte)
+/* Expands a key into the encryption and decryption sub keys
  * Returns 1 if successful or -1 on error
  */
-int libfcrypto_internal_des3_context_crypt_block(
+int libfcrypto_internal_des3_context_expand_key(
      libfcrypto_internal_des3_context_t *internal_context,
-     uint64_t key_value,
-     int mode,
-     uint64_t input_value,
-     uint64_t *output_value,
+     int key_index,
      libcerror_error_t **error )
 {
-	uint64_t sub_keys[ 16 ];
-
-	static char *function                = "libfcrypto_internal_des3_context_crypt_block";
-	uint64_t bit_mask                    = 0;
-	uint64_t permuted_output_value       = 0;
+	static char *function                = "libfcrypto_internal_des3_context_expand_key";
+	uint64_t sub_key                     = 0;
 	uint64_t value_64bit                 = 0;
-	uint32_t function_result             = 0;
-	uint32_t permutation_lower_32bit     = 0;
-	uint32_t permutation_upper_32bit     = 0;
 	uint32_t permuted_choice_lower_32bit = 0;
 	uint32_t permuted_choice_upper_32bit = 0;
-	uint32_t sbox_output                 = 0;
-	uint32_t value_32bit                 = 0;
 	uint8_t bit_shift                    = 0;
-	uint8_t column_bit_mask              = 0;
-	uint8_t crypt_key_index              = 0;
 	uint8_t iteration_shift              = 0;
-	uint8_t row_bit_mask                 = 0;
-	uint8_t sbox_index                   = 0;
 	uint8_t sub_key_index                = 0;
 	uint8_t table_index                  = 0;
 
@@ -380,46 +572,19 @@ int libfcrypto_internal_des3_context_crypt_block(
 
 		return( -1 );
 	}
-	if( ( mode != LIBFCRYPTO_DES3_CRYPT_MODE_ENCRYPT )
-	 && ( mode != LIBFCRYPTO_DES3_CRYPT_MODE_DECRYPT ) )
+	if( ( key_index < 0 )
+	 || ( key_index >= 3 ) )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-		 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
-		 "%s: unsupported mode.",
-		 function );
-
-		return( -1 );
-	}
-	if( output_value == NULL )
-	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid output value.",
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid key index value out of bounds.",
 		 function );
 
 		return( -1 );
 	}
-	/* Calculate the permutation
-	 */
-	value_64bit = 0;
-
-	for( table_index = 0;
-	     table_index < 64;
-	     table_index++ )
-	{
-		bit_shift = 64 - libfcrypto_des3_permutation_table[ table_index ];
-
-		value_64bit <<= 1;
-		value_64bit  |= ( input_value >> bit_shift ) & 1ULL;
-	}
-	permutation_upper_32bit = (uint32_t) ( ( value_64bit >> 32 ) & 0xffffffffUL );
-	permutation_lower_32bit = (uint32_t) ( value_64bit & 0xffffffffUL );
-
-	/* Calculate the key schedule
+	/* Calculate the permuted choice 1
 	 */
 	value_64bit = 0;
 
@@ -430,12 +595,12 @@ int libfcrypto_internal_des3_context_crypt_block(
 		bit_shift = 64 - libfcrypto_des3_permuted_choice_table1[ table_index ];
 
 		value_64bit <<= 1;
-		value_64bit  |= ( key_value >> bit_shift ) & 1ULL;
+		value_64bit  |= ( internal_context->keys[ key_index ] >> bit_shift ) & 1ULL;
 	}
 	permuted_choice_upper_32bit = (uint32_t) ( ( value_64bit >> 28 ) & 0x0fffffffUL );
 	permuted_choice_lower_32bit = (uint32_t) ( value_64bit & 0x0fffffffUL );
 
-	/* Calculate the 16 sub keys
+	/* Calculate the 16 sub keys, the decryption sub keys are stored in reverse order
 	 */
 	for( sub_key_index = 0;
 	     sub_key_index < 16;
@@ -452,105 +617,220 @@ int libfcrypto_internal_des3_context_crypt_block(
 			permuted_choice_lower_32bit = ( ( permuted_choice_lower_32bit << 1 ) & 0x0fffffffUL ) | ( ( permuted_choice_lower_32bit >> 27 ) & 0x00000001UL );
 		}
 		value_64bit = ( (uint64_t) permuted_choice_upper_32bit << 28 ) | permuted_choice_lower_32bit;
-        
-		sub_keys[ sub_key_index ] = 0;
-        
+
+		sub_key = 0;
+
 		for( table_index = 0;
 		     table_index < 48;
 		     table_index++ )
 		{
 			bit_shift = 56 - libfcrypto_des3_permuted_choice_table2[ table_index ];
 
-			sub_keys[ sub_key_index ] <<= 1;
-			sub_keys[ sub_key_index ]  |= ( value_64bit >> bit_shift ) & 1ULL;
+			sub_key <<= 1;
+			sub_key  |= ( value_64bit >> bit_shift ) & 1ULL;
 		}
+		internal_context->encryption_sub_keys[ key_index ][ sub_key_index ]      = sub_key;
+		internal_context->decryption_sub_keys[ key_index ][ 15 - sub_key_index ] = sub_key;
 	}
-	sbox_output = 0;
+	return( 1 );
+}
 
-	for( sub_key_index = 0;
-	     sub_key_index < 16;
-	     sub_key_index++ )
+/* Retrieves the sub keys in the order they are applied
+ * The sub keys must be able to contain 3 sub keys sets, the number of sub keys
+ * is 1 when the keys reduce to single DES or 3 otherwise
+ * Returns 1 if successful or -1 on error
+ */
+int libfcrypto_internal_des3_context_get_sub_keys(
+     libfcrypto_internal_des3_context_t *internal_context,
+     int mode,
+     const uint64_t **sub_keys,
+     int *number_of_sub_keys,
+     libcerror_error_t **error )
+{
+	static char *function = "libfcrypto_internal_des3_context_get_sub_keys";
+	uint8_t key_index     = 0;
+
+	if( internal_context == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid context.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( mode != LIBFCRYPTO_DES3_CRYPT_MODE_ENCRYPT )
+	 && ( mode != LIBFCRYPTO_DES3_CRYPT_MODE_DECRYPT ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported mode.",
+		 function );
+
+		return( -1 );
+	}
+	if( sub_keys == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid sub keys.",
+		 function );
+
+		return( -1 );
+	}
+	if( number_of_sub_keys == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid number of sub keys.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_context->is_single_des != 0 )
 	{
+		key_index = internal_context->single_des_key_index;
+
 		if( mode == LIBFCRYPTO_DES3_CRYPT_MODE_ENCRYPT )
 		{
-			crypt_key_index = sub_key_index;
+			sub_keys[ 0 ] = internal_context->encryption_sub_keys[ key_index ];
 		}
 		else
 		{
-			crypt_key_index = 15 - sub_key_index;
+			sub_keys[ 0 ] = internal_context->decryption_sub_keys[ key_index ];
 		}
-		value_64bit = 0;
-        
-		for( table_index = 0;
-		     table_index < 48;
-		     table_index++ )
+		*number_of_sub_keys = 1;
+	}
+	else
+	{
+		if( mode == LIBFCRYPTO_DES3_CRYPT_MODE_ENCRYPT )
 		{
-			bit_shift = 32 - libfcrypto_des3_expansion_table[ table_index ];
-
-			value_64bit <<= 1;
-			value_64bit  |= ( permutation_lower_32bit >> bit_shift ) & 1ULL;
+			sub_keys[ 0 ] = internal_context->encryption_sub_keys[ 0 ];
+			sub_keys[ 1 ] = internal_context->decryption_sub_keys[ 1 ];
+			sub_keys[ 2 ] = internal_context->encryption_sub_keys[ 2 ];
 		}
-		value_64bit ^= sub_keys[ crypt_key_index ];
-
-		for( table_index = 0;
-		     table_index < 8;
-		     table_index++ )
+		else
 		{
-			sbox_index = table_index * 6;
+			sub_keys[ 0 ] = internal_context->decryption_sub_keys[ 2 ];
+			sub_keys[ 1 ] = internal_context->encryption_sub_keys[ 1 ];
+			sub_keys[ 2 ] = internal_context->decryption_sub_keys[ 0 ];
+		}
+		*number_of_sub_keys = 3;
+	}
+	return( 1 );
+}
 
-			bit_mask  = 0x0000840000000000ULL >> sbox_index;
-			bit_shift = 42 - sbox_index;
+/* De- or encrypts a block of data using DES3 EDE (encrypt-decrypt-encrypt)
+ * The sub keys are retrieved once per buffer with libfcrypto_internal_des3_context_get_sub_keys
+ * The initial and final permutation are only applied once, since the final
+ * and initial permutation between the DES operations cancel out
+ * Only a single DES operation is applied when the keys reduce to single DES
+ * Returns 1 if successful or -1 on error
+ */
+int libfcrypto_internal_des3_context_crypt_block_ede(
+     const uint64_t **sub_keys,
+     int number_of_sub_keys,
+     uint64_t input_value,
+     uint64_t *output_value,
+     libcerror_error_t **error )
+{
+	static char *function = "libfcrypto_internal_des3_context_crypt_block_ede";
+	uint64_t sub_key      = 0;
+	uint32_t value_32bit  = 0;
+	uint32_t value_left   = 0;
+	uint32_t value_right  = 0;
+	uint8_t sub_key_index = 0;
+	int key_index         = 0;
+
+	if( sub_keys == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid sub keys.",
+		 function );
 
-			row_bit_mask = (uint8_t) ( ( value_64bit & bit_mask ) >> bit_shift );
-			row_bit_mask = ( row_bit_mask >> 4 ) | ( row_bit_mask & 0x01 );
+		return( -1 );
+	}
+	if( ( number_of_sub_keys != 1 )
+	 && ( number_of_sub_keys != 3 ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported number of sub keys.",
+		 function );
 
-			bit_mask  = 0x0000780000000000ULL >> sbox_index;
-			bit_shift = 43 - sbox_index;
+		return( -1 );
+	}
+	if( output_value == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid output value.",
+		 function );
 
-			column_bit_mask = (uint8_t) ( ( value_64bit & bit_mask ) >> bit_shift );
+		return( -1 );
+	}
+	value_left  = (uint32_t) ( input_value >> 32 );
+	value_right = (uint32_t) ( input_value & 0xffffffffUL );
 
-			sbox_index = ( row_bit_mask << 4 ) | column_bit_mask;
-            
-			sbox_output <<= 4;
-			sbox_output  |= libfcrypto_des3_sboxes[ table_index ][ sbox_index ] & 0x0f;
-		}
-		function_result = 0;
+	libfcrypto_des3_calculate_initial_permutation(
+	 value_left,
+	 value_right,
+	 value_32bit );
 
-		for( table_index = 0;
-		     table_index < 32;
-		     table_index++ )
+	for( key_index = 0;
+	     key_index < number_of_sub_keys;
+	     key_index++ )
+	{
+		for( sub_key_index = 0;
+		     sub_key_index < 16;
+		     sub_key_index++ )
 		{
-			bit_shift = 32 - libfcrypto_des3_post_sbox_permulation[ table_index ];
+			sub_key = sub_keys[ key_index ][ sub_key_index ];
+
+			libfcrypto_des3_calculate_round(
+			 value_left,
+			 value_right,
+			 sub_key,
+			 value_32bit );
 
-			function_result <<= 1;
-			function_result  |= ( sbox_output >> bit_shift ) & 1UL;
+			value_32bit = value_left;
+			value_left  = value_right;
+			value_right = value_32bit;
 		}
-		value_32bit             = permutation_lower_32bit;
-		permutation_lower_32bit = permutation_upper_32bit ^ function_result;
-		permutation_upper_32bit = value_32bit;
+		/* Undo the swap of the last round
+		 */
+		value_32bit = value_left;
+		value_left  = value_right;
+		value_right = value_32bit;
 	}
-	permuted_output_value = ( (uint64_t) permutation_lower_32bit << 32 ) | permutation_upper_32bit;
+	libfcrypto_des3_calculate_final_permutation(
+	 value_left,
+	 value_right,
+	 value_32bit );
 
-	/* Calculate the inverse permutation
-	 */
-	value_64bit = 0;
-
-	for( table_index = 0;
-	     table_index < 64;
-	     table_index++ )
-	{
-		bit_shift = 64 - libfcrypto_des3_inverse_permutation_table[ table_index ];
-
-		value_64bit <<= 1;
-		value_64bit  |= ( permuted_output_value >> bit_shift ) & 1ULL;
-	}
-	*output_value = value_64bit;
+	*output_value = ( (uint64_t) value_left << 32 ) | value_right;
 
 	return( 1 );
 }
 
 /* De- or encrypts a block of data using DES3-CBC (Cipher Block Chaining)
  * The size must be a multitude of the DES3 block size (8 byte)
+ * The input and output data can be the same buffer
  * Returns 1 if successful or -1 on error
  */
 int libfcrypto_des3_crypt_cbc(
@@ -564,13 +844,18 @@ int libfcrypto_des3_crypt_cbc(
      size_t output_data_size,
      libcerror_error_t **error )
 {
+	uint64_t values[ LIBFCRYPTO_DES3_BITSLICE_MAXIMUM_NUMBER_OF_BLOCKS ];
 	uint8_t block_data[ 8 ];
 	uint8_t internal_initialization_vector[ 8 ];
+	const uint64_t *sub_keys[ 3 ];
 
 	libfcrypto_internal_des3_context_t *internal_context = NULL;
 	static char *function                                = "libfcrypto_des3_crypt_cbc";
 	size_t data_offset                                   = 0;
+	size_t number_of_values                              = 0;
+	size_t value_index                                   = 0;
 	uint64_t value_64bit                                 = 0;
+	int number_of_sub_keys                               = 0;
 
 #if !defined( LIBFCRYPTO_UNFOLLED_LOOPS )
 	uint8_t block_index                                  = 0;
@@ -672,6 +957,22 @@ int libfcrypto_des3_crypt_cbc(
 
 		return( -1 );
 	}
+	if( libfcrypto_internal_des3_context_get_sub_keys(
+	     internal_context,
+	     mode,
+	     sub_keys,
+	     &number_of_sub_keys,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve sub keys.",
+		 function );
+
+		return( -1 );
+	}
 	if( memory_copy(
 	     internal_initialization_vector,
 	     initialization_vector,
@@ -686,6 +987,103 @@ int libfcrypto_des3_crypt_cbc(
 
 		goto on_error;
 	}
+	/* In decryption mode the blocks do not depend on each other and the bitsliced
+	 * functions are used for the blocks that can be decrypted in batches of 64
+	 */
+	while( ( mode == LIBFCRYPTO_DES3_CRYPT_MODE_DECRYPT )
+	    && ( ( input_data_size - data_offset ) >= ( LIBFCRYPTO_DES3_BITSLICE_NUMBER_OF_BLOCKS * 8 ) ) )
+	{
+		number_of_values = ( input_data_size - data_offset ) / 8;
+
+		if( number_of_values > LIBFCRYPTO_DES3_BITSLICE_MAXIMUM_NUMBER_OF_BLOCKS )
+		{
+			number_of_values = LIBFCRYPTO_DES3_BITSLICE_MAXIMUM_NUMBER_OF_BLOCKS;
+		}
+		number_of_values -= number_of_values % LIBFCRYPTO_DES3_BITSLICE_NUMBER_OF_BLOCKS;
+
+		for( value_index = 0;
+		     value_index < number_of_values;
+		     value_index++ )
+		{
+			byte_stream_copy_to_uint64_big_endian(
+			 &( input_data[ data_offset + ( value_index * 8 ) ] ),
+			 values[ value_index ] );
+		}
+		if( libfcrypto_des3_bitslice_crypt_blocks(
+		     internal_context,
+		     mode,
+		     values,
+		     number_of_values,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_ENCRYPTION,
+			 LIBCERROR_ENCRYPTION_ERROR_GENERIC,
+			 "%s: unable to decrypt input data using bitsliced DES3.",
+			 function );
+
+			goto on_error;
+		}
+		/* The last encrypted block is the initialization vector of the next batch
+		 */
+		if( memory_copy(
+		     block_data,
+		     &( input_data[ data_offset + ( ( number_of_values - 1 ) * 8 ) ] ),
+		     8 ) == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+			 "%s: unable to copy encrypted input data to block data.",
+			 function );
+
+			goto on_error;
+		}
+		/* The blocks are written in reverse order so that the preceding encrypted
+		 * block is still available when the input and output data are the same
+		 */
+		for( value_index = number_of_values - 1;
+		     value_index > 0;
+		     value_index-- )
+		{
+			byte_stream_copy_to_uint64_big_endian(
+			 &( input_data[ data_offset + ( ( value_index - 1 ) * 8 ) ] ),
+			 value_64bit );
+
+			value_64bit ^= values[ value_index ];
+
+			byte_stream_copy_from_uint64_big_endian(
+			 &( output_data[ data_offset + ( value_index * 8 ) ] ),
+			 value_64bit );
+		}
+		byte_stream_copy_to_uint64_big_endian(
+		 internal_initialization_vector,
+		 value_64bit );
+
+		value_64bit ^= values[ 0 ];
+
+		byte_stream_copy_from_uint64_big_endian(
+		 &( output_data[ data_offset ] ),
+		 value_64bit );
+
+		if( memory_copy(
+		     internal_initialization_vector,
+		     block_data,
+		     8 ) == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+			 "%s: unable to copy block data to initialization vector.",
+			 function );
+
+			goto on_error;
+		}
+		data_offset += number_of_values * 8;
+	}
 	while( data_offset < input_data_size )
 	{
 		if( mode == LIBFCRYPTO_DES3_CRYPT_MODE_ENCRYPT )
@@ -713,27 +1111,9 @@ int libfcrypto_des3_crypt_cbc(
 			 block_data,
 			 value_64bit );
 
-			if( libfcrypto_internal_des3_context_crypt_block(
-			     internal_context,
-			     internal_context->keys[ 0 ],
-			     LIBFCRYPTO_DES3_CRYPT_MODE_ENCRYPT,
-			     value_64bit,
-			     &value_64bit,
-			     error ) != 1 )
-			{
-				libcerror_error_set(
-				 error,
-				 LIBCERROR_ERROR_DOMAIN_ENCRYPTION,
-				 LIBCERROR_ENCRYPTION_ERROR_GENERIC,
-				 "%s: unable to encrypt input data with first key.",
-				 function );
-
-				goto on_error;
-			}
-			if( libfcrypto_internal_des3_context_crypt_block(
-			     internal_context,
-			     internal_context->keys[ 1 ],
-			     LIBFCRYPTO_DES3_CRYPT_MODE_DECRYPT,
+			if( libfcrypto_internal_des3_context_crypt_block_ede(
+			     sub_keys,
+			     number_of_sub_keys,
 			     value_64bit,
 			     &value_64bit,
 			     error ) != 1 )
@@ -742,24 +1122,7 @@ int libfcrypto_des3_crypt_cbc(
 				 error,
 				 LIBCERROR_ERROR_DOMAIN_ENCRYPTION,
 				 LIBCERROR_ENCRYPTION_ERROR_GENERIC,
-				 "%s: unable to decrypt input data with second key.",
-				 function );
-
-				goto on_error;
-			}
-			if( libfcrypto_internal_des3_context_crypt_block(
-			     internal_context,
-			     internal_context->keys[ 2 ],
-			     LIBFCRYPTO_DES3_CRYPT_MODE_ENCRYPT,
-			     value_64bit,
-			     &value_64bit,
-			     error ) != 1 )
-			{
-				libcerror_error_set(
-				 error,
-				 LIBCERROR_ERROR_DOMAIN_ENCRYPTION,
-				 LIBCERROR_ENCRYPTION_ERROR_GENERIC,
-				 "%s: unable to encrypt input data with third key.",
+				 "%s: unable to encrypt input data.",
 				 function );
 
 				goto on_error;
@@ -785,48 +1148,30 @@ int libfcrypto_des3_crypt_cbc(
 		}
 		else
 		{
-			byte_stream_copy_to_uint64_big_endian(
-			 &( input_data[ data_offset ] ),
-			 value_64bit );
-
-			if( libfcrypto_internal_des3_context_crypt_block(
-			     internal_context,
-			     internal_context->keys[ 2 ],
-			     LIBFCRYPTO_DES3_CRYPT_MODE_DECRYPT,
-			     value_64bit,
-			     &value_64bit,
-			     error ) != 1 )
+			/* The encrypted input block is the initialization vector of the next block
+			 * and is stored before the output data can overwrite it
+			 */
+			if( memory_copy(
+			     block_data,
+			     &( input_data[ data_offset ] ),
+			     8 ) == NULL )
 			{
 				libcerror_error_set(
 				 error,
-				 LIBCERROR_ERROR_DOMAIN_ENCRYPTION,
-				 LIBCERROR_ENCRYPTION_ERROR_GENERIC,
-				 "%s: unable to decrypt input data with third key.",
+				 LIBCERROR_ERROR_DOMAIN_MEMORY,
+				 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+				 "%s: unable to copy encrypted input data to block data.",
 				 function );
 
 				goto on_error;
 			}
-			if( libfcrypto_internal_des3_context_crypt_block(
-			     internal_context,
-			     internal_context->keys[ 1 ],
-			     LIBFCRYPTO_DES3_CRYPT_MODE_ENCRYPT,
-			     value_64bit,
-			     &value_64bit,
-			     error ) != 1 )
-			{
-				libcerror_error_set(
-				 error,
-				 LIBCERROR_ERROR_DOMAIN_ENCRYPTION,
-				 LIBCERROR_ENCRYPTION_ERROR_GENERIC,
-				 "%s: unable to endrypt input data with second key.",
-				 function );
+			byte_stream_copy_to_uint64_big_endian(
+			 &( input_data[ data_offset ] ),
+			 value_64bit );
 
-				goto on_error;
-			}
-			if( libfcrypto_internal_des3_context_crypt_block(
-			     internal_context,
-			     internal_context->keys[ 0 ],
-			     LIBFCRYPTO_DES3_CRYPT_MODE_DECRYPT,
+			if( libfcrypto_internal_des3_context_crypt_block_ede(
+			     sub_keys,
+			     number_of_sub_keys,
 			     value_64bit,
 			     &value_64bit,
 			     error ) != 1 )
@@ -835,7 +1180,7 @@ int libfcrypto_des3_crypt_cbc(
 				 error,
 				 LIBCERROR_ERROR_DOMAIN_ENCRYPTION,
 				 LIBCERROR_ENCRYPTION_ERROR_GENERIC,
-				 "%s: unable to decrypt input data with first key.",
+				 "%s: unable to decrypt input data.",
 				 function );
 
 				goto on_error;
@@ -865,14 +1210,14 @@ int libfcrypto_des3_crypt_cbc(
 
 			if( memory_copy(
 			     internal_initialization_vector,
-			     &( input_data[ data_offset ] ),
+			     block_data,
 			     8 ) == NULL )
 			{
 				libcerror_error_set(
 				 error,
 				 LIBCERROR_ERROR_DOMAIN_MEMORY,
 				 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
-				 "%s: unable to copy encrypted input data to initialization vector.",
+				 "%s: unable to copy block data to initialization vector.",
 				 function );
 
 				goto on_error;
@@ -908,9 +1253,31 @@ int libfcrypto_des3_crypt_cbc(
 
 		goto on_error;
 	}
+	if( number_of_values > 0 )
+	{
+		if( memory_set(
+		     values,
+		     0,
+		     sizeof( uint64_t ) * LIBFCRYPTO_DES3_BITSLICE_MAXIMUM_NUMBER_OF_BLOCKS ) == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+			 "%s: unable to clear values.",
+			 function );
+
+			goto on_error;
+		}
+	}
 	return( 1 );
 
 on_error:
+	memory_set(
+	 values,
+	 0,
+	 sizeof( uint64_t ) * LIBFCRYPTO_DES3_BITSLICE_MAXIMUM_NUMBER_OF_BLOCKS );
+
 	memory_set(
 	 internal_initialization_vector,
 	 0,
@@ -924,6 +1291,100 @@ on_error:
 	return( -1 );
 }
 
+/* Encrypts counter blocks using Triple DES-ECB
+ * Callback function for libfcrypto_ctr_crypt
+ * Returns 1 if successful or -1 on error
+ */
+int libfcrypto_internal_des3_context_encrypt_counter_blocks(
+     intptr_t *context,
+     const uint8_t *input_data,
+     size_t input_data_size,
+     uint8_t *output_data,
+     size_t output_data_size,
+     libcerror_error_t **error )
+{
+	return( libfcrypto_des3_crypt_ecb(
+	         (libfcrypto_des3_context_t *) context,
+	         LIBFCRYPTO_DES3_CRYPT_MODE_ENCRYPT,
+	         input_data,
+	         input_data_size,
+	         output_data,
+	         output_data_size,
+	         error ) );
+}
+
+/* De- or encrypts a block of data using DES3-CTR (Counter)
+ * The key stream is the encryption of consecutive counter blocks, that start with the initial counter block
+ * The counter is stored in the last counter size bytes of the counter block if big-endian
+ * and in the first counter size bytes if little-endian, and wraps around
+ * The offset is the byte offset of the input data relative to the start of the key stream,
+ * which allows to de- or encrypt data at any offset without processing the preceding data
+ * Since de- and encryption are the same operation no mode is required
+ * Returns 1 if successful or -1 on error
+ */
+int libfcrypto_des3_crypt_ctr(
+     libfcrypto_des3_context_t *context,
+     const uint8_t *initial_counter_block,
+     size_t initial_counter_block_size,
+     size_t counter_size,
+     int counter_byte_order,
+     uint64_t offset,
+     const uint8_t *input_data,
+     size_t input_data_size,
+     uint8_t *output_data,
+     size_t output_data_size,
+     libcerror_error_t **error )
+{
+	static char *function = "libfcrypto_des3_crypt_ctr";
+
+	if( context == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid context.",
+		 function );
+
+		return( -1 );
+	}
+	if( initial_counter_block_size != 8 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid initial counter block size value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( libfcrypto_ctr_crypt(
+	     (intptr_t *) context,
+	     &libfcrypto_internal_des3_context_encrypt_counter_blocks,
+	     8,
+	     initial_counter_block,
+	     counter_size,
+	     counter_byte_order,
+	     offset,
+	     input_data,
+	     input_data_size,
+	     output_data,
+	     output_data_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ENCRYPTION,
+		 LIBCERROR_ENCRYPTION_ERROR_GENERIC,
+		 "%s: unable to de/encrypt data.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
 /* De- or encrypts a block of data using DES3-ECB (Electronic CodeBook)
  * The size must be a multitude of the DES3 block size (8 byte)
  * Returns 1 if successful or -1 on error
@@ -937,10 +1398,16 @@ int libfcrypto_des3_crypt_ecb(
      size_t output_data_size,
      libcerror_error_t **error )
 {
+	uint64_t values[ LIBFCRYPTO_DES3_BITSLICE_MAXIMUM_NUMBER_OF_BLOCKS ];
+	const uint64_t *sub_keys[ 3 ];
+
 	libfcrypto_internal_des3_context_t *internal_context = NULL;
 	static char *function                                = "libfcrypto_des3_crypt_ecb";
 	size_t data_offset                                   = 0;
+	size_t number_of_values                              = 0;
+	size_t value_index                                   = 0;
 	uint64_t value_64bit                                 = 0;
+	int number_of_sub_keys                               = 0;
 
 	if( context == NULL )
 	{
@@ -1016,119 +1483,103 @@ int libfcrypto_des3_crypt_ecb(
 
 		return( -1 );
 	}
-	while( data_offset < input_data_size )
+	if( libfcrypto_internal_des3_context_get_sub_keys(
+	     internal_context,
+	     mode,
+	     sub_keys,
+	     &number_of_sub_keys,
+	     error ) != 1 )
 	{
-		byte_stream_copy_to_uint64_big_endian(
-		 &( input_data[ data_offset ] ),
-		 value_64bit );
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve sub keys.",
+		 function );
 
-		if( mode == LIBFCRYPTO_DES3_CRYPT_MODE_ENCRYPT )
+		return( -1 );
+	}
+	/* The bitsliced functions are used for the blocks that can be (de/en)crypted
+	 * in batches of 64, the remaining blocks are (de/en)crypted one at a time
+	 */
+	while( ( input_data_size - data_offset ) >= ( LIBFCRYPTO_DES3_BITSLICE_NUMBER_OF_BLOCKS * 8 ) )
+	{
+		number_of_values = ( input_data_size - data_offset ) / 8;
+
+		if( number_of_values > LIBFCRYPTO_DES3_BITSLICE_MAXIMUM_NUMBER_OF_BLOCKS )
 		{
-			if( libfcrypto_internal_des3_context_crypt_block(
-			     internal_context,
-			     internal_context->keys[ 0 ],
-			     LIBFCRYPTO_DES3_CRYPT_MODE_ENCRYPT,
-			     value_64bit,
-			     &value_64bit,
-			     error ) != 1 )
-			{
-				libcerror_error_set(
-				 error,
-				 LIBCERROR_ERROR_DOMAIN_ENCRYPTION,
-				 LIBCERROR_ENCRYPTION_ERROR_GENERIC,
-				 "%s: unable to encrypt input data with first key.",
-				 function );
+			number_of_values = LIBFCRYPTO_DES3_BITSLICE_MAXIMUM_NUMBER_OF_BLOCKS;
+		}
+		number_of_values -= number_of_values % LIBFCRYPTO_DES3_BITSLICE_NUMBER_OF_BLOCKS;
 
-				return( -1 );
-			}
-			if( libfcrypto_internal_des3_context_crypt_block(
-			     internal_context,
-			     internal_context->keys[ 1 ],
-			     LIBFCRYPTO_DES3_CRYPT_MODE_DECRYPT,
-			     value_64bit,
-			     &value_64bit,
-			     error ) != 1 )
-			{
-				libcerror_error_set(
-				 error,
-				 LIBCERROR_ERROR_DOMAIN_ENCRYPTION,
-				 LIBCERROR_ENCRYPTION_ERROR_GENERIC,
-				 "%s: unable to decrypt input data with second key.",
-				 function );
+		for( value_index = 0;
+		     value_index < number_of_values;
+		     value_index++ )
+		{
+			byte_stream_copy_to_uint64_big_endian(
+			 &( input_data[ data_offset + ( value_index * 8 ) ] ),
+			 values[ value_index ] );
+		}
+		if( libfcrypto_des3_bitslice_crypt_blocks(
+		     internal_context,
+		     mode,
+		     values,
+		     number_of_values,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_ENCRYPTION,
+			 LIBCERROR_ENCRYPTION_ERROR_GENERIC,
+			 "%s: unable to crypt input data using bitsliced DES3.",
+			 function );
 
-				return( -1 );
-			}
-			if( libfcrypto_internal_des3_context_crypt_block(
-			     internal_context,
-			     internal_context->keys[ 2 ],
-			     LIBFCRYPTO_DES3_CRYPT_MODE_ENCRYPT,
-			     value_64bit,
-			     &value_64bit,
-			     error ) != 1 )
-			{
-				libcerror_error_set(
-				 error,
-				 LIBCERROR_ERROR_DOMAIN_ENCRYPTION,
-				 LIBCERROR_ENCRYPTION_ERROR_GENERIC,
-				 "%s: unable to encrypt input data with third key.",
-				 function );
+			memory_set(
+			 values,
+			 0,
+			 sizeof( uint64_t ) * LIBFCRYPTO_DES3_BITSLICE_MAXIMUM_NUMBER_OF_BLOCKS );
 
-				return( -1 );
-			}
+			return( -1 );
 		}
-		else
+		for( value_index = 0;
+		     value_index < number_of_values;
+		     value_index++ )
 		{
-			if( libfcrypto_internal_des3_context_crypt_block(
-			     internal_context,
-			     internal_context->keys[ 2 ],
-			     LIBFCRYPTO_DES3_CRYPT_MODE_DECRYPT,
-			     value_64bit,
-			     &value_64bit,
-			     error ) != 1 )
-			{
-				libcerror_error_set(
-				 error,
-				 LIBCERROR_ERROR_DOMAIN_ENCRYPTION,
-				 LIBCERROR_ENCRYPTION_ERROR_GENERIC,
-				 "%s: unable to decrypt input data with third key.",
-				 function );
+			byte_stream_copy_from_uint64_big_endian(
+			 &( output_data[ data_offset ] ),
+			 values[ value_index ] );
 
-				return( -1 );
-			}
-			if( libfcrypto_internal_des3_context_crypt_block(
-			     internal_context,
-			     internal_context->keys[ 1 ],
-			     LIBFCRYPTO_DES3_CRYPT_MODE_ENCRYPT,
-			     value_64bit,
-			     &value_64bit,
-			     error ) != 1 )
-			{
-				libcerror_error_set(
-				 error,
-				 LIBCERROR_ERROR_DOMAIN_ENCRYPTION,
-				 LIBCERROR_ENCRYPTION_ERROR_GENERIC,
-				 "%s: unable to endrypt input data with second key.",
-				 function );
+			data_offset += 8;
+		}
+	}
+	if( number_of_values > 0 )
+	{
+		memory_set(
+		 values,
+		 0,
+		 sizeof( uint64_t ) * LIBFCRYPTO_DES3_BITSLICE_MAXIMUM_NUMBER_OF_BLOCKS );
+	}
+	while( data_offset < input_data_size )
+	{
+		byte_stream_copy_to_uint64_big_endian(
+		 &( input_data[ data_offset ] ),
+		 value_64bit );
 
-				return( -1 );
-			}
-			if( libfcrypto_internal_des3_context_crypt_block(
-			     internal_context,
-			     internal_context->keys[ 0 ],
-			     LIBFCRYPTO_DES3_CRYPT_MODE_DECRYPT,
-			     value_64bit,
-			     &value_64bit,
-			     error ) != 1 )
-			{
-				libcerror_error_set(
-				 error,
-				 LIBCERROR_ERROR_DOMAIN_ENCRYPTION,
-				 LIBCERROR_ENCRYPTION_ERROR_GENERIC,
-				 "%s: unable to decrypt input data with first key.",
-				 function );
+		if( libfcrypto_internal_des3_context_crypt_block_ede(
+		     sub_keys,
+		     number_of_sub_keys,
+		     value_64bit,
+		     &value_64bit,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_ENCRYPTION,
+			 LIBCERROR_ENCRYPTION_ERROR_GENERIC,
+			 "%s: unable to crypt input data.",
+			 function );
 
-				return( -1 );
-			}
+			return( -1 );
 		}
 		byte_stream_copy_from_uint64_big_endian(
 		 &( output_data[ data_offset ] ),
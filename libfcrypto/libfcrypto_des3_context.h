@@ -40,6 +40,35 @@ struct libfcrypto_internal_des3_context
 	/* The keys
 	 */
 	uint64_t keys[ 3 ];
+
+	/* The encryption sub keys per key
+	 */
+	uint64_t encryption_sub_keys[ 3 ][ 16 ];
+
+	/* The decryption sub keys per key
+	 */
+	uint64_t decryption_sub_keys[ 3 ][ 16 ];
+
+	/* Value to indicate the keys reduce to single DES
+	 */
+	uint8_t is_single_des;
+
+	/* The index of the key used for single DES
+	 */
+	uint8_t single_des_key_index;
+
+	/* The bitsliced function selected by CPU level that (de/en)crypts multiple groups of slices at once
+	 * or NULL if not available
+	 */
+	int (*bitslice_crypt_slices_function)(
+	       const uint64_t **sub_keys,
+	       int number_of_sub_keys,
+	       uint64_t *slices,
+	       libcerror_error_t **error );
+
+	/* The number of blocks processed at once by the bitsliced function
+	 */
+	size_t bitslice_number_of_blocks;
 };
 
 LIBFCRYPTO_EXTERN \
@@ -59,10 +88,21 @@ int libfcrypto_des3_context_set_key(
      size_t key_bit_size,
      libcerror_error_t **error );
 
-int libfcrypto_internal_des3_context_crypt_block(
+int libfcrypto_internal_des3_context_expand_key(
+     libfcrypto_internal_des3_context_t *internal_context,
+     int key_index,
+     libcerror_error_t **error );
+
+int libfcrypto_internal_des3_context_get_sub_keys(
      libfcrypto_internal_des3_context_t *internal_context,
-     uint64_t key_value,
      int mode,
+     const uint64_t **sub_keys,
+     int *number_of_sub_keys,
+     libcerror_error_t **error );
+
+int libfcrypto_internal_des3_context_crypt_block_ede(
+     const uint64_t **sub_keys,
+     int number_of_sub_keys,
      uint64_t input_value,
      uint64_t *output_value,
      libcerror_error_t **error );
@@ -79,6 +119,28 @@ int libfcrypto_des3_crypt_cbc(
      size_t output_data_size,
      libcerror_error_t **error );
 
+int libfcrypto_internal_des3_context_encrypt_counter_blocks(
+     intptr_t *context,
+     const uint8_t *input_data,
+     size_t input_data_size,
+     uint8_t *output_data,
+     size_t output_data_size,
+     libcerror_error_t **error );
+
+LIBFCRYPTO_EXTERN \
+int libfcrypto_des3_crypt_ctr(
+     libfcrypto_des3_context_t *context,
+     const uint8_t *initial_counter_block,
+     size_t initial_counter_block_size,
+     size_t counter_size,
+     int counter_byte_order,
+     uint64_t offset,
+     const uint8_t *input_data,
+     size_t input_data_size,
+     uint8_t *output_data,
+     size_t output_data_size,
+     libcerror_error_t **error );
+
 LIBFCRYPTO_EXTERN \
 int libfcrypto_des3_crypt_ecb(
      libfcrypto_des3_context_t *context,
@@ -0,0 +1,950 @@
+/*
+ * Job queue functions
+ *
+ * Copyright (C) 2017-2024, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <memory.h>
+#include <types.h>
+
+#include "libfcrypto_cipher.h"
+#include "libfcrypto_definitions.h"
+#include "libfcrypto_job_queue.h"
+#include "libfcrypto_libcerror.h"
+#include "libfcrypto_thread_pool.h"
+#include "libfcrypto_types.h"
+
+/* Creates a job queue
+ * Make sure the value job_queue is referencing, is set to NULL
+ * The maximum number of jobs is the number of jobs that can be queued before
+ * a submission is refused. Without worker threads, which is the case without
+ * multi-threading support, submitted jobs are run by the submitting thread
+ * Returns 1 if successful or -1 on error
+ */
+int libfcrypto_job_queue_initialize(
+     libfcrypto_job_queue_t **job_queue,
+     int number_of_threads,
+     int maximum_number_of_jobs,
+     libcerror_error_t **error )
+{
+	libfcrypto_internal_job_queue_t *internal_job_queue = NULL;
+	static char *function                               = "libfcrypto_job_queue_initialize";
+
+#if defined( LIBFCRYPTO_THREAD_POOL_HAVE_PTHREAD )
+	int job_available_condition_initialized             = 0;
+	int jobs_completed_condition_initialized            = 0;
+	int number_of_created_threads                       = 0;
+	int pthread_result                                  = 0;
+	int queue_mutex_initialized                         = 0;
+	int thread_index                                    = 0;
+#endif
+
+	if( job_queue == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid job queue.",
+		 function );
+
+		return( -1 );
+	}
+	if( *job_queue != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid job queue value already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( number_of_threads < 0 )
+	 || ( number_of_threads > LIBFCRYPTO_JOB_QUEUE_MAXIMUM_NUMBER_OF_THREADS ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid number of threads value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( maximum_number_of_jobs <= 0 )
+	 || ( maximum_number_of_jobs > LIBFCRYPTO_JOB_QUEUE_MAXIMUM_NUMBER_OF_JOBS ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid maximum number of jobs value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	internal_job_queue = memory_allocate_structure(
+	                      libfcrypto_internal_job_queue_t );
+
+	if( internal_job_queue == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create job queue.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     internal_job_queue,
+	     0,
+	     sizeof( libfcrypto_internal_job_queue_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear job queue.",
+		 function );
+
+		memory_free(
+		 internal_job_queue );
+
+		return( -1 );
+	}
+	internal_job_queue->jobs = (libfcrypto_internal_job_queue_job_t *) memory_allocate(
+	                                                                    sizeof( libfcrypto_internal_job_queue_job_t ) * maximum_number_of_jobs );
+
+	if( internal_job_queue->jobs == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create jobs.",
+		 function );
+
+		goto on_error;
+	}
+	internal_job_queue->maximum_number_of_jobs = maximum_number_of_jobs;
+	internal_job_queue->next_job_identifier    = 1;
+
+#if defined( LIBFCRYPTO_THREAD_POOL_HAVE_PTHREAD )
+	if( number_of_threads > 0 )
+	{
+		internal_job_queue->threads = (pthread_t *) memory_allocate(
+		                                             sizeof( pthread_t ) * number_of_threads );
+
+		if( internal_job_queue->threads == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+			 "%s: unable to create threads.",
+			 function );
+
+			goto on_error;
+		}
+	}
+	pthread_result = pthread_mutex_init(
+	                  &( internal_job_queue->queue_mutex ),
+	                  NULL );
+
+	if( pthread_result != 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to initialize queue mutex.",
+		 function );
+
+		goto on_error;
+	}
+	queue_mutex_initialized = 1;
+
+	pthread_result = pthread_cond_init(
+	                  &( internal_job_queue->job_available_condition ),
+	                  NULL );
+
+	if( pthread_result != 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to initialize job available condition.",
+		 function );
+
+		goto on_error;
+	}
+	job_available_condition_initialized = 1;
+
+	pthread_result = pthread_cond_init(
+	                  &( internal_job_queue->jobs_completed_condition ),
+	                  NULL );
+
+	if( pthread_result != 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to initialize jobs completed condition.",
+		 function );
+
+		goto on_error;
+	}
+	jobs_completed_condition_initialized = 1;
+
+	for( thread_index = 0;
+	     thread_index < number_of_threads;
+	     thread_index++ )
+	{
+		pthread_result = pthread_create(
+		                  &( internal_job_queue->threads[ thread_index ] ),
+		                  NULL,
+		                  &libfcrypto_internal_job_queue_worker_function,
+		                  (void *) internal_job_queue );
+
+		if( pthread_result != 0 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to create thread: %d.",
+			 function,
+			 thread_index );
+
+			goto on_error;
+		}
+		number_of_created_threads++;
+	}
+	internal_job_queue->number_of_threads = number_of_threads;
+
+#endif /* defined( LIBFCRYPTO_THREAD_POOL_HAVE_PTHREAD ) */
+
+	*job_queue = (libfcrypto_job_queue_t *) internal_job_queue;
+
+	return( 1 );
+
+on_error:
+	if( internal_job_queue != NULL )
+	{
+#if defined( LIBFCRYPTO_THREAD_POOL_HAVE_PTHREAD )
+		if( number_of_created_threads > 0 )
+		{
+			pthread_mutex_lock(
+			 &( internal_job_queue->queue_mutex ) );
+
+			internal_job_queue->stop_threads = 1;
+
+			pthread_cond_broadcast(
+			 &( internal_job_queue->job_available_condition ) );
+
+			pthread_mutex_unlock(
+			 &( internal_job_queue->queue_mutex ) );
+
+			for( thread_index = 0;
+			     thread_index < number_of_created_threads;
+			     thread_index++ )
+			{
+				pthread_join(
+				 internal_job_queue->threads[ thread_index ],
+				 NULL );
+			}
+		}
+		if( jobs_completed_condition_initialized != 0 )
+		{
+			pthread_cond_destroy(
+			 &( internal_job_queue->jobs_completed_condition ) );
+		}
+		if( job_available_condition_initialized != 0 )
+		{
+			pthread_cond_destroy(
+			 &( internal_job_queue->job_available_condition ) );
+		}
+		if( queue_mutex_initialized != 0 )
+		{
+			pthread_mutex_destroy(
+			 &( internal_job_queue->queue_mutex ) );
+		}
+		if( internal_job_queue->threads != NULL )
+		{
+			memory_free(
+			 internal_job_queue->threads );
+		}
+#endif /* defined( LIBFCRYPTO_THREAD_POOL_HAVE_PTHREAD ) */
+
+		if( internal_job_queue->jobs != NULL )
+		{
+			memory_free(
+			 internal_job_queue->jobs );
+		}
+		memory_free(
+		 internal_job_queue );
+	}
+	return( -1 );
+}
+
+/* Frees a job queue
+ * Running jobs are completed and the jobs that are still queued are cancelled,
+ * for which the completion function is called with a result of 0
+ * Returns 1 if successful or -1 on error
+ */
+int libfcrypto_job_queue_free(
+     libfcrypto_job_queue_t **job_queue,
+     libcerror_error_t **error )
+{
+	libfcrypto_internal_job_queue_t *internal_job_queue = NULL;
+	libfcrypto_internal_job_queue_job_t *job            = NULL;
+	static char *function                               = "libfcrypto_job_queue_free";
+	int job_index                                       = 0;
+	int result                                          = 1;
+
+#if defined( LIBFCRYPTO_THREAD_POOL_HAVE_PTHREAD )
+	int thread_index                                    = 0;
+#endif
+
+	if( job_queue == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid job queue.",
+		 function );
+
+		return( -1 );
+	}
+	if( *job_queue != NULL )
+	{
+		internal_job_queue = (libfcrypto_internal_job_queue_t *) *job_queue;
+		*job_queue         = NULL;
+
+#if defined( LIBFCRYPTO_THREAD_POOL_HAVE_PTHREAD )
+		pthread_mutex_lock(
+		 &( internal_job_queue->queue_mutex ) );
+
+		internal_job_queue->stop_threads = 1;
+
+		pthread_cond_broadcast(
+		 &( internal_job_queue->job_available_condition ) );
+
+		pthread_mutex_unlock(
+		 &( internal_job_queue->queue_mutex ) );
+
+		for( thread_index = 0;
+		     thread_index < internal_job_queue->number_of_threads;
+		     thread_index++ )
+		{
+			if( pthread_join(
+			     internal_job_queue->threads[ thread_index ],
+			     NULL ) != 0 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+				 "%s: unable to join thread: %d.",
+				 function,
+				 thread_index );
+
+				result = -1;
+			}
+		}
+#endif /* defined( LIBFCRYPTO_THREAD_POOL_HAVE_PTHREAD ) */
+
+		/* The worker threads have stopped hence the queue no longer needs to be locked
+		 */
+		for( job_index = 0;
+		     job_index < internal_job_queue->number_of_queued_jobs;
+		     job_index++ )
+		{
+			job = &( internal_job_queue->jobs[ ( internal_job_queue->first_job_index + job_index ) % internal_job_queue->maximum_number_of_jobs ] );
+
+			if( job->completion_function != NULL )
+			{
+				job->completion_function(
+				 job->callback_data,
+				 job->identifier,
+				 0,
+				 NULL );
+			}
+		}
+#if defined( LIBFCRYPTO_THREAD_POOL_HAVE_PTHREAD )
+		pthread_cond_destroy(
+		 &( internal_job_queue->jobs_completed_condition ) );
+
+		pthread_cond_destroy(
+		 &( internal_job_queue->job_available_condition ) );
+
+		pthread_mutex_destroy(
+		 &( internal_job_queue->queue_mutex ) );
+
+		if( internal_job_queue->threads != NULL )
+		{
+			memory_free(
+			 internal_job_queue->threads );
+		}
+#endif /* defined( LIBFCRYPTO_THREAD_POOL_HAVE_PTHREAD ) */
+
+		memory_free(
+		 internal_job_queue->jobs );
+
+		memory_free(
+		 internal_job_queue );
+	}
+	return( result );
+}
+
+/* Runs a job and calls its completion function
+ * The error of the job is passed to the completion function and freed after it returns
+ * Returns 1 if successful or -1 on error
+ */
+int libfcrypto_internal_job_queue_run_job(
+     libfcrypto_internal_job_queue_job_t *job )
+{
+	libcerror_error_t *job_error         = NULL;
+	const uint8_t *initialization_vector = NULL;
+	int result                           = 0;
+
+	if( job == NULL )
+	{
+		return( -1 );
+	}
+	if( job->initialization_vector_size > 0 )
+	{
+		initialization_vector = job->initialization_vector;
+	}
+	result = libfcrypto_cipher_crypt(
+	          job->cipher,
+	          job->mode,
+	          initialization_vector,
+	          job->initialization_vector_size,
+	          job->input_data,
+	          job->input_data_size,
+	          job->output_data,
+	          job->output_data_size,
+	          &job_error );
+
+	if( result != 1 )
+	{
+		result = -1;
+	}
+	if( job->completion_function != NULL )
+	{
+		job->completion_function(
+		 job->callback_data,
+		 job->identifier,
+		 result,
+		 job_error );
+	}
+	if( job_error != NULL )
+	{
+		libcerror_error_free(
+		 &job_error );
+	}
+	return( result );
+}
+
+#if defined( LIBFCRYPTO_THREAD_POOL_HAVE_PTHREAD )
+
+/* The worker thread function that runs the queued jobs until the job queue is freed
+ * Returns NULL
+ */
+void *libfcrypto_internal_job_queue_worker_function(
+       void *arguments )
+{
+	libfcrypto_internal_job_queue_job_t job;
+
+	libfcrypto_internal_job_queue_t *internal_job_queue = NULL;
+
+	internal_job_queue = (libfcrypto_internal_job_queue_t *) arguments;
+
+	if( internal_job_queue == NULL )
+	{
+		return( NULL );
+	}
+	pthread_mutex_lock(
+	 &( internal_job_queue->queue_mutex ) );
+
+	while( internal_job_queue->stop_threads == 0 )
+	{
+		if( internal_job_queue->number_of_queued_jobs == 0 )
+		{
+			pthread_cond_wait(
+			 &( internal_job_queue->job_available_condition ),
+			 &( internal_job_queue->queue_mutex ) );
+
+			continue;
+		}
+		/* Copy the job so that its entry in the queue can be reused while it runs
+		 */
+		job = internal_job_queue->jobs[ internal_job_queue->first_job_index ];
+
+		internal_job_queue->first_job_index = ( internal_job_queue->first_job_index + 1 ) % internal_job_queue->maximum_number_of_jobs;
+
+		internal_job_queue->number_of_queued_jobs  -= 1;
+		internal_job_queue->number_of_running_jobs += 1;
+
+		pthread_mutex_unlock(
+		 &( internal_job_queue->queue_mutex ) );
+
+		libfcrypto_internal_job_queue_run_job(
+		 &job );
+
+		pthread_mutex_lock(
+		 &( internal_job_queue->queue_mutex ) );
+
+		internal_job_queue->number_of_running_jobs -= 1;
+
+		if( ( internal_job_queue->number_of_queued_jobs == 0 )
+		 && ( internal_job_queue->number_of_running_jobs == 0 ) )
+		{
+			pthread_cond_broadcast(
+			 &( internal_job_queue->jobs_completed_condition ) );
+		}
+	}
+	pthread_mutex_unlock(
+	 &( internal_job_queue->queue_mutex ) );
+
+	return( NULL );
+}
+
+#endif /* defined( LIBFCRYPTO_THREAD_POOL_HAVE_PTHREAD ) */
+
+/* Submits a job that de- or encrypts data using a cipher
+ * The cipher, input and output data must remain available until the job has completed,
+ * the initialization vector is copied. Jobs run concurrently and in no particular order,
+ * hence the key of the cipher must not be changed while jobs are queued or running
+ * The completion function, if set, is called by the thread that runs the job with a result
+ * of 1 if successful, 0 if the job was cancelled or -1 on error. On error the completion
+ * function is passed the error of the job, which is freed after the completion function
+ * returns, otherwise the error is NULL. Without worker threads the job is run, and
+ * the completion function called, before this function returns
+ * Returns 1 if successful, 0 if the queue is full or -1 on error
+ */
+int libfcrypto_job_queue_submit_crypt(
+     libfcrypto_job_queue_t *job_queue,
+     libfcrypto_cipher_t *cipher,
+     int mode,
+     const uint8_t *initialization_vector,
+     size_t initialization_vector_size,
+     const uint8_t *input_data,
+     size_t input_data_size,
+     uint8_t *output_data,
+     size_t output_data_size,
+     void (*completion_function)(
+             intptr_t *callback_data,
+             uint64_t job_identifier,
+             int result,
+             libcerror_error_t *job_error ),
+     intptr_t *callback_data,
+     uint64_t *job_identifier,
+     libcerror_error_t **error )
+{
+	libfcrypto_internal_job_queue_job_t single_job;
+
+	libfcrypto_internal_job_queue_t *internal_job_queue = NULL;
+	libfcrypto_internal_job_queue_job_t *job            = NULL;
+	static char *function                               = "libfcrypto_job_queue_submit_crypt";
+
+	if( job_queue == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid job queue.",
+		 function );
+
+		return( -1 );
+	}
+	internal_job_queue = (libfcrypto_internal_job_queue_t *) job_queue;
+
+	if( cipher == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid cipher.",
+		 function );
+
+		return( -1 );
+	}
+	/* The RC4 stream cipher keeps state between calls and cannot be used by concurrent jobs
+	 */
+	if( ( (libfcrypto_internal_cipher_t *) cipher )->mode == LIBFCRYPTO_CIPHER_MODE_STREAM )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported cipher mode.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( mode != LIBFCRYPTO_CRYPT_MODE_DECRYPT )
+	 && ( mode != LIBFCRYPTO_CRYPT_MODE_ENCRYPT ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported mode.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( initialization_vector == NULL )
+	 && ( initialization_vector_size != 0 ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid initialization vector.",
+		 function );
+
+		return( -1 );
+	}
+	if( initialization_vector_size > 16 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid initialization vector size value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( input_data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid input data.",
+		 function );
+
+		return( -1 );
+	}
+	if( input_data_size > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid input data size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( output_data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid output data.",
+		 function );
+
+		return( -1 );
+	}
+	if( output_data_size > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid output data size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( job_identifier == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid job identifier.",
+		 function );
+
+		return( -1 );
+	}
+	job = &single_job;
+
+#if defined( LIBFCRYPTO_THREAD_POOL_HAVE_PTHREAD )
+	pthread_mutex_lock(
+	 &( internal_job_queue->queue_mutex ) );
+
+	if( internal_job_queue->number_of_threads > 0 )
+	{
+		if( internal_job_queue->number_of_queued_jobs >= internal_job_queue->maximum_number_of_jobs )
+		{
+			pthread_mutex_unlock(
+			 &( internal_job_queue->queue_mutex ) );
+
+			return( 0 );
+		}
+		job = &( internal_job_queue->jobs[ ( internal_job_queue->first_job_index + internal_job_queue->number_of_queued_jobs ) % internal_job_queue->maximum_number_of_jobs ] );
+	}
+#endif
+	job->identifier                 = internal_job_queue->next_job_identifier;
+	job->cipher                     = cipher;
+	job->mode                       = mode;
+	job->initialization_vector_size = initialization_vector_size;
+	job->input_data                 = input_data;
+	job->input_data_size            = input_data_size;
+	job->output_data                = output_data;
+	job->output_data_size           = output_data_size;
+	job->completion_function        = completion_function;
+	job->callback_data              = callback_data;
+
+	if( initialization_vector_size > 0 )
+	{
+		/* The size of the initialization vector was checked before
+		 */
+		memory_copy(
+		 job->initialization_vector,
+		 initialization_vector,
+		 initialization_vector_size );
+	}
+	internal_job_queue->next_job_identifier += 1;
+
+	*job_identifier = job->identifier;
+
+	if( job != &single_job )
+	{
+		internal_job_queue->number_of_queued_jobs += 1;
+	}
+#if defined( LIBFCRYPTO_THREAD_POOL_HAVE_PTHREAD )
+	pthread_cond_signal(
+	 &( internal_job_queue->job_available_condition ) );
+
+	pthread_mutex_unlock(
+	 &( internal_job_queue->queue_mutex ) );
+#endif
+	if( job == &single_job )
+	{
+		/* Without worker threads the job is run by the submitting thread, a failing job
+		 * is reported to the completion function and not as an error of the submission
+		 */
+		libfcrypto_internal_job_queue_run_job(
+		 job );
+	}
+	return( 1 );
+}
+
+/* Cancels a queued job
+ * The completion function of the job, if set, is called by the calling thread with a result of 0
+ * A job that is running or has completed cannot be cancelled
+ * Returns 1 if the job was cancelled, 0 if not or -1 on error
+ */
+int libfcrypto_job_queue_cancel_job(
+     libfcrypto_job_queue_t *job_queue,
+     uint64_t job_identifier,
+     libcerror_error_t **error )
+{
+	libfcrypto_internal_job_queue_job_t cancelled_job;
+
+	libfcrypto_internal_job_queue_t *internal_job_queue = NULL;
+	static char *function                               = "libfcrypto_job_queue_cancel_job";
+	int job_index                                       = 0;
+	int next_queue_index                                = 0;
+	int queue_index                                     = 0;
+	int result                                          = 0;
+
+	if( job_queue == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid job queue.",
+		 function );
+
+		return( -1 );
+	}
+	internal_job_queue = (libfcrypto_internal_job_queue_t *) job_queue;
+
+#if defined( LIBFCRYPTO_THREAD_POOL_HAVE_PTHREAD )
+	pthread_mutex_lock(
+	 &( internal_job_queue->queue_mutex ) );
+#endif
+	for( job_index = 0;
+	     job_index < internal_job_queue->number_of_queued_jobs;
+	     job_index++ )
+	{
+		queue_index = ( internal_job_queue->first_job_index + job_index ) % internal_job_queue->maximum_number_of_jobs;
+
+		if( internal_job_queue->jobs[ queue_index ].identifier == job_identifier )
+		{
+			result = 1;
+
+			break;
+		}
+	}
+	if( result != 0 )
+	{
+		cancelled_job = internal_job_queue->jobs[ queue_index ];
+
+		/* Remove the job from the queue by moving the jobs that follow it forward
+		 */
+		for( job_index = job_index + 1;
+		     job_index < internal_job_queue->number_of_queued_jobs;
+		     job_index++ )
+		{
+			next_queue_index = ( internal_job_queue->first_job_index + job_index ) % internal_job_queue->maximum_number_of_jobs;
+
+			internal_job_queue->jobs[ queue_index ] = internal_job_queue->jobs[ next_queue_index ];
+
+			queue_index = next_queue_index;
+		}
+		internal_job_queue->number_of_queued_jobs -= 1;
+
+#if defined( LIBFCRYPTO_THREAD_POOL_HAVE_PTHREAD )
+		if( ( internal_job_queue->number_of_queued_jobs == 0 )
+		 && ( internal_job_queue->number_of_running_jobs == 0 ) )
+		{
+			pthread_cond_broadcast(
+			 &( internal_job_queue->jobs_completed_condition ) );
+		}
+#endif
+	}
+#if defined( LIBFCRYPTO_THREAD_POOL_HAVE_PTHREAD )
+	pthread_mutex_unlock(
+	 &( internal_job_queue->queue_mutex ) );
+#endif
+	if( ( result != 0 )
+	 && ( cancelled_job.completion_function != NULL ) )
+	{
+		cancelled_job.completion_function(
+		 cancelled_job.callback_data,
+		 cancelled_job.identifier,
+		 0,
+		 NULL );
+	}
+	return( result );
+}
+
+/* Retrieves the number of jobs that are queued or running
+ * Returns 1 if successful or -1 on error
+ */
+int libfcrypto_job_queue_get_number_of_jobs(
+     libfcrypto_job_queue_t *job_queue,
+     int *number_of_jobs,
+     libcerror_error_t **error )
+{
+	libfcrypto_internal_job_queue_t *internal_job_queue = NULL;
+	static char *function                               = "libfcrypto_job_queue_get_number_of_jobs";
+
+	if( job_queue == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid job queue.",
+		 function );
+
+		return( -1 );
+	}
+	internal_job_queue = (libfcrypto_internal_job_queue_t *) job_queue;
+
+	if( number_of_jobs == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid number of jobs.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( LIBFCRYPTO_THREAD_POOL_HAVE_PTHREAD )
+	pthread_mutex_lock(
+	 &( internal_job_queue->queue_mutex ) );
+#endif
+	*number_of_jobs = internal_job_queue->number_of_queued_jobs
+	                + internal_job_queue->number_of_running_jobs;
+
+#if defined( LIBFCRYPTO_THREAD_POOL_HAVE_PTHREAD )
+	pthread_mutex_unlock(
+	 &( internal_job_queue->queue_mutex ) );
+#endif
+	return( 1 );
+}
+
+/* Waits until all the queued and running jobs have completed
+ * This function must not be called from a completion function
+ * Returns 1 if successful or -1 on error
+ */
+int libfcrypto_job_queue_wait(
+     libfcrypto_job_queue_t *job_queue,
+     libcerror_error_t **error )
+{
+	static char *function                               = "libfcrypto_job_queue_wait";
+
+#if defined( LIBFCRYPTO_THREAD_POOL_HAVE_PTHREAD )
+	libfcrypto_internal_job_queue_t *internal_job_queue = NULL;
+#endif
+
+	if( job_queue == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid job queue.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( LIBFCRYPTO_THREAD_POOL_HAVE_PTHREAD )
+	internal_job_queue = (libfcrypto_internal_job_queue_t *) job_queue;
+
+	pthread_mutex_lock(
+	 &( internal_job_queue->queue_mutex ) );
+
+	while( ( internal_job_queue->number_of_queued_jobs > 0 )
+	    || ( internal_job_queue->number_of_running_jobs > 0 ) )
+	{
+		pthread_cond_wait(
+		 &( internal_job_queue->jobs_completed_condition ),
+		 &( internal_job_queue->queue_mutex ) );
+	}
+	pthread_mutex_unlock(
+	 &( internal_job_queue->queue_mutex ) );
+#endif
+	return( 1 );
+}
+
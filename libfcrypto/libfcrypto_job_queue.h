@@ -0,0 +1,222 @@
+/*
+ * Job queue functions
+ *
+ * Copyright (C) 2017-2024, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _LIBFCRYPTO_JOB_QUEUE_H )
+#define _LIBFCRYPTO_JOB_QUEUE_H
+
+#include <common.h>
+#include <types.h>
+
+#if defined( HAVE_MULTI_THREAD_SUPPORT ) && defined( HAVE_PTHREAD_H ) && !defined( WINAPI )
+#include <pthread.h>
+#endif
+
+#include "libfcrypto_extern.h"
+#include "libfcrypto_libcerror.h"
+#include "libfcrypto_thread_pool.h"
+#include "libfcrypto_types.h"
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+/* The maximum number of worker threads
+ */
+#define LIBFCRYPTO_JOB_QUEUE_MAXIMUM_NUMBER_OF_THREADS	256
+
+/* The maximum number of jobs that can be queued
+ */
+#define LIBFCRYPTO_JOB_QUEUE_MAXIMUM_NUMBER_OF_JOBS	65536
+
+typedef struct libfcrypto_internal_job_queue_job libfcrypto_internal_job_queue_job_t;
+
+struct libfcrypto_internal_job_queue_job
+{
+	/* The identifier
+	 */
+	uint64_t identifier;
+
+	/* The cipher
+	 */
+	libfcrypto_cipher_t *cipher;
+
+	/* The crypt mode
+	 */
+	int mode;
+
+	/* The initialization vector
+	 */
+	uint8_t initialization_vector[ 16 ];
+
+	/* The initialization vector size
+	 */
+	size_t initialization_vector_size;
+
+	/* The input data
+	 */
+	const uint8_t *input_data;
+
+	/* The input data size
+	 */
+	size_t input_data_size;
+
+	/* The output data
+	 */
+	uint8_t *output_data;
+
+	/* The output data size
+	 */
+	size_t output_data_size;
+
+	/* The function that is called when the job has completed or was cancelled
+	 */
+	void (*completion_function)(
+	        intptr_t *callback_data,
+	        uint64_t job_identifier,
+	        int result,
+	        libcerror_error_t *job_error );
+
+	/* The completion function callback data
+	 */
+	intptr_t *callback_data;
+};
+
+typedef struct libfcrypto_internal_job_queue libfcrypto_internal_job_queue_t;
+
+struct libfcrypto_internal_job_queue
+{
+	/* The number of worker threads
+	 */
+	int number_of_threads;
+
+#if defined( LIBFCRYPTO_THREAD_POOL_HAVE_PTHREAD )
+	/* The worker threads
+	 */
+	pthread_t *threads;
+
+	/* The mutex that protects the queue values
+	 */
+	pthread_mutex_t queue_mutex;
+
+	/* The condition that signals the worker threads that a job is available
+	 */
+	pthread_cond_t job_available_condition;
+
+	/* The condition that signals that all jobs have completed
+	 */
+	pthread_cond_t jobs_completed_condition;
+
+#endif /* defined( LIBFCRYPTO_THREAD_POOL_HAVE_PTHREAD ) */
+
+	/* The queued jobs, which are stored in a ring buffer
+	 */
+	libfcrypto_internal_job_queue_job_t *jobs;
+
+	/* The maximum number of queued jobs
+	 */
+	int maximum_number_of_jobs;
+
+	/* The index of the first queued job
+	 */
+	int first_job_index;
+
+	/* The number of queued jobs
+	 */
+	int number_of_queued_jobs;
+
+	/* The number of running jobs
+	 */
+	int number_of_running_jobs;
+
+	/* The identifier of the next job
+	 */
+	uint64_t next_job_identifier;
+
+	/* Value to indicate the worker threads should stop
+	 */
+	uint8_t stop_threads;
+};
+
+LIBFCRYPTO_EXTERN \
+int libfcrypto_job_queue_initialize(
+     libfcrypto_job_queue_t **job_queue,
+     int number_of_threads,
+     int maximum_number_of_jobs,
+     libcerror_error_t **error );
+
+LIBFCRYPTO_EXTERN \
+int libfcrypto_job_queue_free(
+     libfcrypto_job_queue_t **job_queue,
+     libcerror_error_t **error );
+
+int libfcrypto_internal_job_queue_run_job(
+     libfcrypto_internal_job_queue_job_t *job );
+
+#if defined( LIBFCRYPTO_THREAD_POOL_HAVE_PTHREAD )
+
+void *libfcrypto_internal_job_queue_worker_function(
+       void *arguments );
+
+#endif /* defined( LIBFCRYPTO_THREAD_POOL_HAVE_PTHREAD ) */
+
+LIBFCRYPTO_EXTERN \
+int libfcrypto_job_queue_submit_crypt(
+     libfcrypto_job_queue_t *job_queue,
+     libfcrypto_cipher_t *cipher,
+     int mode,
+     const uint8_t *initialization_vector,
+     size_t initialization_vector_size,
+     const uint8_t *input_data,
+     size_t input_data_size,
+     uint8_t *output_data,
+     size_t output_data_size,
+     void (*completion_function)(
+             intptr_t *callback_data,
+             uint64_t job_identifier,
+             int result,
+             libcerror_error_t *job_error ),
+     intptr_t *callback_data,
+     uint64_t *job_identifier,
+     libcerror_error_t **error );
+
+LIBFCRYPTO_EXTERN \
+int libfcrypto_job_queue_cancel_job(
+     libfcrypto_job_queue_t *job_queue,
+     uint64_t job_identifier,
+     libcerror_error_t **error );
+
+LIBFCRYPTO_EXTERN \
+int libfcrypto_job_queue_get_number_of_jobs(
+     libfcrypto_job_queue_t *job_queue,
+     int *number_of_jobs,
+     libcerror_error_t **error );
+
+LIBFCRYPTO_EXTERN \
+int libfcrypto_job_queue_wait(
+     libfcrypto_job_queue_t *job_queue,
+     libcerror_error_t **error );
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _LIBFCRYPTO_JOB_QUEUE_H ) */
+
@@ -27,6 +27,12 @@
 #include "libfcrypto_libcerror.h"
 #include "libfcrypto_rc4_context.h"
 
+#if defined( _MSC_VER )
+#define LIBFCRYPTO_RC4_INLINE	__inline
+#else
+#define LIBFCRYPTO_RC4_INLINE	inline
+#endif
+
 /* Creates a RC4 context
  * Make sure the value context is referencing, is set to NULL
  * Returns 1 if successful or -1 on error
@@ -128,6 +134,25 @@ int libfcrypto_rc4_context_free(
 		internal_context = (libfcrypto_internal_rc4_context_t *) *context;
 		*context         = NULL;
 
+		if( internal_context->checkpoints_data != NULL )
+		{
+			if( memory_set(
+			     internal_context->checkpoints_data,
+			     0,
+			     (size_t) internal_context->maximum_number_of_checkpoints * LIBFCRYPTO_RC4_CHECKPOINT_SIZE ) == NULL )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_MEMORY,
+				 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+				 "%s: unable to clear checkpoints data.",
+				 function );
+
+				result = -1;
+			}
+			memory_free(
+			 internal_context->checkpoints_data );
+		}
 		if( memory_set(
 		     internal_context,
 		     0,
@@ -159,11 +184,6 @@ int libfcrypto_rc4_context_set_key(
 {
 	libfcrypto_internal_rc4_context_t *internal_context = NULL;
 	static char *function                               = "libfcrypto_rc4_context_set_key";
-	size_t key_byte_index                               = 0;
-	size_t key_byte_size                                = 0;
-	uint16_t byte_value                                 = 0;
-	uint8_t permutation_value                           = 0;
-	uint8_t values_index                                = 0;
 
 	if( context == NULL )
 	{
@@ -202,8 +222,66 @@ int libfcrypto_rc4_context_set_key(
 
 		return( -1 );
 	}
-	key_byte_size = key_bit_size / 8;
+	if( libfcrypto_internal_rc4_context_set_key(
+	     internal_context,
+	     key,
+	     key_bit_size / 8,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to set key.",
+		 function );
+
+		return( -1 );
+	}
+	internal_context->number_of_checkpoints = 0;
+
+	if( libfcrypto_internal_rc4_context_set_checkpoint(
+	     internal_context,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to set checkpoint.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Sets the key
+ * This function does not validate the key byte size, which should be in the range 1 - 256
+ * Returns 1 if successful or -1 on error
+ */
+int libfcrypto_internal_rc4_context_set_key(
+     libfcrypto_internal_rc4_context_t *internal_context,
+     const uint8_t *key,
+     size_t key_byte_size,
+     libcerror_error_t **error )
+{
+	static char *function     = "libfcrypto_internal_rc4_context_set_key";
+	size_t key_byte_index     = 0;
+	uint16_t byte_value       = 0;
+	uint8_t permutation_value = 0;
+	uint8_t values_index      = 0;
 
+	if( internal_context == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid internal context.",
+		 function );
+
+		return( -1 );
+	}
 	/* Also referred to as: Key Scheduling Algorithm (KSA)
 	 */
 	for( byte_value = 0;
@@ -216,8 +294,6 @@ int libfcrypto_rc4_context_set_key(
 	     byte_value < 256;
 	     byte_value++ )
 	{
-		key_byte_index = byte_value % key_byte_size;
-
 		/* Note that the following operations are modulus 256
 		 */
 		values_index = ( values_index + internal_context->permutations[ byte_value ] + key[ key_byte_index ] ) & 0xff;
@@ -225,10 +301,292 @@ int libfcrypto_rc4_context_set_key(
 		permutation_value = internal_context->permutations[ byte_value ];
 		internal_context->permutations[ byte_value ] = internal_context->permutations[ values_index ];
 		internal_context->permutations[ values_index ] = permutation_value;
+
+		key_byte_index++;
+
+		if( key_byte_index >= key_byte_size )
+		{
+			key_byte_index = 0;
+		}
 	}
 	internal_context->index[ 0 ] = 0;
 	internal_context->index[ 1 ] = 0;
 
+	internal_context->key_stream_offset = 0;
+
+	return( 1 );
+}
+
+/* Sets the checkpoints
+ * Checkpoints contain a copy of the state every checkpoint interval bytes of the key stream
+ * and allow to seek backwards in the key stream without having to set the key again
+ * A checkpoint interval of 0 disables the checkpoints
+ * The checkpoints are (re)created when the key is set
+ * Returns 1 if successful or -1 on error
+ */
+int libfcrypto_rc4_context_set_checkpoints(
+     libfcrypto_rc4_context_t *context,
+     size_t checkpoint_interval,
+     int maximum_number_of_checkpoints,
+     libcerror_error_t **error )
+{
+	libfcrypto_internal_rc4_context_t *internal_context = NULL;
+	static char *function                               = "libfcrypto_rc4_context_set_checkpoints";
+	size_t checkpoints_data_size                        = 0;
+
+	if( context == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid context.",
+		 function );
+
+		return( -1 );
+	}
+	internal_context = (libfcrypto_internal_rc4_context_t *) context;
+
+	if( checkpoint_interval > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid checkpoint interval value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( checkpoint_interval != 0 )
+	{
+		if( ( maximum_number_of_checkpoints <= 0 )
+		 || ( (size_t) maximum_number_of_checkpoints > ( (size_t) MEMORY_MAXIMUM_ALLOCATION_SIZE / LIBFCRYPTO_RC4_CHECKPOINT_SIZE ) ) )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+			 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+			 "%s: invalid maximum number of checkpoints value out of bounds.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	if( internal_context->checkpoints_data != NULL )
+	{
+		memory_set(
+		 internal_context->checkpoints_data,
+		 0,
+		 (size_t) internal_context->maximum_number_of_checkpoints * LIBFCRYPTO_RC4_CHECKPOINT_SIZE );
+
+		memory_free(
+		 internal_context->checkpoints_data );
+
+		internal_context->checkpoints_data = NULL;
+	}
+	internal_context->checkpoint_interval           = 0;
+	internal_context->number_of_checkpoints         = 0;
+	internal_context->maximum_number_of_checkpoints = 0;
+
+	if( checkpoint_interval == 0 )
+	{
+		return( 1 );
+	}
+	checkpoints_data_size = (size_t) maximum_number_of_checkpoints * LIBFCRYPTO_RC4_CHECKPOINT_SIZE;
+
+	internal_context->checkpoints_data = (uint8_t *) memory_allocate(
+	                                                  sizeof( uint8_t ) * checkpoints_data_size );
+
+	if( internal_context->checkpoints_data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create checkpoints data.",
+		 function );
+
+		return( -1 );
+	}
+	internal_context->checkpoint_interval           = checkpoint_interval;
+	internal_context->maximum_number_of_checkpoints = maximum_number_of_checkpoints;
+
+	/* If the key stream is at its start the first checkpoint can be created directly
+	 */
+	if( internal_context->key_stream_offset == 0 )
+	{
+		if( libfcrypto_internal_rc4_context_set_checkpoint(
+		     internal_context,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to set checkpoint.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	return( 1 );
+}
+
+/* Sets a checkpoint if the key stream offset is that of the next checkpoint
+ * Returns 1 if successful or -1 on error
+ */
+int libfcrypto_internal_rc4_context_set_checkpoint(
+     libfcrypto_internal_rc4_context_t *internal_context,
+     libcerror_error_t **error )
+{
+	uint8_t *checkpoint   = NULL;
+	static char *function = "libfcrypto_internal_rc4_context_set_checkpoint";
+
+	if( internal_context == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid internal context.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( internal_context->checkpoint_interval == 0 )
+	 || ( internal_context->number_of_checkpoints >= internal_context->maximum_number_of_checkpoints )
+	 || ( internal_context->key_stream_offset != ( (uint64_t) internal_context->number_of_checkpoints * internal_context->checkpoint_interval ) ) )
+	{
+		return( 1 );
+	}
+	checkpoint = &( internal_context->checkpoints_data[ internal_context->number_of_checkpoints * LIBFCRYPTO_RC4_CHECKPOINT_SIZE ] );
+
+	if( memory_copy(
+	     checkpoint,
+	     internal_context->permutations,
+	     256 ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+		 "%s: unable to copy permutations table to checkpoint.",
+		 function );
+
+		return( -1 );
+	}
+	checkpoint[ 256 ] = internal_context->index[ 0 ];
+	checkpoint[ 257 ] = internal_context->index[ 1 ];
+
+	internal_context->number_of_checkpoints += 1;
+
+	return( 1 );
+}
+
+/* Seeks an offset in the key stream
+ * Seeking backwards requires checkpoints, the state is restored from the nearest checkpoint
+ * before the offset after which the key stream is generated up to the offset
+ * Returns 1 if successful or -1 on error
+ */
+int libfcrypto_rc4_context_seek_offset(
+     libfcrypto_rc4_context_t *context,
+     uint64_t offset,
+     libcerror_error_t **error )
+{
+	libfcrypto_internal_rc4_context_t *internal_context = NULL;
+	uint8_t *checkpoint                                 = NULL;
+	static char *function                               = "libfcrypto_rc4_context_seek_offset";
+	uint64_t checkpoint_index                           = 0;
+	uint64_t checkpoint_offset                          = 0;
+	uint64_t skip_size                                  = 0;
+
+	if( context == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid context.",
+		 function );
+
+		return( -1 );
+	}
+	internal_context = (libfcrypto_internal_rc4_context_t *) context;
+
+	if( internal_context->number_of_checkpoints > 0 )
+	{
+		checkpoint_index = offset / internal_context->checkpoint_interval;
+
+		if( checkpoint_index >= (uint64_t) internal_context->number_of_checkpoints )
+		{
+			checkpoint_index = (uint64_t) internal_context->number_of_checkpoints - 1;
+		}
+		checkpoint_offset = checkpoint_index * internal_context->checkpoint_interval;
+	}
+	/* Restore the checkpoint if it is closer to the offset than the current key stream offset
+	 */
+	if( ( offset < internal_context->key_stream_offset )
+	 || ( checkpoint_offset > internal_context->key_stream_offset ) )
+	{
+		if( internal_context->number_of_checkpoints == 0 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+			 "%s: unable to seek backwards without checkpoints.",
+			 function );
+
+			return( -1 );
+		}
+		checkpoint = &( internal_context->checkpoints_data[ checkpoint_index * LIBFCRYPTO_RC4_CHECKPOINT_SIZE ] );
+
+		if( memory_copy(
+		     internal_context->permutations,
+		     checkpoint,
+		     256 ) == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+			 "%s: unable to copy permutations table from checkpoint.",
+			 function );
+
+			return( -1 );
+		}
+		internal_context->index[ 0 ] = checkpoint[ 256 ];
+		internal_context->index[ 1 ] = checkpoint[ 257 ];
+
+		internal_context->key_stream_offset = checkpoint_offset;
+	}
+	skip_size = offset - internal_context->key_stream_offset;
+
+	while( skip_size > 0 )
+	{
+		if( skip_size > (uint64_t) SSIZE_MAX )
+		{
+			skip_size = (uint64_t) SSIZE_MAX;
+		}
+		if( libfcrypto_internal_rc4_context_crypt_with_checkpoints(
+		     internal_context,
+		     NULL,
+		     NULL,
+		     (size_t) skip_size,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_ENCRYPTION,
+			 LIBCERROR_ENCRYPTION_ERROR_GENERIC,
+			 "%s: unable to advance key stream.",
+			 function );
+
+			return( -1 );
+		}
+		skip_size = offset - internal_context->key_stream_offset;
+	}
 	return( 1 );
 }
 
@@ -245,10 +603,6 @@ int libfcrypto_rc4_crypt(
 {
 	libfcrypto_internal_rc4_context_t *internal_context = NULL;
 	static char *function                               = "libfcrypto_rc4_crypt";
-	size_t data_offset                                  = 0;
-	uint8_t permutation_value                           = 0;
-	uint8_t values_index1                               = 0;
-	uint8_t values_index2                               = 0;
 
 	if( context == NULL )
 	{
@@ -318,31 +672,1167 @@ int libfcrypto_rc4_crypt(
 
 		return( -1 );
 	}
-	/* Also referred to as: Pseudo-Random Generator Algorithm (PRGA)
-	 */
-	values_index1 = internal_context->index[ 0 ];
-	values_index2 = internal_context->index[ 1 ];
-
-	while( data_offset < input_data_size )
+	if( libfcrypto_internal_rc4_context_crypt_with_checkpoints(
+	     internal_context,
+	     input_data,
+	     output_data,
+	     input_data_size,
+	     error ) != 1 )
 	{
-		/* Note that the following operations are modulus 256
-		 */
-		values_index1 = ( values_index1 + 1 ) & 0xff;
-		values_index2 = ( values_index2 + internal_context->permutations[ values_index1 ] ) & 0xff;
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ENCRYPTION,
+		 LIBCERROR_ENCRYPTION_ERROR_GENERIC,
+		 "%s: unable to crypt data.",
+		 function );
 
-		permutation_value                               = internal_context->permutations[ values_index1 ];
-		internal_context->permutations[ values_index1 ] = internal_context->permutations[ values_index2 ];
-		internal_context->permutations[ values_index2 ] = permutation_value;
+		return( -1 );
+	}
+	return( 1 );
+}
 
-		permutation_value = ( permutation_value + internal_context->permutations[ values_index1 ] ) & 0xff;
+/* Advances the key stream without de- or encrypting data using RC4
+ * This can be used to discard the initial part of the key stream, such as RC4-drop[N]
+ * Returns 1 if successful or -1 on error
+ */
+int libfcrypto_rc4_skip_key_stream(
+     libfcrypto_rc4_context_t *context,
+     size_t skip_size,
+     libcerror_error_t **error )
+{
+	libfcrypto_internal_rc4_context_t *internal_context = NULL;
+	static char *function                               = "libfcrypto_rc4_skip_key_stream";
 
-		output_data[ data_offset ] = input_data[ data_offset ] ^ internal_context->permutations[ permutation_value ];
+	if( context == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid context.",
+		 function );
 
-		data_offset++;
+		return( -1 );
 	}
-	internal_context->index[ 0 ] = values_index1;
-	internal_context->index[ 1 ] = values_index2;
+	internal_context = (libfcrypto_internal_rc4_context_t *) context;
 
-	return( 1 );
-}
+	if( skip_size > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid skip size value exceeds maximum.",
+		 function );
 
+		return( -1 );
+	}
+	if( libfcrypto_internal_rc4_context_crypt_with_checkpoints(
+	     internal_context,
+	     NULL,
+	     NULL,
+	     skip_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ENCRYPTION,
+		 LIBCERROR_ENCRYPTION_ERROR_GENERIC,
+		 "%s: unable to advance key stream.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Retrieves key stream data using RC4
+ * The key stream data can be combined with data using XOR at a later time
+ * Returns 1 if successful or -1 on error
+ */
+int libfcrypto_rc4_get_key_stream(
+     libfcrypto_rc4_context_t *context,
+     uint8_t *key_stream_data,
+     size_t key_stream_data_size,
+     libcerror_error_t **error )
+{
+	libfcrypto_internal_rc4_context_t *internal_context = NULL;
+	static char *function                               = "libfcrypto_rc4_get_key_stream";
+
+	if( context == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid context.",
+		 function );
+
+		return( -1 );
+	}
+	internal_context = (libfcrypto_internal_rc4_context_t *) context;
+
+	if( key_stream_data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid key stream data.",
+		 function );
+
+		return( -1 );
+	}
+	if( key_stream_data_size > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid key stream data size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( libfcrypto_internal_rc4_context_crypt_with_checkpoints(
+	     internal_context,
+	     NULL,
+	     key_stream_data,
+	     key_stream_data_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ENCRYPTION,
+		 LIBCERROR_ENCRYPTION_ERROR_GENERIC,
+		 "%s: unable to retrieve key stream data.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Generates key stream data using the RC4 Pseudo-Random Generator Algorithm (PRGA)
+ * If output data is set the key stream is stored in it, combined with the input data using XOR if set
+ * If output data is NULL the key stream is advanced without storing it
+ * Since the callers pass constant NULL values, the checks are removed when the function is inlined
+ */
+static LIBFCRYPTO_RC4_INLINE void libfcrypto_internal_rc4_context_generate_key_stream(
+                                   libfcrypto_internal_rc4_context_t *internal_context,
+                                   const uint8_t *input_data,
+                                   uint8_t *output_data,
+                                   size_t data_size )
+{
+	size_t data_offset        = 0;
+	uint8_t permutation_value = 0;
+	uint8_t values_index1     = 0;
+	uint8_t values_index2     = 0;
+
+	values_index1 = internal_context->index[ 0 ];
+	values_index2 = internal_context->index[ 1 ];
+
+	while( data_offset < data_size )
+	{
+		/* Note that the following operations are modulus 256
+		 */
+		values_index1 = ( values_index1 + 1 ) & 0xff;
+		values_index2 = ( values_index2 + internal_context->permutations[ values_index1 ] ) & 0xff;
+
+		permutation_value                               = internal_context->permutations[ values_index1 ];
+		internal_context->permutations[ values_index1 ] = internal_context->permutations[ values_index2 ];
+		internal_context->permutations[ values_index2 ] = permutation_value;
+
+		if( output_data != NULL )
+		{
+			permutation_value = ( permutation_value + internal_context->permutations[ values_index1 ] ) & 0xff;
+
+			if( input_data != NULL )
+			{
+				output_data[ data_offset ] = input_data[ data_offset ] ^ internal_context->permutations[ permutation_value ];
+			}
+			else
+			{
+				output_data[ data_offset ] = internal_context->permutations[ permutation_value ];
+			}
+		}
+		data_offset++;
+	}
+	internal_context->index[ 0 ] = values_index1;
+	internal_context->index[ 1 ] = values_index2;
+
+	internal_context->key_stream_offset += data_size;
+}
+
+/* De- or encrypts a buffer of data using RC4
+ * This function does not validate the data, which should be of data size
+ * Returns 1 if successful or -1 on error
+ */
+int libfcrypto_internal_rc4_context_crypt(
+     libfcrypto_internal_rc4_context_t *internal_context,
+     const uint8_t *input_data,
+     uint8_t *output_data,
+     size_t data_size,
+     libcerror_error_t **error )
+{
+	static char *function = "libfcrypto_internal_rc4_context_crypt";
+
+	if( internal_context == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid internal context.",
+		 function );
+
+		return( -1 );
+	}
+	libfcrypto_internal_rc4_context_generate_key_stream(
+	 internal_context,
+	 input_data,
+	 output_data,
+	 data_size );
+
+	return( 1 );
+}
+
+/* Advances the key stream without de- or encrypting data using RC4
+ * Returns 1 if successful or -1 on error
+ */
+int libfcrypto_internal_rc4_context_skip(
+     libfcrypto_internal_rc4_context_t *internal_context,
+     size_t data_size,
+     libcerror_error_t **error )
+{
+	static char *function = "libfcrypto_internal_rc4_context_skip";
+
+	if( internal_context == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid internal context.",
+		 function );
+
+		return( -1 );
+	}
+	libfcrypto_internal_rc4_context_generate_key_stream(
+	 internal_context,
+	 NULL,
+	 NULL,
+	 data_size );
+
+	return( 1 );
+}
+
+/* Retrieves key stream data using RC4
+ * This function does not validate the key stream data, which should be of key stream data size
+ * Returns 1 if successful or -1 on error
+ */
+int libfcrypto_internal_rc4_context_get_key_stream(
+     libfcrypto_internal_rc4_context_t *internal_context,
+     uint8_t *key_stream_data,
+     size_t key_stream_data_size,
+     libcerror_error_t **error )
+{
+	static char *function = "libfcrypto_internal_rc4_context_get_key_stream";
+
+	if( internal_context == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid internal context.",
+		 function );
+
+		return( -1 );
+	}
+	libfcrypto_internal_rc4_context_generate_key_stream(
+	 internal_context,
+	 NULL,
+	 key_stream_data,
+	 key_stream_data_size );
+
+	return( 1 );
+}
+
+/* De- or encrypts a buffer of data using RC4 and sets the checkpoints that are passed
+ * If input data is NULL the key stream is stored in output data
+ * If input data and output data are NULL the key stream is advanced without de- or encrypting data
+ * This function does not validate the data, which should be of data size
+ * Returns 1 if successful or -1 on error
+ */
+int libfcrypto_internal_rc4_context_crypt_with_checkpoints(
+     libfcrypto_internal_rc4_context_t *internal_context,
+     const uint8_t *input_data,
+     uint8_t *output_data,
+     size_t data_size,
+     libcerror_error_t **error )
+{
+	static char *function           = "libfcrypto_internal_rc4_context_crypt_with_checkpoints";
+	uint64_t next_checkpoint_offset = 0;
+	size_t data_offset              = 0;
+	size_t read_size                = 0;
+	int result                      = 0;
+
+	if( internal_context == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid internal context.",
+		 function );
+
+		return( -1 );
+	}
+	while( data_offset < data_size )
+	{
+		if( libfcrypto_internal_rc4_context_set_checkpoint(
+		     internal_context,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to set checkpoint.",
+			 function );
+
+			return( -1 );
+		}
+		read_size = data_size - data_offset;
+
+		/* Stop at the offset of the next checkpoint
+		 */
+		if( ( internal_context->checkpoint_interval != 0 )
+		 && ( internal_context->number_of_checkpoints < internal_context->maximum_number_of_checkpoints ) )
+		{
+			next_checkpoint_offset = (uint64_t) internal_context->number_of_checkpoints * internal_context->checkpoint_interval;
+
+			if( ( next_checkpoint_offset > internal_context->key_stream_offset )
+			 && ( ( next_checkpoint_offset - internal_context->key_stream_offset ) < (uint64_t) read_size ) )
+			{
+				read_size = (size_t) ( next_checkpoint_offset - internal_context->key_stream_offset );
+			}
+		}
+		if( output_data == NULL )
+		{
+			result = libfcrypto_internal_rc4_context_skip(
+			          internal_context,
+			          read_size,
+			          error );
+		}
+		else if( input_data == NULL )
+		{
+			result = libfcrypto_internal_rc4_context_get_key_stream(
+			          internal_context,
+			          &( output_data[ data_offset ] ),
+			          read_size,
+			          error );
+		}
+		else
+		{
+			result = libfcrypto_internal_rc4_context_crypt(
+			          internal_context,
+			          &( input_data[ data_offset ] ),
+			          &( output_data[ data_offset ] ),
+			          read_size,
+			          error );
+		}
+		if( result != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_ENCRYPTION,
+			 LIBCERROR_ENCRYPTION_ERROR_GENERIC,
+			 "%s: unable to crypt data.",
+			 function );
+
+			return( -1 );
+		}
+		data_offset += read_size;
+	}
+	/* Set the checkpoint at the end of the data if applicable
+	 */
+	if( libfcrypto_internal_rc4_context_set_checkpoint(
+	     internal_context,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to set checkpoint.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Sets the keys of multiple contexts
+ * The key scheduling of the contexts is interleaved so that the dependent loads and stores
+ * of the different contexts can be executed in parallel
+ * This function does not validate the key byte sizes, which should be in the range 1 - 256
+ * Returns 1 if successful or -1 on error
+ */
+int libfcrypto_internal_rc4_context_set_keys_interleaved(
+     libfcrypto_internal_rc4_context_t *internal_contexts,
+     const uint8_t **keys,
+     const size_t *key_byte_sizes,
+     libcerror_error_t **error )
+{
+	size_t key_byte_index[ LIBFCRYPTO_RC4_NUMBER_OF_INTERLEAVED_STREAMS ];
+	uint8_t values_index[ LIBFCRYPTO_RC4_NUMBER_OF_INTERLEAVED_STREAMS ];
+
+	static char *function     = "libfcrypto_internal_rc4_context_set_keys_interleaved";
+	uint16_t byte_value       = 0;
+	uint8_t permutation_value = 0;
+	int stream_index          = 0;
+
+	if( internal_contexts == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid internal contexts.",
+		 function );
+
+		return( -1 );
+	}
+	if( keys == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid keys.",
+		 function );
+
+		return( -1 );
+	}
+	if( key_byte_sizes == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid key byte sizes.",
+		 function );
+
+		return( -1 );
+	}
+	for( stream_index = 0;
+	     stream_index < LIBFCRYPTO_RC4_NUMBER_OF_INTERLEAVED_STREAMS;
+	     stream_index++ )
+	{
+		for( byte_value = 0;
+		     byte_value < 256;
+		     byte_value++ )
+		{
+			internal_contexts[ stream_index ].permutations[ byte_value ] = (uint8_t) byte_value;
+		}
+		internal_contexts[ stream_index ].index[ 0 ] = 0;
+		internal_contexts[ stream_index ].index[ 1 ] = 0;
+
+		internal_contexts[ stream_index ].key_stream_offset = 0;
+
+		key_byte_index[ stream_index ] = 0;
+		values_index[ stream_index ]   = 0;
+	}
+	/* Also referred to as: Key Scheduling Algorithm (KSA)
+	 */
+	for( byte_value = 0;
+	     byte_value < 256;
+	     byte_value++ )
+	{
+		for( stream_index = 0;
+		     stream_index < LIBFCRYPTO_RC4_NUMBER_OF_INTERLEAVED_STREAMS;
+		     stream_index++ )
+		{
+			/* Note that the following operations are modulus 256
+			 */
+			values_index[ stream_index ] = ( values_index[ stream_index ] + internal_contexts[ stream_index ].permutations[ byte_value ] + keys[ stream_index ][ key_byte_index[ stream_index ] ] ) & 0xff;
+
+			permutation_value = internal_contexts[ stream_index ].permutations[ byte_value ];
+			internal_contexts[ stream_index ].permutations[ byte_value ] = internal_contexts[ stream_index ].permutations[ values_index[ stream_index ] ];
+			internal_contexts[ stream_index ].permutations[ values_index[ stream_index ] ] = permutation_value;
+
+			key_byte_index[ stream_index ] += 1;
+
+			if( key_byte_index[ stream_index ] >= key_byte_sizes[ stream_index ] )
+			{
+				key_byte_index[ stream_index ] = 0;
+			}
+		}
+	}
+	return( 1 );
+}
+
+/* De- or encrypts buffers of data of multiple contexts using RC4
+ * The key stream generation of the contexts is interleaved so that the dependent loads and stores
+ * of the different contexts can be executed in parallel
+ * This function does not validate the data, which should be of data size for every context
+ * Returns 1 if successful or -1 on error
+ */
+int libfcrypto_internal_rc4_context_crypt_interleaved(
+     libfcrypto_internal_rc4_context_t *internal_contexts,
+     const uint8_t **input_data,
+     uint8_t **output_data,
+     size_t data_size,
+     libcerror_error_t **error )
+{
+	uint8_t values_index1[ LIBFCRYPTO_RC4_NUMBER_OF_INTERLEAVED_STREAMS ];
+	uint8_t values_index2[ LIBFCRYPTO_RC4_NUMBER_OF_INTERLEAVED_STREAMS ];
+
+	static char *function     = "libfcrypto_internal_rc4_context_crypt_interleaved";
+	size_t data_offset        = 0;
+	uint8_t permutation_value = 0;
+	int stream_index          = 0;
+
+	if( internal_contexts == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid internal contexts.",
+		 function );
+
+		return( -1 );
+	}
+	if( input_data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid input data.",
+		 function );
+
+		return( -1 );
+	}
+	if( output_data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid output data.",
+		 function );
+
+		return( -1 );
+	}
+	for( stream_index = 0;
+	     stream_index < LIBFCRYPTO_RC4_NUMBER_OF_INTERLEAVED_STREAMS;
+	     stream_index++ )
+	{
+		values_index1[ stream_index ] = internal_contexts[ stream_index ].index[ 0 ];
+		values_index2[ stream_index ] = internal_contexts[ stream_index ].index[ 1 ];
+	}
+	/* Also referred to as: Pseudo-Random Generator Algorithm (PRGA)
+	 */
+	while( data_offset < data_size )
+	{
+		for( stream_index = 0;
+		     stream_index < LIBFCRYPTO_RC4_NUMBER_OF_INTERLEAVED_STREAMS;
+		     stream_index++ )
+		{
+			/* Note that the following operations are modulus 256
+			 */
+			values_index1[ stream_index ] = ( values_index1[ stream_index ] + 1 ) & 0xff;
+			values_index2[ stream_index ] = ( values_index2[ stream_index ] + internal_contexts[ stream_index ].permutations[ values_index1[ stream_index ] ] ) & 0xff;
+
+			permutation_value                                                               = internal_contexts[ stream_index ].permutations[ values_index1[ stream_index ] ];
+			internal_contexts[ stream_index ].permutations[ values_index1[ stream_index ] ] = internal_contexts[ stream_index ].permutations[ values_index2[ stream_index ] ];
+			internal_contexts[ stream_index ].permutations[ values_index2[ stream_index ] ] = permutation_value;
+
+			permutation_value = ( permutation_value + internal_contexts[ stream_index ].permutations[ values_index1[ stream_index ] ] ) & 0xff;
+
+			output_data[ stream_index ][ data_offset ] = input_data[ stream_index ][ data_offset ] ^ internal_contexts[ stream_index ].permutations[ permutation_value ];
+		}
+		data_offset++;
+	}
+	for( stream_index = 0;
+	     stream_index < LIBFCRYPTO_RC4_NUMBER_OF_INTERLEAVED_STREAMS;
+	     stream_index++ )
+	{
+		internal_contexts[ stream_index ].index[ 0 ] = values_index1[ stream_index ];
+		internal_contexts[ stream_index ].index[ 1 ] = values_index2[ stream_index ];
+
+		internal_contexts[ stream_index ].key_stream_offset += data_size;
+	}
+	return( 1 );
+}
+
+/* De- or encrypts multiple buffers of data each with its own key using RC4
+ * The streams are processed in groups of which the key scheduling and key stream generation are interleaved
+ * Returns 1 if successful or -1 on error
+ */
+int libfcrypto_rc4_crypt_multiple(
+     const uint8_t **keys,
+     const size_t *key_bit_sizes,
+     const uint8_t **input_data,
+     const size_t *input_data_sizes,
+     uint8_t **output_data,
+     const size_t *output_data_sizes,
+     int number_of_streams,
+     libcerror_error_t **error )
+{
+	libfcrypto_internal_rc4_context_t internal_contexts[ LIBFCRYPTO_RC4_NUMBER_OF_INTERLEAVED_STREAMS ];
+	size_t key_byte_sizes[ LIBFCRYPTO_RC4_NUMBER_OF_INTERLEAVED_STREAMS ];
+	const uint8_t *stream_input_data[ LIBFCRYPTO_RC4_NUMBER_OF_INTERLEAVED_STREAMS ];
+	uint8_t *stream_output_data[ LIBFCRYPTO_RC4_NUMBER_OF_INTERLEAVED_STREAMS ];
+
+	static char *function = "libfcrypto_rc4_crypt_multiple";
+	size_t data_size      = 0;
+	int group_index       = 0;
+	int stream_index      = 0;
+
+	if( keys == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid keys.",
+		 function );
+
+		return( -1 );
+	}
+	if( key_bit_sizes == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid key bit sizes.",
+		 function );
+
+		return( -1 );
+	}
+	if( input_data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid input data.",
+		 function );
+
+		return( -1 );
+	}
+	if( input_data_sizes == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid input data sizes.",
+		 function );
+
+		return( -1 );
+	}
+	if( output_data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid output data.",
+		 function );
+
+		return( -1 );
+	}
+	if( output_data_sizes == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid output data sizes.",
+		 function );
+
+		return( -1 );
+	}
+	if( number_of_streams < 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_LESS_THAN_ZERO,
+		 "%s: invalid number of streams value less than zero.",
+		 function );
+
+		return( -1 );
+	}
+	/* Validate all the streams before any data is processed
+	 */
+	for( stream_index = 0;
+	     stream_index < number_of_streams;
+	     stream_index++ )
+	{
+		if( keys[ stream_index ] == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+			 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+			 "%s: invalid key: %d.",
+			 function,
+			 stream_index );
+
+			return( -1 );
+		}
+		if( ( key_bit_sizes[ stream_index ] < 40 )
+		 || ( key_bit_sizes[ stream_index ] > 2048 )
+		 || ( ( key_bit_sizes[ stream_index ] % 8 ) != 0 ) )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+			 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+			 "%s: unsupported key: %d bit size.",
+			 function,
+			 stream_index );
+
+			return( -1 );
+		}
+		if( input_data[ stream_index ] == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+			 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+			 "%s: invalid input data: %d.",
+			 function,
+			 stream_index );
+
+			return( -1 );
+		}
+		if( input_data_sizes[ stream_index ] > (size_t) SSIZE_MAX )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+			 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+			 "%s: invalid input data: %d size value exceeds maximum.",
+			 function,
+			 stream_index );
+
+			return( -1 );
+		}
+		if( output_data[ stream_index ] == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+			 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+			 "%s: invalid output data: %d.",
+			 function,
+			 stream_index );
+
+			return( -1 );
+		}
+		if( ( output_data_sizes[ stream_index ] < input_data_sizes[ stream_index ] )
+		 || ( output_data_sizes[ stream_index ] > (size_t) SSIZE_MAX ) )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+			 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+			 "%s: invalid output data: %d size value out of bounds.",
+			 function,
+			 stream_index );
+
+			return( -1 );
+		}
+	}
+	/* The streams are processed in groups where the states of the group are stored contiguously
+	 */
+	for( group_index = 0;
+	     ( group_index + LIBFCRYPTO_RC4_NUMBER_OF_INTERLEAVED_STREAMS ) <= number_of_streams;
+	     group_index += LIBFCRYPTO_RC4_NUMBER_OF_INTERLEAVED_STREAMS )
+	{
+		data_size = input_data_sizes[ group_index ];
+
+		for( stream_index = 0;
+		     stream_index < LIBFCRYPTO_RC4_NUMBER_OF_INTERLEAVED_STREAMS;
+		     stream_index++ )
+		{
+			key_byte_sizes[ stream_index ]     = key_bit_sizes[ group_index + stream_index ] / 8;
+			stream_input_data[ stream_index ]  = input_data[ group_index + stream_index ];
+			stream_output_data[ stream_index ] = output_data[ group_index + stream_index ];
+
+			if( input_data_sizes[ group_index + stream_index ] < data_size )
+			{
+				data_size = input_data_sizes[ group_index + stream_index ];
+			}
+		}
+		if( libfcrypto_internal_rc4_context_set_keys_interleaved(
+		     internal_contexts,
+		     &( keys[ group_index ] ),
+		     key_byte_sizes,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to set keys.",
+			 function );
+
+			goto on_error;
+		}
+		/* The part of the data that all streams of the group have in common is interleaved
+		 */
+		if( libfcrypto_internal_rc4_context_crypt_interleaved(
+		     internal_contexts,
+		     stream_input_data,
+		     stream_output_data,
+		     data_size,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_ENCRYPTION,
+			 LIBCERROR_ENCRYPTION_ERROR_GENERIC,
+			 "%s: unable to crypt data.",
+			 function );
+
+			goto on_error;
+		}
+		for( stream_index = 0;
+		     stream_index < LIBFCRYPTO_RC4_NUMBER_OF_INTERLEAVED_STREAMS;
+		     stream_index++ )
+		{
+			if( libfcrypto_internal_rc4_context_crypt(
+			     &( internal_contexts[ stream_index ] ),
+			     &( stream_input_data[ stream_index ][ data_size ] ),
+			     &( stream_output_data[ stream_index ][ data_size ] ),
+			     input_data_sizes[ group_index + stream_index ] - data_size,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_ENCRYPTION,
+				 LIBCERROR_ENCRYPTION_ERROR_GENERIC,
+				 "%s: unable to crypt data.",
+				 function );
+
+				goto on_error;
+			}
+		}
+	}
+	/* The remaining streams are processed individually
+	 */
+	for( stream_index = group_index;
+	     stream_index < number_of_streams;
+	     stream_index++ )
+	{
+		if( libfcrypto_internal_rc4_context_set_key(
+		     &( internal_contexts[ 0 ] ),
+		     keys[ stream_index ],
+		     key_bit_sizes[ stream_index ] / 8,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to set key.",
+			 function );
+
+			goto on_error;
+		}
+		if( libfcrypto_internal_rc4_context_crypt(
+		     &( internal_contexts[ 0 ] ),
+		     input_data[ stream_index ],
+		     output_data[ stream_index ],
+		     input_data_sizes[ stream_index ],
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_ENCRYPTION,
+			 LIBCERROR_ENCRYPTION_ERROR_GENERIC,
+			 "%s: unable to crypt data.",
+			 function );
+
+			goto on_error;
+		}
+	}
+	memory_set(
+	 internal_contexts,
+	 0,
+	 sizeof( libfcrypto_internal_rc4_context_t ) * LIBFCRYPTO_RC4_NUMBER_OF_INTERLEAVED_STREAMS );
+
+	return( 1 );
+
+on_error:
+	memory_set(
+	 internal_contexts,
+	 0,
+	 sizeof( libfcrypto_internal_rc4_context_t ) * LIBFCRYPTO_RC4_NUMBER_OF_INTERLEAVED_STREAMS );
+
+	return( -1 );
+}
+
+/* De- or encrypts a buffer of data using RC4 where every block of data uses its own key
+ * The block keys are stored consecutively and all have the same key bit size
+ * The first block key is used for the first block of data, the second for the second block, etc.
+ * The last block of data can be smaller than the block size
+ * Returns 1 if successful or -1 on error
+ */
+int libfcrypto_rc4_crypt_with_block_keys(
+     const uint8_t *block_keys,
+     size_t block_keys_size,
+     size_t key_bit_size,
+     size_t block_size,
+     const uint8_t *input_data,
+     size_t input_data_size,
+     uint8_t *output_data,
+     size_t output_data_size,
+     libcerror_error_t **error )
+{
+	libfcrypto_internal_rc4_context_t internal_contexts[ LIBFCRYPTO_RC4_NUMBER_OF_INTERLEAVED_STREAMS ];
+	size_t key_byte_sizes[ LIBFCRYPTO_RC4_NUMBER_OF_INTERLEAVED_STREAMS ];
+	const uint8_t *keys[ LIBFCRYPTO_RC4_NUMBER_OF_INTERLEAVED_STREAMS ];
+	const uint8_t *stream_input_data[ LIBFCRYPTO_RC4_NUMBER_OF_INTERLEAVED_STREAMS ];
+	uint8_t *stream_output_data[ LIBFCRYPTO_RC4_NUMBER_OF_INTERLEAVED_STREAMS ];
+
+	static char *function   = "libfcrypto_rc4_crypt_with_block_keys";
+	size_t block_key_offset = 0;
+	size_t data_offset      = 0;
+	size_t data_size        = 0;
+	size_t key_byte_size    = 0;
+	size_t number_of_blocks = 0;
+	int stream_index        = 0;
+
+	if( block_keys == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid block keys.",
+		 function );
+
+		return( -1 );
+	}
+	if( block_keys_size > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid block keys size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( key_bit_size < 40 )
+	 || ( key_bit_size > 2048 )
+	 || ( ( key_bit_size % 8 ) != 0 ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported key bit size.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( block_size == 0 )
+	 || ( block_size > (size_t) SSIZE_MAX ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid block size value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( input_data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid input data.",
+		 function );
+
+		return( -1 );
+	}
+	if( input_data_size > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid input data size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( output_data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid output data.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( output_data_size < input_data_size )
+	 || ( output_data_size > (size_t) SSIZE_MAX ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid output data size value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	key_byte_size    = key_bit_size / 8;
+	number_of_blocks = input_data_size / block_size;
+
+	if( ( input_data_size % block_size ) != 0 )
+	{
+		number_of_blocks += 1;
+	}
+	if( ( block_keys_size / key_byte_size ) < number_of_blocks )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_TOO_SMALL,
+		 "%s: invalid block keys size value too small.",
+		 function );
+
+		return( -1 );
+	}
+	/* The blocks are independent of each other, hence groups of full blocks are interleaved
+	 */
+	for( stream_index = 0;
+	     stream_index < LIBFCRYPTO_RC4_NUMBER_OF_INTERLEAVED_STREAMS;
+	     stream_index++ )
+	{
+		key_byte_sizes[ stream_index ] = key_byte_size;
+	}
+	while( ( ( input_data_size - data_offset ) / LIBFCRYPTO_RC4_NUMBER_OF_INTERLEAVED_STREAMS ) >= block_size )
+	{
+		for( stream_index = 0;
+		     stream_index < LIBFCRYPTO_RC4_NUMBER_OF_INTERLEAVED_STREAMS;
+		     stream_index++ )
+		{
+			keys[ stream_index ]               = &( block_keys[ block_key_offset ] );
+			stream_input_data[ stream_index ]  = &( input_data[ data_offset ] );
+			stream_output_data[ stream_index ] = &( output_data[ data_offset ] );
+
+			block_key_offset += key_byte_size;
+			data_offset      += block_size;
+		}
+		if( libfcrypto_internal_rc4_context_set_keys_interleaved(
+		     internal_contexts,
+		     keys,
+		     key_byte_sizes,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to set keys.",
+			 function );
+
+			goto on_error;
+		}
+		if( libfcrypto_internal_rc4_context_crypt_interleaved(
+		     internal_contexts,
+		     stream_input_data,
+		     stream_output_data,
+		     block_size,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_ENCRYPTION,
+			 LIBCERROR_ENCRYPTION_ERROR_GENERIC,
+			 "%s: unable to crypt data.",
+			 function );
+
+			goto on_error;
+		}
+	}
+	/* The remaining blocks are processed individually
+	 */
+	while( data_offset < input_data_size )
+	{
+		data_size = input_data_size - data_offset;
+
+		if( data_size > block_size )
+		{
+			data_size = block_size;
+		}
+		if( libfcrypto_internal_rc4_context_set_key(
+		     &( internal_contexts[ 0 ] ),
+		     &( block_keys[ block_key_offset ] ),
+		     key_byte_size,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to set key.",
+			 function );
+
+			goto on_error;
+		}
+		if( libfcrypto_internal_rc4_context_crypt(
+		     &( internal_contexts[ 0 ] ),
+		     &( input_data[ data_offset ] ),
+		     &( output_data[ data_offset ] ),
+		     data_size,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_ENCRYPTION,
+			 LIBCERROR_ENCRYPTION_ERROR_GENERIC,
+			 "%s: unable to crypt data.",
+			 function );
+
+			goto on_error;
+		}
+		block_key_offset += key_byte_size;
+		data_offset      += data_size;
+	}
+	memory_set(
+	 internal_contexts,
+	 0,
+	 sizeof( libfcrypto_internal_rc4_context_t ) * LIBFCRYPTO_RC4_NUMBER_OF_INTERLEAVED_STREAMS );
+
+	return( 1 );
+
+on_error:
+	memory_set(
+	 internal_contexts,
+	 0,
+	 sizeof( libfcrypto_internal_rc4_context_t ) * LIBFCRYPTO_RC4_NUMBER_OF_INTERLEAVED_STREAMS );
+
+	return( -1 );
+}
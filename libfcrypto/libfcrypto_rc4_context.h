@@ -33,6 +33,14 @@
 extern "C" {
 #endif
 
+/* The number of streams of which the processing is interleaved
+ */
+#define LIBFCRYPTO_RC4_NUMBER_OF_INTERLEAVED_STREAMS	4
+
+/* The size of a checkpoint, which contains the permutations table and indexes
+ */
+#define LIBFCRYPTO_RC4_CHECKPOINT_SIZE			258
+
 typedef struct libfcrypto_internal_rc4_context libfcrypto_internal_rc4_context_t;
 
 struct libfcrypto_internal_rc4_context
@@ -44,6 +52,26 @@ struct libfcrypto_internal_rc4_context
 	/* The permutations table indexes
 	 */
 	uint8_t index[ 2 ];
+
+	/* The key stream offset
+	 */
+	uint64_t key_stream_offset;
+
+	/* The checkpoint interval or 0 if checkpoints are disabled
+	 */
+	size_t checkpoint_interval;
+
+	/* The checkpoints data, where checkpoint N contains the state at key stream offset N * checkpoint interval
+	 */
+	uint8_t *checkpoints_data;
+
+	/* The number of checkpoints
+	 */
+	int number_of_checkpoints;
+
+	/* The maximum number of checkpoints
+	 */
+	int maximum_number_of_checkpoints;
 };
 
 LIBFCRYPTO_EXTERN \
@@ -63,6 +91,29 @@ int libfcrypto_rc4_context_set_key(
      size_t key_bit_size,
      libcerror_error_t **error );
 
+int libfcrypto_internal_rc4_context_set_key(
+     libfcrypto_internal_rc4_context_t *internal_context,
+     const uint8_t *key,
+     size_t key_byte_size,
+     libcerror_error_t **error );
+
+LIBFCRYPTO_EXTERN \
+int libfcrypto_rc4_context_set_checkpoints(
+     libfcrypto_rc4_context_t *context,
+     size_t checkpoint_interval,
+     int maximum_number_of_checkpoints,
+     libcerror_error_t **error );
+
+int libfcrypto_internal_rc4_context_set_checkpoint(
+     libfcrypto_internal_rc4_context_t *internal_context,
+     libcerror_error_t **error );
+
+LIBFCRYPTO_EXTERN \
+int libfcrypto_rc4_context_seek_offset(
+     libfcrypto_rc4_context_t *context,
+     uint64_t offset,
+     libcerror_error_t **error );
+
 LIBFCRYPTO_EXTERN \
 int libfcrypto_rc4_crypt(
      libfcrypto_rc4_context_t *context,
@@ -72,6 +123,80 @@ int libfcrypto_rc4_crypt(
      size_t output_data_size,
      libcerror_error_t **error );
 
+LIBFCRYPTO_EXTERN \
+int libfcrypto_rc4_skip_key_stream(
+     libfcrypto_rc4_context_t *context,
+     size_t skip_size,
+     libcerror_error_t **error );
+
+LIBFCRYPTO_EXTERN \
+int libfcrypto_rc4_get_key_stream(
+     libfcrypto_rc4_context_t *context,
+     uint8_t *key_stream_data,
+     size_t key_stream_data_size,
+     libcerror_error_t **error );
+
+int libfcrypto_internal_rc4_context_crypt(
+     libfcrypto_internal_rc4_context_t *internal_context,
+     const uint8_t *input_data,
+     uint8_t *output_data,
+     size_t data_size,
+     libcerror_error_t **error );
+
+int libfcrypto_internal_rc4_context_skip(
+     libfcrypto_internal_rc4_context_t *internal_context,
+     size_t data_size,
+     libcerror_error_t **error );
+
+int libfcrypto_internal_rc4_context_get_key_stream(
+     libfcrypto_internal_rc4_context_t *internal_context,
+     uint8_t *key_stream_data,
+     size_t key_stream_data_size,
+     libcerror_error_t **error );
+
+int libfcrypto_internal_rc4_context_crypt_with_checkpoints(
+     libfcrypto_internal_rc4_context_t *internal_context,
+     const uint8_t *input_data,
+     uint8_t *output_data,
+     size_t data_size,
+     libcerror_error_t **error );
+
+int libfcrypto_internal_rc4_context_set_keys_interleaved(
+     libfcrypto_internal_rc4_context_t *internal_contexts,
+     const uint8_t **keys,
+     const size_t *key_byte_sizes,
+     libcerror_error_t **error );
+
+int libfcrypto_internal_rc4_context_crypt_interleaved(
+     libfcrypto_internal_rc4_context_t *internal_contexts,
+     const uint8_t **input_data,
+     uint8_t **output_data,
+     size_t data_size,
+     libcerror_error_t **error );
+
+LIBFCRYPTO_EXTERN \
+int libfcrypto_rc4_crypt_multiple(
+     const uint8_t **keys,
+     const size_t *key_bit_sizes,
+     const uint8_t **input_data,
+     const size_t *input_data_sizes,
+     uint8_t **output_data,
+     const size_t *output_data_sizes,
+     int number_of_streams,
+     libcerror_error_t **error );
+
+LIBFCRYPTO_EXTERN \
+int libfcrypto_rc4_crypt_with_block_keys(
+     const uint8_t *block_keys,
+     size_t block_keys_size,
+     size_t key_bit_size,
+     size_t block_size,
+     const uint8_t *input_data,
+     size_t input_data_size,
+     uint8_t *output_data,
+     size_t output_data_size,
+     libcerror_error_t **error );
+
 #if defined( __cplusplus )
 }
 #endif
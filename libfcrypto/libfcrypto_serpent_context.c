@@ -24,9 +24,15 @@
 #include <memory.h>
 #include <types.h>
 
+#include "libfcrypto_cpu.h"
+#include "libfcrypto_ctr.h"
 #include "libfcrypto_definitions.h"
 #include "libfcrypto_serpent_context.h"
 
+#if defined( LIBFCRYPTO_SERPENT_CONTEXT_HAVE_SSE2 ) || defined( LIBFCRYPTO_SERPENT_CONTEXT_HAVE_AVX2 ) || defined( LIBFCRYPTO_SERPENT_CONTEXT_HAVE_AVX512 )
+#include <immintrin.h>
+#endif
+
 /* Serpent
  *
  * http://www.cl.cam.ac.uk/~rja14/Papers/serpent.pdf
@@ -559,6 +565,135 @@
 	libfcrypto_serpent_calculate_reverse_linear_transformation( expanded_key_values, expanded_key_index, value0, value1, value2, value3, value4 ); \
 	libfcrypto_serpent_calculate_reverse_substitution7( value0, value1, value2, value3, value4 );
 
+/* Calculates the 32 rounds to encrypt a block, where the encrypted block is stored in value0, value1, value2 and value3
+ */
+#define libfcrypto_serpent_calculate_forward_rounds( expanded_key_values, value0, value1, value2, value3, value4 ) \
+	value0 ^= expanded_key_values[ 0 ]; \
+	value1 ^= expanded_key_values[ 1 ]; \
+	value2 ^= expanded_key_values[ 2 ]; \
+	value3 ^= expanded_key_values[ 3 ]; \
+	libfcrypto_serpent_calculate_forward_substitution0( value0, value1, value2, value3, value4 ); \
+	libfcrypto_serpent_calculate_forward_linear_transformation_and_substitution1( expanded_key_values, 4, value2, value1, value3, value0, value4 ); \
+	libfcrypto_serpent_calculate_forward_linear_transformation_and_substitution2( expanded_key_values, 8, value4, value3, value0, value2, value1 ); \
+	libfcrypto_serpent_calculate_forward_linear_transformation_and_substitution3( expanded_key_values, 12, value1, value3, value4, value2, value0 ); \
+	libfcrypto_serpent_calculate_forward_linear_transformation_and_substitution4( expanded_key_values, 16, value2, value0, value3, value1, value4 ); \
+	libfcrypto_serpent_calculate_forward_linear_transformation_and_substitution5( expanded_key_values, 20, value0, value3, value1, value4, value2 ); \
+	libfcrypto_serpent_calculate_forward_linear_transformation_and_substitution6( expanded_key_values, 24, value2, value0, value3, value4, value1 ); \
+	libfcrypto_serpent_calculate_forward_linear_transformation_and_substitution7( expanded_key_values, 28, value3, value1, value0, value4, value2 ); \
+	libfcrypto_serpent_calculate_forward_linear_transformation_and_substitution0( expanded_key_values, 32, value2, value0, value4, value3, value1 ); \
+	libfcrypto_serpent_calculate_forward_linear_transformation_and_substitution1( expanded_key_values, 36, value4, value0, value3, value2, value1 ); \
+	libfcrypto_serpent_calculate_forward_linear_transformation_and_substitution2( expanded_key_values, 40, value1, value3, value2, value4, value0 ); \
+	libfcrypto_serpent_calculate_forward_linear_transformation_and_substitution3( expanded_key_values, 44, value0, value3, value1, value4, value2 ); \
+	libfcrypto_serpent_calculate_forward_linear_transformation_and_substitution4( expanded_key_values, 48, value4, value2, value3, value0, value1 ); \
+	libfcrypto_serpent_calculate_forward_linear_transformation_and_substitution5( expanded_key_values, 52, value2, value3, value0, value1, value4 ); \
+	libfcrypto_serpent_calculate_forward_linear_transformation_and_substitution6( expanded_key_values, 56, value4, value2, value3, value1, value0 ); \
+	libfcrypto_serpent_calculate_forward_linear_transformation_and_substitution7( expanded_key_values, 60, value3, value0, value2, value1, value4 ); \
+	libfcrypto_serpent_calculate_forward_linear_transformation_and_substitution0( expanded_key_values, 64, value4, value2, value1, value3, value0 ); \
+	libfcrypto_serpent_calculate_forward_linear_transformation_and_substitution1( expanded_key_values, 68, value1, value2, value3, value4, value0 ); \
+	libfcrypto_serpent_calculate_forward_linear_transformation_and_substitution2( expanded_key_values, 72, value0, value3, value4, value1, value2 ); \
+	libfcrypto_serpent_calculate_forward_linear_transformation_and_substitution3( expanded_key_values, 76, value2, value3, value0, value1, value4 ); \
+	libfcrypto_serpent_calculate_forward_linear_transformation_and_substitution4( expanded_key_values, 80, value1, value4, value3, value2, value0 ); \
+	libfcrypto_serpent_calculate_forward_linear_transformation_and_substitution5( expanded_key_values, 84, value4, value3, value2, value0, value1 ); \
+	libfcrypto_serpent_calculate_forward_linear_transformation_and_substitution6( expanded_key_values, 88, value1, value4, value3, value0, value2 ); \
+	libfcrypto_serpent_calculate_forward_linear_transformation_and_substitution7( expanded_key_values, 92, value3, value2, value4, value0, value1 ); \
+	libfcrypto_serpent_calculate_forward_linear_transformation_and_substitution0( expanded_key_values, 96, value1, value4, value0, value3, value2 ); \
+	libfcrypto_serpent_calculate_forward_linear_transformation_and_substitution1( expanded_key_values, 100, value0, value4, value3, value1, value2 ); \
+	libfcrypto_serpent_calculate_forward_linear_transformation_and_substitution2( expanded_key_values, 104, value2, value3, value1, value0, value4 ); \
+	libfcrypto_serpent_calculate_forward_linear_transformation_and_substitution3( expanded_key_values, 108, value4, value3, value2, value0, value1 ); \
+	libfcrypto_serpent_calculate_forward_linear_transformation_and_substitution4( expanded_key_values, 112, value0, value1, value3, value4, value2 ); \
+	libfcrypto_serpent_calculate_forward_linear_transformation_and_substitution5( expanded_key_values, 116, value1, value3, value4, value2, value0 ); \
+	libfcrypto_serpent_calculate_forward_linear_transformation_and_substitution6( expanded_key_values, 120, value0, value1, value3, value2, value4 ); \
+	libfcrypto_serpent_calculate_forward_linear_transformation_and_substitution7( expanded_key_values, 124, value3, value4, value1, value2, value0 ); \
+	value0 ^= expanded_key_values[ 128 ]; \
+	value1 ^= expanded_key_values[ 129 ]; \
+	value2 ^= expanded_key_values[ 130 ]; \
+	value3 ^= expanded_key_values[ 131 ];
+
+/* Calculates the 32 rounds to decrypt a block, where the decrypted block is stored in value2, value3, value1 and value4
+ */
+#define libfcrypto_serpent_calculate_reverse_rounds( expanded_key_values, value0, value1, value2, value3, value4 ) \
+	value0 ^= expanded_key_values[ 128 ]; \
+	value1 ^= expanded_key_values[ 129 ]; \
+	value2 ^= expanded_key_values[ 130 ]; \
+	value3 ^= expanded_key_values[ 131 ]; \
+	libfcrypto_serpent_calculate_reverse_substitution7( value0, value1, value2, value3, value4 ); \
+	libfcrypto_serpent_calculate_reverse_linear_transformation_and_substitution6( expanded_key_values, 4 * 31, value1, value3, value0, value4, value2 ); \
+	libfcrypto_serpent_calculate_reverse_linear_transformation_and_substitution5( expanded_key_values, 4 * 30, value0, value2, value4, value1, value3 ); \
+	libfcrypto_serpent_calculate_reverse_linear_transformation_and_substitution4( expanded_key_values, 4 * 29, value2, value3, value0, value4, value1 ); \
+	libfcrypto_serpent_calculate_reverse_linear_transformation_and_substitution3( expanded_key_values, 4 * 28, value2, value0, value1, value4, value3 ); \
+	libfcrypto_serpent_calculate_reverse_linear_transformation_and_substitution2( expanded_key_values, 4 * 27, value1, value2, value3, value4, value0 ); \
+	libfcrypto_serpent_calculate_reverse_linear_transformation_and_substitution1( expanded_key_values, 4 * 26, value2, value0, value4, value3, value1 ); \
+	libfcrypto_serpent_calculate_reverse_linear_transformation_and_substitution0( expanded_key_values, 4 * 25, value1, value0, value4, value3, value2 ); \
+	libfcrypto_serpent_calculate_reverse_linear_transformation_and_substitution7( expanded_key_values, 4 * 24, value4, value2, value0, value1, value3 ); \
+	libfcrypto_serpent_calculate_reverse_linear_transformation_and_substitution6( expanded_key_values, 4 * 23, value2, value1, value4, value3, value0 ); \
+	libfcrypto_serpent_calculate_reverse_linear_transformation_and_substitution5( expanded_key_values, 4 * 22, value4, value0, value3, value2, value1 ); \
+	libfcrypto_serpent_calculate_reverse_linear_transformation_and_substitution4( expanded_key_values, 4 * 21, value0, value1, value4, value3, value2 ); \
+	libfcrypto_serpent_calculate_reverse_linear_transformation_and_substitution3( expanded_key_values, 4 * 20, value0, value4, value2, value3, value1 ); \
+	libfcrypto_serpent_calculate_reverse_linear_transformation_and_substitution2( expanded_key_values, 4 * 19, value2, value0, value1, value3, value4 ); \
+	libfcrypto_serpent_calculate_reverse_linear_transformation_and_substitution1( expanded_key_values, 4 * 18, value0, value4, value3, value1, value2 ); \
+	libfcrypto_serpent_calculate_reverse_linear_transformation_and_substitution0( expanded_key_values, 4 * 17, value2, value4, value3, value1, value0 ); \
+	libfcrypto_serpent_calculate_reverse_linear_transformation_and_substitution7( expanded_key_values, 4 * 16, value3, value0, value4, value2, value1 ); \
+	libfcrypto_serpent_calculate_reverse_linear_transformation_and_substitution6( expanded_key_values, 4 * 15, value0, value2, value3, value1, value4 ); \
+	libfcrypto_serpent_calculate_reverse_linear_transformation_and_substitution5( expanded_key_values, 4 * 14, value3, value4, value1, value0, value2 ); \
+	libfcrypto_serpent_calculate_reverse_linear_transformation_and_substitution4( expanded_key_values, 4 * 13, value4, value2, value3, value1, value0 ); \
+	libfcrypto_serpent_calculate_reverse_linear_transformation_and_substitution3( expanded_key_values, 4 * 12, value4, value3, value0, value1, value2 ); \
+	libfcrypto_serpent_calculate_reverse_linear_transformation_and_substitution2( expanded_key_values, 4 * 11, value0, value4, value2, value1, value3 ); \
+	libfcrypto_serpent_calculate_reverse_linear_transformation_and_substitution1( expanded_key_values, 4 * 10, value4, value3, value1, value2, value0 ); \
+	libfcrypto_serpent_calculate_reverse_linear_transformation_and_substitution0( expanded_key_values, 4 * 9, value0, value3, value1, value2, value4 ); \
+	libfcrypto_serpent_calculate_reverse_linear_transformation_and_substitution7( expanded_key_values, 4 * 8, value1, value4, value3, value0, value2 ); \
+	libfcrypto_serpent_calculate_reverse_linear_transformation_and_substitution6( expanded_key_values, 4 * 7, value4, value0, value1, value2, value3 ); \
+	libfcrypto_serpent_calculate_reverse_linear_transformation_and_substitution5( expanded_key_values, 4 * 6, value1, value3, value2, value4, value0 ); \
+	libfcrypto_serpent_calculate_reverse_linear_transformation_and_substitution4( expanded_key_values, 4 * 5, value3, value0, value1, value2, value4 ); \
+	libfcrypto_serpent_calculate_reverse_linear_transformation_and_substitution3( expanded_key_values, 4 * 4, value3, value1, value4, value2, value0 ); \
+	libfcrypto_serpent_calculate_reverse_linear_transformation_and_substitution2( expanded_key_values, 4 * 3, value4, value3, value0, value2, value1 ); \
+	libfcrypto_serpent_calculate_reverse_linear_transformation_and_substitution1( expanded_key_values, 4 * 2, value3, value1, value2, value0, value4 ); \
+	libfcrypto_serpent_calculate_reverse_linear_transformation_and_substitution0( expanded_key_values, 4 * 1, value4, value1, value2, value0, value3 ); \
+	value2 ^= expanded_key_values[ 0 ]; \
+	value3 ^= expanded_key_values[ 1 ]; \
+	value1 ^= expanded_key_values[ 2 ]; \
+	value4 ^= expanded_key_values[ 3 ];
+
+#if defined( LIBFCRYPTO_SERPENT_CONTEXT_HAVE_SSE2 ) || defined( LIBFCRYPTO_SERPENT_CONTEXT_HAVE_AVX2 ) || defined( LIBFCRYPTO_SERPENT_CONTEXT_HAVE_AVX512 )
+
+/* Vectors of 4, 8 and 16 32-bit values, that are used to process multiple blocks at once
+ * The round macros only use operators, hence they apply to these vectors as well as to 32-bit values
+ */
+typedef uint32_t libfcrypto_serpent_vector128_t __attribute__ (( vector_size( 16 ) ));
+typedef uint32_t libfcrypto_serpent_vector256_t __attribute__ (( vector_size( 32 ) ));
+typedef uint32_t libfcrypto_serpent_vector512_t __attribute__ (( vector_size( 64 ) ));
+
+/* Transposes the 4x4 32-bit values in every 128-bit lane of 4 vectors, which converts 4 blocks per lane
+ * into vectors that contain the same 32-bit value of every block, and vice versa
+ */
+#define libfcrypto_serpent_transpose_vectors( vector_type, intrinsic_type, intrinsic_prefix, value0, value1, value2, value3, value4 ) \
+	value4 = (vector_type) intrinsic_prefix ## _unpacklo_epi32( (intrinsic_type) value0, (intrinsic_type) value1 ); \
+	value1 = (vector_type) intrinsic_prefix ## _unpackhi_epi32( (intrinsic_type) value0, (intrinsic_type) value1 ); \
+	value0 = (vector_type) intrinsic_prefix ## _unpacklo_epi32( (intrinsic_type) value2, (intrinsic_type) value3 ); \
+	value3 = (vector_type) intrinsic_prefix ## _unpackhi_epi32( (intrinsic_type) value2, (intrinsic_type) value3 ); \
+	value2 = (vector_type) intrinsic_prefix ## _unpacklo_epi64( (intrinsic_type) value1, (intrinsic_type) value3 ); \
+	value3 = (vector_type) intrinsic_prefix ## _unpackhi_epi64( (intrinsic_type) value1, (intrinsic_type) value3 ); \
+	value1 = (vector_type) intrinsic_prefix ## _unpackhi_epi64( (intrinsic_type) value4, (intrinsic_type) value0 ); \
+	value0 = (vector_type) intrinsic_prefix ## _unpacklo_epi64( (intrinsic_type) value4, (intrinsic_type) value0 );
+
+#endif /* defined( LIBFCRYPTO_SERPENT_CONTEXT_HAVE_SSE2 ) || defined( LIBFCRYPTO_SERPENT_CONTEXT_HAVE_AVX2 ) || defined( LIBFCRYPTO_SERPENT_CONTEXT_HAVE_AVX512 ) */
+
+/* XORs a block of 16 bytes with the XTS tweak value
+ */
+#define libfcrypto_serpent_xts_xor_tweak( input_data, output_data, tweak_value_lower, tweak_value_upper, value_64bit ) \
+	byte_stream_copy_to_uint64_little_endian( &( ( input_data )[ 0 ] ), value_64bit ); \
+	value_64bit ^= tweak_value_lower; \
+	byte_stream_copy_from_uint64_little_endian( &( ( output_data )[ 0 ] ), value_64bit ); \
+	byte_stream_copy_to_uint64_little_endian( &( ( input_data )[ 8 ] ), value_64bit ); \
+	value_64bit ^= tweak_value_upper; \
+	byte_stream_copy_from_uint64_little_endian( &( ( output_data )[ 8 ] ), value_64bit );
+
+/* Multiplies the XTS tweak value by the primitive element x of GF(2^128)
+ */
+#define libfcrypto_serpent_xts_multiply_tweak( tweak_value_lower, tweak_value_upper, value_64bit ) \
+	value_64bit       = tweak_value_upper >> 63; \
+	tweak_value_upper = ( tweak_value_upper << 1 ) | ( tweak_value_lower >> 63 ); \
+	tweak_value_lower = ( tweak_value_lower << 1 ) ^ ( value_64bit * 0x87 );
+
 /* Creates a context
  * Make sure the value context is referencing, is set to NULL
  * Returns 1 if successful or -1 on error
@@ -569,6 +704,8 @@ int libfcrypto_serpent_context_initialize(
 {
 	libfcrypto_internal_serpent_context_t *internal_context = NULL;
 	static char *function                                   = "libfcrypto_serpent_context_initialize";
+	int cpu_level                                           = 0;
+	int function_index                                      = 0;
 
 	if( context == NULL )
 	{
@@ -620,6 +757,39 @@ int libfcrypto_serpent_context_initialize(
 
 		goto on_error;
 	}
+	/* The multi-block functions are selected once per context
+	 */
+	cpu_level = libfcrypto_cpu_get_level();
+
+#if defined( LIBFCRYPTO_SERPENT_CONTEXT_HAVE_AVX512 )
+	if( cpu_level >= LIBFCRYPTO_CPU_LEVEL_AVX512 )
+	{
+		internal_context->crypt_blocks_functions[ function_index ] = libfcrypto_internal_serpent_context_crypt_blocks_avx512;
+		internal_context->crypt_blocks_sizes[ function_index ]     = 256;
+
+		function_index++;
+	}
+#endif
+#if defined( LIBFCRYPTO_SERPENT_CONTEXT_HAVE_AVX2 )
+	if( cpu_level >= LIBFCRYPTO_CPU_LEVEL_AVX2 )
+	{
+		internal_context->crypt_blocks_functions[ function_index ] = libfcrypto_internal_serpent_context_crypt_blocks_avx2;
+		internal_context->crypt_blocks_sizes[ function_index ]     = 128;
+
+		function_index++;
+	}
+#endif
+#if defined( LIBFCRYPTO_SERPENT_CONTEXT_HAVE_SSE2 )
+	if( cpu_level >= LIBFCRYPTO_CPU_LEVEL_SSE2 )
+	{
+		internal_context->crypt_blocks_functions[ function_index ] = libfcrypto_internal_serpent_context_crypt_blocks_sse2;
+		internal_context->crypt_blocks_sizes[ function_index ]     = 64;
+
+		function_index++;
+	}
+#endif
+	internal_context->number_of_crypt_blocks_functions = function_index;
+
 	*context = (libfcrypto_serpent_context_t *) internal_context;
 
 	return( 1 );
@@ -1566,302 +1736,14 @@ int libfcrypto_internal_serpent_context_encrypt_block(
 	 &( input_data[ 12 ] ),
 	 value3 );
 
-	value0 ^= internal_context->expanded_key[ 0 ];
-	value1 ^= internal_context->expanded_key[ 1 ];
-	value2 ^= internal_context->expanded_key[ 2 ];
-	value3 ^= internal_context->expanded_key[ 3 ];
-
-	libfcrypto_serpent_calculate_forward_substitution0(
-	 value0,
-	 value1,
-	 value2,
-	 value3,
-	 value4 );
-
-	libfcrypto_serpent_calculate_forward_linear_transformation_and_substitution1(
-	 internal_context->expanded_key,
-	 4,
-	 value2,
-	 value1,
-	 value3,
-	 value0,
-	 value4 );
-
-	libfcrypto_serpent_calculate_forward_linear_transformation_and_substitution2(
-	 internal_context->expanded_key,
-	 8,
-	 value4,
-	 value3,
-	 value0,
-	 value2,
-	 value1 );
-
-	libfcrypto_serpent_calculate_forward_linear_transformation_and_substitution3(
-	 internal_context->expanded_key,
-	 12,
-	 value1,
-	 value3,
-	 value4,
-	 value2,
-	 value0 );
-
-	libfcrypto_serpent_calculate_forward_linear_transformation_and_substitution4(
-	 internal_context->expanded_key,
-	 16,
-	 value2,
-	 value0,
-	 value3,
-	 value1,
-	 value4 );
-
-	libfcrypto_serpent_calculate_forward_linear_transformation_and_substitution5(
-	 internal_context->expanded_key,
-	 20,
-	 value0,
-	 value3,
-	 value1,
-	 value4,
-	 value2 );
-
-	libfcrypto_serpent_calculate_forward_linear_transformation_and_substitution6(
-	 internal_context->expanded_key,
-	 24,
-	 value2,
-	 value0,
-	 value3,
-	 value4,
-	 value1 );
-
-	libfcrypto_serpent_calculate_forward_linear_transformation_and_substitution7(
-	 internal_context->expanded_key,
-	 28,
-	 value3,
-	 value1,
-	 value0,
-	 value4,
-	 value2 );
-
-	libfcrypto_serpent_calculate_forward_linear_transformation_and_substitution0(
-	 internal_context->expanded_key,
-	 32,
-	 value2,
-	 value0,
-	 value4,
-	 value3,
-	 value1 );
-
-	libfcrypto_serpent_calculate_forward_linear_transformation_and_substitution1(
-	 internal_context->expanded_key,
-	 36,
-	 value4,
-	 value0,
-	 value3,
-	 value2,
-	 value1 );
-
-	libfcrypto_serpent_calculate_forward_linear_transformation_and_substitution2(
-	 internal_context->expanded_key,
-	 40,
-	 value1,
-	 value3,
-	 value2,
-	 value4,
-	 value0 );
-
-	libfcrypto_serpent_calculate_forward_linear_transformation_and_substitution3(
-	 internal_context->expanded_key,
-	 44,
-	 value0,
-	 value3,
-	 value1,
-	 value4,
-	 value2 );
-
-	libfcrypto_serpent_calculate_forward_linear_transformation_and_substitution4(
-	 internal_context->expanded_key,
-	 48,
-	 value4,
-	 value2,
-	 value3,
-	 value0,
-	 value1 );
-
-	libfcrypto_serpent_calculate_forward_linear_transformation_and_substitution5(
-	 internal_context->expanded_key,
-	 52,
-	 value2,
-	 value3,
-	 value0,
-	 value1,
-	 value4 );
-
-	libfcrypto_serpent_calculate_forward_linear_transformation_and_substitution6(
-	 internal_context->expanded_key,
-	 56,
-	 value4,
-	 value2,
-	 value3,
-	 value1,
-	 value0 );
-
-	libfcrypto_serpent_calculate_forward_linear_transformation_and_substitution7(
-	 internal_context->expanded_key,
-	 60,
-	 value3,
-	 value0,
-	 value2,
-	 value1,
-	 value4 );
-
-	libfcrypto_serpent_calculate_forward_linear_transformation_and_substitution0(
-	 internal_context->expanded_key,
-	 64,
-	 value4,
-	 value2,
-	 value1,
-	 value3,
-	 value0 );
-
-	libfcrypto_serpent_calculate_forward_linear_transformation_and_substitution1(
-	 internal_context->expanded_key,
-	 68,
-	 value1,
-	 value2,
-	 value3,
-	 value4,
-	 value0 );
-
-	libfcrypto_serpent_calculate_forward_linear_transformation_and_substitution2(
-	 internal_context->expanded_key,
-	 72,
-	 value0,
-	 value3,
-	 value4,
-	 value1,
-	 value2 );
-
-	libfcrypto_serpent_calculate_forward_linear_transformation_and_substitution3(
-	 internal_context->expanded_key,
-	 76,
-	 value2,
-	 value3,
-	 value0,
-	 value1,
-	 value4 );
-
-	libfcrypto_serpent_calculate_forward_linear_transformation_and_substitution4(
-	 internal_context->expanded_key,
-	 80,
-	 value1,
-	 value4,
-	 value3,
-	 value2,
-	 value0 );
-
-	libfcrypto_serpent_calculate_forward_linear_transformation_and_substitution5(
-	 internal_context->expanded_key,
-	 84,
-	 value4,
-	 value3,
-	 value2,
-	 value0,
-	 value1 );
-
-	libfcrypto_serpent_calculate_forward_linear_transformation_and_substitution6(
-	 internal_context->expanded_key,
-	 88,
-	 value1,
-	 value4,
-	 value3,
-	 value0,
-	 value2 );
-
-	libfcrypto_serpent_calculate_forward_linear_transformation_and_substitution7(
-	 internal_context->expanded_key,
-	 92,
-	 value3,
-	 value2,
-	 value4,
-	 value0,
-	 value1 );
-
-	libfcrypto_serpent_calculate_forward_linear_transformation_and_substitution0(
-	 internal_context->expanded_key,
-	 96,
-	 value1,
-	 value4,
-	 value0,
-	 value3,
-	 value2 );
-
-	libfcrypto_serpent_calculate_forward_linear_transformation_and_substitution1(
-	 internal_context->expanded_key,
-	 100,
-	 value0,
-	 value4,
-	 value3,
-	 value1,
-	 value2 );
-
-	libfcrypto_serpent_calculate_forward_linear_transformation_and_substitution2(
-	 internal_context->expanded_key,
-	 104,
-	 value2,
-	 value3,
-	 value1,
-	 value0,
-	 value4 );
-
-	libfcrypto_serpent_calculate_forward_linear_transformation_and_substitution3(
+	libfcrypto_serpent_calculate_forward_rounds(
 	 internal_context->expanded_key,
-	 108,
-	 value4,
-	 value3,
-	 value2,
-	 value0,
-	 value1 );
-
-	libfcrypto_serpent_calculate_forward_linear_transformation_and_substitution4(
-	 internal_context->expanded_key,
-	 112,
 	 value0,
 	 value1,
-	 value3,
-	 value4,
-	 value2 );
-
-	libfcrypto_serpent_calculate_forward_linear_transformation_and_substitution5(
-	 internal_context->expanded_key,
-	 116,
-	 value1,
-	 value3,
-	 value4,
 	 value2,
-	 value0 );
-
-	libfcrypto_serpent_calculate_forward_linear_transformation_and_substitution6(
-	 internal_context->expanded_key,
-	 120,
-	 value0,
-	 value1,
 	 value3,
-	 value2,
 	 value4 );
 
-	libfcrypto_serpent_calculate_forward_linear_transformation_and_substitution7(
-	 internal_context->expanded_key,
-	 124,
-	 value3,
-	 value4,
-	 value1,
-	 value2,
-	 value0 );
-
-	value0 ^= internal_context->expanded_key[ 128 ];
-	value1 ^= internal_context->expanded_key[ 129 ];
-	value2 ^= internal_context->expanded_key[ 130 ];
-	value3 ^= internal_context->expanded_key[ 131 ];
-
 	byte_stream_copy_from_uint32_little_endian(
 	 &( output_data[ 0 ] ),
 	 value0 );
@@ -1973,345 +1855,1721 @@ int libfcrypto_internal_serpent_context_decrypt_block(
 	 &( input_data[ 12 ] ),
 	 value3 );
 
-	value0 ^= internal_context->expanded_key[ 128 ];
-	value1 ^= internal_context->expanded_key[ 129 ];
-	value2 ^= internal_context->expanded_key[ 130 ];
-	value3 ^= internal_context->expanded_key[ 131 ];
-
-	libfcrypto_serpent_calculate_reverse_substitution7(
+	libfcrypto_serpent_calculate_reverse_rounds(
+	 internal_context->expanded_key,
 	 value0,
 	 value1,
 	 value2,
 	 value3,
 	 value4 );
 
-	libfcrypto_serpent_calculate_reverse_linear_transformation_and_substitution6(
-	 internal_context->expanded_key,
-	 4 * 31,
-	 value1,
-	 value3,
-	 value0,
-	 value4,
+	byte_stream_copy_from_uint32_little_endian(
+	 &( output_data[ 0 ] ),
 	 value2 );
 
-	libfcrypto_serpent_calculate_reverse_linear_transformation_and_substitution5(
-	 internal_context->expanded_key,
-	 4 * 30,
-	 value0,
-	 value2,
-	 value4,
-	 value1,
+	byte_stream_copy_from_uint32_little_endian(
+	 &( output_data[ 4 ] ),
 	 value3 );
 
-	libfcrypto_serpent_calculate_reverse_linear_transformation_and_substitution4(
-	 internal_context->expanded_key,
-	 4 * 29,
-	 value2,
-	 value3,
-	 value0,
-	 value4,
+	byte_stream_copy_from_uint32_little_endian(
+	 &( output_data[ 8 ] ),
 	 value1 );
 
-	libfcrypto_serpent_calculate_reverse_linear_transformation_and_substitution3(
-	 internal_context->expanded_key,
-	 4 * 28,
-	 value2,
-	 value0,
-	 value1,
-	 value4,
-	 value3 );
+	byte_stream_copy_from_uint32_little_endian(
+	 &( output_data[ 12 ] ),
+	 value4 );
 
-	libfcrypto_serpent_calculate_reverse_linear_transformation_and_substitution2(
-	 internal_context->expanded_key,
-	 4 * 27,
-	 value1,
-	 value2,
-	 value3,
-	 value4,
-	 value0 );
+	return( 1 );
+}
 
-	libfcrypto_serpent_calculate_reverse_linear_transformation_and_substitution1(
-	 internal_context->expanded_key,
-	 4 * 26,
-	 value2,
-	 value0,
-	 value4,
-	 value3,
-	 value1 );
+/* De- or encrypts multiple blocks of data using Serpent
+ * The blocks are processed using the multi-block functions selected for the context
+ * and the remaining blocks one at a time
+ * The size must be a multitude of the Serpent block size (16 byte)
+ * Returns 1 if successful or -1 on error
+ */
+int libfcrypto_internal_serpent_context_crypt_blocks(
+     libfcrypto_internal_serpent_context_t *internal_context,
+     int mode,
+     const uint8_t *input_data,
+     size_t input_data_size,
+     uint8_t *output_data,
+     size_t output_data_size,
+     libcerror_error_t **error )
+{
+	static char *function  = "libfcrypto_internal_serpent_context_crypt_blocks";
+	size_t data_offset     = 0;
+	size_t number_of_bytes = 0;
+	int function_index     = 0;
+	int result             = 0;
 
-	libfcrypto_serpent_calculate_reverse_linear_transformation_and_substitution0(
-	 internal_context->expanded_key,
-	 4 * 25,
-	 value1,
-	 value0,
-	 value4,
-	 value3,
-	 value2 );
+	if( internal_context == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid context.",
+		 function );
 
-	libfcrypto_serpent_calculate_reverse_linear_transformation_and_substitution7(
-	 internal_context->expanded_key,
-	 4 * 24,
-	 value4,
-	 value2,
-	 value0,
-	 value1,
-	 value3 );
+		return( -1 );
+	}
+	if( ( mode != LIBFCRYPTO_SERPENT_CRYPT_MODE_ENCRYPT )
+	 && ( mode != LIBFCRYPTO_SERPENT_CRYPT_MODE_DECRYPT ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported mode.",
+		 function );
 
-	libfcrypto_serpent_calculate_reverse_linear_transformation_and_substitution6(
-	 internal_context->expanded_key,
-	 4 * 23,
-	 value2,
-	 value1,
-	 value4,
-	 value3,
-	 value0 );
+		return( -1 );
+	}
+	if( input_data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid input data.",
+		 function );
 
-	libfcrypto_serpent_calculate_reverse_linear_transformation_and_substitution5(
-	 internal_context->expanded_key,
-	 4 * 22,
-	 value4,
-	 value0,
-	 value3,
-	 value2,
-	 value1 );
+		return( -1 );
+	}
+	/* Check if the input data size is a multitude of 16-byte
+	 */
+	if( ( ( input_data_size & (size_t) 0x0f ) != 0 )
+	 || ( input_data_size < 16 )
+	 || ( input_data_size > (size_t) SSIZE_MAX ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid input data size value out of bounds.",
+		 function );
 
-	libfcrypto_serpent_calculate_reverse_linear_transformation_and_substitution4(
-	 internal_context->expanded_key,
-	 4 * 21,
-	 value0,
-	 value1,
-	 value4,
-	 value3,
-	 value2 );
+		return( -1 );
+	}
+	if( output_data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid output data.",
+		 function );
 
-	libfcrypto_serpent_calculate_reverse_linear_transformation_and_substitution3(
-	 internal_context->expanded_key,
-	 4 * 20,
-	 value0,
-	 value4,
-	 value2,
-	 value3,
-	 value1 );
+		return( -1 );
+	}
+	if( ( output_data_size < input_data_size )
+	 || ( output_data_size > (size_t) SSIZE_MAX ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid output data size value out of bounds.",
+		 function );
 
-	libfcrypto_serpent_calculate_reverse_linear_transformation_and_substitution2(
-	 internal_context->expanded_key,
-	 4 * 19,
-	 value2,
-	 value0,
-	 value1,
-	 value3,
-	 value4 );
+		return( -1 );
+	}
+	for( function_index = 0;
+	     function_index < internal_context->number_of_crypt_blocks_functions;
+	     function_index++ )
+	{
+		number_of_bytes = input_data_size - data_offset;
+
+		if( number_of_bytes < internal_context->crypt_blocks_sizes[ function_index ] )
+		{
+			continue;
+		}
+		number_of_bytes -= number_of_bytes % internal_context->crypt_blocks_sizes[ function_index ];
+
+		if( internal_context->crypt_blocks_functions[ function_index ](
+		     internal_context,
+		     mode,
+		     &( input_data[ data_offset ] ),
+		     number_of_bytes,
+		     &( output_data[ data_offset ] ),
+		     number_of_bytes,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_ENCRYPTION,
+			 LIBCERROR_ENCRYPTION_ERROR_GENERIC,
+			 "%s: unable to de- or encrypt input data using multi-block function: %d.",
+			 function,
+			 function_index );
+
+			return( -1 );
+		}
+		data_offset += number_of_bytes;
+	}
+	while( data_offset < input_data_size )
+	{
+		if( mode == LIBFCRYPTO_SERPENT_CRYPT_MODE_ENCRYPT )
+		{
+			result = libfcrypto_internal_serpent_context_encrypt_block(
+			          internal_context,
+			          &( input_data[ data_offset ] ),
+			          16,
+			          &( output_data[ data_offset ] ),
+			          16,
+			          error );
+		}
+		else
+		{
+			result = libfcrypto_internal_serpent_context_decrypt_block(
+			          internal_context,
+			          &( input_data[ data_offset ] ),
+			          16,
+			          &( output_data[ data_offset ] ),
+			          16,
+			          error );
+		}
+		if( result != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_ENCRYPTION,
+			 LIBCERROR_ENCRYPTION_ERROR_GENERIC,
+			 "%s: unable to de- or encrypt input data.",
+			 function );
+
+			return( -1 );
+		}
+		data_offset += 16;
+	}
+	return( 1 );
+}
+
+#if defined( LIBFCRYPTO_SERPENT_CONTEXT_HAVE_SSE2 )
+
+/* De- or encrypts multiple blocks of data using Serpent and SSE2
+ * The blocks are processed 4 at a time, where every 32-bit lane of a vector contains a value of a different block
+ * The size must be a multitude of 4 times the Serpent block size (64 bytes)
+ * Returns 1 if successful or -1 on error
+ */
+__attribute__ (( target( "sse2" ) )) \
+int libfcrypto_internal_serpent_context_crypt_blocks_sse2(
+     libfcrypto_internal_serpent_context_t *internal_context,
+     int mode,
+     const uint8_t *input_data,
+     size_t input_data_size,
+     uint8_t *output_data,
+     size_t output_data_size,
+     libcerror_error_t **error )
+{
+	static char *function                 = "libfcrypto_internal_serpent_context_crypt_blocks_sse2";
+	libfcrypto_serpent_vector128_t value0 = { 0 };
+	libfcrypto_serpent_vector128_t value1 = { 0 };
+	libfcrypto_serpent_vector128_t value2 = { 0 };
+	libfcrypto_serpent_vector128_t value3 = { 0 };
+	libfcrypto_serpent_vector128_t value4 = { 0 };
+	size_t data_offset                    = 0;
+
+	if( internal_context == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid context.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( mode != LIBFCRYPTO_SERPENT_CRYPT_MODE_ENCRYPT )
+	 && ( mode != LIBFCRYPTO_SERPENT_CRYPT_MODE_DECRYPT ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported mode.",
+		 function );
+
+		return( -1 );
+	}
+	if( input_data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid input data.",
+		 function );
+
+		return( -1 );
+	}
+	/* Check if the input data size is a multitude of 64-byte
+	 */
+	if( ( ( input_data_size & (size_t) 0x3f ) != 0 )
+	 || ( input_data_size < 64 )
+	 || ( input_data_size > (size_t) SSIZE_MAX ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid input data size value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( output_data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid output data.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( output_data_size < input_data_size )
+	 || ( output_data_size > (size_t) SSIZE_MAX ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid output data size value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	while( data_offset < input_data_size )
+	{
+		value0 = (libfcrypto_serpent_vector128_t) _mm_loadu_si128(
+		          (const __m128i *) &( input_data[ data_offset ] ) );
+
+		value1 = (libfcrypto_serpent_vector128_t) _mm_loadu_si128(
+		          (const __m128i *) &( input_data[ data_offset + 16 ] ) );
+
+		value2 = (libfcrypto_serpent_vector128_t) _mm_loadu_si128(
+		          (const __m128i *) &( input_data[ data_offset + 32 ] ) );
+
+		value3 = (libfcrypto_serpent_vector128_t) _mm_loadu_si128(
+		          (const __m128i *) &( input_data[ data_offset + 48 ] ) );
+
+		libfcrypto_serpent_transpose_vectors(
+		 libfcrypto_serpent_vector128_t,
+		 __m128i,
+		 _mm,
+		 value0,
+		 value1,
+		 value2,
+		 value3,
+		 value4 );
+
+		if( mode == LIBFCRYPTO_SERPENT_CRYPT_MODE_ENCRYPT )
+		{
+			libfcrypto_serpent_calculate_forward_rounds(
+			 internal_context->expanded_key,
+			 value0,
+			 value1,
+			 value2,
+			 value3,
+			 value4 );
+
+			libfcrypto_serpent_transpose_vectors(
+			 libfcrypto_serpent_vector128_t,
+			 __m128i,
+			 _mm,
+			 value0,
+			 value1,
+			 value2,
+			 value3,
+			 value4 );
+		}
+		else
+		{
+			libfcrypto_serpent_calculate_reverse_rounds(
+			 internal_context->expanded_key,
+			 value0,
+			 value1,
+			 value2,
+			 value3,
+			 value4 );
+
+			/* The decrypted blocks are stored in value2, value3, value1 and value4
+			 */
+			libfcrypto_serpent_transpose_vectors(
+			 libfcrypto_serpent_vector128_t,
+			 __m128i,
+			 _mm,
+			 value2,
+			 value3,
+			 value1,
+			 value4,
+			 value0 );
+
+			value0 = value2;
+			value2 = value1;
+			value1 = value3;
+			value3 = value4;
+		}
+		_mm_storeu_si128(
+		 (__m128i *) &( output_data[ data_offset ] ),
+		 (__m128i) value0 );
+
+		_mm_storeu_si128(
+		 (__m128i *) &( output_data[ data_offset + 16 ] ),
+		 (__m128i) value1 );
+
+		_mm_storeu_si128(
+		 (__m128i *) &( output_data[ data_offset + 32 ] ),
+		 (__m128i) value2 );
+
+		_mm_storeu_si128(
+		 (__m128i *) &( output_data[ data_offset + 48 ] ),
+		 (__m128i) value3 );
+
+		data_offset += 64;
+	}
+	return( 1 );
+}
+
+#endif /* defined( LIBFCRYPTO_SERPENT_CONTEXT_HAVE_SSE2 ) */
+
+#if defined( LIBFCRYPTO_SERPENT_CONTEXT_HAVE_AVX2 )
+
+/* De- or encrypts multiple blocks of data using Serpent and AVX2
+ * The blocks are processed 8 at a time, where every 32-bit lane of a vector contains a value of a different block
+ * The size must be a multitude of 8 times the Serpent block size (128 bytes)
+ * Returns 1 if successful or -1 on error
+ */
+__attribute__ (( target( "avx2" ) )) \
+int libfcrypto_internal_serpent_context_crypt_blocks_avx2(
+     libfcrypto_internal_serpent_context_t *internal_context,
+     int mode,
+     const uint8_t *input_data,
+     size_t input_data_size,
+     uint8_t *output_data,
+     size_t output_data_size,
+     libcerror_error_t **error )
+{
+	static char *function                 = "libfcrypto_internal_serpent_context_crypt_blocks_avx2";
+	libfcrypto_serpent_vector256_t value0 = { 0 };
+	libfcrypto_serpent_vector256_t value1 = { 0 };
+	libfcrypto_serpent_vector256_t value2 = { 0 };
+	libfcrypto_serpent_vector256_t value3 = { 0 };
+	libfcrypto_serpent_vector256_t value4 = { 0 };
+	size_t data_offset                    = 0;
+
+	if( internal_context == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid context.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( mode != LIBFCRYPTO_SERPENT_CRYPT_MODE_ENCRYPT )
+	 && ( mode != LIBFCRYPTO_SERPENT_CRYPT_MODE_DECRYPT ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported mode.",
+		 function );
+
+		return( -1 );
+	}
+	if( input_data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid input data.",
+		 function );
+
+		return( -1 );
+	}
+	/* Check if the input data size is a multitude of 128-byte
+	 */
+	if( ( ( input_data_size & (size_t) 0x7f ) != 0 )
+	 || ( input_data_size < 128 )
+	 || ( input_data_size > (size_t) SSIZE_MAX ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid input data size value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( output_data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid output data.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( output_data_size < input_data_size )
+	 || ( output_data_size > (size_t) SSIZE_MAX ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid output data size value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	while( data_offset < input_data_size )
+	{
+		value0 = (libfcrypto_serpent_vector256_t) _mm256_loadu_si256(
+		          (const __m256i *) &( input_data[ data_offset ] ) );
+
+		value1 = (libfcrypto_serpent_vector256_t) _mm256_loadu_si256(
+		          (const __m256i *) &( input_data[ data_offset + 32 ] ) );
+
+		value2 = (libfcrypto_serpent_vector256_t) _mm256_loadu_si256(
+		          (const __m256i *) &( input_data[ data_offset + 64 ] ) );
+
+		value3 = (libfcrypto_serpent_vector256_t) _mm256_loadu_si256(
+		          (const __m256i *) &( input_data[ data_offset + 96 ] ) );
+
+		libfcrypto_serpent_transpose_vectors(
+		 libfcrypto_serpent_vector256_t,
+		 __m256i,
+		 _mm256,
+		 value0,
+		 value1,
+		 value2,
+		 value3,
+		 value4 );
+
+		if( mode == LIBFCRYPTO_SERPENT_CRYPT_MODE_ENCRYPT )
+		{
+			libfcrypto_serpent_calculate_forward_rounds(
+			 internal_context->expanded_key,
+			 value0,
+			 value1,
+			 value2,
+			 value3,
+			 value4 );
+
+			libfcrypto_serpent_transpose_vectors(
+			 libfcrypto_serpent_vector256_t,
+			 __m256i,
+			 _mm256,
+			 value0,
+			 value1,
+			 value2,
+			 value3,
+			 value4 );
+		}
+		else
+		{
+			libfcrypto_serpent_calculate_reverse_rounds(
+			 internal_context->expanded_key,
+			 value0,
+			 value1,
+			 value2,
+			 value3,
+			 value4 );
+
+			/* The decrypted blocks are stored in value2, value3, value1 and value4
+			 */
+			libfcrypto_serpent_transpose_vectors(
+			 libfcrypto_serpent_vector256_t,
+			 __m256i,
+			 _mm256,
+			 value2,
+			 value3,
+			 value1,
+			 value4,
+			 value0 );
+
+			value0 = value2;
+			value2 = value1;
+			value1 = value3;
+			value3 = value4;
+		}
+		_mm256_storeu_si256(
+		 (__m256i *) &( output_data[ data_offset ] ),
+		 (__m256i) value0 );
+
+		_mm256_storeu_si256(
+		 (__m256i *) &( output_data[ data_offset + 32 ] ),
+		 (__m256i) value1 );
+
+		_mm256_storeu_si256(
+		 (__m256i *) &( output_data[ data_offset + 64 ] ),
+		 (__m256i) value2 );
+
+		_mm256_storeu_si256(
+		 (__m256i *) &( output_data[ data_offset + 96 ] ),
+		 (__m256i) value3 );
+
+		data_offset += 128;
+	}
+	return( 1 );
+}
+
+#endif /* defined( LIBFCRYPTO_SERPENT_CONTEXT_HAVE_AVX2 ) */
+
+#if defined( LIBFCRYPTO_SERPENT_CONTEXT_HAVE_AVX512 )
+
+/* De- or encrypts multiple blocks of data using Serpent and AVX-512
+ * The blocks are processed 16 at a time, where every 32-bit lane of a vector contains a value of a different block
+ * The size must be a multitude of 16 times the Serpent block size (256 bytes)
+ * Returns 1 if successful or -1 on error
+ */
+__attribute__ (( target( "avx512f" ) )) \
+int libfcrypto_internal_serpent_context_crypt_blocks_avx512(
+     libfcrypto_internal_serpent_context_t *internal_context,
+     int mode,
+     const uint8_t *input_data,
+     size_t input_data_size,
+     uint8_t *output_data,
+     size_t output_data_size,
+     libcerror_error_t **error )
+{
+	static char *function                 = "libfcrypto_internal_serpent_context_crypt_blocks_avx512";
+	libfcrypto_serpent_vector512_t value0 = { 0 };
+	libfcrypto_serpent_vector512_t value1 = { 0 };
+	libfcrypto_serpent_vector512_t value2 = { 0 };
+	libfcrypto_serpent_vector512_t value3 = { 0 };
+	libfcrypto_serpent_vector512_t value4 = { 0 };
+	size_t data_offset                    = 0;
+
+	if( internal_context == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid context.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( mode != LIBFCRYPTO_SERPENT_CRYPT_MODE_ENCRYPT )
+	 && ( mode != LIBFCRYPTO_SERPENT_CRYPT_MODE_DECRYPT ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported mode.",
+		 function );
+
+		return( -1 );
+	}
+	if( input_data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid input data.",
+		 function );
+
+		return( -1 );
+	}
+	/* Check if the input data size is a multitude of 256-byte
+	 */
+	if( ( ( input_data_size & (size_t) 0xff ) != 0 )
+	 || ( input_data_size < 256 )
+	 || ( input_data_size > (size_t) SSIZE_MAX ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid input data size value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( output_data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid output data.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( output_data_size < input_data_size )
+	 || ( output_data_size > (size_t) SSIZE_MAX ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid output data size value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	while( data_offset < input_data_size )
+	{
+		value0 = (libfcrypto_serpent_vector512_t) _mm512_loadu_si512(
+		          (const __m512i *) &( input_data[ data_offset ] ) );
+
+		value1 = (libfcrypto_serpent_vector512_t) _mm512_loadu_si512(
+		          (const __m512i *) &( input_data[ data_offset + 64 ] ) );
+
+		value2 = (libfcrypto_serpent_vector512_t) _mm512_loadu_si512(
+		          (const __m512i *) &( input_data[ data_offset + 128 ] ) );
+
+		value3 = (libfcrypto_serpent_vector512_t) _mm512_loadu_si512(
+		          (const __m512i *) &( input_data[ data_offset + 192 ] ) );
+
+		libfcrypto_serpent_transpose_vectors(
+		 libfcrypto_serpent_vector512_t,
+		 __m512i,
+		 _mm512,
+		 value0,
+		 value1,
+		 value2,
+		 value3,
+		 value4 );
+
+		if( mode == LIBFCRYPTO_SERPENT_CRYPT_MODE_ENCRYPT )
+		{
+			libfcrypto_serpent_calculate_forward_rounds(
+			 internal_context->expanded_key,
+			 value0,
+			 value1,
+			 value2,
+			 value3,
+			 value4 );
+
+			libfcrypto_serpent_transpose_vectors(
+			 libfcrypto_serpent_vector512_t,
+			 __m512i,
+			 _mm512,
+			 value0,
+			 value1,
+			 value2,
+			 value3,
+			 value4 );
+		}
+		else
+		{
+			libfcrypto_serpent_calculate_reverse_rounds(
+			 internal_context->expanded_key,
+			 value0,
+			 value1,
+			 value2,
+			 value3,
+			 value4 );
+
+			/* The decrypted blocks are stored in value2, value3, value1 and value4
+			 */
+			libfcrypto_serpent_transpose_vectors(
+			 libfcrypto_serpent_vector512_t,
+			 __m512i,
+			 _mm512,
+			 value2,
+			 value3,
+			 value1,
+			 value4,
+			 value0 );
+
+			value0 = value2;
+			value2 = value1;
+			value1 = value3;
+			value3 = value4;
+		}
+		_mm512_storeu_si512(
+		 (__m512i *) &( output_data[ data_offset ] ),
+		 (__m512i) value0 );
+
+		_mm512_storeu_si512(
+		 (__m512i *) &( output_data[ data_offset + 64 ] ),
+		 (__m512i) value1 );
+
+		_mm512_storeu_si512(
+		 (__m512i *) &( output_data[ data_offset + 128 ] ),
+		 (__m512i) value2 );
+
+		_mm512_storeu_si512(
+		 (__m512i *) &( output_data[ data_offset + 192 ] ),
+		 (__m512i) value3 );
+
+		data_offset += 256;
+	}
+	return( 1 );
+}
+
+#endif /* defined( LIBFCRYPTO_SERPENT_CONTEXT_HAVE_AVX512 ) */
+
+/* De- or encrypts a block of data using Serpent-CBC (Cipher Block Chaining)
+ * The size must be a multitude of the Serpent block size (16 byte)
+ * The input and output data can be the same buffer
+ * Returns 1 if successful or -1 on error
+ */
+int libfcrypto_serpent_crypt_cbc(
+     libfcrypto_serpent_context_t *context,
+     int mode,
+     const uint8_t *initialization_vector,
+     size_t initialization_vector_size,
+     const uint8_t *input_data,
+     size_t input_data_size,
+     uint8_t *output_data,
+     size_t output_data_size,
+     libcerror_error_t **error )
+{
+	uint8_t block_data[ 16 ];
+	uint8_t internal_initialization_vector[ 16 ];
+	uint8_t decrypted_data[ LIBFCRYPTO_SERPENT_CBC_DECRYPTION_BUFFER_SIZE ];
+
+	static char *function         = "libfcrypto_serpent_context_crypt_cbc";
+	size_t data_offset            = 0;
+	size_t number_of_bytes        = 0;
+	size_t value_index            = 0;
+	uint64_t previous_value_64bit = 0;
+	uint64_t value_64bit          = 0;
+
+#if !defined( LIBFCRYPTO_UNFOLLED_LOOPS )
+	uint8_t block_index           = 0;
+#endif
+
+	if( context == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid context.",
+		 function );
+
+		return( -1 );
+	}
+	if( initialization_vector == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid initialization vector.",
+		 function );
+
+		return( -1 );
+	}
+	if( initialization_vector_size != 16 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid initialization vector size value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( mode != LIBFCRYPTO_SERPENT_CRYPT_MODE_ENCRYPT )
+	 && ( mode != LIBFCRYPTO_SERPENT_CRYPT_MODE_DECRYPT ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported mode.",
+		 function );
+
+		return( -1 );
+	}
+	if( input_data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid input data.",
+		 function );
+
+		return( -1 );
+	}
+	/* Check if the input data size is a multitude of 16-byte
+	 */
+	if( ( ( input_data_size & (size_t) 0x0f ) != 0 )
+	 || ( input_data_size < 16 )
+	 || ( input_data_size > (size_t) SSIZE_MAX ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid input data size value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( output_data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid output data.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( output_data_size < input_data_size )
+	 || ( output_data_size > (size_t) SSIZE_MAX ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid output data size value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( memory_copy(
+	     internal_initialization_vector,
+	     initialization_vector,
+	     16 ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+		 "%s: unable to copy initialization vector.",
+		 function );
+
+		goto on_error;
+	}
+	if( mode == LIBFCRYPTO_SERPENT_CRYPT_MODE_ENCRYPT )
+	{
+		while( data_offset < input_data_size )
+		{
+#if defined( LIBFCRYPTO_UNFOLLED_LOOPS )
+			block_data[ 0 ]  = input_data[ data_offset++ ] ^ internal_initialization_vector[ 0 ];
+			block_data[ 1 ]  = input_data[ data_offset++ ] ^ internal_initialization_vector[ 1 ];
+			block_data[ 2 ]  = input_data[ data_offset++ ] ^ internal_initialization_vector[ 2 ];
+			block_data[ 3 ]  = input_data[ data_offset++ ] ^ internal_initialization_vector[ 3 ];
+			block_data[ 4 ]  = input_data[ data_offset++ ] ^ internal_initialization_vector[ 4 ];
+			block_data[ 5 ]  = input_data[ data_offset++ ] ^ internal_initialization_vector[ 5 ];
+			block_data[ 6 ]  = input_data[ data_offset++ ] ^ internal_initialization_vector[ 6 ];
+			block_data[ 7 ]  = input_data[ data_offset++ ] ^ internal_initialization_vector[ 7 ];
+			block_data[ 8 ]  = input_data[ data_offset++ ] ^ internal_initialization_vector[ 8 ];
+			block_data[ 9 ]  = input_data[ data_offset++ ] ^ internal_initialization_vector[ 9 ];
+			block_data[ 10 ] = input_data[ data_offset++ ] ^ internal_initialization_vector[ 10 ];
+			block_data[ 11 ] = input_data[ data_offset++ ] ^ internal_initialization_vector[ 11 ];
+			block_data[ 12 ] = input_data[ data_offset++ ] ^ internal_initialization_vector[ 12 ];
+			block_data[ 13 ] = input_data[ data_offset++ ] ^ internal_initialization_vector[ 13 ];
+			block_data[ 14 ] = input_data[ data_offset++ ] ^ internal_initialization_vector[ 14 ];
+			block_data[ 15 ] = input_data[ data_offset++ ] ^ internal_initialization_vector[ 15 ];
+#else
+			for( block_index = 0;
+			     block_index < 16;
+			     block_index++ )
+			{
+				block_data[ block_index ] = input_data[ data_offset++ ] ^ internal_initialization_vector[ block_index ];
+			}
+#endif
+			data_offset -= 16;
+
+			if( libfcrypto_internal_serpent_context_encrypt_block(
+			     (libfcrypto_internal_serpent_context_t *) context,
+			     block_data,
+			     16,
+			     &( output_data[ data_offset ] ),
+			     16,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_ENCRYPTION,
+				 LIBCERROR_ENCRYPTION_ERROR_GENERIC,
+				 "%s: unable to encrypt input data.",
+				 function );
+
+				goto on_error;
+			}
+			if( memory_copy(
+			     internal_initialization_vector,
+			     &( output_data[ data_offset ] ),
+			     16 ) == NULL )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_MEMORY,
+				 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+				 "%s: unable to copy encrypted output data to initialization vector.",
+				 function );
+
+				goto on_error;
+			}
+			data_offset += 16;
+		}
+	}
+	else
+	{
+		/* In CBC decryption the ciphertext blocks are known in advance, hence the blocks
+		 * are decrypted by the multi-block function and XOR-ed with the preceding
+		 * ciphertext blocks afterwards
+		 */
+		while( data_offset < input_data_size )
+		{
+			number_of_bytes = input_data_size - data_offset;
+
+			if( number_of_bytes > LIBFCRYPTO_SERPENT_CBC_DECRYPTION_BUFFER_SIZE )
+			{
+				number_of_bytes = LIBFCRYPTO_SERPENT_CBC_DECRYPTION_BUFFER_SIZE;
+			}
+			if( libfcrypto_internal_serpent_context_crypt_blocks(
+			     (libfcrypto_internal_serpent_context_t *) context,
+			     LIBFCRYPTO_SERPENT_CRYPT_MODE_DECRYPT,
+			     &( input_data[ data_offset ] ),
+			     number_of_bytes,
+			     decrypted_data,
+			     number_of_bytes,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_ENCRYPTION,
+				 LIBCERROR_ENCRYPTION_ERROR_GENERIC,
+				 "%s: unable to decrypt input data.",
+				 function );
+
+				goto on_error;
+			}
+			/* The last encrypted input block is the initialization vector of the next
+			 * blocks and is stored before the output data can overwrite it
+			 */
+			if( memory_copy(
+			     block_data,
+			     &( input_data[ data_offset + number_of_bytes - 16 ] ),
+			     16 ) == NULL )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_MEMORY,
+				 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+				 "%s: unable to copy encrypted input data to initialization vector.",
+				 function );
+
+				goto on_error;
+			}
+			/* The XOR is applied from back to front so that in-place decryption
+			 * does not overwrite the preceding encrypted input blocks before they are used
+			 */
+			for( value_index = number_of_bytes - 8;
+			     value_index >= 16;
+			     value_index -= 8 )
+			{
+				byte_stream_copy_to_uint64_little_endian(
+				 &( decrypted_data[ value_index ] ),
+				 value_64bit );
+
+				byte_stream_copy_to_uint64_little_endian(
+				 &( input_data[ data_offset + value_index - 16 ] ),
+				 previous_value_64bit );
+
+				value_64bit ^= previous_value_64bit;
+
+				byte_stream_copy_from_uint64_little_endian(
+				 &( output_data[ data_offset + value_index ] ),
+				 value_64bit );
+			}
+#if defined( LIBFCRYPTO_UNFOLLED_LOOPS )
+			output_data[ data_offset ]      = decrypted_data[ 0 ] ^ internal_initialization_vector[ 0 ];
+			output_data[ data_offset + 1 ]  = decrypted_data[ 1 ] ^ internal_initialization_vector[ 1 ];
+			output_data[ data_offset + 2 ]  = decrypted_data[ 2 ] ^ internal_initialization_vector[ 2 ];
+			output_data[ data_offset + 3 ]  = decrypted_data[ 3 ] ^ internal_initialization_vector[ 3 ];
+			output_data[ data_offset + 4 ]  = decrypted_data[ 4 ] ^ internal_initialization_vector[ 4 ];
+			output_data[ data_offset + 5 ]  = decrypted_data[ 5 ] ^ internal_initialization_vector[ 5 ];
+			output_data[ data_offset + 6 ]  = decrypted_data[ 6 ] ^ internal_initialization_vector[ 6 ];
+			output_data[ data_offset + 7 ]  = decrypted_data[ 7 ] ^ internal_initialization_vector[ 7 ];
+			output_data[ data_offset + 8 ]  = decrypted_data[ 8 ] ^ internal_initialization_vector[ 8 ];
+			output_data[ data_offset + 9 ]  = decrypted_data[ 9 ] ^ internal_initialization_vector[ 9 ];
+			output_data[ data_offset + 10 ] = decrypted_data[ 10 ] ^ internal_initialization_vector[ 10 ];
+			output_data[ data_offset + 11 ] = decrypted_data[ 11 ] ^ internal_initialization_vector[ 11 ];
+			output_data[ data_offset + 12 ] = decrypted_data[ 12 ] ^ internal_initialization_vector[ 12 ];
+			output_data[ data_offset + 13 ] = decrypted_data[ 13 ] ^ internal_initialization_vector[ 13 ];
+			output_data[ data_offset + 14 ] = decrypted_data[ 14 ] ^ internal_initialization_vector[ 14 ];
+			output_data[ data_offset + 15 ] = decrypted_data[ 15 ] ^ internal_initialization_vector[ 15 ];
+#else
+			for( block_index = 0;
+			     block_index < 16;
+			     block_index++ )
+			{
+				output_data[ data_offset + block_index ] = decrypted_data[ block_index ] ^ internal_initialization_vector[ block_index ];
+			}
+#endif
+			if( memory_copy(
+			     internal_initialization_vector,
+			     block_data,
+			     16 ) == NULL )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_MEMORY,
+				 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+				 "%s: unable to copy initialization vector.",
+				 function );
+
+				goto on_error;
+			}
+			data_offset += number_of_bytes;
+		}
+	}
+	if( memory_set(
+	     internal_initialization_vector,
+	     0,
+	     16 ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear initialization vector.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     block_data,
+	     0,
+	     16 ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear block data.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     decrypted_data,
+	     0,
+	     LIBFCRYPTO_SERPENT_CBC_DECRYPTION_BUFFER_SIZE ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear decrypted data.",
+		 function );
+
+		goto on_error;
+	}
+	return( 1 );
+
+on_error:
+	memory_set(
+	 internal_initialization_vector,
+	 0,
+	 16 );
+
+	memory_set(
+	 block_data,
+	 0,
+	 16 );
+
+	memory_set(
+	 decrypted_data,
+	 0,
+	 LIBFCRYPTO_SERPENT_CBC_DECRYPTION_BUFFER_SIZE );
+
+	return( -1 );
+}
+
+/* Encrypts counter blocks using Serpent-ECB
+ * Callback function for libfcrypto_ctr_crypt
+ * Returns 1 if successful or -1 on error
+ */
+int libfcrypto_internal_serpent_context_encrypt_counter_blocks(
+     intptr_t *context,
+     const uint8_t *input_data,
+     size_t input_data_size,
+     uint8_t *output_data,
+     size_t output_data_size,
+     libcerror_error_t **error )
+{
+	return( libfcrypto_serpent_crypt_ecb(
+	         (libfcrypto_serpent_context_t *) context,
+	         LIBFCRYPTO_SERPENT_CRYPT_MODE_ENCRYPT,
+	         input_data,
+	         input_data_size,
+	         output_data,
+	         output_data_size,
+	         error ) );
+}
+
+/* De- or encrypts a block of data using Serpent-CTR (Counter)
+ * The key stream is the encryption of consecutive counter blocks, that start with the initial counter block
+ * The counter is stored in the last counter size bytes of the counter block if big-endian
+ * and in the first counter size bytes if little-endian, and wraps around
+ * The offset is the byte offset of the input data relative to the start of the key stream,
+ * which allows to de- or encrypt data at any offset without processing the preceding data
+ * Since de- and encryption are the same operation no mode is required
+ * Returns 1 if successful or -1 on error
+ */
+int libfcrypto_serpent_crypt_ctr(
+     libfcrypto_serpent_context_t *context,
+     const uint8_t *initial_counter_block,
+     size_t initial_counter_block_size,
+     size_t counter_size,
+     int counter_byte_order,
+     uint64_t offset,
+     const uint8_t *input_data,
+     size_t input_data_size,
+     uint8_t *output_data,
+     size_t output_data_size,
+     libcerror_error_t **error )
+{
+	static char *function = "libfcrypto_serpent_crypt_ctr";
+
+	if( context == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid context.",
+		 function );
+
+		return( -1 );
+	}
+	if( initial_counter_block_size != 16 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid initial counter block size value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( libfcrypto_ctr_crypt(
+	     (intptr_t *) context,
+	     &libfcrypto_internal_serpent_context_encrypt_counter_blocks,
+	     16,
+	     initial_counter_block,
+	     counter_size,
+	     counter_byte_order,
+	     offset,
+	     input_data,
+	     input_data_size,
+	     output_data,
+	     output_data_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ENCRYPTION,
+		 LIBCERROR_ENCRYPTION_ERROR_GENERIC,
+		 "%s: unable to de/encrypt data.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* De- or encrypts a block of data using Serpent-ECB (Electronic CodeBook)
+ * The size must be a multitude of the Serpent block size (16 byte)
+ * Returns 1 if successful or -1 on error
+ */
+int libfcrypto_serpent_crypt_ecb(
+     libfcrypto_serpent_context_t *context,
+     int mode,
+     const uint8_t *input_data,
+     size_t input_data_size,
+     uint8_t *output_data,
+     size_t output_data_size,
+     libcerror_error_t **error )
+{
+	static char *function = "libfcrypto_serpent_context_crypt_ecb";
+
+	if( context == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid context.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( mode != LIBFCRYPTO_SERPENT_CRYPT_MODE_ENCRYPT )
+	 && ( mode != LIBFCRYPTO_SERPENT_CRYPT_MODE_DECRYPT ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported mode.",
+		 function );
+
+		return( -1 );
+	}
+	if( input_data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid input data.",
+		 function );
+
+		return( -1 );
+	}
+	/* Check if the input data size is a multitude of 16-byte
+	 */
+	if( ( ( input_data_size & (size_t) 0x0f ) != 0 )
+	 || ( input_data_size < 16 )
+	 || ( input_data_size > (size_t) SSIZE_MAX ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid input data size value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( output_data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid output data.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( output_data_size < input_data_size )
+	 || ( output_data_size > (size_t) SSIZE_MAX ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid output data size value out of bounds.",
+		 function );
 
-	libfcrypto_serpent_calculate_reverse_linear_transformation_and_substitution1(
-	 internal_context->expanded_key,
-	 4 * 18,
-	 value0,
-	 value4,
-	 value3,
-	 value1,
-	 value2 );
+		return( -1 );
+	}
+	if( libfcrypto_internal_serpent_context_crypt_blocks(
+	     (libfcrypto_internal_serpent_context_t *) context,
+	     mode,
+	     input_data,
+	     input_data_size,
+	     output_data,
+	     output_data_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ENCRYPTION,
+		 LIBCERROR_ENCRYPTION_ERROR_GENERIC,
+		 "%s: unable to de- or encrypt input data.",
+		 function );
 
-	libfcrypto_serpent_calculate_reverse_linear_transformation_and_substitution0(
-	 internal_context->expanded_key,
-	 4 * 17,
-	 value2,
-	 value4,
-	 value3,
-	 value1,
-	 value0 );
+		return( -1 );
+	}
+	return( 1 );
+}
 
-	libfcrypto_serpent_calculate_reverse_linear_transformation_and_substitution7(
-	 internal_context->expanded_key,
-	 4 * 16,
-	 value3,
-	 value0,
-	 value4,
-	 value2,
-	 value1 );
+/* De- or encrypts a data unit (sector) using Serpent-XTS
+ * The encrypted tweak value is the data unit number encrypted with the tweak key
+ * The full blocks are XOR-ed with their tweak value and de- or encrypted together by the multi-block
+ * function, a remaining partial block is processed using ciphertext stealing
+ * The size must be at least the Serpent block size (16 byte)
+ * Returns 1 if successful or -1 on error
+ */
+int libfcrypto_internal_serpent_context_crypt_xts_data_unit(
+     libfcrypto_internal_serpent_context_t *internal_context,
+     int mode,
+     const uint8_t *encrypted_tweak_value,
+     const uint8_t *input_data,
+     size_t input_data_size,
+     uint8_t *output_data,
+     size_t output_data_size,
+     libcerror_error_t **error )
+{
+	uint8_t block_data[ 16 ];
+	uint8_t stolen_block_data[ 16 ];
+
+	static char *function       = "libfcrypto_internal_serpent_context_crypt_xts_data_unit";
+	uint8_t block_index         = 0;
+	size_t data_offset          = 0;
+	size_t number_of_bytes      = 0;
+	size_t remaining_size       = 0;
+	uint64_t tweak_value_lower  = 0;
+	uint64_t tweak_value_upper  = 0;
+	uint64_t value_64bit        = 0;
+	uint64_t last_tweak_lower   = 0;
+	uint64_t last_tweak_upper   = 0;
+	int result                  = 0;
 
-	libfcrypto_serpent_calculate_reverse_linear_transformation_and_substitution6(
-	 internal_context->expanded_key,
-	 4 * 15,
-	 value0,
-	 value2,
-	 value3,
-	 value1,
-	 value4 );
+	if( internal_context == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid context.",
+		 function );
 
-	libfcrypto_serpent_calculate_reverse_linear_transformation_and_substitution5(
-	 internal_context->expanded_key,
-	 4 * 14,
-	 value3,
-	 value4,
-	 value1,
-	 value0,
-	 value2 );
+		return( -1 );
+	}
+	if( ( mode != LIBFCRYPTO_SERPENT_CRYPT_MODE_ENCRYPT )
+	 && ( mode != LIBFCRYPTO_SERPENT_CRYPT_MODE_DECRYPT ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported mode.",
+		 function );
 
-	libfcrypto_serpent_calculate_reverse_linear_transformation_and_substitution4(
-	 internal_context->expanded_key,
-	 4 * 13,
-	 value4,
-	 value2,
-	 value3,
-	 value1,
-	 value0 );
+		return( -1 );
+	}
+	if( encrypted_tweak_value == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid encrypted tweak value.",
+		 function );
 
-	libfcrypto_serpent_calculate_reverse_linear_transformation_and_substitution3(
-	 internal_context->expanded_key,
-	 4 * 12,
-	 value4,
-	 value3,
-	 value0,
-	 value1,
-	 value2 );
+		return( -1 );
+	}
+	if( input_data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid input data.",
+		 function );
 
-	libfcrypto_serpent_calculate_reverse_linear_transformation_and_substitution2(
-	 internal_context->expanded_key,
-	 4 * 11,
-	 value0,
-	 value4,
-	 value2,
-	 value1,
-	 value3 );
+		return( -1 );
+	}
+	if( ( input_data_size < 16 )
+	 || ( input_data_size > (size_t) SSIZE_MAX ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid input data size value out of bounds.",
+		 function );
 
-	libfcrypto_serpent_calculate_reverse_linear_transformation_and_substitution1(
-	 internal_context->expanded_key,
-	 4 * 10,
-	 value4,
-	 value3,
-	 value1,
-	 value2,
-	 value0 );
+		return( -1 );
+	}
+	if( output_data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid output data.",
+		 function );
 
-	libfcrypto_serpent_calculate_reverse_linear_transformation_and_substitution0(
-	 internal_context->expanded_key,
-	 4 * 9,
-	 value0,
-	 value3,
-	 value1,
-	 value2,
-	 value4 );
+		return( -1 );
+	}
+	if( ( output_data_size < input_data_size )
+	 || ( output_data_size > (size_t) SSIZE_MAX ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid output data size value out of bounds.",
+		 function );
 
-	libfcrypto_serpent_calculate_reverse_linear_transformation_and_substitution7(
-	 internal_context->expanded_key,
-	 4 * 8,
-	 value1,
-	 value4,
-	 value3,
-	 value0,
-	 value2 );
+		return( -1 );
+	}
+	remaining_size  = input_data_size & (size_t) 0x0f;
+	number_of_bytes = input_data_size - remaining_size;
 
-	libfcrypto_serpent_calculate_reverse_linear_transformation_and_substitution6(
-	 internal_context->expanded_key,
-	 4 * 7,
-	 value4,
-	 value0,
-	 value1,
-	 value2,
-	 value3 );
+	/* With ciphertext stealing the last full block is processed together with the partial block
+	 */
+	if( remaining_size != 0 )
+	{
+		number_of_bytes -= 16;
+	}
+	byte_stream_copy_to_uint64_little_endian(
+	 &( encrypted_tweak_value[ 0 ] ),
+	 tweak_value_lower );
 
-	libfcrypto_serpent_calculate_reverse_linear_transformation_and_substitution5(
-	 internal_context->expanded_key,
-	 4 * 6,
-	 value1,
-	 value3,
-	 value2,
-	 value4,
-	 value0 );
+	byte_stream_copy_to_uint64_little_endian(
+	 &( encrypted_tweak_value[ 8 ] ),
+	 tweak_value_upper );
 
-	libfcrypto_serpent_calculate_reverse_linear_transformation_and_substitution4(
-	 internal_context->expanded_key,
-	 4 * 5,
-	 value3,
-	 value0,
-	 value1,
-	 value2,
-	 value4 );
+	if( number_of_bytes > 0 )
+	{
+		last_tweak_lower = tweak_value_lower;
+		last_tweak_upper = tweak_value_upper;
 
-	libfcrypto_serpent_calculate_reverse_linear_transformation_and_substitution3(
-	 internal_context->expanded_key,
-	 4 * 4,
-	 value3,
-	 value1,
-	 value4,
-	 value2,
-	 value0 );
+		for( data_offset = 0;
+		     data_offset < number_of_bytes;
+		     data_offset += 16 )
+		{
+			libfcrypto_serpent_xts_xor_tweak(
+			 &( input_data[ data_offset ] ),
+			 &( output_data[ data_offset ] ),
+			 tweak_value_lower,
+			 tweak_value_upper,
+			 value_64bit );
+
+			libfcrypto_serpent_xts_multiply_tweak(
+			 tweak_value_lower,
+			 tweak_value_upper,
+			 value_64bit );
+		}
+		if( libfcrypto_internal_serpent_context_crypt_blocks(
+		     internal_context,
+		     mode,
+		     output_data,
+		     number_of_bytes,
+		     output_data,
+		     number_of_bytes,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_ENCRYPTION,
+			 LIBCERROR_ENCRYPTION_ERROR_GENERIC,
+			 "%s: unable to de- or encrypt blocks.",
+			 function );
 
-	libfcrypto_serpent_calculate_reverse_linear_transformation_and_substitution2(
-	 internal_context->expanded_key,
-	 4 * 3,
-	 value4,
-	 value3,
-	 value0,
-	 value2,
-	 value1 );
+			goto on_error;
+		}
+		/* The tweak values are calculated again instead of being stored
+		 */
+		tweak_value_lower = last_tweak_lower;
+		tweak_value_upper = last_tweak_upper;
+
+		for( data_offset = 0;
+		     data_offset < number_of_bytes;
+		     data_offset += 16 )
+		{
+			libfcrypto_serpent_xts_xor_tweak(
+			 &( output_data[ data_offset ] ),
+			 &( output_data[ data_offset ] ),
+			 tweak_value_lower,
+			 tweak_value_upper,
+			 value_64bit );
+
+			libfcrypto_serpent_xts_multiply_tweak(
+			 tweak_value_lower,
+			 tweak_value_upper,
+			 value_64bit );
+		}
+	}
+	if( remaining_size != 0 )
+	{
+		/* Encryption uses the tweak value of the last full block first and decryption
+		 * the tweak value of the partial block
+		 */
+		last_tweak_lower = tweak_value_lower;
+		last_tweak_upper = tweak_value_upper;
+
+		libfcrypto_serpent_xts_multiply_tweak(
+		 tweak_value_lower,
+		 tweak_value_upper,
+		 value_64bit );
+
+		if( mode == LIBFCRYPTO_SERPENT_CRYPT_MODE_DECRYPT )
+		{
+			value_64bit       = last_tweak_lower;
+			last_tweak_lower  = tweak_value_lower;
+			tweak_value_lower = value_64bit;
 
-	libfcrypto_serpent_calculate_reverse_linear_transformation_and_substitution1(
-	 internal_context->expanded_key,
-	 4 * 2,
-	 value3,
-	 value1,
-	 value2,
-	 value0,
-	 value4 );
+			value_64bit       = last_tweak_upper;
+			last_tweak_upper  = tweak_value_upper;
+			tweak_value_upper = value_64bit;
+		}
+		libfcrypto_serpent_xts_xor_tweak(
+		 &( input_data[ data_offset ] ),
+		 block_data,
+		 last_tweak_lower,
+		 last_tweak_upper,
+		 value_64bit );
+
+		for( block_index = 0;
+		     block_index < 2;
+		     block_index++ )
+		{
+			if( mode == LIBFCRYPTO_SERPENT_CRYPT_MODE_ENCRYPT )
+			{
+				result = libfcrypto_internal_serpent_context_encrypt_block(
+				          internal_context,
+				          block_data,
+				          16,
+				          block_data,
+				          16,
+				          error );
+			}
+			else
+			{
+				result = libfcrypto_internal_serpent_context_decrypt_block(
+				          internal_context,
+				          block_data,
+				          16,
+				          block_data,
+				          16,
+				          error );
+			}
+			if( result != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_ENCRYPTION,
+				 LIBCERROR_ENCRYPTION_ERROR_GENERIC,
+				 "%s: unable to de- or encrypt block.",
+				 function );
 
-	libfcrypto_serpent_calculate_reverse_linear_transformation_and_substitution0(
-	 internal_context->expanded_key,
-	 4 * 1,
-	 value4,
-	 value1,
-	 value2,
-	 value0,
-	 value3 );
+				goto on_error;
+			}
+			if( block_index == 0 )
+			{
+				/* The partial block is stolen from the start of the first result,
+				 * which is completed with the remaining input data
+				 */
+				libfcrypto_serpent_xts_xor_tweak(
+				 block_data,
+				 stolen_block_data,
+				 last_tweak_lower,
+				 last_tweak_upper,
+				 value_64bit );
+
+				if( memory_copy(
+				     block_data,
+				     &( input_data[ data_offset + 16 ] ),
+				     remaining_size ) == NULL )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_MEMORY,
+					 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+					 "%s: unable to copy remaining input data.",
+					 function );
+
+					goto on_error;
+				}
+				if( memory_copy(
+				     &( block_data[ remaining_size ] ),
+				     &( stolen_block_data[ remaining_size ] ),
+				     16 - remaining_size ) == NULL )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_MEMORY,
+					 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+					 "%s: unable to copy stolen block data.",
+					 function );
+
+					goto on_error;
+				}
+				libfcrypto_serpent_xts_xor_tweak(
+				 block_data,
+				 block_data,
+				 tweak_value_lower,
+				 tweak_value_upper,
+				 value_64bit );
+			}
+		}
+		libfcrypto_serpent_xts_xor_tweak(
+		 block_data,
+		 &( output_data[ data_offset ] ),
+		 tweak_value_lower,
+		 tweak_value_upper,
+		 value_64bit );
+
+		if( memory_copy(
+		     &( output_data[ data_offset + 16 ] ),
+		     stolen_block_data,
+		     remaining_size ) == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+			 "%s: unable to copy stolen block data.",
+			 function );
 
-	value2 ^= internal_context->expanded_key[ 0 ];
-	value3 ^= internal_context->expanded_key[ 1 ];
-	value1 ^= internal_context->expanded_key[ 2 ];
-	value4 ^= internal_context->expanded_key[ 3 ];
+			goto on_error;
+		}
+	}
+	memory_set(
+	 block_data,
+	 0,
+	 16 );
 
-	byte_stream_copy_from_uint32_little_endian(
-	 &( output_data[ 0 ] ),
-	 value2 );
+	memory_set(
+	 stolen_block_data,
+	 0,
+	 16 );
 
-	byte_stream_copy_from_uint32_little_endian(
-	 &( output_data[ 4 ] ),
-	 value3 );
+	return( 1 );
 
-	byte_stream_copy_from_uint32_little_endian(
-	 &( output_data[ 8 ] ),
-	 value1 );
+on_error:
+	memory_set(
+	 block_data,
+	 0,
+	 16 );
 
-	byte_stream_copy_from_uint32_little_endian(
-	 &( output_data[ 12 ] ),
-	 value4 );
+	memory_set(
+	 stolen_block_data,
+	 0,
+	 16 );
 
-	return( 1 );
+	return( -1 );
 }
 
-/* De- or encrypts a block of data using Serpent-CBC (Cipher Block Chaining)
- * The size must be a multitude of the Serpent block size (16 byte)
+/* De- or encrypts a data unit (sector) using Serpent-XTS (XEX-based tweaked-codebook mode with ciphertext stealing)
+ * The context contains the data key and the tweak context the tweak key
+ * The size of the data unit is the input data size and must be at least the Serpent block size (16 byte)
  * Returns 1 if successful or -1 on error
  */
-int libfcrypto_serpent_crypt_cbc(
+int libfcrypto_serpent_crypt_xts(
      libfcrypto_serpent_context_t *context,
+     libfcrypto_serpent_context_t *tweak_context,
      int mode,
-     const uint8_t *initialization_vector,
-     size_t initialization_vector_size,
+     uint64_t data_unit_number,
      const uint8_t *input_data,
      size_t input_data_size,
      uint8_t *output_data,
      size_t output_data_size,
      libcerror_error_t **error )
 {
-	uint8_t block_data[ 16 ];
-	uint8_t internal_initialization_vector[ 16 ];
-
-	static char *function = "libfcrypto_serpent_context_crypt_cbc";
-	size_t data_offset    = 0;
+	uint8_t tweak_value[ 16 ];
 
-#if !defined( LIBFCRYPTO_UNFOLLED_LOOPS )
-	uint8_t block_index   = 0;
-#endif
+	static char *function = "libfcrypto_serpent_crypt_xts";
 
 	if( context == NULL )
 	{
@@ -2324,24 +3582,13 @@ int libfcrypto_serpent_crypt_cbc(
 
 		return( -1 );
 	}
-	if( initialization_vector == NULL )
+	if( tweak_context == NULL )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
 		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid initialization vector.",
-		 function );
-
-		return( -1 );
-	}
-	if( initialization_vector_size != 16 )
-	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
-		 "%s: invalid initialization vector size value out of bounds.",
+		 "%s: invalid tweak context.",
 		 function );
 
 		return( -1 );
@@ -2369,10 +3616,7 @@ int libfcrypto_serpent_crypt_cbc(
 
 		return( -1 );
 	}
-	/* Check if the input data size is a multitude of 16-byte
-	 */
-	if( ( ( input_data_size & (size_t) 0x0f ) != 0 )
-	 || ( input_data_size < 16 )
+	if( ( input_data_size < 16 )
 	 || ( input_data_size > (size_t) SSIZE_MAX ) )
 	{
 		libcerror_error_set(
@@ -2407,205 +3651,92 @@ int libfcrypto_serpent_crypt_cbc(
 
 		return( -1 );
 	}
-	if( memory_copy(
-	     internal_initialization_vector,
-	     initialization_vector,
-	     16 ) == NULL )
-	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_MEMORY,
-		 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
-		 "%s: unable to copy initialization vector.",
-		 function );
-
-		goto on_error;
-	}
-	while( data_offset < input_data_size )
-	{
-		if( mode == LIBFCRYPTO_SERPENT_CRYPT_MODE_ENCRYPT )
-		{
-#if defined( LIBFCRYPTO_UNFOLLED_LOOPS )
-			block_data[ 0 ]  = input_data[ data_offset++ ] ^ internal_initialization_vector[ 0 ];
-			block_data[ 1 ]  = input_data[ data_offset++ ] ^ internal_initialization_vector[ 1 ];
-			block_data[ 2 ]  = input_data[ data_offset++ ] ^ internal_initialization_vector[ 2 ];
-			block_data[ 3 ]  = input_data[ data_offset++ ] ^ internal_initialization_vector[ 3 ];
-			block_data[ 4 ]  = input_data[ data_offset++ ] ^ internal_initialization_vector[ 4 ];
-			block_data[ 5 ]  = input_data[ data_offset++ ] ^ internal_initialization_vector[ 5 ];
-			block_data[ 6 ]  = input_data[ data_offset++ ] ^ internal_initialization_vector[ 6 ];
-			block_data[ 7 ]  = input_data[ data_offset++ ] ^ internal_initialization_vector[ 7 ];
-			block_data[ 8 ]  = input_data[ data_offset++ ] ^ internal_initialization_vector[ 8 ];
-			block_data[ 9 ]  = input_data[ data_offset++ ] ^ internal_initialization_vector[ 9 ];
-			block_data[ 10 ] = input_data[ data_offset++ ] ^ internal_initialization_vector[ 10 ];
-			block_data[ 11 ] = input_data[ data_offset++ ] ^ internal_initialization_vector[ 11 ];
-			block_data[ 12 ] = input_data[ data_offset++ ] ^ internal_initialization_vector[ 12 ];
-			block_data[ 13 ] = input_data[ data_offset++ ] ^ internal_initialization_vector[ 13 ];
-			block_data[ 14 ] = input_data[ data_offset++ ] ^ internal_initialization_vector[ 14 ];
-			block_data[ 15 ] = input_data[ data_offset++ ] ^ internal_initialization_vector[ 15 ];
-#else
-			for( block_index = 0;
-			     block_index < 16;
-			     block_index++ )
-			{
-				block_data[ block_index ] = input_data[ data_offset++ ] ^ internal_initialization_vector[ block_index ];
-			}
-#endif
-			data_offset -= 16;
-
-			if( libfcrypto_internal_serpent_context_encrypt_block(
-			     (libfcrypto_internal_serpent_context_t *) context,
-			     block_data,
-			     16,
-			     &( output_data[ data_offset ] ),
-			     16,
-			     error ) != 1 )
-			{
-				libcerror_error_set(
-				 error,
-				 LIBCERROR_ERROR_DOMAIN_ENCRYPTION,
-				 LIBCERROR_ENCRYPTION_ERROR_GENERIC,
-				 "%s: unable to encrypt input data.",
-				 function );
-
-				goto on_error;
-			}
-			if( memory_copy(
-			     internal_initialization_vector,
-			     &( output_data[ data_offset ] ),
-			     16 ) == NULL )
-			{
-				libcerror_error_set(
-				 error,
-				 LIBCERROR_ERROR_DOMAIN_MEMORY,
-				 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
-				 "%s: unable to copy encrypted output data to initialization vector.",
-				 function );
-
-				goto on_error;
-			}
-		}
-		else
-		{
-			if( libfcrypto_internal_serpent_context_decrypt_block(
-			     (libfcrypto_internal_serpent_context_t *) context,
-			     &( input_data[ data_offset ] ),
-			     16,
-			     &( output_data[ data_offset ] ),
-			     16,
-			     error ) != 1 )
-			{
-				libcerror_error_set(
-				 error,
-				 LIBCERROR_ERROR_DOMAIN_ENCRYPTION,
-				 LIBCERROR_ENCRYPTION_ERROR_GENERIC,
-				 "%s: unable to decrypt input data.",
-				 function );
-
-				goto on_error;
-			}
-#if defined( LIBFCRYPTO_UNFOLLED_LOOPS )
-			output_data[ data_offset++ ] ^= internal_initialization_vector[ 0 ];
-			output_data[ data_offset++ ] ^= internal_initialization_vector[ 1 ];
-			output_data[ data_offset++ ] ^= internal_initialization_vector[ 2 ];
-			output_data[ data_offset++ ] ^= internal_initialization_vector[ 3 ];
-			output_data[ data_offset++ ] ^= internal_initialization_vector[ 4 ];
-			output_data[ data_offset++ ] ^= internal_initialization_vector[ 5 ];
-			output_data[ data_offset++ ] ^= internal_initialization_vector[ 6 ];
-			output_data[ data_offset++ ] ^= internal_initialization_vector[ 7 ];
-			output_data[ data_offset++ ] ^= internal_initialization_vector[ 8 ];
-			output_data[ data_offset++ ] ^= internal_initialization_vector[ 9 ];
-			output_data[ data_offset++ ] ^= internal_initialization_vector[ 10 ];
-			output_data[ data_offset++ ] ^= internal_initialization_vector[ 11 ];
-			output_data[ data_offset++ ] ^= internal_initialization_vector[ 12 ];
-			output_data[ data_offset++ ] ^= internal_initialization_vector[ 13 ];
-			output_data[ data_offset++ ] ^= internal_initialization_vector[ 14 ];
-			output_data[ data_offset++ ] ^= internal_initialization_vector[ 15 ];
-#else
-			for( block_index = 0;
-			     block_index < 16;
-			     block_index++ )
-			{
-				output_data[ data_offset++ ] ^= internal_initialization_vector[ block_index ];
-			}
-#endif
-			data_offset -= 16;
-
-			if( memory_copy(
-			     internal_initialization_vector,
-			     &( input_data[ data_offset ] ),
-			     16 ) == NULL )
-			{
-				libcerror_error_set(
-				 error,
-				 LIBCERROR_ERROR_DOMAIN_MEMORY,
-				 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
-				 "%s: unable to copy encrypted input data to initialization vector.",
-				 function );
-
-				goto on_error;
-			}
-		}
-		data_offset += 16;
-	}
-	if( memory_set(
-	     internal_initialization_vector,
-	     0,
-	     16 ) == NULL )
+	byte_stream_copy_from_uint64_little_endian(
+	 &( tweak_value[ 0 ] ),
+	 data_unit_number );
+
+	byte_stream_copy_from_uint64_little_endian(
+	 &( tweak_value[ 8 ] ),
+	 (uint64_t) 0 );
+
+	if( libfcrypto_internal_serpent_context_encrypt_block(
+	     (libfcrypto_internal_serpent_context_t *) tweak_context,
+	     tweak_value,
+	     16,
+	     tweak_value,
+	     16,
+	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_MEMORY,
-		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
-		 "%s: unable to clear initialization vector.",
+		 LIBCERROR_ERROR_DOMAIN_ENCRYPTION,
+		 LIBCERROR_ENCRYPTION_ERROR_GENERIC,
+		 "%s: unable to encrypt tweak value.",
 		 function );
 
 		goto on_error;
 	}
-	if( memory_set(
-	     block_data,
-	     0,
-	     16 ) == NULL )
+	if( libfcrypto_internal_serpent_context_crypt_xts_data_unit(
+	     (libfcrypto_internal_serpent_context_t *) context,
+	     mode,
+	     tweak_value,
+	     input_data,
+	     input_data_size,
+	     output_data,
+	     output_data_size,
+	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_MEMORY,
-		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
-		 "%s: unable to clear block data.",
+		 LIBCERROR_ERROR_DOMAIN_ENCRYPTION,
+		 LIBCERROR_ENCRYPTION_ERROR_GENERIC,
+		 "%s: unable to de- or encrypt data unit.",
 		 function );
 
 		goto on_error;
 	}
-	return( 1 );
-
-on_error:
 	memory_set(
-	 internal_initialization_vector,
+	 tweak_value,
 	 0,
 	 16 );
 
+	return( 1 );
+
+on_error:
 	memory_set(
-	 block_data,
+	 tweak_value,
 	 0,
 	 16 );
 
 	return( -1 );
 }
 
-/* De- or encrypts a block of data using Serpent-ECB (Electronic CodeBook)
- * The size must be a multitude of the Serpent block size (16 byte)
+/* De- or encrypts consecutive data units (sectors) using Serpent-XTS (XEX-based tweaked-codebook mode with ciphertext stealing)
+ * The context contains the data key and the tweak context the tweak key
+ * The data unit number is that of the first data unit, the tweak values of
+ * the data units are encrypted together by the multi-block function
+ * The data unit size must be a multitude of the Serpent block size (16 byte)
+ * and the size a multitude of the data unit size
  * Returns 1 if successful or -1 on error
  */
-int libfcrypto_serpent_crypt_ecb(
+int libfcrypto_serpent_crypt_xts_data_units(
      libfcrypto_serpent_context_t *context,
+     libfcrypto_serpent_context_t *tweak_context,
      int mode,
+     uint64_t data_unit_number,
+     size_t data_unit_size,
      const uint8_t *input_data,
      size_t input_data_size,
      uint8_t *output_data,
      size_t output_data_size,
      libcerror_error_t **error )
 {
-	static char *function = "libfcrypto_serpent_context_crypt_ecb";
-	size_t data_offset    = 0;
+	uint8_t tweak_values[ LIBFCRYPTO_SERPENT_XTS_MAXIMUM_NUMBER_OF_TWEAK_VALUES * 16 ];
+
+	static char *function         = "libfcrypto_serpent_crypt_xts_data_units";
+	size_t data_offset            = 0;
+	size_t number_of_tweak_values = 0;
+	size_t tweak_value_index      = 0;
 
 	if( context == NULL )
 	{
@@ -2618,6 +3749,17 @@ int libfcrypto_serpent_crypt_ecb(
 
 		return( -1 );
 	}
+	if( tweak_context == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid tweak context.",
+		 function );
+
+		return( -1 );
+	}
 	if( ( mode != LIBFCRYPTO_SERPENT_CRYPT_MODE_ENCRYPT )
 	 && ( mode != LIBFCRYPTO_SERPENT_CRYPT_MODE_DECRYPT ) )
 	{
@@ -2630,6 +3772,19 @@ int libfcrypto_serpent_crypt_ecb(
 
 		return( -1 );
 	}
+	if( ( data_unit_size < 16 )
+	 || ( ( data_unit_size & (size_t) 0x0f ) != 0 )
+	 || ( data_unit_size > (size_t) SSIZE_MAX ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid data unit size value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
 	if( input_data == NULL )
 	{
 		libcerror_error_set(
@@ -2641,10 +3796,8 @@ int libfcrypto_serpent_crypt_ecb(
 
 		return( -1 );
 	}
-	/* Check if the input data size is a multitude of 16-byte
-	 */
-	if( ( ( input_data_size & (size_t) 0x0f ) != 0 )
-	 || ( input_data_size < 16 )
+	if( ( input_data_size < data_unit_size )
+	 || ( ( input_data_size % data_unit_size ) != 0 )
 	 || ( input_data_size > (size_t) SSIZE_MAX ) )
 	{
 		libcerror_error_set(
@@ -2681,48 +3834,83 @@ int libfcrypto_serpent_crypt_ecb(
 	}
 	while( data_offset < input_data_size )
 	{
-		if( mode == LIBFCRYPTO_SERPENT_CRYPT_MODE_ENCRYPT )
+		number_of_tweak_values = ( input_data_size - data_offset ) / data_unit_size;
+
+		if( number_of_tweak_values > LIBFCRYPTO_SERPENT_XTS_MAXIMUM_NUMBER_OF_TWEAK_VALUES )
 		{
-			if( libfcrypto_internal_serpent_context_encrypt_block(
-			     (libfcrypto_internal_serpent_context_t *) context,
-			     &( input_data[ data_offset ] ),
-			     16,
-			     &( output_data[ data_offset ] ),
-			     16,
-			     error ) != 1 )
-			{
-				libcerror_error_set(
-				 error,
-				 LIBCERROR_ERROR_DOMAIN_ENCRYPTION,
-				 LIBCERROR_ENCRYPTION_ERROR_GENERIC,
-				 "%s: unable to encrypt input data.",
-				 function );
+			number_of_tweak_values = LIBFCRYPTO_SERPENT_XTS_MAXIMUM_NUMBER_OF_TWEAK_VALUES;
+		}
+		for( tweak_value_index = 0;
+		     tweak_value_index < number_of_tweak_values;
+		     tweak_value_index++ )
+		{
+			byte_stream_copy_from_uint64_little_endian(
+			 &( tweak_values[ tweak_value_index * 16 ] ),
+			 data_unit_number );
 
-				return( -1 );
-			}
+			byte_stream_copy_from_uint64_little_endian(
+			 &( tweak_values[ ( tweak_value_index * 16 ) + 8 ] ),
+			 (uint64_t) 0 );
+
+			data_unit_number++;
 		}
-		else
+		if( libfcrypto_internal_serpent_context_crypt_blocks(
+		     (libfcrypto_internal_serpent_context_t *) tweak_context,
+		     LIBFCRYPTO_SERPENT_CRYPT_MODE_ENCRYPT,
+		     tweak_values,
+		     number_of_tweak_values * 16,
+		     tweak_values,
+		     number_of_tweak_values * 16,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_ENCRYPTION,
+			 LIBCERROR_ENCRYPTION_ERROR_GENERIC,
+			 "%s: unable to encrypt tweak values.",
+			 function );
+
+			goto on_error;
+		}
+		for( tweak_value_index = 0;
+		     tweak_value_index < number_of_tweak_values;
+		     tweak_value_index++ )
 		{
-			if( libfcrypto_internal_serpent_context_decrypt_block(
+			if( libfcrypto_internal_serpent_context_crypt_xts_data_unit(
 			     (libfcrypto_internal_serpent_context_t *) context,
+			     mode,
+			     &( tweak_values[ tweak_value_index * 16 ] ),
 			     &( input_data[ data_offset ] ),
-			     16,
+			     data_unit_size,
 			     &( output_data[ data_offset ] ),
-			     16,
+			     data_unit_size,
 			     error ) != 1 )
 			{
 				libcerror_error_set(
 				 error,
 				 LIBCERROR_ERROR_DOMAIN_ENCRYPTION,
 				 LIBCERROR_ENCRYPTION_ERROR_GENERIC,
-				 "%s: unable to decrypt input data.",
+				 "%s: unable to de- or encrypt data unit.",
 				 function );
 
-				return( -1 );
+				goto on_error;
 			}
+			data_offset += data_unit_size;
 		}
-		data_offset += 16;
 	}
+	memory_set(
+	 tweak_values,
+	 0,
+	 LIBFCRYPTO_SERPENT_XTS_MAXIMUM_NUMBER_OF_TWEAK_VALUES * 16 );
+
 	return( 1 );
+
+on_error:
+	memory_set(
+	 tweak_values,
+	 0,
+	 LIBFCRYPTO_SERPENT_XTS_MAXIMUM_NUMBER_OF_TWEAK_VALUES * 16 );
+
+	return( -1 );
 }
 
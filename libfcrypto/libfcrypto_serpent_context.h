@@ -35,6 +35,20 @@ extern "C" {
 
 #define LIBFCRYPTO_SERPENT_NUMBER_OF_EXPANDED_KEY_ELEMENTS	132
 
+/* The size of the buffer of the blocks that are decrypted at once in CBC mode
+ */
+#define LIBFCRYPTO_SERPENT_CBC_DECRYPTION_BUFFER_SIZE		1024
+
+/* The maximum number of XTS tweak values that are encrypted at once
+ */
+#define LIBFCRYPTO_SERPENT_XTS_MAXIMUM_NUMBER_OF_TWEAK_VALUES	16
+
+#if ( defined( __clang__ ) || ( defined( __GNUC__ ) && ( __GNUC__ >= 5 ) ) ) && ( defined( __i386__ ) || defined( __x86_64__ ) )
+#define LIBFCRYPTO_SERPENT_CONTEXT_HAVE_SSE2	1
+#define LIBFCRYPTO_SERPENT_CONTEXT_HAVE_AVX2	1
+#define LIBFCRYPTO_SERPENT_CONTEXT_HAVE_AVX512	1
+#endif
+
 typedef struct libfcrypto_internal_serpent_context libfcrypto_internal_serpent_context_t;
 
 struct libfcrypto_internal_serpent_context
@@ -42,6 +56,25 @@ struct libfcrypto_internal_serpent_context
 	/* The expanded key
 	 */
 	uint32_t expanded_key[ LIBFCRYPTO_SERPENT_NUMBER_OF_EXPANDED_KEY_ELEMENTS ];
+
+	/* The multi-block functions selected by CPU level, from the largest to the smallest
+	 */
+	int (*crypt_blocks_functions[ 3 ])(
+	       libfcrypto_internal_serpent_context_t *internal_context,
+	       int mode,
+	       const uint8_t *input_data,
+	       size_t input_data_size,
+	       uint8_t *output_data,
+	       size_t output_data_size,
+	       libcerror_error_t **error );
+
+	/* The number of bytes processed at once by the multi-block functions
+	 */
+	size_t crypt_blocks_sizes[ 3 ];
+
+	/* The number of multi-block functions
+	 */
+	int number_of_crypt_blocks_functions;
 };
 
 LIBFCRYPTO_EXTERN \
@@ -77,6 +110,54 @@ int libfcrypto_internal_serpent_context_decrypt_block(
      size_t output_data_size,
      libcerror_error_t **error );
 
+int libfcrypto_internal_serpent_context_crypt_blocks(
+     libfcrypto_internal_serpent_context_t *internal_context,
+     int mode,
+     const uint8_t *input_data,
+     size_t input_data_size,
+     uint8_t *output_data,
+     size_t output_data_size,
+     libcerror_error_t **error );
+
+#if defined( LIBFCRYPTO_SERPENT_CONTEXT_HAVE_SSE2 )
+
+int libfcrypto_internal_serpent_context_crypt_blocks_sse2(
+     libfcrypto_internal_serpent_context_t *internal_context,
+     int mode,
+     const uint8_t *input_data,
+     size_t input_data_size,
+     uint8_t *output_data,
+     size_t output_data_size,
+     libcerror_error_t **error );
+
+#endif /* defined( LIBFCRYPTO_SERPENT_CONTEXT_HAVE_SSE2 ) */
+
+#if defined( LIBFCRYPTO_SERPENT_CONTEXT_HAVE_AVX2 )
+
+int libfcrypto_internal_serpent_context_crypt_blocks_avx2(
+     libfcrypto_internal_serpent_context_t *internal_context,
+     int mode,
+     const uint8_t *input_data,
+     size_t input_data_size,
+     uint8_t *output_data,
+     size_t output_data_size,
+     libcerror_error_t **error );
+
+#endif /* defined( LIBFCRYPTO_SERPENT_CONTEXT_HAVE_AVX2 ) */
+
+#if defined( LIBFCRYPTO_SERPENT_CONTEXT_HAVE_AVX512 )
+
+int libfcrypto_internal_serpent_context_crypt_blocks_avx512(
+     libfcrypto_internal_serpent_context_t *internal_context,
+     int mode,
+     const uint8_t *input_data,
+     size_t input_data_size,
+     uint8_t *output_data,
+     size_t output_data_size,
+     libcerror_error_t **error );
+
+#endif /* defined( LIBFCRYPTO_SERPENT_CONTEXT_HAVE_AVX512 ) */
+
 LIBFCRYPTO_EXTERN \
 int libfcrypto_serpent_crypt_cbc(
      libfcrypto_serpent_context_t *context,
@@ -89,6 +170,28 @@ int libfcrypto_serpent_crypt_cbc(
      size_t output_data_size,
      libcerror_error_t **error );
 
+int libfcrypto_internal_serpent_context_encrypt_counter_blocks(
+     intptr_t *context,
+     const uint8_t *input_data,
+     size_t input_data_size,
+     uint8_t *output_data,
+     size_t output_data_size,
+     libcerror_error_t **error );
+
+LIBFCRYPTO_EXTERN \
+int libfcrypto_serpent_crypt_ctr(
+     libfcrypto_serpent_context_t *context,
+     const uint8_t *initial_counter_block,
+     size_t initial_counter_block_size,
+     size_t counter_size,
+     int counter_byte_order,
+     uint64_t offset,
+     const uint8_t *input_data,
+     size_t input_data_size,
+     uint8_t *output_data,
+     size_t output_data_size,
+     libcerror_error_t **error );
+
 LIBFCRYPTO_EXTERN \
 int libfcrypto_serpent_crypt_ecb(
      libfcrypto_serpent_context_t *context,
@@ -99,6 +202,41 @@ int libfcrypto_serpent_crypt_ecb(
      size_t output_data_size,
      libcerror_error_t **error );
 
+int libfcrypto_internal_serpent_context_crypt_xts_data_unit(
+     libfcrypto_internal_serpent_context_t *internal_context,
+     int mode,
+     const uint8_t *encrypted_tweak_value,
+     const uint8_t *input_data,
+     size_t input_data_size,
+     uint8_t *output_data,
+     size_t output_data_size,
+     libcerror_error_t **error );
+
+LIBFCRYPTO_EXTERN \
+int libfcrypto_serpent_crypt_xts(
+     libfcrypto_serpent_context_t *context,
+     libfcrypto_serpent_context_t *tweak_context,
+     int mode,
+     uint64_t data_unit_number,
+     const uint8_t *input_data,
+     size_t input_data_size,
+     uint8_t *output_data,
+     size_t output_data_size,
+     libcerror_error_t **error );
+
+LIBFCRYPTO_EXTERN \
+int libfcrypto_serpent_crypt_xts_data_units(
+     libfcrypto_serpent_context_t *context,
+     libfcrypto_serpent_context_t *tweak_context,
+     int mode,
+     uint64_t data_unit_number,
+     size_t data_unit_size,
+     const uint8_t *input_data,
+     size_t input_data_size,
+     uint8_t *output_data,
+     size_t output_data_size,
+     libcerror_error_t **error );
+
 #if defined( __cplusplus )
 }
 #endif
@@ -24,7 +24,9 @@
 
 #include <stdio.h>
 
+#include "libfcrypto_cpu.h"
 #include "libfcrypto_definitions.h"
+#include "libfcrypto_libcerror.h"
 #include "libfcrypto_support.h"
 
 #if !defined( HAVE_LOCAL_LIBFCRYPTO )
@@ -37,5 +39,82 @@ const char *libfcrypto_get_version(
 	return( (const char *) LIBFCRYPTO_VERSION_STRING );
 }
 
+/* Retrieves the highest CPU level supported by both the CPU and the library
+ * Returns 1 if successful or -1 on error
+ */
+int libfcrypto_get_supported_cpu_level(
+     int *cpu_level,
+     libcerror_error_t **error )
+{
+	static char *function = "libfcrypto_get_supported_cpu_level";
+
+	if( cpu_level == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid CPU level.",
+		 function );
+
+		return( -1 );
+	}
+	*cpu_level = libfcrypto_cpu_get_supported_level();
+
+	return( 1 );
+}
+
+/* Retrieves the CPU level that determines the (de/en)crypt functions used by contexts that are created
+ * Returns 1 if successful or -1 on error
+ */
+int libfcrypto_get_cpu_level(
+     int *cpu_level,
+     libcerror_error_t **error )
+{
+	static char *function = "libfcrypto_get_cpu_level";
+
+	if( cpu_level == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid CPU level.",
+		 function );
+
+		return( -1 );
+	}
+	*cpu_level = libfcrypto_cpu_get_level();
+
+	return( 1 );
+}
+
+/* Sets the CPU level that determines the (de/en)crypt functions used by contexts that are created
+ * The CPU level cannot exceed the supported CPU level
+ * This function is not thread-safe and must not be called while other threads use the library
+ * Returns 1 if successful or -1 on error
+ */
+int libfcrypto_set_cpu_level(
+     int cpu_level,
+     libcerror_error_t **error )
+{
+	static char *function = "libfcrypto_set_cpu_level";
+
+	if( libfcrypto_cpu_set_level(
+	     cpu_level,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to set CPU level.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
 #endif /* !defined( HAVE_LOCAL_LIBFCRYPTO ) */
 
@@ -26,6 +26,7 @@
 #include <types.h>
 
 #include "libfcrypto_extern.h"
+#include "libfcrypto_libcerror.h"
 
 #if defined( __cplusplus )
 extern "C" {
@@ -37,6 +38,21 @@ LIBFCRYPTO_EXTERN \
 const char *libfcrypto_get_version(
              void );
 
+LIBFCRYPTO_EXTERN \
+int libfcrypto_get_supported_cpu_level(
+     int *cpu_level,
+     libcerror_error_t **error );
+
+LIBFCRYPTO_EXTERN \
+int libfcrypto_get_cpu_level(
+     int *cpu_level,
+     libcerror_error_t **error );
+
+LIBFCRYPTO_EXTERN \
+int libfcrypto_set_cpu_level(
+     int cpu_level,
+     libcerror_error_t **error );
+
 #endif /* !defined( HAVE_LOCAL_LIBFCRYPTO ) */
 
 #if defined( __cplusplus )
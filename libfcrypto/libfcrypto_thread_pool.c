@@ -0,0 +1,687 @@
+/*
+ * Thread pool functions
+ *
+ * Copyright (C) 2017-2024, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <memory.h>
+#include <types.h>
+
+#include "libfcrypto_libcerror.h"
+#include "libfcrypto_thread_pool.h"
+#include "libfcrypto_types.h"
+
+/* Creates a thread pool
+ * Make sure the value thread_pool is referencing, is set to NULL
+ * The number of threads is the number of worker threads that are created in addition to
+ * the calling thread, which also runs jobs. Without multi-threading support no worker
+ * threads are created and all jobs are run by the calling thread
+ * Returns 1 if successful or -1 on error
+ */
+int libfcrypto_thread_pool_initialize(
+     libfcrypto_thread_pool_t **thread_pool,
+     int number_of_threads,
+     libcerror_error_t **error )
+{
+	libfcrypto_internal_thread_pool_t *internal_thread_pool = NULL;
+	static char *function                                   = "libfcrypto_thread_pool_initialize";
+
+#if defined( LIBFCRYPTO_THREAD_POOL_HAVE_PTHREAD )
+	int jobs_available_condition_initialized                = 0;
+	int jobs_finished_condition_initialized                 = 0;
+	int jobs_mutex_initialized                              = 0;
+	int number_of_created_threads                           = 0;
+	int pthread_result                                      = 0;
+	int run_mutex_initialized                               = 0;
+	int thread_index                                        = 0;
+#endif
+
+	if( thread_pool == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid thread pool.",
+		 function );
+
+		return( -1 );
+	}
+	if( *thread_pool != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid thread pool value already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( number_of_threads < 0 )
+	 || ( number_of_threads > LIBFCRYPTO_THREAD_POOL_MAXIMUM_NUMBER_OF_THREADS ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid number of threads value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	internal_thread_pool = memory_allocate_structure(
+	                        libfcrypto_internal_thread_pool_t );
+
+	if( internal_thread_pool == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create thread pool.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     internal_thread_pool,
+	     0,
+	     sizeof( libfcrypto_internal_thread_pool_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear thread pool.",
+		 function );
+
+		memory_free(
+		 internal_thread_pool );
+
+		return( -1 );
+	}
+#if defined( LIBFCRYPTO_THREAD_POOL_HAVE_PTHREAD )
+	if( number_of_threads > 0 )
+	{
+		internal_thread_pool->threads = (pthread_t *) memory_allocate(
+		                                               sizeof( pthread_t ) * number_of_threads );
+
+		if( internal_thread_pool->threads == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+			 "%s: unable to create threads.",
+			 function );
+
+			goto on_error;
+		}
+	}
+	pthread_result = pthread_mutex_init(
+	                  &( internal_thread_pool->run_mutex ),
+	                  NULL );
+
+	if( pthread_result != 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to initialize run mutex.",
+		 function );
+
+		goto on_error;
+	}
+	run_mutex_initialized = 1;
+
+	pthread_result = pthread_mutex_init(
+	                  &( internal_thread_pool->jobs_mutex ),
+	                  NULL );
+
+	if( pthread_result != 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to initialize jobs mutex.",
+		 function );
+
+		goto on_error;
+	}
+	jobs_mutex_initialized = 1;
+
+	pthread_result = pthread_cond_init(
+	                  &( internal_thread_pool->jobs_available_condition ),
+	                  NULL );
+
+	if( pthread_result != 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to initialize jobs available condition.",
+		 function );
+
+		goto on_error;
+	}
+	jobs_available_condition_initialized = 1;
+
+	pthread_result = pthread_cond_init(
+	                  &( internal_thread_pool->jobs_finished_condition ),
+	                  NULL );
+
+	if( pthread_result != 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to initialize jobs finished condition.",
+		 function );
+
+		goto on_error;
+	}
+	jobs_finished_condition_initialized = 1;
+
+	for( thread_index = 0;
+	     thread_index < number_of_threads;
+	     thread_index++ )
+	{
+		pthread_result = pthread_create(
+		                  &( internal_thread_pool->threads[ thread_index ] ),
+		                  NULL,
+		                  &libfcrypto_internal_thread_pool_worker_function,
+		                  (void *) internal_thread_pool );
+
+		if( pthread_result != 0 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to create thread: %d.",
+			 function,
+			 thread_index );
+
+			goto on_error;
+		}
+		number_of_created_threads++;
+	}
+	internal_thread_pool->number_of_threads = number_of_threads;
+
+#endif /* defined( LIBFCRYPTO_THREAD_POOL_HAVE_PTHREAD ) */
+
+	*thread_pool = (libfcrypto_thread_pool_t *) internal_thread_pool;
+
+	return( 1 );
+
+on_error:
+	if( internal_thread_pool != NULL )
+	{
+#if defined( LIBFCRYPTO_THREAD_POOL_HAVE_PTHREAD )
+		if( number_of_created_threads > 0 )
+		{
+			pthread_mutex_lock(
+			 &( internal_thread_pool->jobs_mutex ) );
+
+			internal_thread_pool->stop_threads = 1;
+
+			pthread_cond_broadcast(
+			 &( internal_thread_pool->jobs_available_condition ) );
+
+			pthread_mutex_unlock(
+			 &( internal_thread_pool->jobs_mutex ) );
+
+			for( thread_index = 0;
+			     thread_index < number_of_created_threads;
+			     thread_index++ )
+			{
+				pthread_join(
+				 internal_thread_pool->threads[ thread_index ],
+				 NULL );
+			}
+		}
+		if( jobs_finished_condition_initialized != 0 )
+		{
+			pthread_cond_destroy(
+			 &( internal_thread_pool->jobs_finished_condition ) );
+		}
+		if( jobs_available_condition_initialized != 0 )
+		{
+			pthread_cond_destroy(
+			 &( internal_thread_pool->jobs_available_condition ) );
+		}
+		if( jobs_mutex_initialized != 0 )
+		{
+			pthread_mutex_destroy(
+			 &( internal_thread_pool->jobs_mutex ) );
+		}
+		if( run_mutex_initialized != 0 )
+		{
+			pthread_mutex_destroy(
+			 &( internal_thread_pool->run_mutex ) );
+		}
+		if( internal_thread_pool->threads != NULL )
+		{
+			memory_free(
+			 internal_thread_pool->threads );
+		}
+#endif /* defined( LIBFCRYPTO_THREAD_POOL_HAVE_PTHREAD ) */
+
+		memory_free(
+		 internal_thread_pool );
+	}
+	return( -1 );
+}
+
+/* Frees a thread pool
+ * The worker threads are stopped and joined
+ * Returns 1 if successful or -1 on error
+ */
+int libfcrypto_thread_pool_free(
+     libfcrypto_thread_pool_t **thread_pool,
+     libcerror_error_t **error )
+{
+	libfcrypto_internal_thread_pool_t *internal_thread_pool = NULL;
+	static char *function                                   = "libfcrypto_thread_pool_free";
+	int result                                              = 1;
+
+#if defined( LIBFCRYPTO_THREAD_POOL_HAVE_PTHREAD )
+	int thread_index                                        = 0;
+#endif
+
+	if( thread_pool == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid thread pool.",
+		 function );
+
+		return( -1 );
+	}
+	if( *thread_pool != NULL )
+	{
+		internal_thread_pool = (libfcrypto_internal_thread_pool_t *) *thread_pool;
+		*thread_pool         = NULL;
+
+#if defined( LIBFCRYPTO_THREAD_POOL_HAVE_PTHREAD )
+		pthread_mutex_lock(
+		 &( internal_thread_pool->jobs_mutex ) );
+
+		internal_thread_pool->stop_threads = 1;
+
+		pthread_cond_broadcast(
+		 &( internal_thread_pool->jobs_available_condition ) );
+
+		pthread_mutex_unlock(
+		 &( internal_thread_pool->jobs_mutex ) );
+
+		for( thread_index = 0;
+		     thread_index < internal_thread_pool->number_of_threads;
+		     thread_index++ )
+		{
+			if( pthread_join(
+			     internal_thread_pool->threads[ thread_index ],
+			     NULL ) != 0 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+				 "%s: unable to join thread: %d.",
+				 function,
+				 thread_index );
+
+				result = -1;
+			}
+		}
+		pthread_cond_destroy(
+		 &( internal_thread_pool->jobs_finished_condition ) );
+
+		pthread_cond_destroy(
+		 &( internal_thread_pool->jobs_available_condition ) );
+
+		pthread_mutex_destroy(
+		 &( internal_thread_pool->jobs_mutex ) );
+
+		pthread_mutex_destroy(
+		 &( internal_thread_pool->run_mutex ) );
+
+		if( internal_thread_pool->threads != NULL )
+		{
+			memory_free(
+			 internal_thread_pool->threads );
+		}
+#endif /* defined( LIBFCRYPTO_THREAD_POOL_HAVE_PTHREAD ) */
+
+		memory_free(
+		 internal_thread_pool );
+	}
+	return( result );
+}
+
+/* Retrieves the number of worker threads
+ * Returns 1 if successful or -1 on error
+ */
+int libfcrypto_thread_pool_get_number_of_threads(
+     libfcrypto_thread_pool_t *thread_pool,
+     int *number_of_threads,
+     libcerror_error_t **error )
+{
+	libfcrypto_internal_thread_pool_t *internal_thread_pool = NULL;
+	static char *function                                   = "libfcrypto_thread_pool_get_number_of_threads";
+
+	if( thread_pool == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid thread pool.",
+		 function );
+
+		return( -1 );
+	}
+	internal_thread_pool = (libfcrypto_internal_thread_pool_t *) thread_pool;
+
+	if( number_of_threads == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid number of threads.",
+		 function );
+
+		return( -1 );
+	}
+	*number_of_threads = internal_thread_pool->number_of_threads;
+
+	return( 1 );
+}
+
+/* Processes jobs until no more jobs are available
+ * Every job is passed its own error, the error of the failed job with the lowest index is kept
+ * With multi-threading support the jobs mutex must be locked when called
+ * and is locked again on return
+ */
+void libfcrypto_internal_thread_pool_process_jobs(
+      libfcrypto_internal_thread_pool_t *internal_thread_pool )
+{
+	libcerror_error_t *job_error = NULL;
+	intptr_t *job                = NULL;
+	int job_index                = 0;
+	int job_result               = 0;
+
+	if( internal_thread_pool == NULL )
+	{
+		return;
+	}
+	while( internal_thread_pool->next_job_index < internal_thread_pool->number_of_jobs )
+	{
+		job_index = internal_thread_pool->next_job_index;
+		job       = (intptr_t *) &( internal_thread_pool->jobs[ job_index * internal_thread_pool->job_size ] );
+
+		internal_thread_pool->next_job_index += 1;
+
+#if defined( LIBFCRYPTO_THREAD_POOL_HAVE_PTHREAD )
+		pthread_mutex_unlock(
+		 &( internal_thread_pool->jobs_mutex ) );
+#endif
+		job_result = internal_thread_pool->job_function(
+		              job,
+		              &job_error );
+
+#if defined( LIBFCRYPTO_THREAD_POOL_HAVE_PTHREAD )
+		pthread_mutex_lock(
+		 &( internal_thread_pool->jobs_mutex ) );
+#endif
+		if( job_result != 1 )
+		{
+			internal_thread_pool->jobs_result = -1;
+
+			if( ( internal_thread_pool->jobs_error == NULL )
+			 || ( job_index < internal_thread_pool->jobs_error_index ) )
+			{
+				if( internal_thread_pool->jobs_error != NULL )
+				{
+					libcerror_error_free(
+					 &( internal_thread_pool->jobs_error ) );
+				}
+				internal_thread_pool->jobs_error       = job_error;
+				internal_thread_pool->jobs_error_index = job_index;
+
+				job_error = NULL;
+			}
+		}
+		if( job_error != NULL )
+		{
+			libcerror_error_free(
+			 &job_error );
+		}
+		internal_thread_pool->number_of_finished_jobs += 1;
+
+#if defined( LIBFCRYPTO_THREAD_POOL_HAVE_PTHREAD )
+		if( internal_thread_pool->number_of_finished_jobs == internal_thread_pool->number_of_jobs )
+		{
+			pthread_cond_broadcast(
+			 &( internal_thread_pool->jobs_finished_condition ) );
+		}
+#endif
+	}
+}
+
+#if defined( LIBFCRYPTO_THREAD_POOL_HAVE_PTHREAD )
+
+/* The worker thread function that runs the jobs until the thread pool is freed
+ * Returns NULL
+ */
+void *libfcrypto_internal_thread_pool_worker_function(
+       void *arguments )
+{
+	libfcrypto_internal_thread_pool_t *internal_thread_pool = NULL;
+
+	internal_thread_pool = (libfcrypto_internal_thread_pool_t *) arguments;
+
+	if( internal_thread_pool == NULL )
+	{
+		return( NULL );
+	}
+	pthread_mutex_lock(
+	 &( internal_thread_pool->jobs_mutex ) );
+
+	while( internal_thread_pool->stop_threads == 0 )
+	{
+		if( internal_thread_pool->next_job_index < internal_thread_pool->number_of_jobs )
+		{
+			libfcrypto_internal_thread_pool_process_jobs(
+			 internal_thread_pool );
+		}
+		else
+		{
+			pthread_cond_wait(
+			 &( internal_thread_pool->jobs_available_condition ),
+			 &( internal_thread_pool->jobs_mutex ) );
+		}
+	}
+	pthread_mutex_unlock(
+	 &( internal_thread_pool->jobs_mutex ) );
+
+	return( NULL );
+}
+
+#endif /* defined( LIBFCRYPTO_THREAD_POOL_HAVE_PTHREAD ) */
+
+/* Runs jobs using the worker threads and the calling thread
+ * The jobs are stored consecutively in memory and each is passed to the job function
+ * The function returns when all the jobs have finished
+ * Returns 1 if successful or -1 on error
+ */
+int libfcrypto_internal_thread_pool_run_jobs(
+     libfcrypto_internal_thread_pool_t *internal_thread_pool,
+     int (*job_function)(
+            intptr_t *job,
+            libcerror_error_t **error ),
+     uint8_t *jobs,
+     size_t job_size,
+     int number_of_jobs,
+     libcerror_error_t **error )
+{
+	libcerror_error_t *jobs_error = NULL;
+	static char *function         = "libfcrypto_internal_thread_pool_run_jobs";
+	int result                    = 0;
+
+	if( internal_thread_pool == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid thread pool.",
+		 function );
+
+		return( -1 );
+	}
+	if( job_function == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid job function.",
+		 function );
+
+		return( -1 );
+	}
+	if( jobs == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid jobs.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( job_size == 0 )
+	 || ( job_size > (size_t) SSIZE_MAX ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid job size value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( number_of_jobs < 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_LESS_THAN_ZERO,
+		 "%s: invalid number of jobs value less than zero.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( LIBFCRYPTO_THREAD_POOL_HAVE_PTHREAD )
+	pthread_mutex_lock(
+	 &( internal_thread_pool->run_mutex ) );
+
+	pthread_mutex_lock(
+	 &( internal_thread_pool->jobs_mutex ) );
+#endif
+	internal_thread_pool->job_function            = job_function;
+	internal_thread_pool->jobs                    = jobs;
+	internal_thread_pool->job_size                = job_size;
+	internal_thread_pool->number_of_jobs          = number_of_jobs;
+	internal_thread_pool->next_job_index          = 0;
+	internal_thread_pool->number_of_finished_jobs = 0;
+	internal_thread_pool->jobs_result             = 1;
+	internal_thread_pool->jobs_error              = NULL;
+	internal_thread_pool->jobs_error_index        = 0;
+
+#if defined( LIBFCRYPTO_THREAD_POOL_HAVE_PTHREAD )
+	pthread_cond_broadcast(
+	 &( internal_thread_pool->jobs_available_condition ) );
+#endif
+	libfcrypto_internal_thread_pool_process_jobs(
+	 internal_thread_pool );
+
+#if defined( LIBFCRYPTO_THREAD_POOL_HAVE_PTHREAD )
+	while( internal_thread_pool->number_of_finished_jobs < internal_thread_pool->number_of_jobs )
+	{
+		pthread_cond_wait(
+		 &( internal_thread_pool->jobs_finished_condition ),
+		 &( internal_thread_pool->jobs_mutex ) );
+	}
+#endif
+	result     = internal_thread_pool->jobs_result;
+	jobs_error = internal_thread_pool->jobs_error;
+
+	internal_thread_pool->job_function   = NULL;
+	internal_thread_pool->jobs           = NULL;
+	internal_thread_pool->job_size       = 0;
+	internal_thread_pool->number_of_jobs = 0;
+	internal_thread_pool->next_job_index = 0;
+	internal_thread_pool->jobs_error     = NULL;
+
+#if defined( LIBFCRYPTO_THREAD_POOL_HAVE_PTHREAD )
+	pthread_mutex_unlock(
+	 &( internal_thread_pool->jobs_mutex ) );
+
+	pthread_mutex_unlock(
+	 &( internal_thread_pool->run_mutex ) );
+#endif
+	if( result != 1 )
+	{
+		/* Chain the error of the failed job into the error of the caller
+		 */
+		if( ( error != NULL )
+		 && ( *error == NULL ) )
+		{
+			*error     = jobs_error;
+			jobs_error = NULL;
+		}
+		if( jobs_error != NULL )
+		{
+			libcerror_error_free(
+			 &jobs_error );
+		}
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GENERIC,
+		 "%s: unable to run jobs.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
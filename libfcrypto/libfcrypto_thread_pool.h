@@ -0,0 +1,164 @@
+/*
+ * Thread pool functions
+ *
+ * Copyright (C) 2017-2024, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _LIBFCRYPTO_THREAD_POOL_H )
+#define _LIBFCRYPTO_THREAD_POOL_H
+
+#include <common.h>
+#include <types.h>
+
+#if defined( HAVE_MULTI_THREAD_SUPPORT ) && defined( HAVE_PTHREAD_H ) && !defined( WINAPI )
+#include <pthread.h>
+#endif
+
+#include "libfcrypto_extern.h"
+#include "libfcrypto_libcerror.h"
+#include "libfcrypto_types.h"
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+#if defined( HAVE_MULTI_THREAD_SUPPORT ) && defined( HAVE_PTHREAD_H ) && !defined( WINAPI )
+#define LIBFCRYPTO_THREAD_POOL_HAVE_PTHREAD	1
+#endif
+
+/* The maximum number of worker threads
+ */
+#define LIBFCRYPTO_THREAD_POOL_MAXIMUM_NUMBER_OF_THREADS	256
+
+typedef struct libfcrypto_internal_thread_pool libfcrypto_internal_thread_pool_t;
+
+struct libfcrypto_internal_thread_pool
+{
+	/* The number of worker threads
+	 */
+	int number_of_threads;
+
+#if defined( LIBFCRYPTO_THREAD_POOL_HAVE_PTHREAD )
+	/* The worker threads
+	 */
+	pthread_t *threads;
+
+	/* The mutex that allows a single run of jobs at a time
+	 */
+	pthread_mutex_t run_mutex;
+
+	/* The mutex that protects the job values
+	 */
+	pthread_mutex_t jobs_mutex;
+
+	/* The condition that signals the worker threads that jobs are available
+	 */
+	pthread_cond_t jobs_available_condition;
+
+	/* The condition that signals that all jobs have finished
+	 */
+	pthread_cond_t jobs_finished_condition;
+
+#endif /* defined( LIBFCRYPTO_THREAD_POOL_HAVE_PTHREAD ) */
+
+	/* The function that runs a job
+	 */
+	int (*job_function)(
+	       intptr_t *job,
+	       libcerror_error_t **error );
+
+	/* The jobs
+	 */
+	uint8_t *jobs;
+
+	/* The size of a job
+	 */
+	size_t job_size;
+
+	/* The number of jobs
+	 */
+	int number_of_jobs;
+
+	/* The index of the next job to run
+	 */
+	int next_job_index;
+
+	/* The number of finished jobs
+	 */
+	int number_of_finished_jobs;
+
+	/* The result of the jobs, which is -1 if any of the jobs failed
+	 */
+	int jobs_result;
+
+	/* The error of the failed job with the lowest index
+	 */
+	libcerror_error_t *jobs_error;
+
+	/* The index of the failed job with the lowest index
+	 */
+	int jobs_error_index;
+
+	/* Value to indicate the worker threads should stop
+	 */
+	uint8_t stop_threads;
+};
+
+LIBFCRYPTO_EXTERN \
+int libfcrypto_thread_pool_initialize(
+     libfcrypto_thread_pool_t **thread_pool,
+     int number_of_threads,
+     libcerror_error_t **error );
+
+LIBFCRYPTO_EXTERN \
+int libfcrypto_thread_pool_free(
+     libfcrypto_thread_pool_t **thread_pool,
+     libcerror_error_t **error );
+
+LIBFCRYPTO_EXTERN \
+int libfcrypto_thread_pool_get_number_of_threads(
+     libfcrypto_thread_pool_t *thread_pool,
+     int *number_of_threads,
+     libcerror_error_t **error );
+
+void libfcrypto_internal_thread_pool_process_jobs(
+      libfcrypto_internal_thread_pool_t *internal_thread_pool );
+
+#if defined( LIBFCRYPTO_THREAD_POOL_HAVE_PTHREAD )
+
+void *libfcrypto_internal_thread_pool_worker_function(
+       void *arguments );
+
+#endif /* defined( LIBFCRYPTO_THREAD_POOL_HAVE_PTHREAD ) */
+
+int libfcrypto_internal_thread_pool_run_jobs(
+     libfcrypto_internal_thread_pool_t *internal_thread_pool,
+     int (*job_function)(
+            intptr_t *job,
+            libcerror_error_t **error ),
+     uint8_t *jobs,
+     size_t job_size,
+     int number_of_jobs,
+     libcerror_error_t **error );
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _LIBFCRYPTO_THREAD_POOL_H ) */
+
@@ -35,15 +35,23 @@
  */
 #if defined( HAVE_DEBUG_OUTPUT ) && !defined( WINAPI )
 typedef struct libfcrypto_blowfish_context {}	libfcrypto_blowfish_context_t;
+typedef struct libfcrypto_cbc_stream {}		libfcrypto_cbc_stream_t;
+typedef struct libfcrypto_cipher {}		libfcrypto_cipher_t;
 typedef struct libfcrypto_des3_context {}	libfcrypto_des3_context_t;
+typedef struct libfcrypto_job_queue {}	libfcrypto_job_queue_t;
 typedef struct libfcrypto_rc4_context {}	libfcrypto_rc4_context_t;
 typedef struct libfcrypto_serpent_context {}	libfcrypto_serpent_context_t;
+typedef struct libfcrypto_thread_pool {}		libfcrypto_thread_pool_t;
 
 #else
 typedef intptr_t libfcrypto_blowfish_context_t;
+typedef intptr_t libfcrypto_cbc_stream_t;
+typedef intptr_t libfcrypto_cipher_t;
 typedef intptr_t libfcrypto_des3_context_t;
+typedef intptr_t libfcrypto_job_queue_t;
 typedef intptr_t libfcrypto_rc4_context_t;
 typedef intptr_t libfcrypto_serpent_context_t;
+typedef intptr_t libfcrypto_thread_pool_t;
 
 #endif /* defined( HAVE_DEBUG_OUTPUT ) && !defined( WINAPI ) */
 
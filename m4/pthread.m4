@@ -0,0 +1,153 @@
+dnl Checks for pthread required headers and functions
+dnl
+dnl Version: 20241017
+
+dnl Function to detect if pthread is available
+dnl ac_pthread_dummy is used to prevent AC_CHECK_LIB adding unnecessary -l<library> arguments
+AC_DEFUN([AX_PTHREAD_CHECK_LIB],
+  [AS_IF(
+    [test "x$ac_cv_enable_winapi" = xyes || test "x$ac_cv_enable_multi_threading_support" = xno || test "x$ac_cv_with_pthread" = xno],
+    [ac_cv_pthread=no],
+    [ac_cv_pthread=check
+    dnl Check if the directory provided as parameter exists
+    dnl For both --with-pthread which returns "yes" and --with-pthread= which returns ""
+    dnl treat them as auto-detection.
+    AS_IF(
+      [test "x$ac_cv_with_pthread" != x && test "x$ac_cv_with_pthread" != xauto-detect && test "x$ac_cv_with_pthread" != xyes],
+      [AX_CHECK_LIB_DIRECTORY_EXISTS([pthread])])
+
+    dnl Check for headers
+    AC_CHECK_HEADERS([pthread.h])
+
+    AS_IF(
+      [test "x$ac_cv_header_pthread_h" = xno],
+      [ac_cv_pthread=no],
+      [ac_cv_pthread=pthread
+
+      dnl Check for thread functions
+      AC_CHECK_LIB(
+        pthread,
+        pthread_create,
+        [ac_pthread_dummy=yes],
+        [ac_cv_pthread=no])
+      AC_CHECK_LIB(
+        pthread,
+        pthread_exit,
+        [ac_pthread_dummy=yes],
+        [ac_cv_pthread=no])
+      AC_CHECK_LIB(
+        pthread,
+        pthread_join,
+        [ac_pthread_dummy=yes],
+        [ac_cv_pthread=no])
+
+      dnl Check for condition functions
+      AC_CHECK_LIB(
+        pthread,
+        pthread_cond_init,
+        [ac_pthread_dummy=yes],
+        [ac_cv_pthread=no])
+      AC_CHECK_LIB(
+        pthread,
+        pthread_cond_destroy,
+        [ac_pthread_dummy=yes],
+        [ac_cv_pthread=no])
+      AC_CHECK_LIB(
+        pthread,
+        pthread_cond_broadcast,
+        [ac_pthread_dummy=yes],
+        [ac_cv_pthread=no])
+      AC_CHECK_LIB(
+        pthread,
+        pthread_cond_wait,
+        [ac_pthread_dummy=yes],
+        [ac_cv_pthread=no])
+
+      dnl Check for mutex functions
+      AC_CHECK_LIB(
+        pthread,
+        pthread_mutex_init,
+        [ac_pthread_dummy=yes],
+        [ac_cv_pthread=no])
+      AC_CHECK_LIB(
+        pthread,
+        pthread_mutex_destroy,
+        [ac_pthread_dummy=yes],
+        [ac_cv_pthread=no])
+      AC_CHECK_LIB(
+        pthread,
+        pthread_mutex_lock,
+        [ac_pthread_dummy=yes],
+        [ac_cv_pthread=no])
+      AC_CHECK_LIB(
+        pthread,
+        pthread_mutex_unlock,
+        [ac_pthread_dummy=yes],
+        [ac_cv_pthread=no])
+
+      ac_cv_pthread_LIBADD="-lpthread";
+      ])
+    ])
+
+  AS_IF(
+    [test "x$ac_cv_pthread" = xpthread],
+    [AC_DEFINE(
+      [HAVE_PTHREAD],
+      [1],
+      [Define to 1 if you have the 'pthread' library (-lpthread).])
+    ])
+
+  AS_IF(
+    [test "x$ac_cv_pthread" != xno],
+    [AC_SUBST(
+      [HAVE_PTHREAD],
+      [1]) ],
+    [AC_SUBST(
+      [HAVE_PTHREAD],
+      [0])
+    ])
+  ])
+
+dnl Function to detect how to enable pthread
+AC_DEFUN([AX_PTHREAD_CHECK_ENABLE],
+  [AX_COMMON_ARG_ENABLE(
+    [multi-threading-support],
+    [multi_threading_support],
+    [enable multi-threading support],
+    [yes])
+  AX_COMMON_ARG_WITH(
+    [pthread],
+    [pthread],
+    [search for pthread in includedir and libdir or in the specified DIR, or no if not to use pthread],
+    [auto-detect],
+    [DIR])
+
+  AX_PTHREAD_CHECK_LIB
+
+  AS_IF(
+    [test "x$ac_cv_pthread" = xpthread],
+    [AC_DEFINE(
+      [HAVE_MULTI_THREAD_SUPPORT],
+      [1],
+      [Define to 1 if multi thread support should be used.])
+    AC_SUBST(
+      [HAVE_MULTI_THREAD_SUPPORT],
+      [1])
+
+    AC_SUBST(
+      [PTHREAD_CPPFLAGS],
+      [$ac_cv_pthread_CPPFLAGS])
+    AC_SUBST(
+      [PTHREAD_LIBADD],
+      [$ac_cv_pthread_LIBADD])
+
+    AC_SUBST(
+      [ax_pthread_pc_libs_private],
+      [-lpthread])
+    ],
+    [AC_SUBST(
+      [HAVE_MULTI_THREAD_SUPPORT],
+      [0])
+    ])
+  ])
+
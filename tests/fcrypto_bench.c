@@ -0,0 +1,1952 @@
+/*
+ * Throughput and latency benchmark program
+ *
+ * Copyright (C) 2017-2024, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <file_stream.h>
+#include <memory.h>
+#include <system_string.h>
+#include <types.h>
+
+#if defined( HAVE_STDLIB_H ) || defined( WINAPI )
+#include <stdlib.h>
+#endif
+
+#if defined( HAVE_UNISTD_H )
+#include <unistd.h>
+#endif
+
+#if !defined( WINAPI )
+#include <time.h>
+#endif
+
+#if ( defined( __clang__ ) || defined( __GNUC__ ) ) && ( defined( __i386__ ) || defined( __x86_64__ ) )
+#include <x86intrin.h>
+#define FCRYPTO_BENCH_HAVE_RDTSC	1
+
+#elif defined( _MSC_VER ) && ( defined( _M_IX86 ) || defined( _M_X64 ) )
+#include <intrin.h>
+#define FCRYPTO_BENCH_HAVE_RDTSC	1
+#endif
+
+#include "fcrypto_test_libcerror.h"
+#include "fcrypto_test_libfcrypto.h"
+#include "fcrypto_test_unused.h"
+
+/* The default maximum buffer size of 64 MiB
+ */
+#define FCRYPTO_BENCH_DEFAULT_MAXIMUM_BUFFER_SIZE	( 64 * 1024 * 1024 )
+
+/* The default minimum time of a measurement in milliseconds
+ */
+#define FCRYPTO_BENCH_DEFAULT_MINIMUM_TIME		100
+
+/* The minimum buffer size, which is a multiple of all the block sizes
+ */
+#define FCRYPTO_BENCH_MINIMUM_BUFFER_SIZE		16
+
+/* The minimum size of the data that is (de/en)crypted by a single thread
+ */
+#define FCRYPTO_BENCH_MINIMUM_CHUNK_SIZE		( 64 * 1024 )
+
+/* The maximum number of threads of the thread pool
+ */
+#define FCRYPTO_BENCH_MAXIMUM_NUMBER_OF_THREADS		256
+
+/* The maximum number of jobs of the job queue
+ */
+#define FCRYPTO_BENCH_MAXIMUM_NUMBER_OF_JOBS		1024
+
+/* The data unit (sector) size used by the data unit and block key measurements
+ */
+#define FCRYPTO_BENCH_DATA_UNIT_SIZE			512
+
+/* The number of streams used by the multiple stream measurements
+ */
+#define FCRYPTO_BENCH_NUMBER_OF_STREAMS			4
+
+enum FCRYPTO_BENCH_FUNCTIONS
+{
+	FCRYPTO_BENCH_FUNCTION_CIPHER_CRYPT_CBC_DATA_UNITS	= 1,
+	FCRYPTO_BENCH_FUNCTION_CIPHER_CRYPT_CBC_MULTIPLE,
+	FCRYPTO_BENCH_FUNCTION_RC4_CRYPT_MULTIPLE,
+	FCRYPTO_BENCH_FUNCTION_RC4_CRYPT_WITH_BLOCK_KEYS,
+	FCRYPTO_BENCH_FUNCTION_SERPENT_CRYPT_XTS,
+	FCRYPTO_BENCH_FUNCTION_SERPENT_CRYPT_XTS_DATA_UNITS
+};
+
+typedef struct fcrypto_bench_algorithm fcrypto_bench_algorithm_t;
+
+struct fcrypto_bench_algorithm
+{
+	/* The name
+	 */
+	const char *name;
+
+	/* The algorithm
+	 */
+	int algorithm;
+
+	/* The (chaining) modes
+	 */
+	int modes[ 3 ];
+
+	/* The number of (chaining) modes
+	 */
+	int number_of_modes;
+
+	/* The key sizes in bits
+	 */
+	size_t key_bit_sizes[ 3 ];
+};
+
+fcrypto_bench_algorithm_t fcrypto_bench_algorithms[ 4 ] = {
+	{ "blowfish", LIBFCRYPTO_CIPHER_ALGORITHM_BLOWFISH,
+	  { LIBFCRYPTO_CIPHER_MODE_CBC, LIBFCRYPTO_CIPHER_MODE_CTR, LIBFCRYPTO_CIPHER_MODE_ECB }, 3,
+	  { 128, 256, 448 } },
+	{ "des3", LIBFCRYPTO_CIPHER_ALGORITHM_DES3,
+	  { LIBFCRYPTO_CIPHER_MODE_CBC, LIBFCRYPTO_CIPHER_MODE_CTR, LIBFCRYPTO_CIPHER_MODE_ECB }, 3,
+	  { 64, 128, 192 } },
+	{ "rc4", LIBFCRYPTO_CIPHER_ALGORITHM_RC4,
+	  { LIBFCRYPTO_CIPHER_MODE_STREAM, 0, 0 }, 1,
+	  { 40, 128, 256 } },
+	{ "serpent", LIBFCRYPTO_CIPHER_ALGORITHM_SERPENT,
+	  { LIBFCRYPTO_CIPHER_MODE_CBC, LIBFCRYPTO_CIPHER_MODE_CTR, LIBFCRYPTO_CIPHER_MODE_ECB }, 3,
+	  { 128, 192, 256 } } };
+
+typedef struct fcrypto_bench_function fcrypto_bench_function_t;
+
+struct fcrypto_bench_function
+{
+	/* The name
+	 */
+	const char *name;
+
+	/* The function
+	 */
+	int function;
+
+	/* The algorithm
+	 */
+	int algorithm;
+
+	/* The number of (de/en)crypt modes, which is 1 if the same function is used to decrypt and encrypt
+	 */
+	int number_of_crypt_modes;
+
+	/* The minimum buffer size
+	 */
+	size_t minimum_buffer_size;
+
+	/* Value to indicate the function uses the thread pool of the cipher
+	 */
+	uint8_t uses_thread_pool;
+};
+
+fcrypto_bench_function_t fcrypto_bench_functions[ 10 ] = {
+	{ "cipher_crypt_cbc_data_units", FCRYPTO_BENCH_FUNCTION_CIPHER_CRYPT_CBC_DATA_UNITS,
+	  LIBFCRYPTO_CIPHER_ALGORITHM_BLOWFISH, 2, FCRYPTO_BENCH_DATA_UNIT_SIZE, 1 },
+	{ "cipher_crypt_cbc_data_units", FCRYPTO_BENCH_FUNCTION_CIPHER_CRYPT_CBC_DATA_UNITS,
+	  LIBFCRYPTO_CIPHER_ALGORITHM_DES3, 2, FCRYPTO_BENCH_DATA_UNIT_SIZE, 1 },
+	{ "cipher_crypt_cbc_data_units", FCRYPTO_BENCH_FUNCTION_CIPHER_CRYPT_CBC_DATA_UNITS,
+	  LIBFCRYPTO_CIPHER_ALGORITHM_SERPENT, 2, FCRYPTO_BENCH_DATA_UNIT_SIZE, 1 },
+	{ "cipher_crypt_cbc_multiple", FCRYPTO_BENCH_FUNCTION_CIPHER_CRYPT_CBC_MULTIPLE,
+	  LIBFCRYPTO_CIPHER_ALGORITHM_BLOWFISH, 2, FCRYPTO_BENCH_NUMBER_OF_STREAMS * 16, 0 },
+	{ "cipher_crypt_cbc_multiple", FCRYPTO_BENCH_FUNCTION_CIPHER_CRYPT_CBC_MULTIPLE,
+	  LIBFCRYPTO_CIPHER_ALGORITHM_DES3, 2, FCRYPTO_BENCH_NUMBER_OF_STREAMS * 16, 0 },
+	{ "cipher_crypt_cbc_multiple", FCRYPTO_BENCH_FUNCTION_CIPHER_CRYPT_CBC_MULTIPLE,
+	  LIBFCRYPTO_CIPHER_ALGORITHM_SERPENT, 2, FCRYPTO_BENCH_NUMBER_OF_STREAMS * 16, 0 },
+	{ "rc4_crypt_multiple", FCRYPTO_BENCH_FUNCTION_RC4_CRYPT_MULTIPLE,
+	  LIBFCRYPTO_CIPHER_ALGORITHM_RC4, 1, FCRYPTO_BENCH_NUMBER_OF_STREAMS * 16, 0 },
+	{ "rc4_crypt_with_block_keys", FCRYPTO_BENCH_FUNCTION_RC4_CRYPT_WITH_BLOCK_KEYS,
+	  LIBFCRYPTO_CIPHER_ALGORITHM_RC4, 1, FCRYPTO_BENCH_DATA_UNIT_SIZE, 0 },
+	{ "serpent_crypt_xts", FCRYPTO_BENCH_FUNCTION_SERPENT_CRYPT_XTS,
+	  LIBFCRYPTO_CIPHER_ALGORITHM_SERPENT, 2, 16, 0 },
+	{ "serpent_crypt_xts_data_units", FCRYPTO_BENCH_FUNCTION_SERPENT_CRYPT_XTS_DATA_UNITS,
+	  LIBFCRYPTO_CIPHER_ALGORITHM_SERPENT, 2, FCRYPTO_BENCH_DATA_UNIT_SIZE, 0 } };
+
+const char *fcrypto_bench_cpu_level_names[ 5 ] = {
+	"scalar", "sse2", "ssse3", "avx2", "avx512" };
+
+/* The key used by all the measurements
+ */
+uint8_t fcrypto_bench_key[ 56 ] = {
+	0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09, 0x0a, 0x0b, 0x0c, 0x0d, 0x0e, 0x0f,
+	0x10, 0x11, 0x12, 0x13, 0x14, 0x15, 0x16, 0x17, 0x18, 0x19, 0x1a, 0x1b, 0x1c, 0x1d, 0x1e, 0x1f,
+	0x20, 0x21, 0x22, 0x23, 0x24, 0x25, 0x26, 0x27, 0x28, 0x29, 0x2a, 0x2b, 0x2c, 0x2d, 0x2e, 0x2f,
+	0x30, 0x31, 0x32, 0x33, 0x34, 0x35, 0x36, 0x37 };
+
+/* The initialization vector used by all the measurements
+ */
+uint8_t fcrypto_bench_initialization_vector[ 16 ] = {
+	0xf0, 0xf1, 0xf2, 0xf3, 0xf4, 0xf5, 0xf6, 0xf7, 0xf8, 0xf9, 0xfa, 0xfb, 0xfc, 0xfd, 0xfe, 0xff };
+
+/* The results of the jobs submitted to the job queue
+ */
+int fcrypto_bench_job_results[ FCRYPTO_BENCH_MAXIMUM_NUMBER_OF_JOBS ];
+
+/* Prints usage information
+ */
+void fcrypto_bench_usage_fprint(
+      FILE *stream )
+{
+	if( stream == NULL )
+	{
+		return;
+	}
+	fprintf( stream, "Use fcrypto_bench to measure the throughput and latency of the\n"
+	                 "(de/en)cryption functions and the cost of the key setup.\n"
+	                 "The results are written to stdout in JSON.\n\n" );
+
+	fprintf( stream, "Usage: fcrypto_bench [ -a algorithm ] [ -c cpu_level ] [ -j threads ]\n"
+	                 "                     [ -m maximum_buffer_size ] [ -t minimum_time ] [ -h ]\n\n" );
+
+	fprintf( stream, "\t-a: only measure a specific algorithm, options: blowfish, des3, rc4\n"
+	                 "\t    or serpent\n" );
+	fprintf( stream, "\t-c: only measure a specific CPU level, options: scalar, sse2, ssse3,\n"
+	                 "\t    avx2 or avx512, by default all the supported CPU levels are measured\n" );
+	fprintf( stream, "\t-h: shows this help\n" );
+	fprintf( stream, "\t-j: the number of worker threads used by the threaded and job queue\n"
+	                 "\t    measurements, 0 disables them, by default the number of online\n"
+	                 "\t    processors - 1\n" );
+	fprintf( stream, "\t-m: the maximum buffer size in bytes, by default 64 MiB. The buffer\n"
+	                 "\t    sizes measured range from 16 bytes to the maximum in powers of 4\n" );
+	fprintf( stream, "\t-t: the minimum time of a measurement in milliseconds, by default 100\n" );
+}
+
+/* Retrieves a decimal value from a string
+ * Returns 1 if successful or -1 on error
+ */
+int fcrypto_bench_get_decimal_value(
+     const system_character_t *string,
+     uint64_t *value )
+{
+	uint64_t safe_value = 0;
+	size_t string_index = 0;
+
+	if( ( string == NULL )
+	 || ( string[ 0 ] == 0 )
+	 || ( value == NULL ) )
+	{
+		return( -1 );
+	}
+	for( string_index = 0;
+	     string[ string_index ] != 0;
+	     string_index++ )
+	{
+		if( ( string[ string_index ] < (system_character_t) '0' )
+		 || ( string[ string_index ] > (system_character_t) '9' )
+		 || ( safe_value > ( ( (uint64_t) UINT32_MAX * 1024 ) / 10 ) ) )
+		{
+			return( -1 );
+		}
+		safe_value *= 10;
+		safe_value += (uint64_t) ( string[ string_index ] - (system_character_t) '0' );
+	}
+	*value = safe_value;
+
+	return( 1 );
+}
+
+/* Determines if a string matches an ASCII name
+ * Returns 1 if the string matches, 0 if not
+ */
+int fcrypto_bench_string_matches_name(
+     const system_character_t *string,
+     const char *name )
+{
+	size_t string_index = 0;
+
+	if( ( string == NULL )
+	 || ( name == NULL ) )
+	{
+		return( 0 );
+	}
+	while( name[ string_index ] != 0 )
+	{
+		if( string[ string_index ] != (system_character_t) name[ string_index ] )
+		{
+			return( 0 );
+		}
+		string_index++;
+	}
+	if( string[ string_index ] != 0 )
+	{
+		return( 0 );
+	}
+	return( 1 );
+}
+
+/* Retrieves the value of a monotonic clock in nanoseconds
+ * Returns the time value
+ */
+uint64_t fcrypto_bench_get_time(
+          void )
+{
+#if defined( WINAPI )
+	LARGE_INTEGER counter;
+	LARGE_INTEGER frequency;
+
+	QueryPerformanceFrequency(
+	 &frequency );
+
+	QueryPerformanceCounter(
+	 &counter );
+
+	return( (uint64_t) ( ( (double) counter.QuadPart * 1000000000.0 ) / (double) frequency.QuadPart ) );
+#else
+	struct timespec time_value;
+
+	clock_gettime(
+	 CLOCK_MONOTONIC,
+	 &time_value );
+
+	return( ( (uint64_t) time_value.tv_sec * 1000000000UL ) + (uint64_t) time_value.tv_nsec );
+#endif
+}
+
+/* Retrieves the value of the time stamp counter
+ * Returns the counter value or 0 if not available
+ */
+uint64_t fcrypto_bench_get_cycles(
+          void )
+{
+#if defined( FCRYPTO_BENCH_HAVE_RDTSC )
+	return( (uint64_t) __rdtsc() );
+#else
+	return( 0 );
+#endif
+}
+
+/* Retrieves the name of a (chaining) mode
+ * Returns the name
+ */
+const char *fcrypto_bench_get_mode_name(
+             int mode )
+{
+	switch( mode )
+	{
+		case LIBFCRYPTO_CIPHER_MODE_CBC:
+			return( "cbc" );
+
+		case LIBFCRYPTO_CIPHER_MODE_CTR:
+			return( "ctr" );
+
+		case LIBFCRYPTO_CIPHER_MODE_ECB:
+			return( "ecb" );
+
+		case LIBFCRYPTO_CIPHER_MODE_STREAM:
+			return( "stream" );
+
+		default:
+			break;
+	}
+	return( "unknown" );
+}
+
+/* Prints the cycles of a measurement as JSON, which is null if not available
+ */
+void fcrypto_bench_cycles_fprint(
+      FILE *stream,
+      uint64_t elapsed_cycles,
+      double divisor )
+{
+	if( stream == NULL )
+	{
+		return;
+	}
+	if( ( elapsed_cycles == 0 )
+	 || ( divisor <= 0.0 ) )
+	{
+		fprintf( stream, "null" );
+	}
+	else
+	{
+		fprintf( stream, "%.3f", (double) elapsed_cycles / divisor );
+	}
+}
+
+/* Generates the initialization vector of a data unit from the data unit number
+ * The data unit number is stored in little-endian, similar to a plain sector number
+ * Returns 1 if successful or -1 on error
+ */
+int fcrypto_bench_initialization_vector_function(
+     intptr_t *function_data FCRYPTO_TEST_ATTRIBUTE_UNUSED,
+     uint64_t data_unit_number,
+     uint8_t *initialization_vector,
+     size_t initialization_vector_size,
+     libcerror_error_t **error FCRYPTO_TEST_ATTRIBUTE_UNUSED )
+{
+	size_t byte_index = 0;
+
+	FCRYPTO_TEST_UNREFERENCED_PARAMETER( function_data )
+	FCRYPTO_TEST_UNREFERENCED_PARAMETER( error )
+
+	if( initialization_vector == NULL )
+	{
+		return( -1 );
+	}
+	for( byte_index = 0;
+	     byte_index < initialization_vector_size;
+	     byte_index++ )
+	{
+		initialization_vector[ byte_index ] = (uint8_t) ( data_unit_number & 0xff );
+
+		data_unit_number >>= 8;
+	}
+	return( 1 );
+}
+
+/* Stores the result of a job submitted to the job queue
+ */
+void fcrypto_bench_job_completion_function(
+      intptr_t *callback_data,
+      uint64_t job_identifier FCRYPTO_TEST_ATTRIBUTE_UNUSED,
+      int result,
+      libcerror_error_t *job_error FCRYPTO_TEST_ATTRIBUTE_UNUSED )
+{
+	int *job_result = (int *) callback_data;
+
+	FCRYPTO_TEST_UNREFERENCED_PARAMETER( job_identifier )
+	FCRYPTO_TEST_UNREFERENCED_PARAMETER( job_error )
+
+	if( job_result != NULL )
+	{
+		*job_result = result;
+	}
+}
+
+/* De- or encrypts a buffer by splitting it into jobs that are submitted to the job queue
+ * Returns 1 if successful or -1 on error
+ */
+int fcrypto_bench_crypt_with_job_queue(
+     libfcrypto_job_queue_t *job_queue,
+     libfcrypto_cipher_t *cipher,
+     int crypt_mode,
+     size_t block_size,
+     const uint8_t *input_data,
+     uint8_t *output_data,
+     size_t buffer_size,
+     libcerror_error_t **error )
+{
+	uint64_t job_identifier = 0;
+	size_t chunk_size       = FCRYPTO_BENCH_MINIMUM_CHUNK_SIZE;
+	size_t data_offset      = 0;
+	size_t data_size        = 0;
+	int job_index           = 0;
+	int number_of_jobs      = 0;
+
+	if( ( buffer_size / FCRYPTO_BENCH_MAXIMUM_NUMBER_OF_JOBS ) > chunk_size )
+	{
+		chunk_size = buffer_size / FCRYPTO_BENCH_MAXIMUM_NUMBER_OF_JOBS;
+	}
+	while( ( data_offset < buffer_size )
+	    && ( number_of_jobs < FCRYPTO_BENCH_MAXIMUM_NUMBER_OF_JOBS ) )
+	{
+		data_size = buffer_size - data_offset;
+
+		if( data_size > chunk_size )
+		{
+			data_size = chunk_size;
+		}
+		fcrypto_bench_job_results[ number_of_jobs ] = 0;
+
+		/* The job queue is large enough to contain all the jobs hence it cannot be full
+		 */
+		if( libfcrypto_job_queue_submit_crypt(
+		     job_queue,
+		     cipher,
+		     crypt_mode,
+		     fcrypto_bench_initialization_vector,
+		     block_size,
+		     &( input_data[ data_offset ] ),
+		     data_size,
+		     &( output_data[ data_offset ] ),
+		     data_size,
+		     &fcrypto_bench_job_completion_function,
+		     (intptr_t *) &( fcrypto_bench_job_results[ number_of_jobs ] ),
+		     &job_identifier,
+		     error ) != 1 )
+		{
+			libfcrypto_job_queue_wait(
+			 job_queue,
+			 NULL );
+
+			return( -1 );
+		}
+		data_offset    += data_size;
+		number_of_jobs += 1;
+	}
+	if( libfcrypto_job_queue_wait(
+	     job_queue,
+	     error ) != 1 )
+	{
+		return( -1 );
+	}
+	for( job_index = 0;
+	     job_index < number_of_jobs;
+	     job_index++ )
+	{
+		if( fcrypto_bench_job_results[ job_index ] != 1 )
+		{
+			return( -1 );
+		}
+	}
+	return( 1 );
+}
+
+/* Measures the cost of the key setup
+ * Returns 1 if successful or -1 on error
+ */
+int fcrypto_bench_measure_key_setup(
+     fcrypto_bench_algorithm_t *bench_algorithm,
+     size_t key_bit_size,
+     uint64_t minimum_time,
+     int *is_first_result,
+     libcerror_error_t **error )
+{
+	libfcrypto_cipher_t *cipher   = NULL;
+	uint64_t elapsed_cycles       = 0;
+	uint64_t elapsed_time         = 0;
+	uint64_t iteration            = 0;
+	uint64_t number_of_iterations = 1;
+	uint64_t start_cycles         = 0;
+	uint64_t start_time           = 0;
+
+	if( ( bench_algorithm == NULL )
+	 || ( is_first_result == NULL ) )
+	{
+		return( -1 );
+	}
+	if( libfcrypto_cipher_initialize(
+	     &cipher,
+	     bench_algorithm->algorithm,
+	     bench_algorithm->modes[ 0 ],
+	     error ) != 1 )
+	{
+		goto on_error;
+	}
+	/* Double the number of iterations until the measurement takes the minimum time
+	 */
+	do
+	{
+		start_time   = fcrypto_bench_get_time();
+		start_cycles = fcrypto_bench_get_cycles();
+
+		for( iteration = 0;
+		     iteration < number_of_iterations;
+		     iteration++ )
+		{
+			if( libfcrypto_cipher_set_key(
+			     cipher,
+			     fcrypto_bench_key,
+			     key_bit_size,
+			     error ) != 1 )
+			{
+				goto on_error;
+			}
+		}
+		elapsed_cycles = fcrypto_bench_get_cycles() - start_cycles;
+		elapsed_time   = fcrypto_bench_get_time() - start_time;
+
+		if( elapsed_time >= minimum_time )
+		{
+			break;
+		}
+		number_of_iterations *= 2;
+	}
+	while( elapsed_time < minimum_time );
+
+	if( libfcrypto_cipher_free(
+	     &cipher,
+	     error ) != 1 )
+	{
+		goto on_error;
+	}
+	fprintf( stdout, "%s\n    { \"algorithm\": \"%s\", \"key_bit_size\": %" PRIzu ", \"iterations\": %" PRIu64 ", ",
+	         ( *is_first_result != 0 ) ? "" : ",",
+	         bench_algorithm->name,
+	         key_bit_size,
+	         number_of_iterations );
+
+	fprintf( stdout, "\"nanoseconds_per_call\": %.3f, \"cycles_per_call\": ",
+	         (double) elapsed_time / (double) number_of_iterations );
+
+	fcrypto_bench_cycles_fprint(
+	 stdout,
+	 elapsed_cycles,
+	 (double) number_of_iterations );
+
+	fprintf( stdout, " }" );
+
+	*is_first_result = 0;
+
+	return( 1 );
+
+on_error:
+	if( cipher != NULL )
+	{
+		libfcrypto_cipher_free(
+		 &cipher,
+		 NULL );
+	}
+	return( -1 );
+}
+
+/* Measures the throughput and latency of (de/en)crypting a buffer
+ * Returns 1 if successful or -1 on error
+ */
+int fcrypto_bench_measure_crypt(
+     fcrypto_bench_algorithm_t *bench_algorithm,
+     int mode,
+     int crypt_mode,
+     size_t key_bit_size,
+     int cpu_level,
+     libfcrypto_thread_pool_t *thread_pool,
+     libfcrypto_job_queue_t *job_queue,
+     int number_of_threads,
+     uint8_t *input_data,
+     uint8_t *output_data,
+     size_t buffer_size,
+     uint64_t minimum_time,
+     int *is_first_result,
+     libcerror_error_t **error )
+{
+	libfcrypto_cipher_t *cipher   = NULL;
+	const char *direction         = NULL;
+	const char *kernel_suffix     = "";
+	uint64_t elapsed_cycles       = 0;
+	uint64_t elapsed_time         = 0;
+	uint64_t iteration            = 0;
+	uint64_t number_of_iterations = 1;
+	uint64_t start_cycles         = 0;
+	uint64_t start_time           = 0;
+	size_t block_size             = 0;
+
+	if( ( bench_algorithm == NULL )
+	 || ( is_first_result == NULL ) )
+	{
+		return( -1 );
+	}
+	/* The functions are selected by CPU level when the cipher is created
+	 */
+	if( libfcrypto_set_cpu_level(
+	     cpu_level,
+	     error ) != 1 )
+	{
+		goto on_error;
+	}
+	if( libfcrypto_cipher_initialize(
+	     &cipher,
+	     bench_algorithm->algorithm,
+	     mode,
+	     error ) != 1 )
+	{
+		goto on_error;
+	}
+	if( libfcrypto_cipher_set_key(
+	     cipher,
+	     fcrypto_bench_key,
+	     key_bit_size,
+	     error ) != 1 )
+	{
+		goto on_error;
+	}
+	if( libfcrypto_cipher_get_block_size(
+	     cipher,
+	     &block_size,
+	     error ) != 1 )
+	{
+		goto on_error;
+	}
+	if( thread_pool != NULL )
+	{
+		if( libfcrypto_cipher_set_thread_pool(
+		     cipher,
+		     thread_pool,
+		     FCRYPTO_BENCH_MINIMUM_CHUNK_SIZE,
+		     error ) != 1 )
+		{
+			goto on_error;
+		}
+	}
+	/* Double the number of iterations until the measurement takes the minimum time
+	 */
+	do
+	{
+		start_time   = fcrypto_bench_get_time();
+		start_cycles = fcrypto_bench_get_cycles();
+
+		for( iteration = 0;
+		     iteration < number_of_iterations;
+		     iteration++ )
+		{
+			if( job_queue != NULL )
+			{
+				if( fcrypto_bench_crypt_with_job_queue(
+				     job_queue,
+				     cipher,
+				     crypt_mode,
+				     block_size,
+				     input_data,
+				     output_data,
+				     buffer_size,
+				     error ) != 1 )
+				{
+					goto on_error;
+				}
+			}
+			else if( libfcrypto_cipher_crypt(
+			          cipher,
+			          crypt_mode,
+			          fcrypto_bench_initialization_vector,
+			          block_size,
+			          input_data,
+			          buffer_size,
+			          output_data,
+			          buffer_size,
+			          error ) != 1 )
+			{
+				goto on_error;
+			}
+		}
+		elapsed_cycles = fcrypto_bench_get_cycles() - start_cycles;
+		elapsed_time   = fcrypto_bench_get_time() - start_time;
+
+		if( elapsed_time >= minimum_time )
+		{
+			break;
+		}
+		number_of_iterations *= 2;
+	}
+	while( elapsed_time < minimum_time );
+
+	if( libfcrypto_cipher_free(
+	     &cipher,
+	     error ) != 1 )
+	{
+		goto on_error;
+	}
+	/* CTR and stream modes use the same function to decrypt and encrypt
+	 */
+	if( ( mode == LIBFCRYPTO_CIPHER_MODE_CTR )
+	 || ( mode == LIBFCRYPTO_CIPHER_MODE_STREAM ) )
+	{
+		direction = "crypt";
+	}
+	else if( crypt_mode == LIBFCRYPTO_CRYPT_MODE_DECRYPT )
+	{
+		direction = "decrypt";
+	}
+	else
+	{
+		direction = "encrypt";
+	}
+	if( thread_pool != NULL )
+	{
+		kernel_suffix = "_threaded";
+	}
+	else if( job_queue != NULL )
+	{
+		kernel_suffix = "_job_queue";
+	}
+	if( elapsed_time == 0 )
+	{
+		elapsed_time = 1;
+	}
+	fprintf( stdout, "%s\n    { \"algorithm\": \"%s\", \"mode\": \"%s\", \"direction\": \"%s\", \"key_bit_size\": %" PRIzu ", ",
+	         ( *is_first_result != 0 ) ? "" : ",",
+	         bench_algorithm->name,
+	         fcrypto_bench_get_mode_name(
+	          mode ),
+	         direction,
+	         key_bit_size );
+
+	fprintf( stdout, "\"kernel\": \"%s%s\", \"threads\": %d, \"buffer_size\": %" PRIzu ", \"iterations\": %" PRIu64 ", ",
+	         fcrypto_bench_cpu_level_names[ cpu_level ],
+	         kernel_suffix,
+	         number_of_threads,
+	         buffer_size,
+	         number_of_iterations );
+
+	fprintf( stdout, "\"megabytes_per_second\": %.3f, \"nanoseconds_per_call\": %.3f, \"cycles_per_byte\": ",
+	         ( (double) buffer_size * (double) number_of_iterations * 1000.0 ) / (double) elapsed_time,
+	         (double) elapsed_time / (double) number_of_iterations );
+
+	fcrypto_bench_cycles_fprint(
+	 stdout,
+	 elapsed_cycles,
+	 (double) buffer_size * (double) number_of_iterations );
+
+	fprintf( stdout, " }" );
+
+	*is_first_result = 0;
+
+	return( 1 );
+
+on_error:
+	if( cipher != NULL )
+	{
+		libfcrypto_cipher_free(
+		 &cipher,
+		 NULL );
+	}
+	return( -1 );
+}
+
+/* Measures all the buffer sizes, (de/en)crypt modes and kernels of an algorithm, mode and key size
+ * Returns 1 if successful or -1 on error
+ */
+int fcrypto_bench_measure_mode(
+     fcrypto_bench_algorithm_t *bench_algorithm,
+     int mode,
+     size_t key_bit_size,
+     int minimum_cpu_level,
+     int maximum_cpu_level,
+     libfcrypto_thread_pool_t *thread_pool,
+     libfcrypto_job_queue_t *job_queue,
+     int number_of_threads,
+     uint8_t *input_data,
+     uint8_t *output_data,
+     size_t maximum_buffer_size,
+     uint64_t minimum_time,
+     int *is_first_result,
+     libcerror_error_t **error )
+{
+	size_t buffer_size        = 0;
+	int cpu_level             = 0;
+	int crypt_mode            = 0;
+	int crypt_mode_index      = 0;
+	int number_of_crypt_modes = 2;
+
+	/* CTR and stream modes use the same function to decrypt and encrypt
+	 */
+	if( ( mode == LIBFCRYPTO_CIPHER_MODE_CTR )
+	 || ( mode == LIBFCRYPTO_CIPHER_MODE_STREAM ) )
+	{
+		number_of_crypt_modes = 1;
+	}
+	for( crypt_mode_index = 0;
+	     crypt_mode_index < number_of_crypt_modes;
+	     crypt_mode_index++ )
+	{
+		if( crypt_mode_index == 0 )
+		{
+			crypt_mode = LIBFCRYPTO_CRYPT_MODE_ENCRYPT;
+		}
+		else
+		{
+			crypt_mode = LIBFCRYPTO_CRYPT_MODE_DECRYPT;
+		}
+		for( buffer_size = FCRYPTO_BENCH_MINIMUM_BUFFER_SIZE;
+		     buffer_size <= maximum_buffer_size;
+		     buffer_size *= 4 )
+		{
+			for( cpu_level = minimum_cpu_level;
+			     cpu_level <= maximum_cpu_level;
+			     cpu_level++ )
+			{
+				if( fcrypto_bench_measure_crypt(
+				     bench_algorithm,
+				     mode,
+				     crypt_mode,
+				     key_bit_size,
+				     cpu_level,
+				     NULL,
+				     NULL,
+				     0,
+				     input_data,
+				     output_data,
+				     buffer_size,
+				     minimum_time,
+				     is_first_result,
+				     error ) != 1 )
+				{
+					return( -1 );
+				}
+			}
+			/* The RC4 stream cipher cannot be (de/en)crypted in parallel
+			 */
+			if( mode == LIBFCRYPTO_CIPHER_MODE_STREAM )
+			{
+				continue;
+			}
+			if( thread_pool != NULL )
+			{
+				if( fcrypto_bench_measure_crypt(
+				     bench_algorithm,
+				     mode,
+				     crypt_mode,
+				     key_bit_size,
+				     maximum_cpu_level,
+				     thread_pool,
+				     NULL,
+				     number_of_threads,
+				     input_data,
+				     output_data,
+				     buffer_size,
+				     minimum_time,
+				     is_first_result,
+				     error ) != 1 )
+				{
+					return( -1 );
+				}
+			}
+			if( job_queue != NULL )
+			{
+				if( fcrypto_bench_measure_crypt(
+				     bench_algorithm,
+				     mode,
+				     crypt_mode,
+				     key_bit_size,
+				     maximum_cpu_level,
+				     NULL,
+				     job_queue,
+				     number_of_threads,
+				     input_data,
+				     output_data,
+				     buffer_size,
+				     minimum_time,
+				     is_first_result,
+				     error ) != 1 )
+				{
+					return( -1 );
+				}
+			}
+		}
+	}
+	return( 1 );
+}
+
+/* Measures the throughput and latency of (de/en)crypting a buffer using a specific function
+ * Returns 1 if successful or -1 on error
+ */
+int fcrypto_bench_measure_function(
+     fcrypto_bench_algorithm_t *bench_algorithm,
+     fcrypto_bench_function_t *bench_function,
+     int crypt_mode,
+     size_t key_bit_size,
+     int cpu_level,
+     libfcrypto_thread_pool_t *thread_pool,
+     int number_of_threads,
+     uint8_t *input_data,
+     uint8_t *output_data,
+     size_t buffer_size,
+     uint64_t minimum_time,
+     int *is_first_result,
+     libcerror_error_t **error )
+{
+	const uint8_t *stream_initialization_vectors[ FCRYPTO_BENCH_NUMBER_OF_STREAMS ];
+	const uint8_t *stream_input_data[ FCRYPTO_BENCH_NUMBER_OF_STREAMS ];
+	const uint8_t *stream_keys[ FCRYPTO_BENCH_NUMBER_OF_STREAMS ];
+	size_t stream_data_sizes[ FCRYPTO_BENCH_NUMBER_OF_STREAMS ];
+	size_t stream_key_bit_sizes[ FCRYPTO_BENCH_NUMBER_OF_STREAMS ];
+	uint8_t *stream_output_data[ FCRYPTO_BENCH_NUMBER_OF_STREAMS ];
+
+	libfcrypto_cipher_t *cipher                         = NULL;
+	libfcrypto_serpent_context_t *serpent_context       = NULL;
+	libfcrypto_serpent_context_t *serpent_tweak_context = NULL;
+	const char *direction                               = NULL;
+	uint8_t *block_keys                                 = NULL;
+	uint64_t elapsed_cycles                             = 0;
+	uint64_t elapsed_time                               = 0;
+	uint64_t iteration                                  = 0;
+	uint64_t number_of_iterations                       = 1;
+	uint64_t start_cycles                               = 0;
+	uint64_t start_time                                 = 0;
+	size_t block_keys_size                              = 0;
+	size_t block_size                                   = 0;
+	size_t data_offset                                  = 0;
+	size_t key_byte_size                                = 0;
+	int result                                          = 0;
+	int stream_index                                    = 0;
+
+	if( ( bench_algorithm == NULL )
+	 || ( bench_function == NULL )
+	 || ( is_first_result == NULL ) )
+	{
+		return( -1 );
+	}
+	/* The functions are selected by CPU level when the cipher or context is created
+	 */
+	if( libfcrypto_set_cpu_level(
+	     cpu_level,
+	     error ) != 1 )
+	{
+		goto on_error;
+	}
+	switch( bench_function->function )
+	{
+		case FCRYPTO_BENCH_FUNCTION_CIPHER_CRYPT_CBC_DATA_UNITS:
+		case FCRYPTO_BENCH_FUNCTION_CIPHER_CRYPT_CBC_MULTIPLE:
+			if( libfcrypto_cipher_initialize(
+			     &cipher,
+			     bench_algorithm->algorithm,
+			     LIBFCRYPTO_CIPHER_MODE_CBC,
+			     error ) != 1 )
+			{
+				goto on_error;
+			}
+			if( libfcrypto_cipher_set_key(
+			     cipher,
+			     fcrypto_bench_key,
+			     key_bit_size,
+			     error ) != 1 )
+			{
+				goto on_error;
+			}
+			if( libfcrypto_cipher_get_block_size(
+			     cipher,
+			     &block_size,
+			     error ) != 1 )
+			{
+				goto on_error;
+			}
+			if( thread_pool != NULL )
+			{
+				if( libfcrypto_cipher_set_thread_pool(
+				     cipher,
+				     thread_pool,
+				     FCRYPTO_BENCH_MINIMUM_CHUNK_SIZE,
+				     error ) != 1 )
+				{
+					goto on_error;
+				}
+			}
+			break;
+
+		case FCRYPTO_BENCH_FUNCTION_RC4_CRYPT_WITH_BLOCK_KEYS:
+			/* Every data unit uses its own key
+			 */
+			key_byte_size   = key_bit_size / 8;
+			block_keys_size = ( buffer_size / FCRYPTO_BENCH_DATA_UNIT_SIZE ) * key_byte_size;
+
+			block_keys = (uint8_t *) memory_allocate(
+			                          block_keys_size );
+
+			if( block_keys == NULL )
+			{
+				goto on_error;
+			}
+			for( data_offset = 0;
+			     data_offset < block_keys_size;
+			     data_offset++ )
+			{
+				block_keys[ data_offset ] = fcrypto_bench_key[ data_offset % key_byte_size ] ^ (uint8_t) ( data_offset / key_byte_size );
+			}
+			break;
+
+		case FCRYPTO_BENCH_FUNCTION_SERPENT_CRYPT_XTS:
+		case FCRYPTO_BENCH_FUNCTION_SERPENT_CRYPT_XTS_DATA_UNITS:
+			if( libfcrypto_serpent_context_initialize(
+			     &serpent_context,
+			     error ) != 1 )
+			{
+				goto on_error;
+			}
+			if( libfcrypto_serpent_context_set_key(
+			     serpent_context,
+			     fcrypto_bench_key,
+			     key_bit_size,
+			     error ) != 1 )
+			{
+				goto on_error;
+			}
+			if( libfcrypto_serpent_context_initialize(
+			     &serpent_tweak_context,
+			     error ) != 1 )
+			{
+				goto on_error;
+			}
+			if( libfcrypto_serpent_context_set_key(
+			     serpent_tweak_context,
+			     &( fcrypto_bench_key[ 24 ] ),
+			     key_bit_size,
+			     error ) != 1 )
+			{
+				goto on_error;
+			}
+			break;
+
+		default:
+			break;
+	}
+	/* The multiple stream functions (de/en)crypt the buffer as equally sized streams
+	 */
+	for( stream_index = 0;
+	     stream_index < FCRYPTO_BENCH_NUMBER_OF_STREAMS;
+	     stream_index++ )
+	{
+		data_offset = ( buffer_size / FCRYPTO_BENCH_NUMBER_OF_STREAMS ) * stream_index;
+
+		stream_initialization_vectors[ stream_index ] = fcrypto_bench_initialization_vector;
+		stream_keys[ stream_index ]                   = fcrypto_bench_key;
+		stream_key_bit_sizes[ stream_index ]          = key_bit_size;
+		stream_input_data[ stream_index ]             = &( input_data[ data_offset ] );
+		stream_output_data[ stream_index ]            = &( output_data[ data_offset ] );
+		stream_data_sizes[ stream_index ]             = buffer_size / FCRYPTO_BENCH_NUMBER_OF_STREAMS;
+	}
+	/* Double the number of iterations until the measurement takes the minimum time
+	 */
+	do
+	{
+		start_time   = fcrypto_bench_get_time();
+		start_cycles = fcrypto_bench_get_cycles();
+
+		for( iteration = 0;
+		     iteration < number_of_iterations;
+		     iteration++ )
+		{
+			switch( bench_function->function )
+			{
+				case FCRYPTO_BENCH_FUNCTION_CIPHER_CRYPT_CBC_DATA_UNITS:
+					result = libfcrypto_cipher_crypt_cbc_data_units(
+					          cipher,
+					          crypt_mode,
+					          0,
+					          FCRYPTO_BENCH_DATA_UNIT_SIZE,
+					          NULL,
+					          0,
+					          &fcrypto_bench_initialization_vector_function,
+					          NULL,
+					          input_data,
+					          buffer_size,
+					          output_data,
+					          buffer_size,
+					          error );
+					break;
+
+				case FCRYPTO_BENCH_FUNCTION_CIPHER_CRYPT_CBC_MULTIPLE:
+					result = libfcrypto_cipher_crypt_cbc_multiple(
+					          cipher,
+					          crypt_mode,
+					          stream_initialization_vectors,
+					          block_size,
+					          stream_input_data,
+					          stream_data_sizes,
+					          stream_output_data,
+					          stream_data_sizes,
+					          FCRYPTO_BENCH_NUMBER_OF_STREAMS,
+					          error );
+					break;
+
+				case FCRYPTO_BENCH_FUNCTION_RC4_CRYPT_MULTIPLE:
+					result = libfcrypto_rc4_crypt_multiple(
+					          stream_keys,
+					          stream_key_bit_sizes,
+					          stream_input_data,
+					          stream_data_sizes,
+					          stream_output_data,
+					          stream_data_sizes,
+					          FCRYPTO_BENCH_NUMBER_OF_STREAMS,
+					          error );
+					break;
+
+				case FCRYPTO_BENCH_FUNCTION_RC4_CRYPT_WITH_BLOCK_KEYS:
+					result = libfcrypto_rc4_crypt_with_block_keys(
+					          block_keys,
+					          block_keys_size,
+					          key_bit_size,
+					          FCRYPTO_BENCH_DATA_UNIT_SIZE,
+					          input_data,
+					          buffer_size,
+					          output_data,
+					          buffer_size,
+					          error );
+					break;
+
+				case FCRYPTO_BENCH_FUNCTION_SERPENT_CRYPT_XTS:
+					result = libfcrypto_serpent_crypt_xts(
+					          serpent_context,
+					          serpent_tweak_context,
+					          crypt_mode,
+					          0,
+					          input_data,
+					          buffer_size,
+					          output_data,
+					          buffer_size,
+					          error );
+					break;
+
+				case FCRYPTO_BENCH_FUNCTION_SERPENT_CRYPT_XTS_DATA_UNITS:
+					result = libfcrypto_serpent_crypt_xts_data_units(
+					          serpent_context,
+					          serpent_tweak_context,
+					          crypt_mode,
+					          0,
+					          FCRYPTO_BENCH_DATA_UNIT_SIZE,
+					          input_data,
+					          buffer_size,
+					          output_data,
+					          buffer_size,
+					          error );
+					break;
+
+				default:
+					result = -1;
+					break;
+			}
+			if( result != 1 )
+			{
+				goto on_error;
+			}
+		}
+		elapsed_cycles = fcrypto_bench_get_cycles() - start_cycles;
+		elapsed_time   = fcrypto_bench_get_time() - start_time;
+
+		if( elapsed_time >= minimum_time )
+		{
+			break;
+		}
+		number_of_iterations *= 2;
+	}
+	while( elapsed_time < minimum_time );
+
+	if( serpent_tweak_context != NULL )
+	{
+		if( libfcrypto_serpent_context_free(
+		     &serpent_tweak_context,
+		     error ) != 1 )
+		{
+			goto on_error;
+		}
+	}
+	if( serpent_context != NULL )
+	{
+		if( libfcrypto_serpent_context_free(
+		     &serpent_context,
+		     error ) != 1 )
+		{
+			goto on_error;
+		}
+	}
+	if( cipher != NULL )
+	{
+		if( libfcrypto_cipher_free(
+		     &cipher,
+		     error ) != 1 )
+		{
+			goto on_error;
+		}
+	}
+	if( block_keys != NULL )
+	{
+		memory_free(
+		 block_keys );
+
+		block_keys = NULL;
+	}
+	/* The RC4 functions use the same function to decrypt and encrypt
+	 */
+	if( bench_function->number_of_crypt_modes == 1 )
+	{
+		direction = "crypt";
+	}
+	else if( crypt_mode == LIBFCRYPTO_CRYPT_MODE_DECRYPT )
+	{
+		direction = "decrypt";
+	}
+	else
+	{
+		direction = "encrypt";
+	}
+	if( elapsed_time == 0 )
+	{
+		elapsed_time = 1;
+	}
+	fprintf( stdout, "%s\n    { \"function\": \"%s\", \"algorithm\": \"%s\", \"direction\": \"%s\", \"key_bit_size\": %" PRIzu ", ",
+	         ( *is_first_result != 0 ) ? "" : ",",
+	         bench_function->name,
+	         bench_algorithm->name,
+	         direction,
+	         key_bit_size );
+
+	fprintf( stdout, "\"kernel\": \"%s%s\", \"threads\": %d, \"buffer_size\": %" PRIzu ", \"iterations\": %" PRIu64 ", ",
+	         fcrypto_bench_cpu_level_names[ cpu_level ],
+	         ( thread_pool != NULL ) ? "_threaded" : "",
+	         number_of_threads,
+	         buffer_size,
+	         number_of_iterations );
+
+	fprintf( stdout, "\"megabytes_per_second\": %.3f, \"nanoseconds_per_call\": %.3f, \"cycles_per_byte\": ",
+	         ( (double) buffer_size * (double) number_of_iterations * 1000.0 ) / (double) elapsed_time,
+	         (double) elapsed_time / (double) number_of_iterations );
+
+	fcrypto_bench_cycles_fprint(
+	 stdout,
+	 elapsed_cycles,
+	 (double) buffer_size * (double) number_of_iterations );
+
+	fprintf( stdout, " }" );
+
+	*is_first_result = 0;
+
+	return( 1 );
+
+on_error:
+	if( serpent_tweak_context != NULL )
+	{
+		libfcrypto_serpent_context_free(
+		 &serpent_tweak_context,
+		 NULL );
+	}
+	if( serpent_context != NULL )
+	{
+		libfcrypto_serpent_context_free(
+		 &serpent_context,
+		 NULL );
+	}
+	if( cipher != NULL )
+	{
+		libfcrypto_cipher_free(
+		 &cipher,
+		 NULL );
+	}
+	if( block_keys != NULL )
+	{
+		memory_free(
+		 block_keys );
+	}
+	return( -1 );
+}
+
+/* Measures all the buffer sizes, (de/en)crypt modes and kernels of the functions of an algorithm and key size
+ * Returns 1 if successful or -1 on error
+ */
+int fcrypto_bench_measure_functions(
+     fcrypto_bench_algorithm_t *bench_algorithm,
+     size_t key_bit_size,
+     int minimum_cpu_level,
+     int maximum_cpu_level,
+     libfcrypto_thread_pool_t *thread_pool,
+     int number_of_threads,
+     uint8_t *input_data,
+     uint8_t *output_data,
+     size_t maximum_buffer_size,
+     uint64_t minimum_time,
+     int *is_first_result,
+     libcerror_error_t **error )
+{
+	fcrypto_bench_function_t *bench_function = NULL;
+	size_t buffer_size                       = 0;
+	int cpu_level                            = 0;
+	int crypt_mode                           = 0;
+	int crypt_mode_index                     = 0;
+	int function_index                       = 0;
+
+	if( bench_algorithm == NULL )
+	{
+		return( -1 );
+	}
+	for( function_index = 0;
+	     function_index < 10;
+	     function_index++ )
+	{
+		bench_function = &( fcrypto_bench_functions[ function_index ] );
+
+		if( bench_function->algorithm != bench_algorithm->algorithm )
+		{
+			continue;
+		}
+		for( crypt_mode_index = 0;
+		     crypt_mode_index < bench_function->number_of_crypt_modes;
+		     crypt_mode_index++ )
+		{
+			if( crypt_mode_index == 0 )
+			{
+				crypt_mode = LIBFCRYPTO_CRYPT_MODE_ENCRYPT;
+			}
+			else
+			{
+				crypt_mode = LIBFCRYPTO_CRYPT_MODE_DECRYPT;
+			}
+			for( buffer_size = FCRYPTO_BENCH_MINIMUM_BUFFER_SIZE;
+			     buffer_size <= maximum_buffer_size;
+			     buffer_size *= 4 )
+			{
+				if( buffer_size < bench_function->minimum_buffer_size )
+				{
+					continue;
+				}
+				for( cpu_level = minimum_cpu_level;
+				     cpu_level <= maximum_cpu_level;
+				     cpu_level++ )
+				{
+					if( fcrypto_bench_measure_function(
+					     bench_algorithm,
+					     bench_function,
+					     crypt_mode,
+					     key_bit_size,
+					     cpu_level,
+					     NULL,
+					     0,
+					     input_data,
+					     output_data,
+					     buffer_size,
+					     minimum_time,
+					     is_first_result,
+					     error ) != 1 )
+					{
+						return( -1 );
+					}
+				}
+				if( ( thread_pool != NULL )
+				 && ( bench_function->uses_thread_pool != 0 ) )
+				{
+					if( fcrypto_bench_measure_function(
+					     bench_algorithm,
+					     bench_function,
+					     crypt_mode,
+					     key_bit_size,
+					     maximum_cpu_level,
+					     thread_pool,
+					     number_of_threads,
+					     input_data,
+					     output_data,
+					     buffer_size,
+					     minimum_time,
+					     is_first_result,
+					     error ) != 1 )
+					{
+						return( -1 );
+					}
+				}
+			}
+		}
+	}
+	return( 1 );
+}
+
+/* The main program
+ */
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+int wmain(
+     int argc,
+     wchar_t * const argv[] )
+#else
+int main(
+     int argc,
+     char * const argv[] )
+#endif
+{
+	fcrypto_bench_algorithm_t *bench_algorithm = NULL;
+	libcerror_error_t *error                   = NULL;
+	libfcrypto_job_queue_t *job_queue          = NULL;
+	libfcrypto_thread_pool_t *thread_pool      = NULL;
+	const system_character_t *algorithm_name   = NULL;
+	uint8_t *input_data                        = NULL;
+	uint8_t *output_data                       = NULL;
+	uint64_t maximum_buffer_size               = FCRYPTO_BENCH_DEFAULT_MAXIMUM_BUFFER_SIZE;
+	uint64_t minimum_time                      = FCRYPTO_BENCH_DEFAULT_MINIMUM_TIME;
+	uint64_t value_64bit                       = 0;
+	size_t data_offset                         = 0;
+	int algorithm_index                        = 0;
+	int argument_index                         = 0;
+	int cpu_level                              = 0;
+	int default_cpu_level                      = 0;
+	int is_first_result                        = 1;
+	int key_index                              = 0;
+	int maximum_cpu_level                      = 0;
+	int minimum_cpu_level                      = 0;
+	int mode_index                             = 0;
+	int number_of_threads                      = -1;
+
+	if( libfcrypto_get_supported_cpu_level(
+	     &maximum_cpu_level,
+	     &error ) != 1 )
+	{
+		fprintf(
+		 stderr,
+		 "Unable to retrieve supported CPU level.\n" );
+
+		goto on_error;
+	}
+	if( libfcrypto_get_cpu_level(
+	     &default_cpu_level,
+	     &error ) != 1 )
+	{
+		fprintf(
+		 stderr,
+		 "Unable to retrieve CPU level.\n" );
+
+		goto on_error;
+	}
+	for( argument_index = 1;
+	     argument_index < argc;
+	     argument_index++ )
+	{
+		if( fcrypto_bench_string_matches_name(
+		     argv[ argument_index ],
+		     "-h" ) != 0 )
+		{
+			fcrypto_bench_usage_fprint(
+			 stdout );
+
+			return( EXIT_SUCCESS );
+		}
+		if( ( argument_index + 1 ) >= argc )
+		{
+			fcrypto_bench_usage_fprint(
+			 stderr );
+
+			return( EXIT_FAILURE );
+		}
+		if( fcrypto_bench_string_matches_name(
+		     argv[ argument_index ],
+		     "-a" ) != 0 )
+		{
+			algorithm_name = argv[ ++argument_index ];
+		}
+		else if( fcrypto_bench_string_matches_name(
+		          argv[ argument_index ],
+		          "-c" ) != 0 )
+		{
+			argument_index++;
+
+			for( cpu_level = LIBFCRYPTO_CPU_LEVEL_SCALAR;
+			     cpu_level <= LIBFCRYPTO_CPU_LEVEL_AVX512;
+			     cpu_level++ )
+			{
+				if( fcrypto_bench_string_matches_name(
+				     argv[ argument_index ],
+				     fcrypto_bench_cpu_level_names[ cpu_level ] ) != 0 )
+				{
+					break;
+				}
+			}
+			if( cpu_level > maximum_cpu_level )
+			{
+				fprintf(
+				 stderr,
+				 "Unsupported CPU level.\n" );
+
+				return( EXIT_FAILURE );
+			}
+			minimum_cpu_level = cpu_level;
+			maximum_cpu_level = cpu_level;
+		}
+		else if( fcrypto_bench_string_matches_name(
+		          argv[ argument_index ],
+		          "-j" ) != 0 )
+		{
+			if( ( fcrypto_bench_get_decimal_value(
+			       argv[ ++argument_index ],
+			       &value_64bit ) != 1 )
+			 || ( value_64bit > FCRYPTO_BENCH_MAXIMUM_NUMBER_OF_THREADS ) )
+			{
+				fprintf(
+				 stderr,
+				 "Invalid number of threads.\n" );
+
+				return( EXIT_FAILURE );
+			}
+			number_of_threads = (int) value_64bit;
+		}
+		else if( fcrypto_bench_string_matches_name(
+		          argv[ argument_index ],
+		          "-m" ) != 0 )
+		{
+			if( ( fcrypto_bench_get_decimal_value(
+			       argv[ ++argument_index ],
+			       &maximum_buffer_size ) != 1 )
+			 || ( maximum_buffer_size < FCRYPTO_BENCH_MINIMUM_BUFFER_SIZE )
+			 || ( maximum_buffer_size > (uint64_t) SSIZE_MAX ) )
+			{
+				fprintf(
+				 stderr,
+				 "Invalid maximum buffer size.\n" );
+
+				return( EXIT_FAILURE );
+			}
+		}
+		else if( fcrypto_bench_string_matches_name(
+		          argv[ argument_index ],
+		          "-t" ) != 0 )
+		{
+			if( ( fcrypto_bench_get_decimal_value(
+			       argv[ ++argument_index ],
+			       &minimum_time ) != 1 )
+			 || ( minimum_time > 3600000 ) )
+			{
+				fprintf(
+				 stderr,
+				 "Invalid minimum time.\n" );
+
+				return( EXIT_FAILURE );
+			}
+		}
+		else
+		{
+			fcrypto_bench_usage_fprint(
+			 stderr );
+
+			return( EXIT_FAILURE );
+		}
+	}
+	if( algorithm_name != NULL )
+	{
+		for( algorithm_index = 0;
+		     algorithm_index < 4;
+		     algorithm_index++ )
+		{
+			if( fcrypto_bench_string_matches_name(
+			     algorithm_name,
+			     fcrypto_bench_algorithms[ algorithm_index ].name ) != 0 )
+			{
+				break;
+			}
+		}
+		if( algorithm_index >= 4 )
+		{
+			fprintf(
+			 stderr,
+			 "Unsupported algorithm.\n" );
+
+			return( EXIT_FAILURE );
+		}
+	}
+	if( number_of_threads == -1 )
+	{
+		number_of_threads = 0;
+
+#if defined( HAVE_UNISTD_H ) && defined( _SC_NPROCESSORS_ONLN )
+		value_64bit = (uint64_t) sysconf(
+		                          _SC_NPROCESSORS_ONLN );
+
+		if( ( value_64bit > 1 )
+		 && ( value_64bit <= FCRYPTO_BENCH_MAXIMUM_NUMBER_OF_THREADS ) )
+		{
+			/* The calling thread also (de/en)crypts data
+			 */
+			number_of_threads = (int) value_64bit - 1;
+		}
+#endif
+	}
+	/* Round the maximum buffer size down to a power of 4 multiple of the minimum buffer size
+	 */
+	value_64bit = FCRYPTO_BENCH_MINIMUM_BUFFER_SIZE;
+
+	while( ( value_64bit * 4 ) <= maximum_buffer_size )
+	{
+		value_64bit *= 4;
+	}
+	maximum_buffer_size = value_64bit;
+
+	input_data = (uint8_t *) memory_allocate(
+	                          (size_t) maximum_buffer_size );
+
+	if( input_data == NULL )
+	{
+		fprintf(
+		 stderr,
+		 "Unable to create input data.\n" );
+
+		goto on_error;
+	}
+	output_data = (uint8_t *) memory_allocate(
+	                           (size_t) maximum_buffer_size );
+
+	if( output_data == NULL )
+	{
+		fprintf(
+		 stderr,
+		 "Unable to create output data.\n" );
+
+		goto on_error;
+	}
+	for( data_offset = 0;
+	     data_offset < (size_t) maximum_buffer_size;
+	     data_offset++ )
+	{
+		input_data[ data_offset ] = (uint8_t) ( ( data_offset * 13 ) + 5 );
+	}
+	if( number_of_threads > 0 )
+	{
+		if( libfcrypto_thread_pool_initialize(
+		     &thread_pool,
+		     number_of_threads,
+		     &error ) != 1 )
+		{
+			fprintf(
+			 stderr,
+			 "Unable to create thread pool.\n" );
+
+			goto on_error;
+		}
+		if( libfcrypto_thread_pool_get_number_of_threads(
+		     thread_pool,
+		     &number_of_threads,
+		     &error ) != 1 )
+		{
+			fprintf(
+			 stderr,
+			 "Unable to retrieve number of threads.\n" );
+
+			goto on_error;
+		}
+		/* Without multi-threading support the thread pool has no worker threads
+		 */
+		if( number_of_threads == 0 )
+		{
+			if( libfcrypto_thread_pool_free(
+			     &thread_pool,
+			     &error ) != 1 )
+			{
+				fprintf(
+				 stderr,
+				 "Unable to free thread pool.\n" );
+
+				goto on_error;
+			}
+		}
+		else if( libfcrypto_job_queue_initialize(
+		          &job_queue,
+		          number_of_threads,
+		          FCRYPTO_BENCH_MAXIMUM_NUMBER_OF_JOBS,
+		          &error ) != 1 )
+		{
+			fprintf(
+			 stderr,
+			 "Unable to create job queue.\n" );
+
+			goto on_error;
+		}
+	}
+	fprintf( stdout, "{\n  \"library_version\": \"%s\",\n", libfcrypto_get_version() );
+	fprintf( stdout, "  \"supported_cpu_level\": \"%s\",\n", fcrypto_bench_cpu_level_names[ maximum_cpu_level ] );
+	fprintf( stdout, "  \"number_of_threads\": %d,\n", number_of_threads );
+	fprintf( stdout, "  \"minimum_time_milliseconds\": %" PRIu64 ",\n", minimum_time );
+#if defined( FCRYPTO_BENCH_HAVE_RDTSC )
+	fprintf( stdout, "  \"cycles_source\": \"time_stamp_counter\",\n" );
+#else
+	fprintf( stdout, "  \"cycles_source\": null,\n" );
+#endif
+	fprintf( stdout, "  \"key_setup\": [" );
+
+	/* The measurements use nanoseconds
+	 */
+	minimum_time *= 1000000;
+
+	for( algorithm_index = 0;
+	     algorithm_index < 4;
+	     algorithm_index++ )
+	{
+		bench_algorithm = &( fcrypto_bench_algorithms[ algorithm_index ] );
+
+		if( ( algorithm_name != NULL )
+		 && ( fcrypto_bench_string_matches_name(
+		       algorithm_name,
+		       bench_algorithm->name ) == 0 ) )
+		{
+			continue;
+		}
+		for( key_index = 0;
+		     key_index < 3;
+		     key_index++ )
+		{
+			if( fcrypto_bench_measure_key_setup(
+			     bench_algorithm,
+			     bench_algorithm->key_bit_sizes[ key_index ],
+			     minimum_time,
+			     &is_first_result,
+			     &error ) != 1 )
+			{
+				fprintf(
+				 stderr,
+				 "Unable to measure key setup.\n" );
+
+				goto on_error;
+			}
+		}
+	}
+	fprintf( stdout, "\n  ],\n  \"throughput\": [" );
+
+	is_first_result = 1;
+
+	for( algorithm_index = 0;
+	     algorithm_index < 4;
+	     algorithm_index++ )
+	{
+		bench_algorithm = &( fcrypto_bench_algorithms[ algorithm_index ] );
+
+		if( ( algorithm_name != NULL )
+		 && ( fcrypto_bench_string_matches_name(
+		       algorithm_name,
+		       bench_algorithm->name ) == 0 ) )
+		{
+			continue;
+		}
+		for( mode_index = 0;
+		     mode_index < bench_algorithm->number_of_modes;
+		     mode_index++ )
+		{
+			for( key_index = 0;
+			     key_index < 3;
+			     key_index++ )
+			{
+				if( fcrypto_bench_measure_mode(
+				     bench_algorithm,
+				     bench_algorithm->modes[ mode_index ],
+				     bench_algorithm->key_bit_sizes[ key_index ],
+				     minimum_cpu_level,
+				     maximum_cpu_level,
+				     thread_pool,
+				     job_queue,
+				     number_of_threads,
+				     input_data,
+				     output_data,
+				     (size_t) maximum_buffer_size,
+				     minimum_time,
+				     &is_first_result,
+				     &error ) != 1 )
+				{
+					fprintf(
+					 stderr,
+					 "Unable to measure throughput.\n" );
+
+					goto on_error;
+				}
+			}
+		}
+	}
+	fprintf( stdout, "\n  ],\n  \"functions\": [" );
+
+	is_first_result = 1;
+
+	for( algorithm_index = 0;
+	     algorithm_index < 4;
+	     algorithm_index++ )
+	{
+		bench_algorithm = &( fcrypto_bench_algorithms[ algorithm_index ] );
+
+		if( ( algorithm_name != NULL )
+		 && ( fcrypto_bench_string_matches_name(
+		       algorithm_name,
+		       bench_algorithm->name ) == 0 ) )
+		{
+			continue;
+		}
+		for( key_index = 0;
+		     key_index < 3;
+		     key_index++ )
+		{
+			if( fcrypto_bench_measure_functions(
+			     bench_algorithm,
+			     bench_algorithm->key_bit_sizes[ key_index ],
+			     minimum_cpu_level,
+			     maximum_cpu_level,
+			     thread_pool,
+			     number_of_threads,
+			     input_data,
+			     output_data,
+			     (size_t) maximum_buffer_size,
+			     minimum_time,
+			     &is_first_result,
+			     &error ) != 1 )
+			{
+				fprintf(
+				 stderr,
+				 "Unable to measure functions.\n" );
+
+				goto on_error;
+			}
+		}
+	}
+	fprintf( stdout, "\n  ]\n}\n" );
+
+	if( libfcrypto_set_cpu_level(
+	     default_cpu_level,
+	     &error ) != 1 )
+	{
+		fprintf(
+		 stderr,
+		 "Unable to restore CPU level.\n" );
+
+		goto on_error;
+	}
+	if( job_queue != NULL )
+	{
+		if( libfcrypto_job_queue_free(
+		     &job_queue,
+		     &error ) != 1 )
+		{
+			fprintf(
+			 stderr,
+			 "Unable to free job queue.\n" );
+
+			goto on_error;
+		}
+	}
+	if( thread_pool != NULL )
+	{
+		if( libfcrypto_thread_pool_free(
+		     &thread_pool,
+		     &error ) != 1 )
+		{
+			fprintf(
+			 stderr,
+			 "Unable to free thread pool.\n" );
+
+			goto on_error;
+		}
+	}
+	memory_free(
+	 output_data );
+
+	memory_free(
+	 input_data );
+
+	return( EXIT_SUCCESS );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_backtrace_fprint(
+		 error,
+		 stderr );
+
+		libcerror_error_free(
+		 &error );
+	}
+	if( job_queue != NULL )
+	{
+		libfcrypto_job_queue_free(
+		 &job_queue,
+		 NULL );
+	}
+	if( thread_pool != NULL )
+	{
+		libfcrypto_thread_pool_free(
+		 &thread_pool,
+		 NULL );
+	}
+	if( output_data != NULL )
+	{
+		memory_free(
+		 output_data );
+	}
+	if( input_data != NULL )
+	{
+		memory_free(
+		 input_data );
+	}
+	return( EXIT_FAILURE );
+}
+
@@ -1222,35 +1222,1324 @@ on_error:
 	return( 0 );
 }
 
+/* Tests the libfcrypto_internal_blowfish_context_crypt_blocks function
+ * Returns 1 if successful or 0 if not
+ */
+int fcrypto_test_blowfish_context_crypt_blocks(
+     void )
+{
+	uint8_t key[ 5 ] = { 't', 'e', 's', 't', '1' };
+
+	uint8_t encrypted_data[ 96 ];
+	uint8_t expected_data[ 96 ];
+	uint8_t initialization_vector[ 8 ];
+	uint8_t input_data[ 96 ];
+	uint8_t output_data[ 96 ];
+
+	libcerror_error_t *error                        = NULL;
+	libfcrypto_blowfish_context_t *blowfish_context = NULL;
+	size_t data_offset                              = 0;
+	int result                                      = 0;
+	uint8_t byte_index                              = 0;
+
+	/* Initialize test
+	 */
+	for( data_offset = 0;
+	     data_offset < 96;
+	     data_offset++ )
+	{
+		input_data[ data_offset ] = (uint8_t) ( ( data_offset * 7 ) + 3 );
+	}
+	result = libfcrypto_blowfish_context_initialize(
+	          &blowfish_context,
+	          &error );
+
+	FCRYPTO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FCRYPTO_TEST_ASSERT_IS_NOT_NULL(
+	 "blowfish_context",
+	 blowfish_context );
+
+	FCRYPTO_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfcrypto_blowfish_context_set_key(
+	          blowfish_context,
+	          key,
+	          40,
+	          &error );
+
+	FCRYPTO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FCRYPTO_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test encrypting 12 blocks, which uses both the 8 and 4 block kernel
+	 */
+	for( data_offset = 0;
+	     data_offset < 96;
+	     data_offset += 8 )
+	{
+		result = libfcrypto_internal_blowfish_context_encrypt_block(
+		          (libfcrypto_internal_blowfish_context_t *) blowfish_context,
+		          &( input_data[ data_offset ] ),
+		          8,
+		          &( expected_data[ data_offset ] ),
+		          8,
+		          &error );
+
+		FCRYPTO_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		FCRYPTO_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+	}
+	result = libfcrypto_internal_blowfish_context_crypt_blocks(
+	          (libfcrypto_internal_blowfish_context_t *) blowfish_context,
+	          LIBFCRYPTO_BLOWFISH_CRYPT_MODE_ENCRYPT,
+	          NULL,
+	          input_data,
+	          96,
+	          encrypted_data,
+	          96,
+	          &error );
+
+	FCRYPTO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FCRYPTO_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = memory_compare(
+	          encrypted_data,
+	          expected_data,
+	          96 );
+
+	FCRYPTO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	/* Test decrypting 12 blocks
+	 */
+	result = libfcrypto_internal_blowfish_context_crypt_blocks(
+	          (libfcrypto_internal_blowfish_context_t *) blowfish_context,
+	          LIBFCRYPTO_BLOWFISH_CRYPT_MODE_DECRYPT,
+	          NULL,
+	          encrypted_data,
+	          96,
+	          output_data,
+	          96,
+	          &error );
+
+	FCRYPTO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FCRYPTO_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = memory_compare(
+	          output_data,
+	          input_data,
+	          96 );
+
+	FCRYPTO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	/* Test decrypting 12 blocks in-place using CBC
+	 */
+	for( byte_index = 0;
+	     byte_index < 8;
+	     byte_index++ )
+	{
+		initialization_vector[ byte_index ] = byte_index;
+	}
+	for( data_offset = 0;
+	     data_offset < 96;
+	     data_offset++ )
+	{
+		if( data_offset < 8 )
+		{
+			expected_data[ data_offset ] = input_data[ data_offset ] ^ initialization_vector[ data_offset ];
+		}
+		else
+		{
+			expected_data[ data_offset ] = input_data[ data_offset ] ^ encrypted_data[ data_offset - 8 ];
+		}
+	}
+	result = libfcrypto_internal_blowfish_context_crypt_blocks(
+	          (libfcrypto_internal_blowfish_context_t *) blowfish_context,
+	          LIBFCRYPTO_BLOWFISH_CRYPT_MODE_DECRYPT,
+	          initialization_vector,
+	          encrypted_data,
+	          96,
+	          encrypted_data,
+	          96,
+	          &error );
+
+	FCRYPTO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FCRYPTO_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = memory_compare(
+	          encrypted_data,
+	          expected_data,
+	          96 );
+
+	FCRYPTO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	/* The initialization vector is updated to the last encrypted block
+	 */
+	result = libfcrypto_internal_blowfish_context_encrypt_block(
+	          (libfcrypto_internal_blowfish_context_t *) blowfish_context,
+	          &( input_data[ 88 ] ),
+	          8,
+	          output_data,
+	          8,
+	          &error );
+
+	FCRYPTO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FCRYPTO_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = memory_compare(
+	          initialization_vector,
+	          output_data,
+	          8 );
+
+	FCRYPTO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	/* Test error cases
+	 */
+	result = libfcrypto_internal_blowfish_context_crypt_blocks(
+	          NULL,
+	          LIBFCRYPTO_BLOWFISH_CRYPT_MODE_ENCRYPT,
+	          NULL,
+	          input_data,
+	          96,
+	          output_data,
+	          96,
+	          &error );
+
+	FCRYPTO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FCRYPTO_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfcrypto_internal_blowfish_context_crypt_blocks(
+	          (libfcrypto_internal_blowfish_context_t *) blowfish_context,
+	          -1,
+	          NULL,
+	          input_data,
+	          96,
+	          output_data,
+	          96,
+	          &error );
+
+	FCRYPTO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FCRYPTO_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfcrypto_internal_blowfish_context_crypt_blocks(
+	          (libfcrypto_internal_blowfish_context_t *) blowfish_context,
+	          LIBFCRYPTO_BLOWFISH_CRYPT_MODE_ENCRYPT,
+	          initialization_vector,
+	          input_data,
+	          96,
+	          output_data,
+	          96,
+	          &error );
+
+	FCRYPTO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FCRYPTO_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfcrypto_internal_blowfish_context_crypt_blocks(
+	          (libfcrypto_internal_blowfish_context_t *) blowfish_context,
+	          LIBFCRYPTO_BLOWFISH_CRYPT_MODE_ENCRYPT,
+	          NULL,
+	          NULL,
+	          96,
+	          output_data,
+	          96,
+	          &error );
+
+	FCRYPTO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FCRYPTO_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfcrypto_internal_blowfish_context_crypt_blocks(
+	          (libfcrypto_internal_blowfish_context_t *) blowfish_context,
+	          LIBFCRYPTO_BLOWFISH_CRYPT_MODE_ENCRYPT,
+	          NULL,
+	          input_data,
+	          24,
+	          output_data,
+	          96,
+	          &error );
+
+	FCRYPTO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FCRYPTO_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfcrypto_internal_blowfish_context_crypt_blocks(
+	          (libfcrypto_internal_blowfish_context_t *) blowfish_context,
+	          LIBFCRYPTO_BLOWFISH_CRYPT_MODE_ENCRYPT,
+	          NULL,
+	          input_data,
+	          96,
+	          NULL,
+	          96,
+	          &error );
+
+	FCRYPTO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FCRYPTO_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfcrypto_internal_blowfish_context_crypt_blocks(
+	          (libfcrypto_internal_blowfish_context_t *) blowfish_context,
+	          LIBFCRYPTO_BLOWFISH_CRYPT_MODE_ENCRYPT,
+	          NULL,
+	          input_data,
+	          96,
+	          output_data,
+	          64,
+	          &error );
+
+	FCRYPTO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FCRYPTO_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libfcrypto_blowfish_context_free(
+	          &blowfish_context,
+	          &error );
+
+	FCRYPTO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FCRYPTO_TEST_ASSERT_IS_NULL(
+	 "blowfish_context",
+	 blowfish_context );
+
+	FCRYPTO_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( blowfish_context != NULL )
+	{
+		libfcrypto_blowfish_context_free(
+		 &blowfish_context,
+		 NULL );
+	}
+	return( 0 );
+}
+
+#if defined( LIBFCRYPTO_BLOWFISH_CONTEXT_HAVE_AVX2 )
+
+/* Tests the libfcrypto_internal_blowfish_context_crypt_blocks_avx2 function
+ * Returns 1 if successful or 0 if not
+ */
+int fcrypto_test_blowfish_context_crypt_blocks_avx2(
+     void )
+{
+	uint8_t key[ 5 ] = { 't', 'e', 's', 't', '1' };
+
+	uint8_t encrypted_data[ 192 ];
+	uint8_t expected_data[ 192 ];
+	uint8_t initialization_vector[ 8 ];
+	uint8_t input_data[ 192 ];
+	uint8_t output_data[ 192 ];
+
+	libcerror_error_t *error                        = NULL;
+	libfcrypto_blowfish_context_t *blowfish_context = NULL;
+	size_t data_offset                              = 0;
+	int result                                      = 0;
+	uint8_t byte_index                              = 0;
+
+	if( __builtin_cpu_supports( "avx2" ) == 0 )
+	{
+		return( 1 );
+	}
+	/* Initialize test
+	 */
+	for( data_offset = 0;
+	     data_offset < 192;
+	     data_offset++ )
+	{
+		input_data[ data_offset ] = (uint8_t) ( ( data_offset * 7 ) + 3 );
+	}
+	result = libfcrypto_blowfish_context_initialize(
+	          &blowfish_context,
+	          &error );
+
+	FCRYPTO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FCRYPTO_TEST_ASSERT_IS_NOT_NULL(
+	 "blowfish_context",
+	 blowfish_context );
+
+	FCRYPTO_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfcrypto_blowfish_context_set_key(
+	          blowfish_context,
+	          key,
+	          40,
+	          &error );
+
+	FCRYPTO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FCRYPTO_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test encrypting 24 blocks, which uses both 2 vectors and 1 vector of 8 blocks
+	 */
+	for( data_offset = 0;
+	     data_offset < 192;
+	     data_offset += 8 )
+	{
+		result = libfcrypto_internal_blowfish_context_encrypt_block(
+		          (libfcrypto_internal_blowfish_context_t *) blowfish_context,
+		          &( input_data[ data_offset ] ),
+		          8,
+		          &( expected_data[ data_offset ] ),
+		          8,
+		          &error );
+
+		FCRYPTO_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		FCRYPTO_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+	}
+	result = libfcrypto_internal_blowfish_context_crypt_blocks_avx2(
+	          (libfcrypto_internal_blowfish_context_t *) blowfish_context,
+	          LIBFCRYPTO_BLOWFISH_CRYPT_MODE_ENCRYPT,
+	          NULL,
+	          input_data,
+	          192,
+	          encrypted_data,
+	          192,
+	          &error );
+
+	FCRYPTO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FCRYPTO_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = memory_compare(
+	          encrypted_data,
+	          expected_data,
+	          192 );
+
+	FCRYPTO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	/* Test decrypting 24 blocks
+	 */
+	result = libfcrypto_internal_blowfish_context_crypt_blocks_avx2(
+	          (libfcrypto_internal_blowfish_context_t *) blowfish_context,
+	          LIBFCRYPTO_BLOWFISH_CRYPT_MODE_DECRYPT,
+	          NULL,
+	          encrypted_data,
+	          192,
+	          output_data,
+	          192,
+	          &error );
+
+	FCRYPTO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FCRYPTO_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = memory_compare(
+	          output_data,
+	          input_data,
+	          192 );
+
+	FCRYPTO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	/* Test decrypting 24 blocks in-place using CBC
+	 */
+	for( byte_index = 0;
+	     byte_index < 8;
+	     byte_index++ )
+	{
+		initialization_vector[ byte_index ] = byte_index;
+	}
+	for( data_offset = 0;
+	     data_offset < 192;
+	     data_offset++ )
+	{
+		if( data_offset < 8 )
+		{
+			expected_data[ data_offset ] = input_data[ data_offset ] ^ initialization_vector[ data_offset ];
+		}
+		else
+		{
+			expected_data[ data_offset ] = input_data[ data_offset ] ^ encrypted_data[ data_offset - 8 ];
+		}
+	}
+	result = libfcrypto_internal_blowfish_context_crypt_blocks_avx2(
+	          (libfcrypto_internal_blowfish_context_t *) blowfish_context,
+	          LIBFCRYPTO_BLOWFISH_CRYPT_MODE_DECRYPT,
+	          initialization_vector,
+	          encrypted_data,
+	          192,
+	          encrypted_data,
+	          192,
+	          &error );
+
+	FCRYPTO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FCRYPTO_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = memory_compare(
+	          encrypted_data,
+	          expected_data,
+	          192 );
+
+	FCRYPTO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	/* The initialization vector is updated to the last encrypted block
+	 */
+	result = libfcrypto_internal_blowfish_context_encrypt_block(
+	          (libfcrypto_internal_blowfish_context_t *) blowfish_context,
+	          &( input_data[ 184 ] ),
+	          8,
+	          output_data,
+	          8,
+	          &error );
+
+	FCRYPTO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FCRYPTO_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = memory_compare(
+	          initialization_vector,
+	          output_data,
+	          8 );
+
+	FCRYPTO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	/* Test error cases
+	 */
+	result = libfcrypto_internal_blowfish_context_crypt_blocks_avx2(
+	          NULL,
+	          LIBFCRYPTO_BLOWFISH_CRYPT_MODE_ENCRYPT,
+	          NULL,
+	          input_data,
+	          192,
+	          output_data,
+	          192,
+	          &error );
+
+	FCRYPTO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FCRYPTO_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfcrypto_internal_blowfish_context_crypt_blocks_avx2(
+	          (libfcrypto_internal_blowfish_context_t *) blowfish_context,
+	          -1,
+	          NULL,
+	          input_data,
+	          192,
+	          output_data,
+	          192,
+	          &error );
+
+	FCRYPTO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FCRYPTO_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfcrypto_internal_blowfish_context_crypt_blocks_avx2(
+	          (libfcrypto_internal_blowfish_context_t *) blowfish_context,
+	          LIBFCRYPTO_BLOWFISH_CRYPT_MODE_ENCRYPT,
+	          initialization_vector,
+	          input_data,
+	          192,
+	          output_data,
+	          192,
+	          &error );
+
+	FCRYPTO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FCRYPTO_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfcrypto_internal_blowfish_context_crypt_blocks_avx2(
+	          (libfcrypto_internal_blowfish_context_t *) blowfish_context,
+	          LIBFCRYPTO_BLOWFISH_CRYPT_MODE_ENCRYPT,
+	          NULL,
+	          NULL,
+	          192,
+	          output_data,
+	          192,
+	          &error );
+
+	FCRYPTO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FCRYPTO_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfcrypto_internal_blowfish_context_crypt_blocks_avx2(
+	          (libfcrypto_internal_blowfish_context_t *) blowfish_context,
+	          LIBFCRYPTO_BLOWFISH_CRYPT_MODE_ENCRYPT,
+	          NULL,
+	          input_data,
+	          96,
+	          output_data,
+	          192,
+	          &error );
+
+	FCRYPTO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FCRYPTO_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfcrypto_internal_blowfish_context_crypt_blocks_avx2(
+	          (libfcrypto_internal_blowfish_context_t *) blowfish_context,
+	          LIBFCRYPTO_BLOWFISH_CRYPT_MODE_ENCRYPT,
+	          NULL,
+	          input_data,
+	          192,
+	          NULL,
+	          192,
+	          &error );
+
+	FCRYPTO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FCRYPTO_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfcrypto_internal_blowfish_context_crypt_blocks_avx2(
+	          (libfcrypto_internal_blowfish_context_t *) blowfish_context,
+	          LIBFCRYPTO_BLOWFISH_CRYPT_MODE_ENCRYPT,
+	          NULL,
+	          input_data,
+	          192,
+	          output_data,
+	          128,
+	          &error );
+
+	FCRYPTO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FCRYPTO_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libfcrypto_blowfish_context_free(
+	          &blowfish_context,
+	          &error );
+
+	FCRYPTO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FCRYPTO_TEST_ASSERT_IS_NULL(
+	 "blowfish_context",
+	 blowfish_context );
+
+	FCRYPTO_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( blowfish_context != NULL )
+	{
+		libfcrypto_blowfish_context_free(
+		 &blowfish_context,
+		 NULL );
+	}
+	return( 0 );
+}
+
+#endif /* defined( LIBFCRYPTO_BLOWFISH_CONTEXT_HAVE_AVX2 ) */
+
 #endif /* if defined( __GNUC__ ) && !defined( LIBFCRYPTO_DLL_IMPORT ) */
 
-/* Tests the libfcrypto_blowfish_crypt_cbc function
+/* Tests the libfcrypto_blowfish_crypt_cbc function
+ * Returns 1 if successful or 0 if not
+ */
+int fcrypto_test_blowfish_crypt_cbc(
+     void )
+{
+	uint8_t key[ 16 ] = {
+		'T', 'h', 'i', 's', ' ', 'i', 's', ' ', 'a', ' ', 'k', 'e', 'y', '1', '2', '3' };
+
+	uint8_t encrypted_data[ 32 ] = {
+		'}', 0x00, 0x99, 0xd2, 0xab, 0x1c, 0xcd, 0x80, 'y', 0xef, 0x0b, 0x0f, 0xf7, '2', 'R', 'p',
+		0xbb, '\\', 'h', 0x06, 0xff, 0x07, 0x9a, 0xcf, 'E', '\r', 0x8d, 0x18, 0x90, 0x8e, 0xfe, 0xa3 };
+
+	uint8_t unencrypted_data[ 32 ] = {
+		'T', 'h', 'i', 's', ' ', 'i', 's', ' ', 's', 'e', 'c', 'r', 'e', 't', ' ', 'e',
+		'n', 'c', 'r', 'y', 'p', 't', 'e', 'd', ' ', 't', 'e', 'x', 't', '!', '!', '!' };
+
+	uint8_t initialization_vector[ 8 ] = { 'T' , 'h' , 'i' , 's' , ' ' , 'I' , 'V' , '!' };
+
+	uint8_t output_data[ 32 ];
+
+	libcerror_error_t *error                        = NULL;
+	libfcrypto_blowfish_context_t *blowfish_context = NULL;
+	int result                                      = 0;
+
+	/* Initialize test
+	 */
+	result = libfcrypto_blowfish_context_initialize(
+	          &blowfish_context,
+	          &error );
+
+	FCRYPTO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FCRYPTO_TEST_ASSERT_IS_NOT_NULL(
+	 "blowfish_context",
+	 blowfish_context );
+
+	FCRYPTO_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfcrypto_blowfish_context_set_key(
+	          blowfish_context,
+	          key,
+	          128,
+	          &error );
+
+	FCRYPTO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FCRYPTO_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test decrypting a buffer of data
+	 */
+	result = libfcrypto_blowfish_crypt_cbc(
+	          blowfish_context,
+	          LIBFCRYPTO_BLOWFISH_CRYPT_MODE_DECRYPT,
+	          initialization_vector,
+	          8,
+	          encrypted_data,
+	          32,
+	          output_data,
+	          32,
+	          &error );
+
+	FCRYPTO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FCRYPTO_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = memory_compare(
+	          output_data,
+	          unencrypted_data,
+	          32 );
+
+	FCRYPTO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	/* Test encrypting a buffer of data
+	 */
+	result = libfcrypto_blowfish_crypt_cbc(
+	          blowfish_context,
+	          LIBFCRYPTO_BLOWFISH_CRYPT_MODE_ENCRYPT,
+	          initialization_vector,
+	          8,
+	          unencrypted_data,
+	          32,
+	          output_data,
+	          32,
+	          &error );
+
+	FCRYPTO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FCRYPTO_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = memory_compare(
+	          output_data,
+	          encrypted_data,
+	          32 );
+
+	FCRYPTO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	/* Test decrypting a buffer of data in-place
+	 */
+	memory_copy(
+	 output_data,
+	 encrypted_data,
+	 32 );
+
+	result = libfcrypto_blowfish_crypt_cbc(
+	          blowfish_context,
+	          LIBFCRYPTO_BLOWFISH_CRYPT_MODE_DECRYPT,
+	          initialization_vector,
+	          8,
+	          output_data,
+	          32,
+	          output_data,
+	          32,
+	          &error );
+
+	FCRYPTO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FCRYPTO_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = memory_compare(
+	          output_data,
+	          unencrypted_data,
+	          32 );
+
+	FCRYPTO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	/* Test encrypting a buffer of data in-place
+	 */
+	result = libfcrypto_blowfish_crypt_cbc(
+	          blowfish_context,
+	          LIBFCRYPTO_BLOWFISH_CRYPT_MODE_ENCRYPT,
+	          initialization_vector,
+	          8,
+	          output_data,
+	          32,
+	          output_data,
+	          32,
+	          &error );
+
+	FCRYPTO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FCRYPTO_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = memory_compare(
+	          output_data,
+	          encrypted_data,
+	          32 );
+
+	FCRYPTO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	/* Test decrypting a buffer of data in-place that is smaller than the number
+	 * of blocks that are decrypted at once
+	 */
+	result = libfcrypto_blowfish_crypt_cbc(
+	          blowfish_context,
+	          LIBFCRYPTO_BLOWFISH_CRYPT_MODE_DECRYPT,
+	          initialization_vector,
+	          8,
+	          output_data,
+	          24,
+	          output_data,
+	          24,
+	          &error );
+
+	FCRYPTO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FCRYPTO_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = memory_compare(
+	          output_data,
+	          unencrypted_data,
+	          24 );
+
+	FCRYPTO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	/* Test error cases
+	 */
+	result = libfcrypto_blowfish_crypt_cbc(
+	          NULL,
+	          LIBFCRYPTO_BLOWFISH_CRYPT_MODE_DECRYPT,
+	          initialization_vector,
+	          8,
+	          encrypted_data,
+	          32,
+	          output_data,
+	          32,
+	          &error );
+
+	FCRYPTO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FCRYPTO_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfcrypto_blowfish_crypt_cbc(
+	          blowfish_context,
+	          -1,
+	          initialization_vector,
+	          8,
+	          encrypted_data,
+	          32,
+	          output_data,
+	          32,
+	          &error );
+
+	FCRYPTO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FCRYPTO_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfcrypto_blowfish_crypt_cbc(
+	          blowfish_context,
+	          LIBFCRYPTO_BLOWFISH_CRYPT_MODE_DECRYPT,
+	          NULL,
+	          8,
+	          encrypted_data,
+	          32,
+	          output_data,
+	          32,
+	          &error );
+
+	FCRYPTO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FCRYPTO_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfcrypto_blowfish_crypt_cbc(
+	          blowfish_context,
+	          LIBFCRYPTO_BLOWFISH_CRYPT_MODE_DECRYPT,
+	          initialization_vector,
+	          (size_t) SSIZE_MAX + 1,
+	          encrypted_data,
+	          32,
+	          output_data,
+	          32,
+	          &error );
+
+	FCRYPTO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FCRYPTO_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfcrypto_blowfish_crypt_cbc(
+	          blowfish_context,
+	          LIBFCRYPTO_BLOWFISH_CRYPT_MODE_DECRYPT,
+	          initialization_vector,
+	          8,
+	          NULL,
+	          32,
+	          output_data,
+	          32,
+	          &error );
+
+	FCRYPTO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FCRYPTO_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfcrypto_blowfish_crypt_cbc(
+	          blowfish_context,
+	          LIBFCRYPTO_BLOWFISH_CRYPT_MODE_DECRYPT,
+	          initialization_vector,
+	          8,
+	          encrypted_data,
+	          (size_t) SSIZE_MAX + 1,
+	          output_data,
+	          32,
+	          &error );
+
+	FCRYPTO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FCRYPTO_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfcrypto_blowfish_crypt_cbc(
+	          blowfish_context,
+	          LIBFCRYPTO_BLOWFISH_CRYPT_MODE_DECRYPT,
+	          initialization_vector,
+	          8,
+	          encrypted_data,
+	          32,
+	          NULL,
+	          32,
+	          &error );
+
+	FCRYPTO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FCRYPTO_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfcrypto_blowfish_crypt_cbc(
+	          blowfish_context,
+	          LIBFCRYPTO_BLOWFISH_CRYPT_MODE_DECRYPT,
+	          initialization_vector,
+	          8,
+	          encrypted_data,
+	          32,
+	          output_data,
+	          (size_t) SSIZE_MAX + 1,
+	          &error );
+
+	FCRYPTO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FCRYPTO_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libfcrypto_blowfish_context_free(
+	          &blowfish_context,
+	          &error );
+
+	FCRYPTO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FCRYPTO_TEST_ASSERT_IS_NULL(
+	 "blowfish_context",
+	 blowfish_context );
+
+	FCRYPTO_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( blowfish_context != NULL )
+	{
+		libfcrypto_blowfish_context_free(
+		 &blowfish_context,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libfcrypto_blowfish_crypt_ctr function
  * Returns 1 if successful or 0 if not
  */
-int fcrypto_test_blowfish_crypt_cbc(
+int fcrypto_test_blowfish_crypt_ctr(
      void )
 {
-	uint8_t key[ 16 ] = {
-		'T', 'h', 'i', 's', ' ', 'i', 's', ' ', 'a', ' ', 'k', 'e', 'y', '1', '2', '3' };
-
-	uint8_t encrypted_data[ 32 ] = {
-		'}', 0x00, 0x99, 0xd2, 0xab, 0x1c, 0xcd, 0x80, 'y', 0xef, 0x0b, 0x0f, 0xf7, '2', 'R', 'p',
-		0xbb, '\\', 'h', 0x06, 0xff, 0x07, 0x9a, 0xcf, 'E', '\r', 0x8d, 0x18, 0x90, 0x8e, 0xfe, 0xa3 };
-
-	uint8_t unencrypted_data[ 32 ] = {
-		'T', 'h', 'i', 's', ' ', 'i', 's', ' ', 's', 'e', 'c', 'r', 'e', 't', ' ', 'e',
-		'n', 'c', 'r', 'y', 'p', 't', 'e', 'd', ' ', 't', 'e', 'x', 't', '!', '!', '!' };
+	uint8_t initial_counter_block[ 8 ] = {
+		0x03, 0x14, 0x25, 0x36, 0x00, 0x00, 0xff, 0xf0 };
 
-	uint8_t initialization_vector[ 8 ] = { 'T' , 'h' , 'i' , 's' , ' ' , 'I' , 'V' , '!' };
+	uint8_t key[ 16 ] = {
+		0x07, 0x24, 0x41, 0x5e, 0x7b, 0x98, 0xb5, 0xd2, 0xef, 0x0c, 0x29, 0x46, 0x63, 0x80, 0x9d, 0xba };
 
-	uint8_t output_data[ 32 ];
+	uint8_t counter_blocks_data[ 3008 ];
+	uint8_t expected_output_data[ 3000 ];
+	uint8_t input_data[ 3000 ];
+	uint8_t output_data[ 3000 ];
 
 	libcerror_error_t *error                        = NULL;
 	libfcrypto_blowfish_context_t *blowfish_context = NULL;
+	size_t block_index                              = 0;
+	size_t byte_index                               = 0;
+	size_t data_offset                              = 0;
+	uint32_t counter_value                          = 0;
 	int result                                      = 0;
 
 	/* Initialize test
 	 */
+	for( data_offset = 0;
+	     data_offset < 3000;
+	     data_offset++ )
+	{
+		input_data[ data_offset ] = (uint8_t) ( ( data_offset * 13 ) + 5 );
+	}
 	result = libfcrypto_blowfish_context_initialize(
 	          &blowfish_context,
 	          &error );
@@ -1283,17 +2572,63 @@ int fcrypto_test_blowfish_crypt_cbc(
 	 "error",
 	 error );
 
-	/* Test decrypting a buffer of data
+	/* Calculate the expected output data using Blowfish-ECB with a 32-bit big-endian counter
+	 * that carries over into the third byte from the end of the counter block
 	 */
-	result = libfcrypto_blowfish_crypt_cbc(
+	for( block_index = 0;
+	     block_index < 376;
+	     block_index++ )
+	{
+		for( byte_index = 0;
+		     byte_index < 8;
+		     byte_index++ )
+		{
+			counter_blocks_data[ ( block_index * 8 ) + byte_index ] = initial_counter_block[ byte_index ];
+		}
+		counter_value = (uint32_t) ( 0x0000fff0UL + block_index );
+
+		counter_blocks_data[ ( block_index * 8 ) + 4 ] = (uint8_t) ( counter_value >> 24 );
+		counter_blocks_data[ ( block_index * 8 ) + 5 ] = (uint8_t) ( counter_value >> 16 );
+		counter_blocks_data[ ( block_index * 8 ) + 6 ] = (uint8_t) ( counter_value >> 8 );
+		counter_blocks_data[ ( block_index * 8 ) + 7 ] = (uint8_t) counter_value;
+	}
+	result = libfcrypto_blowfish_crypt_ecb(
 	          blowfish_context,
-	          LIBFCRYPTO_BLOWFISH_CRYPT_MODE_DECRYPT,
-	          initialization_vector,
+	          LIBFCRYPTO_BLOWFISH_CRYPT_MODE_ENCRYPT,
+	          counter_blocks_data,
+	          3008,
+	          counter_blocks_data,
+	          3008,
+	          &error );
+
+	FCRYPTO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FCRYPTO_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	for( data_offset = 0;
+	     data_offset < 3000;
+	     data_offset++ )
+	{
+		expected_output_data[ data_offset ] = input_data[ data_offset ] ^ counter_blocks_data[ data_offset ];
+	}
+	/* Test encrypting a buffer of data that spans multiple key stream buffers
+	 */
+	result = libfcrypto_blowfish_crypt_ctr(
+	          blowfish_context,
+	          initial_counter_block,
 	          8,
-	          encrypted_data,
-	          32,
+	          4,
+	          LIBFCRYPTO_ENDIAN_BIG,
+	          0,
+	          input_data,
+	          3000,
 	          output_data,
-	          32,
+	          3000,
 	          &error );
 
 	FCRYPTO_TEST_ASSERT_EQUAL_INT(
@@ -1307,25 +2642,27 @@ int fcrypto_test_blowfish_crypt_cbc(
 
 	result = memory_compare(
 	          output_data,
-	          unencrypted_data,
-	          32 );
+	          expected_output_data,
+	          3000 );
 
 	FCRYPTO_TEST_ASSERT_EQUAL_INT(
 	 "result",
 	 result,
 	 0 );
 
-	/* Test encrypting a buffer of data
+	/* Test decrypting the data
 	 */
-	result = libfcrypto_blowfish_crypt_cbc(
+	result = libfcrypto_blowfish_crypt_ctr(
 	          blowfish_context,
-	          LIBFCRYPTO_BLOWFISH_CRYPT_MODE_ENCRYPT,
-	          initialization_vector,
+	          initial_counter_block,
 	          8,
-	          unencrypted_data,
-	          32,
+	          4,
+	          LIBFCRYPTO_ENDIAN_BIG,
+	          0,
 	          output_data,
-	          32,
+	          3000,
+	          output_data,
+	          3000,
 	          &error );
 
 	FCRYPTO_TEST_ASSERT_EQUAL_INT(
@@ -1339,8 +2676,138 @@ int fcrypto_test_blowfish_crypt_cbc(
 
 	result = memory_compare(
 	          output_data,
-	          encrypted_data,
-	          32 );
+	          input_data,
+	          3000 );
+
+	FCRYPTO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	/* Test encrypting data at an offset that is not a multiple of the block size
+	 */
+	result = libfcrypto_blowfish_crypt_ctr(
+	          blowfish_context,
+	          initial_counter_block,
+	          8,
+	          4,
+	          LIBFCRYPTO_ENDIAN_BIG,
+	          1029,
+	          &( input_data[ 1029 ] ),
+	          1500,
+	          output_data,
+	          1500,
+	          &error );
+
+	FCRYPTO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FCRYPTO_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = memory_compare(
+	          output_data,
+	          &( expected_output_data[ 1029 ] ),
+	          1500 );
+
+	FCRYPTO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	/* Test encrypting data in-place
+	 */
+	for( data_offset = 0;
+	     data_offset < 3000;
+	     data_offset++ )
+	{
+		output_data[ data_offset ] = input_data[ data_offset ];
+	}
+	result = libfcrypto_blowfish_crypt_ctr(
+	          blowfish_context,
+	          initial_counter_block,
+	          8,
+	          4,
+	          LIBFCRYPTO_ENDIAN_BIG,
+	          0,
+	          output_data,
+	          3000,
+	          output_data,
+	          3000,
+	          &error );
+
+	FCRYPTO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FCRYPTO_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = memory_compare(
+	          output_data,
+	          expected_output_data,
+	          3000 );
+
+	FCRYPTO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	/* Test encrypting data with a little-endian counter at an offset
+	 */
+	result = libfcrypto_blowfish_crypt_ctr(
+	          blowfish_context,
+	          initial_counter_block,
+	          8,
+	          4,
+	          LIBFCRYPTO_ENDIAN_LITTLE,
+	          0,
+	          input_data,
+	          3000,
+	          expected_output_data,
+	          3000,
+	          &error );
+
+	FCRYPTO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FCRYPTO_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfcrypto_blowfish_crypt_ctr(
+	          blowfish_context,
+	          initial_counter_block,
+	          8,
+	          4,
+	          LIBFCRYPTO_ENDIAN_LITTLE,
+	          77,
+	          &( input_data[ 77 ] ),
+	          2000,
+	          output_data,
+	          2000,
+	          &error );
+
+	FCRYPTO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FCRYPTO_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = memory_compare(
+	          output_data,
+	          &( expected_output_data[ 77 ] ),
+	          2000 );
 
 	FCRYPTO_TEST_ASSERT_EQUAL_INT(
 	 "result",
@@ -1349,15 +2816,17 @@ int fcrypto_test_blowfish_crypt_cbc(
 
 	/* Test error cases
 	 */
-	result = libfcrypto_blowfish_crypt_cbc(
+	result = libfcrypto_blowfish_crypt_ctr(
 	          NULL,
-	          LIBFCRYPTO_BLOWFISH_CRYPT_MODE_DECRYPT,
-	          initialization_vector,
+	          initial_counter_block,
 	          8,
-	          encrypted_data,
-	          32,
+	          4,
+	          LIBFCRYPTO_ENDIAN_BIG,
+	          0,
+	          input_data,
+	          3000,
 	          output_data,
-	          32,
+	          3000,
 	          &error );
 
 	FCRYPTO_TEST_ASSERT_EQUAL_INT(
@@ -1372,15 +2841,17 @@ int fcrypto_test_blowfish_crypt_cbc(
 	libcerror_error_free(
 	 &error );
 
-	result = libfcrypto_blowfish_crypt_cbc(
+	result = libfcrypto_blowfish_crypt_ctr(
 	          blowfish_context,
-	          -1,
-	          initialization_vector,
+	          NULL,
 	          8,
-	          encrypted_data,
-	          32,
+	          4,
+	          LIBFCRYPTO_ENDIAN_BIG,
+	          0,
+	          input_data,
+	          3000,
 	          output_data,
-	          32,
+	          3000,
 	          &error );
 
 	FCRYPTO_TEST_ASSERT_EQUAL_INT(
@@ -1395,15 +2866,42 @@ int fcrypto_test_blowfish_crypt_cbc(
 	libcerror_error_free(
 	 &error );
 
-	result = libfcrypto_blowfish_crypt_cbc(
+	result = libfcrypto_blowfish_crypt_ctr(
 	          blowfish_context,
-	          LIBFCRYPTO_BLOWFISH_CRYPT_MODE_DECRYPT,
-	          NULL,
+	          initial_counter_block,
+	          7,
+	          4,
+	          LIBFCRYPTO_ENDIAN_BIG,
+	          0,
+	          input_data,
+	          3000,
+	          output_data,
+	          3000,
+	          &error );
+
+	FCRYPTO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FCRYPTO_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfcrypto_blowfish_crypt_ctr(
+	          blowfish_context,
+	          initial_counter_block,
 	          8,
-	          encrypted_data,
-	          32,
+	          0,
+	          LIBFCRYPTO_ENDIAN_BIG,
+	          0,
+	          input_data,
+	          3000,
 	          output_data,
-	          32,
+	          3000,
 	          &error );
 
 	FCRYPTO_TEST_ASSERT_EQUAL_INT(
@@ -1418,15 +2916,17 @@ int fcrypto_test_blowfish_crypt_cbc(
 	libcerror_error_free(
 	 &error );
 
-	result = libfcrypto_blowfish_crypt_cbc(
+	result = libfcrypto_blowfish_crypt_ctr(
 	          blowfish_context,
-	          LIBFCRYPTO_BLOWFISH_CRYPT_MODE_DECRYPT,
-	          initialization_vector,
-	          (size_t) SSIZE_MAX + 1,
-	          encrypted_data,
-	          32,
+	          initial_counter_block,
+	          8,
+	          9,
+	          LIBFCRYPTO_ENDIAN_BIG,
+	          0,
+	          input_data,
+	          3000,
 	          output_data,
-	          32,
+	          3000,
 	          &error );
 
 	FCRYPTO_TEST_ASSERT_EQUAL_INT(
@@ -1441,15 +2941,42 @@ int fcrypto_test_blowfish_crypt_cbc(
 	libcerror_error_free(
 	 &error );
 
-	result = libfcrypto_blowfish_crypt_cbc(
+	result = libfcrypto_blowfish_crypt_ctr(
 	          blowfish_context,
-	          LIBFCRYPTO_BLOWFISH_CRYPT_MODE_DECRYPT,
-	          initialization_vector,
+	          initial_counter_block,
+	          8,
+	          4,
+	          0,
+	          0,
+	          input_data,
+	          3000,
+	          output_data,
+	          3000,
+	          &error );
+
+	FCRYPTO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FCRYPTO_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfcrypto_blowfish_crypt_ctr(
+	          blowfish_context,
+	          initial_counter_block,
 	          8,
+	          4,
+	          LIBFCRYPTO_ENDIAN_BIG,
+	          0,
 	          NULL,
-	          32,
+	          3000,
 	          output_data,
-	          32,
+	          3000,
 	          &error );
 
 	FCRYPTO_TEST_ASSERT_EQUAL_INT(
@@ -1464,15 +2991,17 @@ int fcrypto_test_blowfish_crypt_cbc(
 	libcerror_error_free(
 	 &error );
 
-	result = libfcrypto_blowfish_crypt_cbc(
+	result = libfcrypto_blowfish_crypt_ctr(
 	          blowfish_context,
-	          LIBFCRYPTO_BLOWFISH_CRYPT_MODE_DECRYPT,
-	          initialization_vector,
+	          initial_counter_block,
 	          8,
-	          encrypted_data,
+	          4,
+	          LIBFCRYPTO_ENDIAN_BIG,
+	          0,
+	          input_data,
 	          (size_t) SSIZE_MAX + 1,
 	          output_data,
-	          32,
+	          3000,
 	          &error );
 
 	FCRYPTO_TEST_ASSERT_EQUAL_INT(
@@ -1487,15 +3016,17 @@ int fcrypto_test_blowfish_crypt_cbc(
 	libcerror_error_free(
 	 &error );
 
-	result = libfcrypto_blowfish_crypt_cbc(
+	result = libfcrypto_blowfish_crypt_ctr(
 	          blowfish_context,
-	          LIBFCRYPTO_BLOWFISH_CRYPT_MODE_DECRYPT,
-	          initialization_vector,
+	          initial_counter_block,
 	          8,
-	          encrypted_data,
-	          32,
+	          4,
+	          LIBFCRYPTO_ENDIAN_BIG,
+	          0,
+	          input_data,
+	          3000,
 	          NULL,
-	          32,
+	          3000,
 	          &error );
 
 	FCRYPTO_TEST_ASSERT_EQUAL_INT(
@@ -1510,13 +3041,40 @@ int fcrypto_test_blowfish_crypt_cbc(
 	libcerror_error_free(
 	 &error );
 
-	result = libfcrypto_blowfish_crypt_cbc(
+	result = libfcrypto_blowfish_crypt_ctr(
 	          blowfish_context,
-	          LIBFCRYPTO_BLOWFISH_CRYPT_MODE_DECRYPT,
-	          initialization_vector,
+	          initial_counter_block,
 	          8,
-	          encrypted_data,
-	          32,
+	          4,
+	          LIBFCRYPTO_ENDIAN_BIG,
+	          0,
+	          input_data,
+	          3000,
+	          output_data,
+	          2999,
+	          &error );
+
+	FCRYPTO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FCRYPTO_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfcrypto_blowfish_crypt_ctr(
+	          blowfish_context,
+	          initial_counter_block,
+	          8,
+	          4,
+	          LIBFCRYPTO_ENDIAN_BIG,
+	          0,
+	          input_data,
+	          3000,
 	          output_data,
 	          (size_t) SSIZE_MAX + 1,
 	          &error );
@@ -2049,12 +3607,28 @@ int main(
 	 "libfcrypto_internal_blowfish_context_decrypt_block",
 	 fcrypto_test_blowfish_context_decrypt_block );
 
+	FCRYPTO_TEST_RUN(
+	 "libfcrypto_internal_blowfish_context_crypt_blocks",
+	 fcrypto_test_blowfish_context_crypt_blocks );
+
+#if defined( LIBFCRYPTO_BLOWFISH_CONTEXT_HAVE_AVX2 )
+
+	FCRYPTO_TEST_RUN(
+	 "libfcrypto_internal_blowfish_context_crypt_blocks_avx2",
+	 fcrypto_test_blowfish_context_crypt_blocks_avx2 );
+
+#endif /* defined( LIBFCRYPTO_BLOWFISH_CONTEXT_HAVE_AVX2 ) */
+
 #endif /* if defined( __GNUC__ ) && !defined( LIBFCRYPTO_DLL_IMPORT ) */
 
 	FCRYPTO_TEST_RUN(
 	 "libfcrypto_blowfish_crypt_cbc",
 	 fcrypto_test_blowfish_crypt_cbc );
 
+	FCRYPTO_TEST_RUN(
+	 "libfcrypto_blowfish_crypt_ctr",
+	 fcrypto_test_blowfish_crypt_ctr );
+
 	FCRYPTO_TEST_RUN(
 	 "libfcrypto_blowfish_crypt_ecb",
 	 fcrypto_test_blowfish_crypt_ecb );
@@ -0,0 +1,1930 @@
+/*
+ * Library CBC stream type test program
+ *
+ * Copyright (C) 2017-2024, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <file_stream.h>
+#include <memory.h>
+#include <types.h>
+
+#if defined( HAVE_STDLIB_H ) || defined( WINAPI )
+#include <stdlib.h>
+#endif
+
+#include "fcrypto_test_libcerror.h"
+#include "fcrypto_test_libfcrypto.h"
+#include "fcrypto_test_macros.h"
+#include "fcrypto_test_memory.h"
+#include "fcrypto_test_unused.h"
+
+/* Tests the libfcrypto_cbc_stream_initialize function
+ * Returns 1 if successful or 0 if not
+ */
+int fcrypto_test_cbc_stream_initialize(
+     void )
+{
+	uint8_t initialization_vector[ 16 ] = {
+		0xf0, 0xf1, 0xf2, 0xf3, 0xf4, 0xf5, 0xf6, 0xf7, 0xf8, 0xf9, 0xfa, 0xfb, 0xfc, 0xfd, 0xfe, 0xff };
+
+	uint8_t key[ 32 ] = {
+		0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09, 0x0a, 0x0b, 0x0c, 0x0d, 0x0e, 0x0f,
+		0x10, 0x11, 0x12, 0x13, 0x14, 0x15, 0x16, 0x17, 0x18, 0x19, 0x1a, 0x1b, 0x1c, 0x1d, 0x1e, 0x1f };
+
+	libcerror_error_t *error        = NULL;
+	libfcrypto_cbc_stream_t *stream = NULL;
+	libfcrypto_cipher_t *cipher     = NULL;
+	int result                      = 0;
+
+#if defined( HAVE_FCRYPTO_TEST_MEMORY )
+	int number_of_malloc_fail_tests = 1;
+	int number_of_memset_fail_tests = 2;
+	int test_number                 = 0;
+#endif
+
+	/* Initialize test
+	 */
+	result = libfcrypto_cipher_initialize(
+	          &cipher,
+	          LIBFCRYPTO_CIPHER_ALGORITHM_SERPENT,
+	          LIBFCRYPTO_CIPHER_MODE_CBC,
+	          &error );
+
+	FCRYPTO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FCRYPTO_TEST_ASSERT_IS_NOT_NULL(
+	 "cipher",
+	 cipher );
+
+	FCRYPTO_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfcrypto_cipher_set_key(
+	          cipher,
+	          key,
+	          256,
+	          &error );
+
+	FCRYPTO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FCRYPTO_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libfcrypto_cbc_stream_initialize(
+	          &stream,
+	          cipher,
+	          LIBFCRYPTO_CRYPT_MODE_ENCRYPT,
+	          initialization_vector,
+	          16,
+	          &error );
+
+	FCRYPTO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FCRYPTO_TEST_ASSERT_IS_NOT_NULL(
+	 "stream",
+	 stream );
+
+	FCRYPTO_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfcrypto_cbc_stream_free(
+	          &stream,
+	          &error );
+
+	FCRYPTO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FCRYPTO_TEST_ASSERT_IS_NULL(
+	 "stream",
+	 stream );
+
+	FCRYPTO_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libfcrypto_cbc_stream_initialize(
+	          NULL,
+	          cipher,
+	          LIBFCRYPTO_CRYPT_MODE_ENCRYPT,
+	          initialization_vector,
+	          16,
+	          &error );
+
+	FCRYPTO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FCRYPTO_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	stream = (libfcrypto_cbc_stream_t *) 0x12345678UL;
+
+	result = libfcrypto_cbc_stream_initialize(
+	          &stream,
+	          cipher,
+	          LIBFCRYPTO_CRYPT_MODE_ENCRYPT,
+	          initialization_vector,
+	          16,
+	          &error );
+
+	stream = NULL;
+
+	FCRYPTO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FCRYPTO_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfcrypto_cbc_stream_initialize(
+	          &stream,
+	          NULL,
+	          LIBFCRYPTO_CRYPT_MODE_ENCRYPT,
+	          initialization_vector,
+	          16,
+	          &error );
+
+	FCRYPTO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FCRYPTO_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	FCRYPTO_TEST_ASSERT_IS_NULL(
+	 "stream",
+	 stream );
+
+	result = libfcrypto_cbc_stream_initialize(
+	          &stream,
+	          cipher,
+	          -1,
+	          initialization_vector,
+	          16,
+	          &error );
+
+	FCRYPTO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FCRYPTO_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	FCRYPTO_TEST_ASSERT_IS_NULL(
+	 "stream",
+	 stream );
+
+	result = libfcrypto_cbc_stream_initialize(
+	          &stream,
+	          cipher,
+	          LIBFCRYPTO_CRYPT_MODE_ENCRYPT,
+	          NULL,
+	          16,
+	          &error );
+
+	FCRYPTO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FCRYPTO_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	FCRYPTO_TEST_ASSERT_IS_NULL(
+	 "stream",
+	 stream );
+
+	result = libfcrypto_cbc_stream_initialize(
+	          &stream,
+	          cipher,
+	          LIBFCRYPTO_CRYPT_MODE_ENCRYPT,
+	          initialization_vector,
+	          8,
+	          &error );
+
+	FCRYPTO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FCRYPTO_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	FCRYPTO_TEST_ASSERT_IS_NULL(
+	 "stream",
+	 stream );
+
+	result = libfcrypto_cipher_free(
+	          &cipher,
+	          &error );
+
+	FCRYPTO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FCRYPTO_TEST_ASSERT_IS_NULL(
+	 "cipher",
+	 cipher );
+
+	FCRYPTO_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfcrypto_cipher_initialize(
+	          &cipher,
+	          LIBFCRYPTO_CIPHER_ALGORITHM_SERPENT,
+	          LIBFCRYPTO_CIPHER_MODE_ECB,
+	          &error );
+
+	FCRYPTO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FCRYPTO_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfcrypto_cbc_stream_initialize(
+	          &stream,
+	          cipher,
+	          LIBFCRYPTO_CRYPT_MODE_ENCRYPT,
+	          initialization_vector,
+	          16,
+	          &error );
+
+	FCRYPTO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FCRYPTO_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	FCRYPTO_TEST_ASSERT_IS_NULL(
+	 "stream",
+	 stream );
+
+	result = libfcrypto_cipher_free(
+	          &cipher,
+	          &error );
+
+	FCRYPTO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FCRYPTO_TEST_ASSERT_IS_NULL(
+	 "cipher",
+	 cipher );
+
+	FCRYPTO_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfcrypto_cipher_initialize(
+	          &cipher,
+	          LIBFCRYPTO_CIPHER_ALGORITHM_SERPENT,
+	          LIBFCRYPTO_CIPHER_MODE_CBC,
+	          &error );
+
+	FCRYPTO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FCRYPTO_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+#if defined( HAVE_FCRYPTO_TEST_MEMORY )
+
+	for( test_number = 0;
+	     test_number < number_of_malloc_fail_tests;
+	     test_number++ )
+	{
+		/* Test libfcrypto_cbc_stream_initialize with malloc failing
+		 */
+		fcrypto_test_malloc_attempts_before_fail = test_number;
+
+		result = libfcrypto_cbc_stream_initialize(
+		          &stream,
+		          cipher,
+		          LIBFCRYPTO_CRYPT_MODE_ENCRYPT,
+		          initialization_vector,
+		          16,
+		          &error );
+
+		if( fcrypto_test_malloc_attempts_before_fail != -1 )
+		{
+			fcrypto_test_malloc_attempts_before_fail = -1;
+
+			if( stream != NULL )
+			{
+				libfcrypto_cbc_stream_free(
+				 &stream,
+				 NULL );
+			}
+		}
+		else
+		{
+			FCRYPTO_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 -1 );
+
+			FCRYPTO_TEST_ASSERT_IS_NULL(
+			 "stream",
+			 stream );
+
+			FCRYPTO_TEST_ASSERT_IS_NOT_NULL(
+			 "error",
+			 error );
+
+			libcerror_error_free(
+			 &error );
+		}
+	}
+	for( test_number = 0;
+	     test_number < number_of_memset_fail_tests;
+	     test_number++ )
+	{
+		/* Test libfcrypto_cbc_stream_initialize with memset failing
+		 */
+		fcrypto_test_memset_attempts_before_fail = test_number;
+
+		result = libfcrypto_cbc_stream_initialize(
+		          &stream,
+		          cipher,
+		          LIBFCRYPTO_CRYPT_MODE_ENCRYPT,
+		          initialization_vector,
+		          16,
+		          &error );
+
+		if( fcrypto_test_memset_attempts_before_fail != -1 )
+		{
+			fcrypto_test_memset_attempts_before_fail = -1;
+
+			if( stream != NULL )
+			{
+				libfcrypto_cbc_stream_free(
+				 &stream,
+				 NULL );
+			}
+		}
+		else
+		{
+			FCRYPTO_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 -1 );
+
+			FCRYPTO_TEST_ASSERT_IS_NULL(
+			 "stream",
+			 stream );
+
+			FCRYPTO_TEST_ASSERT_IS_NOT_NULL(
+			 "error",
+			 error );
+
+			libcerror_error_free(
+			 &error );
+		}
+	}
+#endif /* defined( HAVE_FCRYPTO_TEST_MEMORY ) */
+
+	/* Clean up
+	 */
+	result = libfcrypto_cipher_free(
+	          &cipher,
+	          &error );
+
+	FCRYPTO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FCRYPTO_TEST_ASSERT_IS_NULL(
+	 "cipher",
+	 cipher );
+
+	FCRYPTO_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( stream != NULL )
+	{
+		libfcrypto_cbc_stream_free(
+		 &stream,
+		 NULL );
+	}
+	if( cipher != NULL )
+	{
+		libfcrypto_cipher_free(
+		 &cipher,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libfcrypto_cbc_stream_free function
+ * Returns 1 if successful or 0 if not
+ */
+int fcrypto_test_cbc_stream_free(
+     void )
+{
+	libcerror_error_t *error = NULL;
+	int result               = 0;
+
+	/* Test error cases
+	 */
+	result = libfcrypto_cbc_stream_free(
+	          NULL,
+	          &error );
+
+	FCRYPTO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FCRYPTO_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libfcrypto_cbc_stream_set_initialization_vector function
+ * Returns 1 if successful or 0 if not
+ */
+int fcrypto_test_cbc_stream_set_initialization_vector(
+     void )
+{
+	uint8_t initialization_vector[ 16 ] = {
+		0xf0, 0xf1, 0xf2, 0xf3, 0xf4, 0xf5, 0xf6, 0xf7, 0xf8, 0xf9, 0xfa, 0xfb, 0xfc, 0xfd, 0xfe, 0xff };
+
+	uint8_t key[ 32 ] = {
+		0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09, 0x0a, 0x0b, 0x0c, 0x0d, 0x0e, 0x0f,
+		0x10, 0x11, 0x12, 0x13, 0x14, 0x15, 0x16, 0x17, 0x18, 0x19, 0x1a, 0x1b, 0x1c, 0x1d, 0x1e, 0x1f };
+
+	libcerror_error_t *error        = NULL;
+	libfcrypto_cbc_stream_t *stream = NULL;
+	libfcrypto_cipher_t *cipher     = NULL;
+	size_t buffered_data_size       = 0;
+	ssize_t write_count             = 0;
+	int result                      = 0;
+
+	/* Initialize test
+	 */
+	result = libfcrypto_cipher_initialize(
+	          &cipher,
+	          LIBFCRYPTO_CIPHER_ALGORITHM_SERPENT,
+	          LIBFCRYPTO_CIPHER_MODE_CBC,
+	          &error );
+
+	FCRYPTO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FCRYPTO_TEST_ASSERT_IS_NOT_NULL(
+	 "cipher",
+	 cipher );
+
+	FCRYPTO_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfcrypto_cipher_set_key(
+	          cipher,
+	          key,
+	          256,
+	          &error );
+
+	FCRYPTO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FCRYPTO_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfcrypto_cbc_stream_initialize(
+	          &stream,
+	          cipher,
+	          LIBFCRYPTO_CRYPT_MODE_ENCRYPT,
+	          initialization_vector,
+	          16,
+	          &error );
+
+	FCRYPTO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FCRYPTO_TEST_ASSERT_IS_NOT_NULL(
+	 "stream",
+	 stream );
+
+	FCRYPTO_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	write_count = libfcrypto_cbc_stream_update(
+	               stream,
+	               key,
+	               5,
+	               key,
+	               32,
+	               &error );
+
+	FCRYPTO_TEST_ASSERT_EQUAL_SSIZE(
+	 "write_count",
+	 write_count,
+	 (ssize_t) 0 );
+
+	FCRYPTO_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfcrypto_cbc_stream_set_initialization_vector(
+	          stream,
+	          initialization_vector,
+	          16,
+	          &error );
+
+	FCRYPTO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FCRYPTO_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfcrypto_cbc_stream_get_buffered_data_size(
+	          stream,
+	          &buffered_data_size,
+	          &error );
+
+	FCRYPTO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FCRYPTO_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FCRYPTO_TEST_ASSERT_EQUAL_SIZE(
+	 "buffered_data_size",
+	 buffered_data_size,
+	 (size_t) 0 );
+
+	/* Test error cases
+	 */
+	result = libfcrypto_cbc_stream_set_initialization_vector(
+	          NULL,
+	          initialization_vector,
+	          16,
+	          &error );
+
+	FCRYPTO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FCRYPTO_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfcrypto_cbc_stream_set_initialization_vector(
+	          stream,
+	          NULL,
+	          16,
+	          &error );
+
+	FCRYPTO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FCRYPTO_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfcrypto_cbc_stream_set_initialization_vector(
+	          stream,
+	          initialization_vector,
+	          8,
+	          &error );
+
+	FCRYPTO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FCRYPTO_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfcrypto_cbc_stream_set_initialization_vector(
+	          stream,
+	          initialization_vector,
+	          32,
+	          &error );
+
+	FCRYPTO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FCRYPTO_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libfcrypto_cbc_stream_free(
+	          &stream,
+	          &error );
+
+	FCRYPTO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FCRYPTO_TEST_ASSERT_IS_NULL(
+	 "stream",
+	 stream );
+
+	FCRYPTO_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfcrypto_cipher_free(
+	          &cipher,
+	          &error );
+
+	FCRYPTO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FCRYPTO_TEST_ASSERT_IS_NULL(
+	 "cipher",
+	 cipher );
+
+	FCRYPTO_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( stream != NULL )
+	{
+		libfcrypto_cbc_stream_free(
+		 &stream,
+		 NULL );
+	}
+	if( cipher != NULL )
+	{
+		libfcrypto_cipher_free(
+		 &cipher,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libfcrypto_cbc_stream_get_buffered_data_size function
+ * Returns 1 if successful or 0 if not
+ */
+int fcrypto_test_cbc_stream_get_buffered_data_size(
+     void )
+{
+	uint8_t initialization_vector[ 16 ] = {
+		0xf0, 0xf1, 0xf2, 0xf3, 0xf4, 0xf5, 0xf6, 0xf7, 0xf8, 0xf9, 0xfa, 0xfb, 0xfc, 0xfd, 0xfe, 0xff };
+
+	uint8_t key[ 32 ] = {
+		0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09, 0x0a, 0x0b, 0x0c, 0x0d, 0x0e, 0x0f,
+		0x10, 0x11, 0x12, 0x13, 0x14, 0x15, 0x16, 0x17, 0x18, 0x19, 0x1a, 0x1b, 0x1c, 0x1d, 0x1e, 0x1f };
+
+	libcerror_error_t *error        = NULL;
+	libfcrypto_cbc_stream_t *stream = NULL;
+	libfcrypto_cipher_t *cipher     = NULL;
+	size_t buffered_data_size       = 0;
+	ssize_t write_count             = 0;
+	int result                      = 0;
+
+	/* Initialize test
+	 */
+	result = libfcrypto_cipher_initialize(
+	          &cipher,
+	          LIBFCRYPTO_CIPHER_ALGORITHM_SERPENT,
+	          LIBFCRYPTO_CIPHER_MODE_CBC,
+	          &error );
+
+	FCRYPTO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FCRYPTO_TEST_ASSERT_IS_NOT_NULL(
+	 "cipher",
+	 cipher );
+
+	FCRYPTO_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfcrypto_cipher_set_key(
+	          cipher,
+	          key,
+	          256,
+	          &error );
+
+	FCRYPTO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FCRYPTO_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfcrypto_cbc_stream_initialize(
+	          &stream,
+	          cipher,
+	          LIBFCRYPTO_CRYPT_MODE_ENCRYPT,
+	          initialization_vector,
+	          16,
+	          &error );
+
+	FCRYPTO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FCRYPTO_TEST_ASSERT_IS_NOT_NULL(
+	 "stream",
+	 stream );
+
+	FCRYPTO_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libfcrypto_cbc_stream_get_buffered_data_size(
+	          stream,
+	          &buffered_data_size,
+	          &error );
+
+	FCRYPTO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FCRYPTO_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FCRYPTO_TEST_ASSERT_EQUAL_SIZE(
+	 "buffered_data_size",
+	 buffered_data_size,
+	 (size_t) 0 );
+
+	write_count = libfcrypto_cbc_stream_update(
+	               stream,
+	               key,
+	               21,
+	               key,
+	               32,
+	               &error );
+
+	FCRYPTO_TEST_ASSERT_EQUAL_SSIZE(
+	 "write_count",
+	 write_count,
+	 (ssize_t) 16 );
+
+	FCRYPTO_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfcrypto_cbc_stream_get_buffered_data_size(
+	          stream,
+	          &buffered_data_size,
+	          &error );
+
+	FCRYPTO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FCRYPTO_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FCRYPTO_TEST_ASSERT_EQUAL_SIZE(
+	 "buffered_data_size",
+	 buffered_data_size,
+	 (size_t) 5 );
+
+	/* Test error cases
+	 */
+	result = libfcrypto_cbc_stream_get_buffered_data_size(
+	          NULL,
+	          &buffered_data_size,
+	          &error );
+
+	FCRYPTO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FCRYPTO_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfcrypto_cbc_stream_get_buffered_data_size(
+	          stream,
+	          NULL,
+	          &error );
+
+	FCRYPTO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FCRYPTO_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libfcrypto_cbc_stream_free(
+	          &stream,
+	          &error );
+
+	FCRYPTO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FCRYPTO_TEST_ASSERT_IS_NULL(
+	 "stream",
+	 stream );
+
+	FCRYPTO_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfcrypto_cipher_free(
+	          &cipher,
+	          &error );
+
+	FCRYPTO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FCRYPTO_TEST_ASSERT_IS_NULL(
+	 "cipher",
+	 cipher );
+
+	FCRYPTO_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( stream != NULL )
+	{
+		libfcrypto_cbc_stream_free(
+		 &stream,
+		 NULL );
+	}
+	if( cipher != NULL )
+	{
+		libfcrypto_cipher_free(
+		 &cipher,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libfcrypto_cbc_stream_update function with a specific algorithm and mode
+ * Returns 1 if successful or 0 if not
+ */
+int fcrypto_test_cbc_stream_update_with_algorithm_and_mode(
+     int algorithm,
+     int mode )
+{
+	uint8_t initialization_vector[ 16 ] = {
+		0xf0, 0xf1, 0xf2, 0xf3, 0xf4, 0xf5, 0xf6, 0xf7, 0xf8, 0xf9, 0xfa, 0xfb, 0xfc, 0xfd, 0xfe, 0xff };
+
+	uint8_t key[ 32 ] = {
+		0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09, 0x0a, 0x0b, 0x0c, 0x0d, 0x0e, 0x0f,
+		0x10, 0x11, 0x12, 0x13, 0x14, 0x15, 0x16, 0x17, 0x18, 0x19, 0x1a, 0x1b, 0x1c, 0x1d, 0x1e, 0x1f };
+
+	size_t chunk_sizes[ 9 ] = {
+		1, 7, 8, 3, 16, 33, 2500, 100, 5 };
+
+	uint8_t chunk_data[ 2516 ];
+	uint8_t expected_output_data[ 4160 ];
+	uint8_t input_data[ 4160 ];
+	uint8_t output_data[ 4160 ];
+
+	libcerror_error_t *error        = NULL;
+	libfcrypto_cbc_stream_t *stream = NULL;
+	libfcrypto_cipher_t *cipher     = NULL;
+	size_t block_size               = 0;
+	size_t buffered_data_size       = 0;
+	size_t chunk_index              = 0;
+	size_t chunk_size               = 0;
+	size_t data_offset              = 0;
+	size_t input_data_offset        = 0;
+	size_t key_bit_size             = 256;
+	size_t output_data_offset       = 0;
+	ssize_t write_count             = 0;
+	int in_place                    = 0;
+	int result                      = 0;
+
+	/* Initialize test
+	 */
+	for( data_offset = 0;
+	     data_offset < 4160;
+	     data_offset++ )
+	{
+		input_data[ data_offset ] = (uint8_t) ( ( data_offset * 13 ) + 5 );
+	}
+	if( algorithm == LIBFCRYPTO_CIPHER_ALGORITHM_BLOWFISH )
+	{
+		key_bit_size = 128;
+	}
+	else if( algorithm == LIBFCRYPTO_CIPHER_ALGORITHM_DES3 )
+	{
+		key_bit_size = 192;
+	}
+	result = libfcrypto_cipher_initialize(
+	          &cipher,
+	          algorithm,
+	          LIBFCRYPTO_CIPHER_MODE_CBC,
+	          &error );
+
+	FCRYPTO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FCRYPTO_TEST_ASSERT_IS_NOT_NULL(
+	 "cipher",
+	 cipher );
+
+	FCRYPTO_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfcrypto_cipher_set_key(
+	          cipher,
+	          key,
+	          key_bit_size,
+	          &error );
+
+	FCRYPTO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FCRYPTO_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfcrypto_cipher_get_block_size(
+	          cipher,
+	          &block_size,
+	          &error );
+
+	FCRYPTO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FCRYPTO_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Calculate the expected output data by (de/en)crypting the data at once
+	 */
+	result = libfcrypto_cipher_crypt(
+	          cipher,
+	          mode,
+	          initialization_vector,
+	          block_size,
+	          input_data,
+	          4160,
+	          expected_output_data,
+	          4160,
+	          &error );
+
+	FCRYPTO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FCRYPTO_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfcrypto_cbc_stream_initialize(
+	          &stream,
+	          cipher,
+	          mode,
+	          initialization_vector,
+	          block_size,
+	          &error );
+
+	FCRYPTO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FCRYPTO_TEST_ASSERT_IS_NOT_NULL(
+	 "stream",
+	 stream );
+
+	FCRYPTO_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases with separate input and output data and with the data
+	 * of each chunk (de/en)crypted in place, as done by a pipeline that passes through read buffers
+	 */
+	for( in_place = 0;
+	     in_place < 2;
+	     in_place++ )
+	{
+		result = libfcrypto_cbc_stream_set_initialization_vector(
+		          stream,
+		          initialization_vector,
+		          block_size,
+		          &error );
+
+		FCRYPTO_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		FCRYPTO_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		chunk_index        = 0;
+		input_data_offset  = 0;
+		output_data_offset = 0;
+
+		while( input_data_offset < 4160 )
+		{
+			chunk_size = chunk_sizes[ chunk_index % 9 ];
+
+			if( chunk_size > ( 4160 - input_data_offset ) )
+			{
+				chunk_size = 4160 - input_data_offset;
+			}
+			if( in_place == 0 )
+			{
+				write_count = libfcrypto_cbc_stream_update(
+				               stream,
+				               &( input_data[ input_data_offset ] ),
+				               chunk_size,
+				               &( output_data[ output_data_offset ] ),
+				               4160 - output_data_offset,
+				               &error );
+			}
+			else
+			{
+				memory_copy(
+				 chunk_data,
+				 &( input_data[ input_data_offset ] ),
+				 chunk_size );
+
+				write_count = libfcrypto_cbc_stream_update(
+				               stream,
+				               chunk_data,
+				               chunk_size,
+				               chunk_data,
+				               2516,
+				               &error );
+
+				if( write_count > 0 )
+				{
+					memory_copy(
+					 &( output_data[ output_data_offset ] ),
+					 chunk_data,
+					 (size_t) write_count );
+				}
+			}
+			FCRYPTO_TEST_ASSERT_NOT_EQUAL_SSIZE(
+			 "write_count",
+			 write_count,
+			 (ssize_t) -1 );
+
+			FCRYPTO_TEST_ASSERT_IS_NULL(
+			 "error",
+			 error );
+
+			input_data_offset  += chunk_size;
+			output_data_offset += (size_t) write_count;
+
+			chunk_index++;
+		}
+		FCRYPTO_TEST_ASSERT_EQUAL_SIZE(
+		 "output_data_offset",
+		 output_data_offset,
+		 (size_t) 4160 );
+
+		result = libfcrypto_cbc_stream_get_buffered_data_size(
+		          stream,
+		          &buffered_data_size,
+		          &error );
+
+		FCRYPTO_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		FCRYPTO_TEST_ASSERT_EQUAL_SIZE(
+		 "buffered_data_size",
+		 buffered_data_size,
+		 (size_t) 0 );
+
+		FCRYPTO_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		result = libfcrypto_cbc_stream_finalize(
+		          stream,
+		          &error );
+
+		FCRYPTO_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		FCRYPTO_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		result = memory_compare(
+		          output_data,
+		          expected_output_data,
+		          4160 );
+
+		FCRYPTO_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 0 );
+	}
+	/* Clean up
+	 */
+	result = libfcrypto_cbc_stream_free(
+	          &stream,
+	          &error );
+
+	FCRYPTO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FCRYPTO_TEST_ASSERT_IS_NULL(
+	 "stream",
+	 stream );
+
+	FCRYPTO_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfcrypto_cipher_free(
+	          &cipher,
+	          &error );
+
+	FCRYPTO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FCRYPTO_TEST_ASSERT_IS_NULL(
+	 "cipher",
+	 cipher );
+
+	FCRYPTO_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( stream != NULL )
+	{
+		libfcrypto_cbc_stream_free(
+		 &stream,
+		 NULL );
+	}
+	if( cipher != NULL )
+	{
+		libfcrypto_cipher_free(
+		 &cipher,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libfcrypto_cbc_stream_update function
+ * Returns 1 if successful or 0 if not
+ */
+int fcrypto_test_cbc_stream_update(
+     void )
+{
+	int algorithms[ 3 ] = {
+		LIBFCRYPTO_CIPHER_ALGORITHM_BLOWFISH, LIBFCRYPTO_CIPHER_ALGORITHM_DES3, LIBFCRYPTO_CIPHER_ALGORITHM_SERPENT };
+
+	int modes[ 2 ] = {
+		LIBFCRYPTO_CRYPT_MODE_DECRYPT, LIBFCRYPTO_CRYPT_MODE_ENCRYPT };
+
+	uint8_t initialization_vector[ 16 ] = {
+		0xf0, 0xf1, 0xf2, 0xf3, 0xf4, 0xf5, 0xf6, 0xf7, 0xf8, 0xf9, 0xfa, 0xfb, 0xfc, 0xfd, 0xfe, 0xff };
+
+	uint8_t key[ 32 ] = {
+		0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09, 0x0a, 0x0b, 0x0c, 0x0d, 0x0e, 0x0f,
+		0x10, 0x11, 0x12, 0x13, 0x14, 0x15, 0x16, 0x17, 0x18, 0x19, 0x1a, 0x1b, 0x1c, 0x1d, 0x1e, 0x1f };
+
+	uint8_t data[ 32 ];
+
+	libcerror_error_t *error        = NULL;
+	libfcrypto_cbc_stream_t *stream = NULL;
+	libfcrypto_cipher_t *cipher     = NULL;
+	ssize_t write_count             = 0;
+	int algorithm_index             = 0;
+	int mode_index                  = 0;
+	int result                      = 0;
+
+	/* Test regular cases
+	 */
+	for( algorithm_index = 0;
+	     algorithm_index < 3;
+	     algorithm_index++ )
+	{
+		for( mode_index = 0;
+		     mode_index < 2;
+		     mode_index++ )
+		{
+			result = fcrypto_test_cbc_stream_update_with_algorithm_and_mode(
+			          algorithms[ algorithm_index ],
+			          modes[ mode_index ] );
+
+			FCRYPTO_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 1 );
+		}
+	}
+	/* Initialize test for the error cases
+	 */
+	result = libfcrypto_cipher_initialize(
+	          &cipher,
+	          LIBFCRYPTO_CIPHER_ALGORITHM_SERPENT,
+	          LIBFCRYPTO_CIPHER_MODE_CBC,
+	          &error );
+
+	FCRYPTO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FCRYPTO_TEST_ASSERT_IS_NOT_NULL(
+	 "cipher",
+	 cipher );
+
+	FCRYPTO_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfcrypto_cipher_set_key(
+	          cipher,
+	          key,
+	          256,
+	          &error );
+
+	FCRYPTO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FCRYPTO_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfcrypto_cbc_stream_initialize(
+	          &stream,
+	          cipher,
+	          LIBFCRYPTO_CRYPT_MODE_ENCRYPT,
+	          initialization_vector,
+	          16,
+	          &error );
+
+	FCRYPTO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FCRYPTO_TEST_ASSERT_IS_NOT_NULL(
+	 "stream",
+	 stream );
+
+	FCRYPTO_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	write_count = libfcrypto_cbc_stream_update(
+	               NULL,
+	               key,
+	               16,
+	               data,
+	               32,
+	               &error );
+
+	FCRYPTO_TEST_ASSERT_EQUAL_SSIZE(
+	 "write_count",
+	 write_count,
+	 (ssize_t) -1 );
+
+	FCRYPTO_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	write_count = libfcrypto_cbc_stream_update(
+	               stream,
+	               NULL,
+	               16,
+	               data,
+	               32,
+	               &error );
+
+	FCRYPTO_TEST_ASSERT_EQUAL_SSIZE(
+	 "write_count",
+	 write_count,
+	 (ssize_t) -1 );
+
+	FCRYPTO_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	write_count = libfcrypto_cbc_stream_update(
+	               stream,
+	               key,
+	               (size_t) SSIZE_MAX + 1,
+	               data,
+	               32,
+	               &error );
+
+	FCRYPTO_TEST_ASSERT_EQUAL_SSIZE(
+	 "write_count",
+	 write_count,
+	 (ssize_t) -1 );
+
+	FCRYPTO_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	write_count = libfcrypto_cbc_stream_update(
+	               stream,
+	               key,
+	               16,
+	               NULL,
+	               32,
+	               &error );
+
+	FCRYPTO_TEST_ASSERT_EQUAL_SSIZE(
+	 "write_count",
+	 write_count,
+	 (ssize_t) -1 );
+
+	FCRYPTO_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	write_count = libfcrypto_cbc_stream_update(
+	               stream,
+	               key,
+	               16,
+	               data,
+	               15,
+	               &error );
+
+	FCRYPTO_TEST_ASSERT_EQUAL_SSIZE(
+	 "write_count",
+	 write_count,
+	 (ssize_t) -1 );
+
+	FCRYPTO_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	write_count = libfcrypto_cbc_stream_update(
+	               stream,
+	               key,
+	               16,
+	               data,
+	               (size_t) SSIZE_MAX + 1,
+	               &error );
+
+	FCRYPTO_TEST_ASSERT_EQUAL_SSIZE(
+	 "write_count",
+	 write_count,
+	 (ssize_t) -1 );
+
+	FCRYPTO_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libfcrypto_cbc_stream_free(
+	          &stream,
+	          &error );
+
+	FCRYPTO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FCRYPTO_TEST_ASSERT_IS_NULL(
+	 "stream",
+	 stream );
+
+	FCRYPTO_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfcrypto_cipher_free(
+	          &cipher,
+	          &error );
+
+	FCRYPTO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FCRYPTO_TEST_ASSERT_IS_NULL(
+	 "cipher",
+	 cipher );
+
+	FCRYPTO_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( stream != NULL )
+	{
+		libfcrypto_cbc_stream_free(
+		 &stream,
+		 NULL );
+	}
+	if( cipher != NULL )
+	{
+		libfcrypto_cipher_free(
+		 &cipher,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libfcrypto_cbc_stream_finalize function
+ * Returns 1 if successful or 0 if not
+ */
+int fcrypto_test_cbc_stream_finalize(
+     void )
+{
+	uint8_t initialization_vector[ 16 ] = {
+		0xf0, 0xf1, 0xf2, 0xf3, 0xf4, 0xf5, 0xf6, 0xf7, 0xf8, 0xf9, 0xfa, 0xfb, 0xfc, 0xfd, 0xfe, 0xff };
+
+	uint8_t key[ 32 ] = {
+		0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09, 0x0a, 0x0b, 0x0c, 0x0d, 0x0e, 0x0f,
+		0x10, 0x11, 0x12, 0x13, 0x14, 0x15, 0x16, 0x17, 0x18, 0x19, 0x1a, 0x1b, 0x1c, 0x1d, 0x1e, 0x1f };
+
+	uint8_t data[ 32 ];
+
+	libcerror_error_t *error        = NULL;
+	libfcrypto_cbc_stream_t *stream = NULL;
+	libfcrypto_cipher_t *cipher     = NULL;
+	ssize_t write_count             = 0;
+	int result                      = 0;
+
+	/* Initialize test
+	 */
+	result = libfcrypto_cipher_initialize(
+	          &cipher,
+	          LIBFCRYPTO_CIPHER_ALGORITHM_SERPENT,
+	          LIBFCRYPTO_CIPHER_MODE_CBC,
+	          &error );
+
+	FCRYPTO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FCRYPTO_TEST_ASSERT_IS_NOT_NULL(
+	 "cipher",
+	 cipher );
+
+	FCRYPTO_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfcrypto_cipher_set_key(
+	          cipher,
+	          key,
+	          256,
+	          &error );
+
+	FCRYPTO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FCRYPTO_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfcrypto_cbc_stream_initialize(
+	          &stream,
+	          cipher,
+	          LIBFCRYPTO_CRYPT_MODE_ENCRYPT,
+	          initialization_vector,
+	          16,
+	          &error );
+
+	FCRYPTO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FCRYPTO_TEST_ASSERT_IS_NOT_NULL(
+	 "stream",
+	 stream );
+
+	FCRYPTO_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libfcrypto_cbc_stream_finalize(
+	          stream,
+	          &error );
+
+	FCRYPTO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FCRYPTO_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	write_count = libfcrypto_cbc_stream_update(
+	               stream,
+	               key,
+	               32,
+	               data,
+	               32,
+	               &error );
+
+	FCRYPTO_TEST_ASSERT_EQUAL_SSIZE(
+	 "write_count",
+	 write_count,
+	 (ssize_t) 32 );
+
+	FCRYPTO_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfcrypto_cbc_stream_finalize(
+	          stream,
+	          &error );
+
+	FCRYPTO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FCRYPTO_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libfcrypto_cbc_stream_finalize(
+	          NULL,
+	          &error );
+
+	FCRYPTO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FCRYPTO_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	write_count = libfcrypto_cbc_stream_update(
+	               stream,
+	               key,
+	               3,
+	               data,
+	               32,
+	               &error );
+
+	FCRYPTO_TEST_ASSERT_EQUAL_SSIZE(
+	 "write_count",
+	 write_count,
+	 (ssize_t) 0 );
+
+	FCRYPTO_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfcrypto_cbc_stream_finalize(
+	          stream,
+	          &error );
+
+	FCRYPTO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FCRYPTO_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libfcrypto_cbc_stream_free(
+	          &stream,
+	          &error );
+
+	FCRYPTO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FCRYPTO_TEST_ASSERT_IS_NULL(
+	 "stream",
+	 stream );
+
+	FCRYPTO_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfcrypto_cipher_free(
+	          &cipher,
+	          &error );
+
+	FCRYPTO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FCRYPTO_TEST_ASSERT_IS_NULL(
+	 "cipher",
+	 cipher );
+
+	FCRYPTO_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( stream != NULL )
+	{
+		libfcrypto_cbc_stream_free(
+		 &stream,
+		 NULL );
+	}
+	if( cipher != NULL )
+	{
+		libfcrypto_cipher_free(
+		 &cipher,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* The main program
+ */
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+int wmain(
+     int argc FCRYPTO_TEST_ATTRIBUTE_UNUSED,
+     wchar_t * const argv[] FCRYPTO_TEST_ATTRIBUTE_UNUSED )
+#else
+int main(
+     int argc FCRYPTO_TEST_ATTRIBUTE_UNUSED,
+     char * const argv[] FCRYPTO_TEST_ATTRIBUTE_UNUSED )
+#endif
+{
+	FCRYPTO_TEST_UNREFERENCED_PARAMETER( argc )
+	FCRYPTO_TEST_UNREFERENCED_PARAMETER( argv )
+
+	FCRYPTO_TEST_RUN(
+	 "libfcrypto_cbc_stream_initialize",
+	 fcrypto_test_cbc_stream_initialize );
+
+	FCRYPTO_TEST_RUN(
+	 "libfcrypto_cbc_stream_free",
+	 fcrypto_test_cbc_stream_free );
+
+	FCRYPTO_TEST_RUN(
+	 "libfcrypto_cbc_stream_set_initialization_vector",
+	 fcrypto_test_cbc_stream_set_initialization_vector );
+
+	FCRYPTO_TEST_RUN(
+	 "libfcrypto_cbc_stream_get_buffered_data_size",
+	 fcrypto_test_cbc_stream_get_buffered_data_size );
+
+	FCRYPTO_TEST_RUN(
+	 "libfcrypto_cbc_stream_update",
+	 fcrypto_test_cbc_stream_update );
+
+	FCRYPTO_TEST_RUN(
+	 "libfcrypto_cbc_stream_finalize",
+	 fcrypto_test_cbc_stream_finalize );
+
+	return( EXIT_SUCCESS );
+
+on_error:
+	return( EXIT_FAILURE );
+}
+
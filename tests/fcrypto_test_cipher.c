@@ -0,0 +1,4065 @@
+/*
+ * Library cipher type test program
+ *
+ * Copyright (C) 2017-2024, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <file_stream.h>
+#include <memory.h>
+#include <types.h>
+
+#if defined( HAVE_STDLIB_H ) || defined( WINAPI )
+#include <stdlib.h>
+#endif
+
+#include "fcrypto_test_libcerror.h"
+#include "fcrypto_test_libfcrypto.h"
+#include "fcrypto_test_macros.h"
+#include "fcrypto_test_memory.h"
+#include "fcrypto_test_unused.h"
+
+/* Tests the libfcrypto_cipher_initialize function
+ * Returns 1 if successful or 0 if not
+ */
+int fcrypto_test_cipher_initialize(
+     void )
+{
+	libcerror_error_t *error        = NULL;
+	libfcrypto_cipher_t *cipher     = NULL;
+	int result                      = 0;
+
+#if defined( HAVE_FCRYPTO_TEST_MEMORY )
+	int number_of_malloc_fail_tests = 2;
+	int number_of_memset_fail_tests = 2;
+	int test_number                 = 0;
+#endif
+
+	/* Test regular cases
+	 */
+	result = libfcrypto_cipher_initialize(
+	          &cipher,
+	          LIBFCRYPTO_CIPHER_ALGORITHM_SERPENT,
+	          LIBFCRYPTO_CIPHER_MODE_CBC,
+	          &error );
+
+	FCRYPTO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FCRYPTO_TEST_ASSERT_IS_NOT_NULL(
+	 "cipher",
+	 cipher );
+
+	FCRYPTO_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfcrypto_cipher_free(
+	          &cipher,
+	          &error );
+
+	FCRYPTO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FCRYPTO_TEST_ASSERT_IS_NULL(
+	 "cipher",
+	 cipher );
+
+	FCRYPTO_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libfcrypto_cipher_initialize(
+	          NULL,
+	          LIBFCRYPTO_CIPHER_ALGORITHM_SERPENT,
+	          LIBFCRYPTO_CIPHER_MODE_CBC,
+	          &error );
+
+	FCRYPTO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FCRYPTO_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	cipher = (libfcrypto_cipher_t *) 0x12345678UL;
+
+	result = libfcrypto_cipher_initialize(
+	          &cipher,
+	          LIBFCRYPTO_CIPHER_ALGORITHM_SERPENT,
+	          LIBFCRYPTO_CIPHER_MODE_CBC,
+	          &error );
+
+	cipher = NULL;
+
+	FCRYPTO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FCRYPTO_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfcrypto_cipher_initialize(
+	          &cipher,
+	          0,
+	          LIBFCRYPTO_CIPHER_MODE_CBC,
+	          &error );
+
+	FCRYPTO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FCRYPTO_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	FCRYPTO_TEST_ASSERT_IS_NULL(
+	 "cipher",
+	 cipher );
+
+	result = libfcrypto_cipher_initialize(
+	          &cipher,
+	          LIBFCRYPTO_CIPHER_ALGORITHM_SERPENT,
+	          0,
+	          &error );
+
+	FCRYPTO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FCRYPTO_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	FCRYPTO_TEST_ASSERT_IS_NULL(
+	 "cipher",
+	 cipher );
+
+	result = libfcrypto_cipher_initialize(
+	          &cipher,
+	          LIBFCRYPTO_CIPHER_ALGORITHM_SERPENT,
+	          LIBFCRYPTO_CIPHER_MODE_STREAM,
+	          &error );
+
+	FCRYPTO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FCRYPTO_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	FCRYPTO_TEST_ASSERT_IS_NULL(
+	 "cipher",
+	 cipher );
+
+	result = libfcrypto_cipher_initialize(
+	          &cipher,
+	          LIBFCRYPTO_CIPHER_ALGORITHM_RC4,
+	          LIBFCRYPTO_CIPHER_MODE_CBC,
+	          &error );
+
+	FCRYPTO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FCRYPTO_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	FCRYPTO_TEST_ASSERT_IS_NULL(
+	 "cipher",
+	 cipher );
+
+#if defined( HAVE_FCRYPTO_TEST_MEMORY )
+
+	for( test_number = 0;
+	     test_number < number_of_malloc_fail_tests;
+	     test_number++ )
+	{
+		/* Test libfcrypto_cipher_initialize with malloc failing
+		 */
+		fcrypto_test_malloc_attempts_before_fail = test_number;
+
+		result = libfcrypto_cipher_initialize(
+		          &cipher,
+		          LIBFCRYPTO_CIPHER_ALGORITHM_SERPENT,
+		          LIBFCRYPTO_CIPHER_MODE_CBC,
+		          &error );
+
+		if( fcrypto_test_malloc_attempts_before_fail != -1 )
+		{
+			fcrypto_test_malloc_attempts_before_fail = -1;
+
+			if( cipher != NULL )
+			{
+				libfcrypto_cipher_free(
+				 &cipher,
+				 NULL );
+			}
+		}
+		else
+		{
+			FCRYPTO_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 -1 );
+
+			FCRYPTO_TEST_ASSERT_IS_NULL(
+			 "cipher",
+			 cipher );
+
+			FCRYPTO_TEST_ASSERT_IS_NOT_NULL(
+			 "error",
+			 error );
+
+			libcerror_error_free(
+			 &error );
+		}
+	}
+	for( test_number = 0;
+	     test_number < number_of_memset_fail_tests;
+	     test_number++ )
+	{
+		/* Test libfcrypto_cipher_initialize with memset failing
+		 */
+		fcrypto_test_memset_attempts_before_fail = test_number;
+
+		result = libfcrypto_cipher_initialize(
+		          &cipher,
+		          LIBFCRYPTO_CIPHER_ALGORITHM_SERPENT,
+		          LIBFCRYPTO_CIPHER_MODE_CBC,
+		          &error );
+
+		if( fcrypto_test_memset_attempts_before_fail != -1 )
+		{
+			fcrypto_test_memset_attempts_before_fail = -1;
+
+			if( cipher != NULL )
+			{
+				libfcrypto_cipher_free(
+				 &cipher,
+				 NULL );
+			}
+		}
+		else
+		{
+			FCRYPTO_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 -1 );
+
+			FCRYPTO_TEST_ASSERT_IS_NULL(
+			 "cipher",
+			 cipher );
+
+			FCRYPTO_TEST_ASSERT_IS_NOT_NULL(
+			 "error",
+			 error );
+
+			libcerror_error_free(
+			 &error );
+		}
+	}
+#endif /* defined( HAVE_FCRYPTO_TEST_MEMORY ) */
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( cipher != NULL )
+	{
+		libfcrypto_cipher_free(
+		 &cipher,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libfcrypto_cipher_free function
+ * Returns 1 if successful or 0 if not
+ */
+int fcrypto_test_cipher_free(
+     void )
+{
+#if defined( HAVE_FCRYPTO_TEST_MEMORY )
+	libfcrypto_cipher_t *cipher = NULL;
+#endif
+
+	libcerror_error_t *error    = NULL;
+	int result                  = 0;
+
+	/* Test error cases
+	 */
+	result = libfcrypto_cipher_free(
+	          NULL,
+	          &error );
+
+	FCRYPTO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FCRYPTO_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+#if defined( HAVE_FCRYPTO_TEST_MEMORY )
+	/* Initialize test
+	 */
+	result = libfcrypto_cipher_initialize(
+	          &cipher,
+	          LIBFCRYPTO_CIPHER_ALGORITHM_SERPENT,
+	          LIBFCRYPTO_CIPHER_MODE_CBC,
+	          &error );
+
+	FCRYPTO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FCRYPTO_TEST_ASSERT_IS_NOT_NULL(
+	 "cipher",
+	 cipher );
+
+	FCRYPTO_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test libfcrypto_cipher_free with memset failing
+	 */
+	fcrypto_test_memset_attempts_before_fail = 0;
+
+	result = libfcrypto_cipher_free(
+	          &cipher,
+	          &error );
+
+	if( fcrypto_test_memset_attempts_before_fail != -1 )
+	{
+		fcrypto_test_memset_attempts_before_fail = -1;
+	}
+	else
+	{
+		FCRYPTO_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 -1 );
+
+		FCRYPTO_TEST_ASSERT_IS_NOT_NULL(
+		 "error",
+		 error );
+
+		libcerror_error_free(
+		 &error );
+	}
+	/* Clean up
+	 */
+	result = libfcrypto_cipher_free(
+	          &cipher,
+	          &error );
+
+	FCRYPTO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FCRYPTO_TEST_ASSERT_IS_NULL(
+	 "cipher",
+	 cipher );
+
+	FCRYPTO_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+#endif /* defined( HAVE_FCRYPTO_TEST_MEMORY ) */
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+#if defined( HAVE_FCRYPTO_TEST_MEMORY )
+	if( cipher != NULL )
+	{
+		libfcrypto_cipher_free(
+		 &cipher,
+		 NULL );
+	}
+#endif
+	return( 0 );
+}
+
+/* Tests the libfcrypto_cipher_set_key function
+ * Returns 1 if successful or 0 if not
+ */
+int fcrypto_test_cipher_set_key(
+     void )
+{
+	uint8_t key[ 32 ] = {
+		0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09, 0x0a, 0x0b, 0x0c, 0x0d, 0x0e, 0x0f,
+		0x10, 0x11, 0x12, 0x13, 0x14, 0x15, 0x16, 0x17, 0x18, 0x19, 0x1a, 0x1b, 0x1c, 0x1d, 0x1e, 0x1f };
+
+	libcerror_error_t *error    = NULL;
+	libfcrypto_cipher_t *cipher = NULL;
+	int result                  = 0;
+
+	/* Initialize test
+	 */
+	result = libfcrypto_cipher_initialize(
+	          &cipher,
+	          LIBFCRYPTO_CIPHER_ALGORITHM_SERPENT,
+	          LIBFCRYPTO_CIPHER_MODE_CBC,
+	          &error );
+
+	FCRYPTO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FCRYPTO_TEST_ASSERT_IS_NOT_NULL(
+	 "cipher",
+	 cipher );
+
+	FCRYPTO_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libfcrypto_cipher_set_key(
+	          cipher,
+	          key,
+	          256,
+	          &error );
+
+	FCRYPTO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FCRYPTO_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libfcrypto_cipher_set_key(
+	          NULL,
+	          key,
+	          256,
+	          &error );
+
+	FCRYPTO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FCRYPTO_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfcrypto_cipher_set_key(
+	          cipher,
+	          NULL,
+	          256,
+	          &error );
+
+	FCRYPTO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FCRYPTO_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfcrypto_cipher_set_key(
+	          cipher,
+	          key,
+	          0,
+	          &error );
+
+	FCRYPTO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FCRYPTO_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libfcrypto_cipher_free(
+	          &cipher,
+	          &error );
+
+	FCRYPTO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FCRYPTO_TEST_ASSERT_IS_NULL(
+	 "cipher",
+	 cipher );
+
+	FCRYPTO_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( cipher != NULL )
+	{
+		libfcrypto_cipher_free(
+		 &cipher,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libfcrypto_cipher_get_block_size function
+ * Returns 1 if successful or 0 if not
+ */
+int fcrypto_test_cipher_get_block_size(
+     void )
+{
+	libcerror_error_t *error    = NULL;
+	libfcrypto_cipher_t *cipher = NULL;
+	size_t block_size           = 0;
+	int result                  = 0;
+
+	/* Initialize test
+	 */
+	result = libfcrypto_cipher_initialize(
+	          &cipher,
+	          LIBFCRYPTO_CIPHER_ALGORITHM_SERPENT,
+	          LIBFCRYPTO_CIPHER_MODE_CTR,
+	          &error );
+
+	FCRYPTO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FCRYPTO_TEST_ASSERT_IS_NOT_NULL(
+	 "cipher",
+	 cipher );
+
+	FCRYPTO_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libfcrypto_cipher_get_block_size(
+	          cipher,
+	          &block_size,
+	          &error );
+
+	FCRYPTO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FCRYPTO_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FCRYPTO_TEST_ASSERT_EQUAL_SIZE(
+	 "block_size",
+	 block_size,
+	 (size_t) 16 );
+
+	/* Test error cases
+	 */
+	result = libfcrypto_cipher_get_block_size(
+	          NULL,
+	          &block_size,
+	          &error );
+
+	FCRYPTO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FCRYPTO_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfcrypto_cipher_get_block_size(
+	          cipher,
+	          NULL,
+	          &error );
+
+	FCRYPTO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FCRYPTO_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libfcrypto_cipher_free(
+	          &cipher,
+	          &error );
+
+	FCRYPTO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FCRYPTO_TEST_ASSERT_IS_NULL(
+	 "cipher",
+	 cipher );
+
+	FCRYPTO_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( cipher != NULL )
+	{
+		libfcrypto_cipher_free(
+		 &cipher,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libfcrypto_cipher_set_thread_pool function
+ * Returns 1 if successful or 0 if not
+ */
+int fcrypto_test_cipher_set_thread_pool(
+     void )
+{
+	libcerror_error_t *error               = NULL;
+	libfcrypto_cipher_t *cipher            = NULL;
+	libfcrypto_thread_pool_t *thread_pool = NULL;
+	int result                             = 0;
+
+	/* Initialize test
+	 */
+	result = libfcrypto_cipher_initialize(
+	          &cipher,
+	          LIBFCRYPTO_CIPHER_ALGORITHM_SERPENT,
+	          LIBFCRYPTO_CIPHER_MODE_CTR,
+	          &error );
+
+	FCRYPTO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FCRYPTO_TEST_ASSERT_IS_NOT_NULL(
+	 "cipher",
+	 cipher );
+
+	FCRYPTO_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfcrypto_thread_pool_initialize(
+	          &thread_pool,
+	          2,
+	          &error );
+
+	FCRYPTO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FCRYPTO_TEST_ASSERT_IS_NOT_NULL(
+	 "thread_pool",
+	 thread_pool );
+
+	FCRYPTO_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libfcrypto_cipher_set_thread_pool(
+	          cipher,
+	          thread_pool,
+	          1024,
+	          &error );
+
+	FCRYPTO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FCRYPTO_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfcrypto_cipher_set_thread_pool(
+	          cipher,
+	          NULL,
+	          16,
+	          &error );
+
+	FCRYPTO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FCRYPTO_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libfcrypto_cipher_set_thread_pool(
+	          NULL,
+	          thread_pool,
+	          1024,
+	          &error );
+
+	FCRYPTO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FCRYPTO_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfcrypto_cipher_set_thread_pool(
+	          cipher,
+	          thread_pool,
+	          8,
+	          &error );
+
+	FCRYPTO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FCRYPTO_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfcrypto_cipher_set_thread_pool(
+	          cipher,
+	          thread_pool,
+	          (size_t) SSIZE_MAX + 1,
+	          &error );
+
+	FCRYPTO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FCRYPTO_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libfcrypto_thread_pool_free(
+	          &thread_pool,
+	          &error );
+
+	FCRYPTO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FCRYPTO_TEST_ASSERT_IS_NULL(
+	 "thread_pool",
+	 thread_pool );
+
+	FCRYPTO_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfcrypto_cipher_free(
+	          &cipher,
+	          &error );
+
+	FCRYPTO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FCRYPTO_TEST_ASSERT_IS_NULL(
+	 "cipher",
+	 cipher );
+
+	FCRYPTO_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( thread_pool != NULL )
+	{
+		libfcrypto_thread_pool_free(
+		 &thread_pool,
+		 NULL );
+	}
+	if( cipher != NULL )
+	{
+		libfcrypto_cipher_free(
+		 &cipher,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libfcrypto_cipher_crypt function with a specific algorithm and mode
+ * Returns 1 if successful or 0 if not
+ */
+int fcrypto_test_cipher_crypt_with_algorithm_and_mode(
+     int algorithm,
+     int mode )
+{
+	uint8_t initialization_vector[ 16 ] = {
+		0xf0, 0xf1, 0xf2, 0xf3, 0xf4, 0xf5, 0xf6, 0xf7, 0xf8, 0xf9, 0xfa, 0xfb, 0xfc, 0xfd, 0xfe, 0xff };
+
+	uint8_t key[ 32 ] = {
+		0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09, 0x0a, 0x0b, 0x0c, 0x0d, 0x0e, 0x0f,
+		0x10, 0x11, 0x12, 0x13, 0x14, 0x15, 0x16, 0x17, 0x18, 0x19, 0x1a, 0x1b, 0x1c, 0x1d, 0x1e, 0x1f };
+
+	uint8_t expected_output_data[ 512 ];
+	uint8_t input_data[ 512 ];
+	uint8_t output_data[ 512 ];
+
+	libcerror_error_t *error    = NULL;
+	libfcrypto_cipher_t *cipher = NULL;
+	intptr_t *context           = NULL;
+	size_t block_size           = 0;
+	size_t data_offset          = 0;
+	size_t key_bit_size         = 0;
+	int result                  = 0;
+
+	/* Initialize test
+	 */
+	for( data_offset = 0;
+	     data_offset < 512;
+	     data_offset++ )
+	{
+		input_data[ data_offset ] = (uint8_t) ( ( data_offset * 13 ) + 5 );
+	}
+	result = libfcrypto_cipher_initialize(
+	          &cipher,
+	          algorithm,
+	          mode,
+	          &error );
+
+	FCRYPTO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FCRYPTO_TEST_ASSERT_IS_NOT_NULL(
+	 "cipher",
+	 cipher );
+
+	FCRYPTO_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfcrypto_cipher_get_block_size(
+	          cipher,
+	          &block_size,
+	          &error );
+
+	FCRYPTO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FCRYPTO_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Calculate the expected output data with the algorithm specific functions
+	 */
+	switch( algorithm )
+	{
+		case LIBFCRYPTO_CIPHER_ALGORITHM_BLOWFISH:
+			key_bit_size = 128;
+
+			result = libfcrypto_blowfish_context_initialize(
+			          (libfcrypto_blowfish_context_t **) &context,
+			          &error );
+
+			if( result == 1 )
+			{
+				result = libfcrypto_blowfish_context_set_key(
+				          (libfcrypto_blowfish_context_t *) context,
+				          key,
+				          key_bit_size,
+				          &error );
+			}
+			if( result == 1 )
+			{
+				if( mode == LIBFCRYPTO_CIPHER_MODE_CBC )
+				{
+					result = libfcrypto_blowfish_crypt_cbc(
+					          (libfcrypto_blowfish_context_t *) context,
+					          LIBFCRYPTO_CRYPT_MODE_ENCRYPT,
+					          initialization_vector,
+					          8,
+					          input_data,
+					          512,
+					          expected_output_data,
+					          512,
+					          &error );
+				}
+				else if( mode == LIBFCRYPTO_CIPHER_MODE_CTR )
+				{
+					result = libfcrypto_blowfish_crypt_ctr(
+					          (libfcrypto_blowfish_context_t *) context,
+					          initialization_vector,
+					          8,
+					          8,
+					          LIBFCRYPTO_ENDIAN_BIG,
+					          0,
+					          input_data,
+					          512,
+					          expected_output_data,
+					          512,
+					          &error );
+				}
+				else
+				{
+					result = libfcrypto_blowfish_crypt_ecb(
+					          (libfcrypto_blowfish_context_t *) context,
+					          LIBFCRYPTO_CRYPT_MODE_ENCRYPT,
+					          input_data,
+					          512,
+					          expected_output_data,
+					          512,
+					          &error );
+				}
+			}
+			if( context != NULL )
+			{
+				libfcrypto_blowfish_context_free(
+				 (libfcrypto_blowfish_context_t **) &context,
+				 NULL );
+			}
+			break;
+
+		case LIBFCRYPTO_CIPHER_ALGORITHM_DES3:
+			key_bit_size = 192;
+
+			result = libfcrypto_des3_context_initialize(
+			          (libfcrypto_des3_context_t **) &context,
+			          &error );
+
+			if( result == 1 )
+			{
+				result = libfcrypto_des3_context_set_key(
+				          (libfcrypto_des3_context_t *) context,
+				          key,
+				          key_bit_size,
+				          &error );
+			}
+			if( result == 1 )
+			{
+				if( mode == LIBFCRYPTO_CIPHER_MODE_CBC )
+				{
+					result = libfcrypto_des3_crypt_cbc(
+					          (libfcrypto_des3_context_t *) context,
+					          LIBFCRYPTO_CRYPT_MODE_ENCRYPT,
+					          initialization_vector,
+					          8,
+					          input_data,
+					          512,
+					          expected_output_data,
+					          512,
+					          &error );
+				}
+				else if( mode == LIBFCRYPTO_CIPHER_MODE_CTR )
+				{
+					result = libfcrypto_des3_crypt_ctr(
+					          (libfcrypto_des3_context_t *) context,
+					          initialization_vector,
+					          8,
+					          8,
+					          LIBFCRYPTO_ENDIAN_BIG,
+					          0,
+					          input_data,
+					          512,
+					          expected_output_data,
+					          512,
+					          &error );
+				}
+				else
+				{
+					result = libfcrypto_des3_crypt_ecb(
+					          (libfcrypto_des3_context_t *) context,
+					          LIBFCRYPTO_CRYPT_MODE_ENCRYPT,
+					          input_data,
+					          512,
+					          expected_output_data,
+					          512,
+					          &error );
+				}
+			}
+			if( context != NULL )
+			{
+				libfcrypto_des3_context_free(
+				 (libfcrypto_des3_context_t **) &context,
+				 NULL );
+			}
+			break;
+
+		case LIBFCRYPTO_CIPHER_ALGORITHM_RC4:
+			key_bit_size = 128;
+
+			result = libfcrypto_rc4_context_initialize(
+			          (libfcrypto_rc4_context_t **) &context,
+			          &error );
+
+			if( result == 1 )
+			{
+				result = libfcrypto_rc4_context_set_key(
+				          (libfcrypto_rc4_context_t *) context,
+				          key,
+				          key_bit_size,
+				          &error );
+			}
+			if( result == 1 )
+			{
+				result = libfcrypto_rc4_crypt(
+				          (libfcrypto_rc4_context_t *) context,
+				          input_data,
+				          512,
+				          expected_output_data,
+				          512,
+				          &error );
+			}
+			if( context != NULL )
+			{
+				libfcrypto_rc4_context_free(
+				 (libfcrypto_rc4_context_t **) &context,
+				 NULL );
+			}
+			break;
+
+		case LIBFCRYPTO_CIPHER_ALGORITHM_SERPENT:
+			key_bit_size = 256;
+
+			result = libfcrypto_serpent_context_initialize(
+			          (libfcrypto_serpent_context_t **) &context,
+			          &error );
+
+			if( result == 1 )
+			{
+				result = libfcrypto_serpent_context_set_key(
+				          (libfcrypto_serpent_context_t *) context,
+				          key,
+				          key_bit_size,
+				          &error );
+			}
+			if( result == 1 )
+			{
+				if( mode == LIBFCRYPTO_CIPHER_MODE_CBC )
+				{
+					result = libfcrypto_serpent_crypt_cbc(
+					          (libfcrypto_serpent_context_t *) context,
+					          LIBFCRYPTO_CRYPT_MODE_ENCRYPT,
+					          initialization_vector,
+					          16,
+					          input_data,
+					          512,
+					          expected_output_data,
+					          512,
+					          &error );
+				}
+				else if( mode == LIBFCRYPTO_CIPHER_MODE_CTR )
+				{
+					result = libfcrypto_serpent_crypt_ctr(
+					          (libfcrypto_serpent_context_t *) context,
+					          initialization_vector,
+					          16,
+					          16,
+					          LIBFCRYPTO_ENDIAN_BIG,
+					          0,
+					          input_data,
+					          512,
+					          expected_output_data,
+					          512,
+					          &error );
+				}
+				else
+				{
+					result = libfcrypto_serpent_crypt_ecb(
+					          (libfcrypto_serpent_context_t *) context,
+					          LIBFCRYPTO_CRYPT_MODE_ENCRYPT,
+					          input_data,
+					          512,
+					          expected_output_data,
+					          512,
+					          &error );
+				}
+			}
+			if( context != NULL )
+			{
+				libfcrypto_serpent_context_free(
+				 (libfcrypto_serpent_context_t **) &context,
+				 NULL );
+			}
+			break;
+	}
+	FCRYPTO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FCRYPTO_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfcrypto_cipher_set_key(
+	          cipher,
+	          key,
+	          key_bit_size,
+	          &error );
+
+	FCRYPTO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FCRYPTO_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test encrypting data
+	 */
+	result = libfcrypto_cipher_crypt(
+	          cipher,
+	          LIBFCRYPTO_CRYPT_MODE_ENCRYPT,
+	          initialization_vector,
+	          block_size,
+	          input_data,
+	          512,
+	          output_data,
+	          512,
+	          &error );
+
+	FCRYPTO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FCRYPTO_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = memory_compare(
+	          output_data,
+	          expected_output_data,
+	          512 );
+
+	FCRYPTO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	/* Test decrypting data, RC4 requires the key to be set again to restart the key stream
+	 */
+	result = libfcrypto_cipher_set_key(
+	          cipher,
+	          key,
+	          key_bit_size,
+	          &error );
+
+	FCRYPTO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FCRYPTO_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfcrypto_cipher_crypt(
+	          cipher,
+	          LIBFCRYPTO_CRYPT_MODE_DECRYPT,
+	          initialization_vector,
+	          block_size,
+	          expected_output_data,
+	          512,
+	          output_data,
+	          512,
+	          &error );
+
+	FCRYPTO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FCRYPTO_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = memory_compare(
+	          output_data,
+	          input_data,
+	          512 );
+
+	FCRYPTO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	/* Test encrypting and decrypting data in-place, where the decrypted size is not
+	 * a multitude of the number of blocks that are processed at once
+	 */
+	result = libfcrypto_cipher_set_key(
+	          cipher,
+	          key,
+	          key_bit_size,
+	          &error );
+
+	FCRYPTO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FCRYPTO_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	memory_copy(
+	 output_data,
+	 input_data,
+	 512 );
+
+	result = libfcrypto_cipher_crypt(
+	          cipher,
+	          LIBFCRYPTO_CRYPT_MODE_ENCRYPT,
+	          initialization_vector,
+	          block_size,
+	          output_data,
+	          512,
+	          output_data,
+	          512,
+	          &error );
+
+	FCRYPTO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FCRYPTO_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = memory_compare(
+	          output_data,
+	          expected_output_data,
+	          512 );
+
+	FCRYPTO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	result = libfcrypto_cipher_set_key(
+	          cipher,
+	          key,
+	          key_bit_size,
+	          &error );
+
+	FCRYPTO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FCRYPTO_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfcrypto_cipher_crypt(
+	          cipher,
+	          LIBFCRYPTO_CRYPT_MODE_DECRYPT,
+	          initialization_vector,
+	          block_size,
+	          output_data,
+	          496,
+	          output_data,
+	          496,
+	          &error );
+
+	FCRYPTO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FCRYPTO_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = memory_compare(
+	          output_data,
+	          input_data,
+	          496 );
+
+	FCRYPTO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	/* Test error cases
+	 */
+	result = libfcrypto_cipher_crypt(
+	          NULL,
+	          LIBFCRYPTO_CRYPT_MODE_ENCRYPT,
+	          initialization_vector,
+	          block_size,
+	          input_data,
+	          512,
+	          output_data,
+	          512,
+	          &error );
+
+	FCRYPTO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FCRYPTO_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfcrypto_cipher_crypt(
+	          cipher,
+	          LIBFCRYPTO_CRYPT_MODE_ENCRYPT,
+	          initialization_vector,
+	          block_size,
+	          NULL,
+	          512,
+	          output_data,
+	          512,
+	          &error );
+
+	FCRYPTO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FCRYPTO_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libfcrypto_cipher_free(
+	          &cipher,
+	          &error );
+
+	FCRYPTO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FCRYPTO_TEST_ASSERT_IS_NULL(
+	 "cipher",
+	 cipher );
+
+	FCRYPTO_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( cipher != NULL )
+	{
+		libfcrypto_cipher_free(
+		 &cipher,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libfcrypto_cipher_crypt function
+ * Returns 1 if successful or 0 if not
+ */
+int fcrypto_test_cipher_crypt(
+     void )
+{
+	int algorithms[ 3 ] = {
+		LIBFCRYPTO_CIPHER_ALGORITHM_BLOWFISH, LIBFCRYPTO_CIPHER_ALGORITHM_DES3, LIBFCRYPTO_CIPHER_ALGORITHM_SERPENT };
+
+	int modes[ 3 ] = {
+		LIBFCRYPTO_CIPHER_MODE_CBC, LIBFCRYPTO_CIPHER_MODE_CTR, LIBFCRYPTO_CIPHER_MODE_ECB };
+
+	int algorithm_index = 0;
+	int mode_index      = 0;
+	int result          = 0;
+
+	for( algorithm_index = 0;
+	     algorithm_index < 3;
+	     algorithm_index++ )
+	{
+		for( mode_index = 0;
+		     mode_index < 3;
+		     mode_index++ )
+		{
+			result = fcrypto_test_cipher_crypt_with_algorithm_and_mode(
+			          algorithms[ algorithm_index ],
+			          modes[ mode_index ] );
+
+			FCRYPTO_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 1 );
+		}
+	}
+	result = fcrypto_test_cipher_crypt_with_algorithm_and_mode(
+	          LIBFCRYPTO_CIPHER_ALGORITHM_RC4,
+	          LIBFCRYPTO_CIPHER_MODE_STREAM );
+
+	FCRYPTO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	return( 1 );
+
+on_error:
+	return( 0 );
+}
+
+/* Tests the libfcrypto_cipher_crypt_segments function with a specific algorithm and mode
+ * Returns 1 if successful or 0 if not
+ */
+int fcrypto_test_cipher_crypt_segments_with_algorithm_and_mode(
+     int algorithm,
+     int mode )
+{
+	uint8_t initialization_vector[ 16 ] = {
+		0xf0, 0xf1, 0xf2, 0xf3, 0xf4, 0xf5, 0xf6, 0xf7, 0xf8, 0xf9, 0xfa, 0xfb, 0xfc, 0xfd, 0xfe, 0xff };
+
+	uint8_t key[ 32 ] = {
+		0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09, 0x0a, 0x0b, 0x0c, 0x0d, 0x0e, 0x0f,
+		0x10, 0x11, 0x12, 0x13, 0x14, 0x15, 0x16, 0x17, 0x18, 0x19, 0x1a, 0x1b, 0x1c, 0x1d, 0x1e, 0x1f };
+
+	size_t input_segment_sizes[ 5 ] = {
+		5, 100, 0, 251, 156 };
+
+	size_t output_segment_sizes[ 3 ] = {
+		64, 3, 445 };
+
+	const uint8_t *input_segments[ 5 ];
+	uint8_t *output_segments[ 3 ];
+	uint8_t expected_output_data[ 512 ];
+	uint8_t input_data[ 512 ];
+	uint8_t output_data[ 512 ];
+
+	libcerror_error_t *error    = NULL;
+	libfcrypto_cipher_t *cipher = NULL;
+	size_t block_size           = 0;
+	size_t data_offset          = 0;
+	size_t data_size            = 512;
+	size_t key_bit_size         = 256;
+	int crypt_mode              = 0;
+	int result                  = 0;
+	int segment_index           = 0;
+
+	/* Initialize test
+	 */
+	for( data_offset = 0;
+	     data_offset < 512;
+	     data_offset++ )
+	{
+		input_data[ data_offset ] = (uint8_t) ( ( data_offset * 13 ) + 5 );
+	}
+	if( algorithm == LIBFCRYPTO_CIPHER_ALGORITHM_BLOWFISH )
+	{
+		key_bit_size = 128;
+	}
+	else if( algorithm == LIBFCRYPTO_CIPHER_ALGORITHM_DES3 )
+	{
+		key_bit_size = 192;
+	}
+	/* CTR and stream mode support data that is not a multitude of the block size
+	 */
+	if( ( mode == LIBFCRYPTO_CIPHER_MODE_CTR )
+	 || ( mode == LIBFCRYPTO_CIPHER_MODE_STREAM ) )
+	{
+		data_size                 = 509;
+		input_segment_sizes[ 4 ]  = 153;
+		output_segment_sizes[ 2 ] = 442;
+	}
+	data_offset = 0;
+
+	for( segment_index = 0;
+	     segment_index < 5;
+	     segment_index++ )
+	{
+		input_segments[ segment_index ] = &( input_data[ data_offset ] );
+
+		data_offset += input_segment_sizes[ segment_index ];
+	}
+	data_offset = 0;
+
+	for( segment_index = 0;
+	     segment_index < 3;
+	     segment_index++ )
+	{
+		output_segments[ segment_index ] = &( output_data[ data_offset ] );
+
+		data_offset += output_segment_sizes[ segment_index ];
+	}
+	result = libfcrypto_cipher_initialize(
+	          &cipher,
+	          algorithm,
+	          mode,
+	          &error );
+
+	FCRYPTO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FCRYPTO_TEST_ASSERT_IS_NOT_NULL(
+	 "cipher",
+	 cipher );
+
+	FCRYPTO_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfcrypto_cipher_get_block_size(
+	          cipher,
+	          &block_size,
+	          &error );
+
+	FCRYPTO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FCRYPTO_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	for( crypt_mode = LIBFCRYPTO_CRYPT_MODE_DECRYPT;
+	     crypt_mode <= LIBFCRYPTO_CRYPT_MODE_ENCRYPT;
+	     crypt_mode++ )
+	{
+		/* Calculate the expected output data by (de/en)crypting the data at once,
+		 * RC4 requires the key to be set again to restart the key stream
+		 */
+		result = libfcrypto_cipher_set_key(
+		          cipher,
+		          key,
+		          key_bit_size,
+		          &error );
+
+		FCRYPTO_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		FCRYPTO_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		result = libfcrypto_cipher_crypt(
+		          cipher,
+		          crypt_mode,
+		          initialization_vector,
+		          block_size,
+		          input_data,
+		          data_size,
+		          expected_output_data,
+		          data_size,
+		          &error );
+
+		FCRYPTO_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		FCRYPTO_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		result = libfcrypto_cipher_set_key(
+		          cipher,
+		          key,
+		          key_bit_size,
+		          &error );
+
+		FCRYPTO_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		FCRYPTO_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		/* Test de- or encrypting data with blocks that straddle segment boundaries
+		 */
+		result = libfcrypto_cipher_crypt_segments(
+		          cipher,
+		          crypt_mode,
+		          initialization_vector,
+		          block_size,
+		          input_segments,
+		          input_segment_sizes,
+		          5,
+		          output_segments,
+		          output_segment_sizes,
+		          3,
+		          &error );
+
+		FCRYPTO_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		FCRYPTO_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		result = memory_compare(
+		          output_data,
+		          expected_output_data,
+		          data_size );
+
+		FCRYPTO_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 0 );
+	}
+	/* Test error cases
+	 */
+	result = libfcrypto_cipher_crypt_segments(
+	          NULL,
+	          LIBFCRYPTO_CRYPT_MODE_ENCRYPT,
+	          initialization_vector,
+	          block_size,
+	          input_segments,
+	          input_segment_sizes,
+	          5,
+	          output_segments,
+	          output_segment_sizes,
+	          3,
+	          &error );
+
+	FCRYPTO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FCRYPTO_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfcrypto_cipher_crypt_segments(
+	          cipher,
+	          -1,
+	          initialization_vector,
+	          block_size,
+	          input_segments,
+	          input_segment_sizes,
+	          5,
+	          output_segments,
+	          output_segment_sizes,
+	          3,
+	          &error );
+
+	FCRYPTO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FCRYPTO_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfcrypto_cipher_crypt_segments(
+	          cipher,
+	          LIBFCRYPTO_CRYPT_MODE_ENCRYPT,
+	          initialization_vector,
+	          block_size,
+	          NULL,
+	          input_segment_sizes,
+	          5,
+	          output_segments,
+	          output_segment_sizes,
+	          3,
+	          &error );
+
+	FCRYPTO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FCRYPTO_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfcrypto_cipher_crypt_segments(
+	          cipher,
+	          LIBFCRYPTO_CRYPT_MODE_ENCRYPT,
+	          initialization_vector,
+	          block_size,
+	          input_segments,
+	          NULL,
+	          5,
+	          output_segments,
+	          output_segment_sizes,
+	          3,
+	          &error );
+
+	FCRYPTO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FCRYPTO_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfcrypto_cipher_crypt_segments(
+	          cipher,
+	          LIBFCRYPTO_CRYPT_MODE_ENCRYPT,
+	          initialization_vector,
+	          block_size,
+	          input_segments,
+	          input_segment_sizes,
+	          -1,
+	          output_segments,
+	          output_segment_sizes,
+	          3,
+	          &error );
+
+	FCRYPTO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FCRYPTO_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfcrypto_cipher_crypt_segments(
+	          cipher,
+	          LIBFCRYPTO_CRYPT_MODE_ENCRYPT,
+	          initialization_vector,
+	          block_size,
+	          input_segments,
+	          input_segment_sizes,
+	          5,
+	          NULL,
+	          output_segment_sizes,
+	          3,
+	          &error );
+
+	FCRYPTO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FCRYPTO_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfcrypto_cipher_crypt_segments(
+	          cipher,
+	          LIBFCRYPTO_CRYPT_MODE_ENCRYPT,
+	          initialization_vector,
+	          block_size,
+	          input_segments,
+	          input_segment_sizes,
+	          5,
+	          output_segments,
+	          NULL,
+	          3,
+	          &error );
+
+	FCRYPTO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FCRYPTO_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfcrypto_cipher_crypt_segments(
+	          cipher,
+	          LIBFCRYPTO_CRYPT_MODE_ENCRYPT,
+	          initialization_vector,
+	          block_size,
+	          input_segments,
+	          input_segment_sizes,
+	          5,
+	          output_segments,
+	          output_segment_sizes,
+	          -1,
+	          &error );
+
+	FCRYPTO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FCRYPTO_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	input_segments[ 1 ] = NULL;
+
+	result = libfcrypto_cipher_crypt_segments(
+	          cipher,
+	          LIBFCRYPTO_CRYPT_MODE_ENCRYPT,
+	          initialization_vector,
+	          block_size,
+	          input_segments,
+	          input_segment_sizes,
+	          5,
+	          output_segments,
+	          output_segment_sizes,
+	          3,
+	          &error );
+
+	FCRYPTO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FCRYPTO_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	input_segments[ 1 ] = &( input_data[ 5 ] );
+
+	result = libfcrypto_cipher_crypt_segments(
+	          cipher,
+	          LIBFCRYPTO_CRYPT_MODE_ENCRYPT,
+	          initialization_vector,
+	          block_size,
+	          input_segments,
+	          input_segment_sizes,
+	          5,
+	          output_segments,
+	          output_segment_sizes,
+	          2,
+	          &error );
+
+	FCRYPTO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FCRYPTO_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Test error cases specific to CBC mode
+	 */
+	if( mode == LIBFCRYPTO_CIPHER_MODE_CBC )
+	{
+		result = libfcrypto_cipher_crypt_segments(
+		          cipher,
+		          LIBFCRYPTO_CRYPT_MODE_ENCRYPT,
+		          NULL,
+		          block_size,
+		          input_segments,
+		          input_segment_sizes,
+		          5,
+		          output_segments,
+		          output_segment_sizes,
+		          3,
+		          &error );
+
+		FCRYPTO_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 -1 );
+
+		FCRYPTO_TEST_ASSERT_IS_NOT_NULL(
+		 "error",
+		 error );
+
+		libcerror_error_free(
+		 &error );
+
+		result = libfcrypto_cipher_crypt_segments(
+		          cipher,
+		          LIBFCRYPTO_CRYPT_MODE_ENCRYPT,
+		          initialization_vector,
+		          0,
+		          input_segments,
+		          input_segment_sizes,
+		          5,
+		          output_segments,
+		          output_segment_sizes,
+		          3,
+		          &error );
+
+		FCRYPTO_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 -1 );
+
+		FCRYPTO_TEST_ASSERT_IS_NOT_NULL(
+		 "error",
+		 error );
+
+		libcerror_error_free(
+		 &error );
+
+		result = libfcrypto_cipher_crypt_segments(
+		          cipher,
+		          LIBFCRYPTO_CRYPT_MODE_ENCRYPT,
+		          initialization_vector,
+		          block_size,
+		          input_segments,
+		          input_segment_sizes,
+		          1,
+		          output_segments,
+		          input_segment_sizes,
+		          1,
+		          &error );
+
+		FCRYPTO_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 -1 );
+
+		FCRYPTO_TEST_ASSERT_IS_NOT_NULL(
+		 "error",
+		 error );
+
+		libcerror_error_free(
+		 &error );
+	}
+	/* Clean up
+	 */
+	result = libfcrypto_cipher_free(
+	          &cipher,
+	          &error );
+
+	FCRYPTO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FCRYPTO_TEST_ASSERT_IS_NULL(
+	 "cipher",
+	 cipher );
+
+	FCRYPTO_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( cipher != NULL )
+	{
+		libfcrypto_cipher_free(
+		 &cipher,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libfcrypto_cipher_crypt_segments function
+ * Returns 1 if successful or 0 if not
+ */
+int fcrypto_test_cipher_crypt_segments(
+     void )
+{
+	int algorithms[ 3 ] = {
+		LIBFCRYPTO_CIPHER_ALGORITHM_BLOWFISH, LIBFCRYPTO_CIPHER_ALGORITHM_DES3, LIBFCRYPTO_CIPHER_ALGORITHM_SERPENT };
+
+	int modes[ 3 ] = {
+		LIBFCRYPTO_CIPHER_MODE_CBC, LIBFCRYPTO_CIPHER_MODE_CTR, LIBFCRYPTO_CIPHER_MODE_ECB };
+
+	int algorithm_index = 0;
+	int mode_index      = 0;
+	int result          = 0;
+
+	for( algorithm_index = 0;
+	     algorithm_index < 3;
+	     algorithm_index++ )
+	{
+		for( mode_index = 0;
+		     mode_index < 3;
+		     mode_index++ )
+		{
+			result = fcrypto_test_cipher_crypt_segments_with_algorithm_and_mode(
+			          algorithms[ algorithm_index ],
+			          modes[ mode_index ] );
+
+			FCRYPTO_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 1 );
+		}
+	}
+	result = fcrypto_test_cipher_crypt_segments_with_algorithm_and_mode(
+	          LIBFCRYPTO_CIPHER_ALGORITHM_RC4,
+	          LIBFCRYPTO_CIPHER_MODE_STREAM );
+
+	FCRYPTO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	return( 1 );
+
+on_error:
+	return( 0 );
+}
+
+/* Generates a plain initialization vector from the data unit number
+ * Returns 1 if successful or -1 on error
+ */
+int fcrypto_test_cipher_get_plain_initialization_vector(
+     intptr_t *function_data FCRYPTO_TEST_ATTRIBUTE_UNUSED,
+     uint64_t data_unit_number,
+     uint8_t *initialization_vector,
+     size_t initialization_vector_size,
+     libcerror_error_t **error FCRYPTO_TEST_ATTRIBUTE_UNUSED )
+{
+	size_t byte_index = 0;
+
+	FCRYPTO_TEST_UNREFERENCED_PARAMETER( function_data )
+	FCRYPTO_TEST_UNREFERENCED_PARAMETER( error )
+
+	for( byte_index = 0;
+	     byte_index < initialization_vector_size;
+	     byte_index++ )
+	{
+		initialization_vector[ byte_index ] = (uint8_t) ( data_unit_number & 0xff );
+
+		data_unit_number >>= 8;
+	}
+	return( 1 );
+}
+
+/* Tests the libfcrypto_cipher_crypt_cbc_data_units function with a specific algorithm
+ * Returns 1 if successful or 0 if not
+ */
+int fcrypto_test_cipher_crypt_cbc_data_units_with_algorithm(
+     int algorithm,
+     size_t data_unit_size,
+     size_t number_of_data_units )
+{
+	uint8_t key[ 32 ] = {
+		0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09, 0x0a, 0x0b, 0x0c, 0x0d, 0x0e, 0x0f,
+		0x10, 0x11, 0x12, 0x13, 0x14, 0x15, 0x16, 0x17, 0x18, 0x19, 0x1a, 0x1b, 0x1c, 0x1d, 0x1e, 0x1f };
+
+	uint8_t expected_output_data[ 8224 ];
+	uint8_t initialization_vectors[ 9 * 16 ];
+	uint8_t input_data[ 8224 ];
+	uint8_t output_data[ 8224 ];
+
+	libcerror_error_t *error    = NULL;
+	libfcrypto_cipher_t *cipher = NULL;
+	size_t block_size           = 0;
+	size_t data_offset          = 0;
+	size_t data_size            = 0;
+	size_t data_unit_index      = 0;
+	size_t key_bit_size         = 256;
+	int result                  = 0;
+
+	/* Initialize test
+	 */
+	data_size = data_unit_size * number_of_data_units;
+
+	for( data_offset = 0;
+	     data_offset < data_size;
+	     data_offset++ )
+	{
+		input_data[ data_offset ] = (uint8_t) ( ( data_offset * 13 ) + 5 );
+	}
+	if( algorithm == LIBFCRYPTO_CIPHER_ALGORITHM_BLOWFISH )
+	{
+		key_bit_size = 128;
+	}
+	else if( algorithm == LIBFCRYPTO_CIPHER_ALGORITHM_DES3 )
+	{
+		key_bit_size = 192;
+	}
+	result = libfcrypto_cipher_initialize(
+	          &cipher,
+	          algorithm,
+	          LIBFCRYPTO_CIPHER_MODE_CBC,
+	          &error );
+
+	FCRYPTO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FCRYPTO_TEST_ASSERT_IS_NOT_NULL(
+	 "cipher",
+	 cipher );
+
+	FCRYPTO_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfcrypto_cipher_set_key(
+	          cipher,
+	          key,
+	          key_bit_size,
+	          &error );
+
+	FCRYPTO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FCRYPTO_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfcrypto_cipher_get_block_size(
+	          cipher,
+	          &block_size,
+	          &error );
+
+	FCRYPTO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FCRYPTO_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Calculate the expected output data by encrypting every data unit on its own
+	 */
+	for( data_unit_index = 0;
+	     data_unit_index < number_of_data_units;
+	     data_unit_index++ )
+	{
+		result = fcrypto_test_cipher_get_plain_initialization_vector(
+		          NULL,
+		          (uint64_t) ( 0x1000 + data_unit_index ),
+		          &( initialization_vectors[ data_unit_index * block_size ] ),
+		          block_size,
+		          &error );
+
+		FCRYPTO_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		result = libfcrypto_cipher_crypt(
+		          cipher,
+		          LIBFCRYPTO_CRYPT_MODE_ENCRYPT,
+		          &( initialization_vectors[ data_unit_index * block_size ] ),
+		          block_size,
+		          &( input_data[ data_unit_index * data_unit_size ] ),
+		          data_unit_size,
+		          &( expected_output_data[ data_unit_index * data_unit_size ] ),
+		          data_unit_size,
+		          &error );
+
+		FCRYPTO_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		FCRYPTO_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+	}
+	/* Test encryption with the initialization vector function
+	 */
+	result = libfcrypto_cipher_crypt_cbc_data_units(
+	          cipher,
+	          LIBFCRYPTO_CRYPT_MODE_ENCRYPT,
+	          0x1000,
+	          data_unit_size,
+	          NULL,
+	          0,
+	          &fcrypto_test_cipher_get_plain_initialization_vector,
+	          NULL,
+	          input_data,
+	          data_size,
+	          output_data,
+	          data_size,
+	          &error );
+
+	FCRYPTO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FCRYPTO_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = memory_compare(
+	          output_data,
+	          expected_output_data,
+	          data_size );
+
+	FCRYPTO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	/* Test decryption with the initialization vector function
+	 */
+	result = libfcrypto_cipher_crypt_cbc_data_units(
+	          cipher,
+	          LIBFCRYPTO_CRYPT_MODE_DECRYPT,
+	          0x1000,
+	          data_unit_size,
+	          NULL,
+	          0,
+	          &fcrypto_test_cipher_get_plain_initialization_vector,
+	          NULL,
+	          expected_output_data,
+	          data_size,
+	          output_data,
+	          data_size,
+	          &error );
+
+	FCRYPTO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FCRYPTO_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = memory_compare(
+	          output_data,
+	          input_data,
+	          data_size );
+
+	FCRYPTO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	/* Test in-place decryption with the initialization vectors
+	 */
+	memory_copy(
+	 output_data,
+	 expected_output_data,
+	 data_size );
+
+	result = libfcrypto_cipher_crypt_cbc_data_units(
+	          cipher,
+	          LIBFCRYPTO_CRYPT_MODE_DECRYPT,
+	          0x1000,
+	          data_unit_size,
+	          initialization_vectors,
+	          number_of_data_units * block_size,
+	          NULL,
+	          NULL,
+	          output_data,
+	          data_size,
+	          output_data,
+	          data_size,
+	          &error );
+
+	FCRYPTO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FCRYPTO_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = memory_compare(
+	          output_data,
+	          input_data,
+	          data_size );
+
+	FCRYPTO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	/* Test in-place encryption with the initialization vectors
+	 */
+	result = libfcrypto_cipher_crypt_cbc_data_units(
+	          cipher,
+	          LIBFCRYPTO_CRYPT_MODE_ENCRYPT,
+	          0x1000,
+	          data_unit_size,
+	          initialization_vectors,
+	          number_of_data_units * block_size,
+	          NULL,
+	          NULL,
+	          output_data,
+	          data_size,
+	          output_data,
+	          data_size,
+	          &error );
+
+	FCRYPTO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FCRYPTO_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = memory_compare(
+	          output_data,
+	          expected_output_data,
+	          data_size );
+
+	FCRYPTO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	/* Test error cases
+	 */
+	result = libfcrypto_cipher_crypt_cbc_data_units(
+	          NULL,
+	          LIBFCRYPTO_CRYPT_MODE_ENCRYPT,
+	          0x1000,
+	          data_unit_size,
+	          NULL,
+	          0,
+	          &fcrypto_test_cipher_get_plain_initialization_vector,
+	          NULL,
+	          input_data,
+	          data_size,
+	          output_data,
+	          data_size,
+	          &error );
+
+	FCRYPTO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FCRYPTO_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfcrypto_cipher_crypt_cbc_data_units(
+	          cipher,
+	          -1,
+	          0x1000,
+	          data_unit_size,
+	          NULL,
+	          0,
+	          &fcrypto_test_cipher_get_plain_initialization_vector,
+	          NULL,
+	          input_data,
+	          data_size,
+	          output_data,
+	          data_size,
+	          &error );
+
+	FCRYPTO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FCRYPTO_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfcrypto_cipher_crypt_cbc_data_units(
+	          cipher,
+	          LIBFCRYPTO_CRYPT_MODE_ENCRYPT,
+	          0x1000,
+	          0,
+	          NULL,
+	          0,
+	          &fcrypto_test_cipher_get_plain_initialization_vector,
+	          NULL,
+	          input_data,
+	          data_size,
+	          output_data,
+	          data_size,
+	          &error );
+
+	FCRYPTO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FCRYPTO_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfcrypto_cipher_crypt_cbc_data_units(
+	          cipher,
+	          LIBFCRYPTO_CRYPT_MODE_ENCRYPT,
+	          0x1000,
+	          block_size + 1,
+	          NULL,
+	          0,
+	          &fcrypto_test_cipher_get_plain_initialization_vector,
+	          NULL,
+	          input_data,
+	          data_size,
+	          output_data,
+	          data_size,
+	          &error );
+
+	FCRYPTO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FCRYPTO_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfcrypto_cipher_crypt_cbc_data_units(
+	          cipher,
+	          LIBFCRYPTO_CRYPT_MODE_ENCRYPT,
+	          0x1000,
+	          data_unit_size,
+	          NULL,
+	          0,
+	          &fcrypto_test_cipher_get_plain_initialization_vector,
+	          NULL,
+	          NULL,
+	          data_size,
+	          output_data,
+	          data_size,
+	          &error );
+
+	FCRYPTO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FCRYPTO_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfcrypto_cipher_crypt_cbc_data_units(
+	          cipher,
+	          LIBFCRYPTO_CRYPT_MODE_ENCRYPT,
+	          0x1000,
+	          data_unit_size,
+	          NULL,
+	          0,
+	          &fcrypto_test_cipher_get_plain_initialization_vector,
+	          NULL,
+	          input_data,
+	          data_size - 1,
+	          output_data,
+	          data_size,
+	          &error );
+
+	FCRYPTO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FCRYPTO_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfcrypto_cipher_crypt_cbc_data_units(
+	          cipher,
+	          LIBFCRYPTO_CRYPT_MODE_ENCRYPT,
+	          0x1000,
+	          data_unit_size,
+	          NULL,
+	          0,
+	          &fcrypto_test_cipher_get_plain_initialization_vector,
+	          NULL,
+	          input_data,
+	          data_size,
+	          NULL,
+	          data_size,
+	          &error );
+
+	FCRYPTO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FCRYPTO_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfcrypto_cipher_crypt_cbc_data_units(
+	          cipher,
+	          LIBFCRYPTO_CRYPT_MODE_ENCRYPT,
+	          0x1000,
+	          data_unit_size,
+	          NULL,
+	          0,
+	          &fcrypto_test_cipher_get_plain_initialization_vector,
+	          NULL,
+	          input_data,
+	          data_size,
+	          output_data,
+	          data_size - 1,
+	          &error );
+
+	FCRYPTO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FCRYPTO_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfcrypto_cipher_crypt_cbc_data_units(
+	          cipher,
+	          LIBFCRYPTO_CRYPT_MODE_ENCRYPT,
+	          0x1000,
+	          data_unit_size,
+	          initialization_vectors,
+	          block_size,
+	          NULL,
+	          NULL,
+	          input_data,
+	          data_size,
+	          output_data,
+	          data_size,
+	          &error );
+
+	FCRYPTO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FCRYPTO_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfcrypto_cipher_crypt_cbc_data_units(
+	          cipher,
+	          LIBFCRYPTO_CRYPT_MODE_ENCRYPT,
+	          0x1000,
+	          data_unit_size,
+	          NULL,
+	          0,
+	          NULL,
+	          NULL,
+	          input_data,
+	          data_size,
+	          output_data,
+	          data_size,
+	          &error );
+
+	FCRYPTO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FCRYPTO_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libfcrypto_cipher_free(
+	          &cipher,
+	          &error );
+
+	FCRYPTO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FCRYPTO_TEST_ASSERT_IS_NULL(
+	 "cipher",
+	 cipher );
+
+	FCRYPTO_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( cipher != NULL )
+	{
+		libfcrypto_cipher_free(
+		 &cipher,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libfcrypto_cipher_crypt_cbc_data_units function
+ * Returns 1 if successful or 0 if not
+ */
+int fcrypto_test_cipher_crypt_cbc_data_units(
+     void )
+{
+	int algorithms[ 3 ] = {
+		LIBFCRYPTO_CIPHER_ALGORITHM_BLOWFISH, LIBFCRYPTO_CIPHER_ALGORITHM_DES3, LIBFCRYPTO_CIPHER_ALGORITHM_SERPENT };
+
+	int algorithm_index = 0;
+	int result          = 0;
+
+	for( algorithm_index = 0;
+	     algorithm_index < 3;
+	     algorithm_index++ )
+	{
+		/* Test data units that are decrypted at once in multiple parts of the buffer
+		 */
+		result = fcrypto_test_cipher_crypt_cbc_data_units_with_algorithm(
+		          algorithms[ algorithm_index ],
+		          512,
+		          9 );
+
+		FCRYPTO_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		/* Test data units that are larger than the buffer
+		 */
+		result = fcrypto_test_cipher_crypt_cbc_data_units_with_algorithm(
+		          algorithms[ algorithm_index ],
+		          4112,
+		          2 );
+
+		FCRYPTO_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+	}
+	return( 1 );
+
+on_error:
+	return( 0 );
+}
+
+/* Tests the libfcrypto_cipher_crypt_cbc_multiple function with a specific algorithm
+ * Returns 1 if successful or 0 if not
+ */
+int fcrypto_test_cipher_crypt_cbc_multiple_with_algorithm(
+     int algorithm )
+{
+	uint8_t key[ 32 ] = {
+		0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09, 0x0a, 0x0b, 0x0c, 0x0d, 0x0e, 0x0f,
+		0x10, 0x11, 0x12, 0x13, 0x14, 0x15, 0x16, 0x17, 0x18, 0x19, 0x1a, 0x1b, 0x1c, 0x1d, 0x1e, 0x1f };
+
+	size_t stream_sizes[ 515 ] = {
+		512, 96, 0, 1024, 16 };
+
+	const uint8_t *initialization_vectors[ 515 ];
+	const uint8_t *input_streams[ 515 ];
+	uint8_t *expected_output_streams[ 515 ];
+	uint8_t *output_streams[ 515 ];
+	uint8_t expected_output_data[ 4144 ];
+	uint8_t initialization_vector_data[ 515 * 16 ];
+	uint8_t input_data[ 4144 ];
+	uint8_t output_data[ 4144 ];
+
+	libcerror_error_t *error    = NULL;
+	libfcrypto_cipher_t *cipher = NULL;
+	size_t block_size           = 0;
+	size_t data_offset          = 0;
+	size_t data_size            = 0;
+	size_t key_bit_size         = 256;
+	int number_of_streams       = 5;
+	int result                  = 0;
+	int stream_index            = 0;
+
+	/* Initialize test
+	 */
+	for( data_offset = 0;
+	     data_offset < 4144;
+	     data_offset++ )
+	{
+		input_data[ data_offset ] = (uint8_t) ( ( data_offset * 13 ) + 5 );
+	}
+	for( data_offset = 0;
+	     data_offset < ( 515 * 16 );
+	     data_offset++ )
+	{
+		initialization_vector_data[ data_offset ] = (uint8_t) ( ( data_offset * 7 ) + 3 );
+	}
+	if( algorithm == LIBFCRYPTO_CIPHER_ALGORITHM_BLOWFISH )
+	{
+		key_bit_size = 128;
+	}
+	else if( algorithm == LIBFCRYPTO_CIPHER_ALGORITHM_DES3 )
+	{
+		key_bit_size = 192;
+	}
+	result = libfcrypto_cipher_initialize(
+	          &cipher,
+	          algorithm,
+	          LIBFCRYPTO_CIPHER_MODE_CBC,
+	          &error );
+
+	FCRYPTO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FCRYPTO_TEST_ASSERT_IS_NOT_NULL(
+	 "cipher",
+	 cipher );
+
+	FCRYPTO_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfcrypto_cipher_set_key(
+	          cipher,
+	          key,
+	          key_bit_size,
+	          &error );
+
+	FCRYPTO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FCRYPTO_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfcrypto_cipher_get_block_size(
+	          cipher,
+	          &block_size,
+	          &error );
+
+	FCRYPTO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FCRYPTO_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Set up streams of different sizes
+	 */
+	data_offset = 0;
+
+	for( stream_index = 0;
+	     stream_index < number_of_streams;
+	     stream_index++ )
+	{
+		initialization_vectors[ stream_index ]  = &( initialization_vector_data[ stream_index * 16 ] );
+		input_streams[ stream_index ]           = &( input_data[ data_offset ] );
+		output_streams[ stream_index ]          = &( output_data[ data_offset ] );
+		expected_output_streams[ stream_index ] = &( expected_output_data[ data_offset ] );
+
+		data_offset += stream_sizes[ stream_index ];
+	}
+	data_size = data_offset;
+
+	/* Calculate the expected output data by encrypting every stream on its own
+	 */
+	for( stream_index = 0;
+	     stream_index < number_of_streams;
+	     stream_index++ )
+	{
+		if( stream_sizes[ stream_index ] == 0 )
+		{
+			continue;
+		}
+		result = libfcrypto_cipher_crypt(
+		          cipher,
+		          LIBFCRYPTO_CRYPT_MODE_ENCRYPT,
+		          initialization_vectors[ stream_index ],
+		          block_size,
+		          input_streams[ stream_index ],
+		          stream_sizes[ stream_index ],
+		          expected_output_streams[ stream_index ],
+		          stream_sizes[ stream_index ],
+		          &error );
+
+		FCRYPTO_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		FCRYPTO_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+	}
+	/* Test encryption of multiple streams
+	 */
+	result = libfcrypto_cipher_crypt_cbc_multiple(
+	          cipher,
+	          LIBFCRYPTO_CRYPT_MODE_ENCRYPT,
+	          initialization_vectors,
+	          block_size,
+	          input_streams,
+	          stream_sizes,
+	          output_streams,
+	          stream_sizes,
+	          number_of_streams,
+	          &error );
+
+	FCRYPTO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FCRYPTO_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = memory_compare(
+	          output_data,
+	          expected_output_data,
+	          data_size );
+
+	FCRYPTO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	/* Test decryption of multiple streams
+	 */
+	result = libfcrypto_cipher_crypt_cbc_multiple(
+	          cipher,
+	          LIBFCRYPTO_CRYPT_MODE_DECRYPT,
+	          initialization_vectors,
+	          block_size,
+	          (const uint8_t **) expected_output_streams,
+	          stream_sizes,
+	          output_streams,
+	          stream_sizes,
+	          number_of_streams,
+	          &error );
+
+	FCRYPTO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FCRYPTO_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = memory_compare(
+	          output_data,
+	          input_data,
+	          data_size );
+
+	FCRYPTO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	/* Test in-place encryption of multiple streams
+	 */
+	result = libfcrypto_cipher_crypt_cbc_multiple(
+	          cipher,
+	          LIBFCRYPTO_CRYPT_MODE_ENCRYPT,
+	          initialization_vectors,
+	          block_size,
+	          (const uint8_t **) output_streams,
+	          stream_sizes,
+	          output_streams,
+	          stream_sizes,
+	          number_of_streams,
+	          &error );
+
+	FCRYPTO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FCRYPTO_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = memory_compare(
+	          output_data,
+	          expected_output_data,
+	          data_size );
+
+	FCRYPTO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	/* Test more streams than are encrypted at once
+	 */
+	number_of_streams = (int) ( 4096 / block_size ) + 3;
+
+	data_offset = 0;
+
+	for( stream_index = 0;
+	     stream_index < number_of_streams;
+	     stream_index++ )
+	{
+		stream_sizes[ stream_index ] = block_size;
+
+		initialization_vectors[ stream_index ]  = &( initialization_vector_data[ stream_index * 16 ] );
+		input_streams[ stream_index ]           = &( input_data[ data_offset ] );
+		output_streams[ stream_index ]          = &( output_data[ data_offset ] );
+		expected_output_streams[ stream_index ] = &( expected_output_data[ data_offset ] );
+
+		data_offset += stream_sizes[ stream_index ];
+	}
+	data_size = data_offset;
+
+	for( stream_index = 0;
+	     stream_index < number_of_streams;
+	     stream_index++ )
+	{
+		if( stream_sizes[ stream_index ] == 0 )
+		{
+			continue;
+		}
+		result = libfcrypto_cipher_crypt(
+		          cipher,
+		          LIBFCRYPTO_CRYPT_MODE_ENCRYPT,
+		          initialization_vectors[ stream_index ],
+		          block_size,
+		          input_streams[ stream_index ],
+		          stream_sizes[ stream_index ],
+		          expected_output_streams[ stream_index ],
+		          stream_sizes[ stream_index ],
+		          &error );
+
+		FCRYPTO_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		FCRYPTO_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+	}
+	result = libfcrypto_cipher_crypt_cbc_multiple(
+	          cipher,
+	          LIBFCRYPTO_CRYPT_MODE_ENCRYPT,
+	          initialization_vectors,
+	          block_size,
+	          input_streams,
+	          stream_sizes,
+	          output_streams,
+	          stream_sizes,
+	          number_of_streams,
+	          &error );
+
+	FCRYPTO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FCRYPTO_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = memory_compare(
+	          output_data,
+	          expected_output_data,
+	          data_size );
+
+	FCRYPTO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	/* Test error cases
+	 */
+	number_of_streams = 5;
+
+	stream_sizes[ 4 ] = block_size + 1;
+
+	result = libfcrypto_cipher_crypt_cbc_multiple(
+	          cipher,
+	          LIBFCRYPTO_CRYPT_MODE_ENCRYPT,
+	          initialization_vectors,
+	          block_size,
+	          input_streams,
+	          stream_sizes,
+	          output_streams,
+	          stream_sizes,
+	          number_of_streams,
+	          &error );
+
+	FCRYPTO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FCRYPTO_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	stream_sizes[ 4 ] = block_size;
+
+	result = libfcrypto_cipher_crypt_cbc_multiple(
+	          NULL,
+	          LIBFCRYPTO_CRYPT_MODE_ENCRYPT,
+	          initialization_vectors,
+	          block_size,
+	          input_streams,
+	          stream_sizes,
+	          output_streams,
+	          stream_sizes,
+	          number_of_streams,
+	          &error );
+
+	FCRYPTO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FCRYPTO_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfcrypto_cipher_crypt_cbc_multiple(
+	          cipher,
+	          -1,
+	          initialization_vectors,
+	          block_size,
+	          input_streams,
+	          stream_sizes,
+	          output_streams,
+	          stream_sizes,
+	          number_of_streams,
+	          &error );
+
+	FCRYPTO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FCRYPTO_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfcrypto_cipher_crypt_cbc_multiple(
+	          cipher,
+	          LIBFCRYPTO_CRYPT_MODE_ENCRYPT,
+	          NULL,
+	          block_size,
+	          input_streams,
+	          stream_sizes,
+	          output_streams,
+	          stream_sizes,
+	          number_of_streams,
+	          &error );
+
+	FCRYPTO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FCRYPTO_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfcrypto_cipher_crypt_cbc_multiple(
+	          cipher,
+	          LIBFCRYPTO_CRYPT_MODE_ENCRYPT,
+	          initialization_vectors,
+	          0,
+	          input_streams,
+	          stream_sizes,
+	          output_streams,
+	          stream_sizes,
+	          number_of_streams,
+	          &error );
+
+	FCRYPTO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FCRYPTO_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfcrypto_cipher_crypt_cbc_multiple(
+	          cipher,
+	          LIBFCRYPTO_CRYPT_MODE_ENCRYPT,
+	          initialization_vectors,
+	          block_size,
+	          NULL,
+	          stream_sizes,
+	          output_streams,
+	          stream_sizes,
+	          number_of_streams,
+	          &error );
+
+	FCRYPTO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FCRYPTO_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfcrypto_cipher_crypt_cbc_multiple(
+	          cipher,
+	          LIBFCRYPTO_CRYPT_MODE_ENCRYPT,
+	          initialization_vectors,
+	          block_size,
+	          input_streams,
+	          NULL,
+	          output_streams,
+	          stream_sizes,
+	          number_of_streams,
+	          &error );
+
+	FCRYPTO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FCRYPTO_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfcrypto_cipher_crypt_cbc_multiple(
+	          cipher,
+	          LIBFCRYPTO_CRYPT_MODE_ENCRYPT,
+	          initialization_vectors,
+	          block_size,
+	          input_streams,
+	          stream_sizes,
+	          NULL,
+	          stream_sizes,
+	          number_of_streams,
+	          &error );
+
+	FCRYPTO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FCRYPTO_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfcrypto_cipher_crypt_cbc_multiple(
+	          cipher,
+	          LIBFCRYPTO_CRYPT_MODE_ENCRYPT,
+	          initialization_vectors,
+	          block_size,
+	          input_streams,
+	          stream_sizes,
+	          output_streams,
+	          NULL,
+	          number_of_streams,
+	          &error );
+
+	FCRYPTO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FCRYPTO_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfcrypto_cipher_crypt_cbc_multiple(
+	          cipher,
+	          LIBFCRYPTO_CRYPT_MODE_ENCRYPT,
+	          initialization_vectors,
+	          block_size,
+	          input_streams,
+	          stream_sizes,
+	          output_streams,
+	          stream_sizes,
+	          -1,
+	          &error );
+
+	FCRYPTO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FCRYPTO_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	input_streams[ 1 ] = NULL;
+
+	result = libfcrypto_cipher_crypt_cbc_multiple(
+	          cipher,
+	          LIBFCRYPTO_CRYPT_MODE_ENCRYPT,
+	          initialization_vectors,
+	          block_size,
+	          input_streams,
+	          stream_sizes,
+	          output_streams,
+	          stream_sizes,
+	          number_of_streams,
+	          &error );
+
+	FCRYPTO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FCRYPTO_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libfcrypto_cipher_free(
+	          &cipher,
+	          &error );
+
+	FCRYPTO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FCRYPTO_TEST_ASSERT_IS_NULL(
+	 "cipher",
+	 cipher );
+
+	FCRYPTO_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( cipher != NULL )
+	{
+		libfcrypto_cipher_free(
+		 &cipher,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libfcrypto_cipher_crypt_cbc_multiple function
+ * Returns 1 if successful or 0 if not
+ */
+int fcrypto_test_cipher_crypt_cbc_multiple(
+     void )
+{
+	int algorithms[ 3 ] = {
+		LIBFCRYPTO_CIPHER_ALGORITHM_BLOWFISH, LIBFCRYPTO_CIPHER_ALGORITHM_DES3, LIBFCRYPTO_CIPHER_ALGORITHM_SERPENT };
+
+	int algorithm_index = 0;
+	int result          = 0;
+
+	for( algorithm_index = 0;
+	     algorithm_index < 3;
+	     algorithm_index++ )
+	{
+		result = fcrypto_test_cipher_crypt_cbc_multiple_with_algorithm(
+		          algorithms[ algorithm_index ] );
+
+		FCRYPTO_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+	}
+	return( 1 );
+
+on_error:
+	return( 0 );
+}
+
+/* Tests the libfcrypto_cipher_crypt and libfcrypto_cipher_crypt_cbc_data_units functions
+ * with a thread pool with a specific algorithm and mode
+ * Returns 1 if successful or 0 if not
+ */
+int fcrypto_test_cipher_crypt_with_thread_pool_with_algorithm_and_mode(
+     int algorithm,
+     int mode )
+{
+	uint8_t initialization_vector[ 16 ] = {
+		0xf0, 0xf1, 0xf2, 0xf3, 0xf4, 0xf5, 0xf6, 0xf7, 0xf8, 0xf9, 0xfa, 0xfb, 0xfc, 0xfd, 0xfe, 0xff };
+
+	uint8_t key[ 32 ] = {
+		0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09, 0x0a, 0x0b, 0x0c, 0x0d, 0x0e, 0x0f,
+		0x10, 0x11, 0x12, 0x13, 0x14, 0x15, 0x16, 0x17, 0x18, 0x19, 0x1a, 0x1b, 0x1c, 0x1d, 0x1e, 0x1f };
+
+	uint8_t expected_output_data[ 4144 ];
+	uint8_t input_data[ 4144 ];
+	uint8_t output_data[ 4144 ];
+
+	libcerror_error_t *error              = NULL;
+	libfcrypto_cipher_t *cipher           = NULL;
+	libfcrypto_cipher_t *reference_cipher = NULL;
+	libfcrypto_thread_pool_t *thread_pool = NULL;
+	size_t block_size                     = 0;
+	size_t data_offset                    = 0;
+	size_t data_size                      = 4144;
+	size_t key_bit_size                   = 256;
+	int result                            = 0;
+
+	/* Initialize test
+	 */
+	for( data_offset = 0;
+	     data_offset < data_size;
+	     data_offset++ )
+	{
+		input_data[ data_offset ] = (uint8_t) ( ( data_offset * 13 ) + 5 );
+	}
+	if( algorithm == LIBFCRYPTO_CIPHER_ALGORITHM_BLOWFISH )
+	{
+		key_bit_size = 128;
+	}
+	else if( algorithm == LIBFCRYPTO_CIPHER_ALGORITHM_DES3 )
+	{
+		key_bit_size = 192;
+	}
+	/* Use a data size that is not a multiple of the block size in CTR mode
+	 */
+	if( mode == LIBFCRYPTO_CIPHER_MODE_CTR )
+	{
+		data_size -= 5;
+	}
+	result = libfcrypto_thread_pool_initialize(
+	          &thread_pool,
+	          3,
+	          &error );
+
+	FCRYPTO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FCRYPTO_TEST_ASSERT_IS_NOT_NULL(
+	 "thread_pool",
+	 thread_pool );
+
+	FCRYPTO_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfcrypto_cipher_initialize(
+	          &cipher,
+	          algorithm,
+	          mode,
+	          &error );
+
+	FCRYPTO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FCRYPTO_TEST_ASSERT_IS_NOT_NULL(
+	 "cipher",
+	 cipher );
+
+	FCRYPTO_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfcrypto_cipher_set_key(
+	          cipher,
+	          key,
+	          key_bit_size,
+	          &error );
+
+	FCRYPTO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FCRYPTO_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfcrypto_cipher_get_block_size(
+	          cipher,
+	          &block_size,
+	          &error );
+
+	FCRYPTO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FCRYPTO_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfcrypto_cipher_initialize(
+	          &reference_cipher,
+	          algorithm,
+	          mode,
+	          &error );
+
+	FCRYPTO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FCRYPTO_TEST_ASSERT_IS_NOT_NULL(
+	 "reference_cipher",
+	 reference_cipher );
+
+	FCRYPTO_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfcrypto_cipher_set_key(
+	          reference_cipher,
+	          key,
+	          key_bit_size,
+	          &error );
+
+	FCRYPTO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FCRYPTO_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Use a small minimum chunk size so that the data is split over all the threads
+	 */
+	result = libfcrypto_cipher_set_thread_pool(
+	          cipher,
+	          thread_pool,
+	          4 * block_size,
+	          &error );
+
+	FCRYPTO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FCRYPTO_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Calculate the expected output data without the thread pool
+	 */
+	result = libfcrypto_cipher_crypt(
+	          reference_cipher,
+	          LIBFCRYPTO_CRYPT_MODE_ENCRYPT,
+	          initialization_vector,
+	          block_size,
+	          input_data,
+	          data_size,
+	          expected_output_data,
+	          data_size,
+	          &error );
+
+	FCRYPTO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FCRYPTO_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libfcrypto_cipher_crypt(
+	          cipher,
+	          LIBFCRYPTO_CRYPT_MODE_ENCRYPT,
+	          initialization_vector,
+	          block_size,
+	          input_data,
+	          data_size,
+	          output_data,
+	          data_size,
+	          &error );
+
+	FCRYPTO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FCRYPTO_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = memory_compare(
+	          output_data,
+	          expected_output_data,
+	          data_size );
+
+	FCRYPTO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	result = libfcrypto_cipher_crypt(
+	          cipher,
+	          LIBFCRYPTO_CRYPT_MODE_DECRYPT,
+	          initialization_vector,
+	          block_size,
+	          expected_output_data,
+	          data_size,
+	          output_data,
+	          data_size,
+	          &error );
+
+	FCRYPTO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FCRYPTO_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = memory_compare(
+	          output_data,
+	          input_data,
+	          data_size );
+
+	FCRYPTO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	/* Test decryption in-place
+	 */
+	memory_copy(
+	 output_data,
+	 expected_output_data,
+	 data_size );
+
+	result = libfcrypto_cipher_crypt(
+	          cipher,
+	          LIBFCRYPTO_CRYPT_MODE_DECRYPT,
+	          initialization_vector,
+	          block_size,
+	          output_data,
+	          data_size,
+	          output_data,
+	          data_size,
+	          &error );
+
+	FCRYPTO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FCRYPTO_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = memory_compare(
+	          output_data,
+	          input_data,
+	          data_size );
+
+	FCRYPTO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	if( mode == LIBFCRYPTO_CIPHER_MODE_CBC )
+	{
+		result = libfcrypto_cipher_crypt_cbc_data_units(
+		          reference_cipher,
+		          LIBFCRYPTO_CRYPT_MODE_ENCRYPT,
+		          0x1000,
+		          512,
+		          NULL,
+		          0,
+		          &fcrypto_test_cipher_get_plain_initialization_vector,
+		          NULL,
+		          input_data,
+		          4096,
+		          expected_output_data,
+		          4096,
+		          &error );
+
+		FCRYPTO_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		FCRYPTO_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		result = libfcrypto_cipher_crypt_cbc_data_units(
+		          cipher,
+		          LIBFCRYPTO_CRYPT_MODE_ENCRYPT,
+		          0x1000,
+		          512,
+		          NULL,
+		          0,
+		          &fcrypto_test_cipher_get_plain_initialization_vector,
+		          NULL,
+		          input_data,
+		          4096,
+		          output_data,
+		          4096,
+		          &error );
+
+		FCRYPTO_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		FCRYPTO_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		result = memory_compare(
+		          output_data,
+		          expected_output_data,
+		          4096 );
+
+		FCRYPTO_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 0 );
+
+		result = libfcrypto_cipher_crypt_cbc_data_units(
+		          cipher,
+		          LIBFCRYPTO_CRYPT_MODE_DECRYPT,
+		          0x1000,
+		          512,
+		          NULL,
+		          0,
+		          &fcrypto_test_cipher_get_plain_initialization_vector,
+		          NULL,
+		          expected_output_data,
+		          4096,
+		          output_data,
+		          4096,
+		          &error );
+
+		FCRYPTO_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		FCRYPTO_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		result = memory_compare(
+		          output_data,
+		          input_data,
+		          4096 );
+
+		FCRYPTO_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 0 );
+	}
+	/* Clean up
+	 */
+	result = libfcrypto_cipher_free(
+	          &reference_cipher,
+	          &error );
+
+	FCRYPTO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FCRYPTO_TEST_ASSERT_IS_NULL(
+	 "reference_cipher",
+	 reference_cipher );
+
+	FCRYPTO_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfcrypto_cipher_free(
+	          &cipher,
+	          &error );
+
+	FCRYPTO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FCRYPTO_TEST_ASSERT_IS_NULL(
+	 "cipher",
+	 cipher );
+
+	FCRYPTO_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfcrypto_thread_pool_free(
+	          &thread_pool,
+	          &error );
+
+	FCRYPTO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FCRYPTO_TEST_ASSERT_IS_NULL(
+	 "thread_pool",
+	 thread_pool );
+
+	FCRYPTO_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( reference_cipher != NULL )
+	{
+		libfcrypto_cipher_free(
+		 &reference_cipher,
+		 NULL );
+	}
+	if( cipher != NULL )
+	{
+		libfcrypto_cipher_free(
+		 &cipher,
+		 NULL );
+	}
+	if( thread_pool != NULL )
+	{
+		libfcrypto_thread_pool_free(
+		 &thread_pool,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libfcrypto_cipher_crypt and libfcrypto_cipher_crypt_cbc_data_units functions with a thread pool
+ * Returns 1 if successful or 0 if not
+ */
+int fcrypto_test_cipher_crypt_with_thread_pool(
+     void )
+{
+	int algorithms[ 3 ] = {
+		LIBFCRYPTO_CIPHER_ALGORITHM_BLOWFISH, LIBFCRYPTO_CIPHER_ALGORITHM_DES3, LIBFCRYPTO_CIPHER_ALGORITHM_SERPENT };
+
+	int modes[ 3 ] = {
+		LIBFCRYPTO_CIPHER_MODE_CBC, LIBFCRYPTO_CIPHER_MODE_CTR, LIBFCRYPTO_CIPHER_MODE_ECB };
+
+	int algorithm_index = 0;
+	int mode_index      = 0;
+	int result          = 0;
+
+	for( algorithm_index = 0;
+	     algorithm_index < 3;
+	     algorithm_index++ )
+	{
+		for( mode_index = 0;
+		     mode_index < 3;
+		     mode_index++ )
+		{
+			result = fcrypto_test_cipher_crypt_with_thread_pool_with_algorithm_and_mode(
+			          algorithms[ algorithm_index ],
+			          modes[ mode_index ] );
+
+			FCRYPTO_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 1 );
+		}
+	}
+	return( 1 );
+
+on_error:
+	return( 0 );
+}
+
+/* The main program
+ */
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+int wmain(
+     int argc FCRYPTO_TEST_ATTRIBUTE_UNUSED,
+     wchar_t * const argv[] FCRYPTO_TEST_ATTRIBUTE_UNUSED )
+#else
+int main(
+     int argc FCRYPTO_TEST_ATTRIBUTE_UNUSED,
+     char * const argv[] FCRYPTO_TEST_ATTRIBUTE_UNUSED )
+#endif
+{
+	FCRYPTO_TEST_UNREFERENCED_PARAMETER( argc )
+	FCRYPTO_TEST_UNREFERENCED_PARAMETER( argv )
+
+	FCRYPTO_TEST_RUN(
+	 "libfcrypto_cipher_initialize",
+	 fcrypto_test_cipher_initialize );
+
+	FCRYPTO_TEST_RUN(
+	 "libfcrypto_cipher_free",
+	 fcrypto_test_cipher_free );
+
+	FCRYPTO_TEST_RUN(
+	 "libfcrypto_cipher_set_key",
+	 fcrypto_test_cipher_set_key );
+
+	FCRYPTO_TEST_RUN(
+	 "libfcrypto_cipher_get_block_size",
+	 fcrypto_test_cipher_get_block_size );
+
+	FCRYPTO_TEST_RUN(
+	 "libfcrypto_cipher_set_thread_pool",
+	 fcrypto_test_cipher_set_thread_pool );
+
+	FCRYPTO_TEST_RUN(
+	 "libfcrypto_cipher_crypt",
+	 fcrypto_test_cipher_crypt );
+
+	FCRYPTO_TEST_RUN(
+	 "libfcrypto_cipher_crypt_segments",
+	 fcrypto_test_cipher_crypt_segments );
+
+	FCRYPTO_TEST_RUN(
+	 "libfcrypto_cipher_crypt_cbc_data_units",
+	 fcrypto_test_cipher_crypt_cbc_data_units );
+
+	FCRYPTO_TEST_RUN(
+	 "libfcrypto_cipher_crypt_cbc_multiple",
+	 fcrypto_test_cipher_crypt_cbc_multiple );
+
+	FCRYPTO_TEST_RUN(
+	 "libfcrypto_cipher_crypt_with_thread_pool",
+	 fcrypto_test_cipher_crypt_with_thread_pool );
+
+	return( EXIT_SUCCESS );
+
+on_error:
+	return( EXIT_FAILURE );
+}
+
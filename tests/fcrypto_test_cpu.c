@@ -0,0 +1,411 @@
+/*
+ * Library CPU level functions test program
+ *
+ * Copyright (C) 2017-2024, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+
+#include <common.h>
+#include <file_stream.h>
+#include <types.h>
+
+#if defined( HAVE_STDLIB_H ) || defined( WINAPI )
+#include <stdlib.h>
+#endif
+
+#include "fcrypto_test_libcerror.h"
+#include "fcrypto_test_libfcrypto.h"
+#include "fcrypto_test_macros.h"
+#include "fcrypto_test_unused.h"
+
+#include "../libfcrypto/libfcrypto_cpu.h"
+
+#if defined( __GNUC__ ) && !defined( LIBFCRYPTO_DLL_IMPORT )
+
+/* Tests the libfcrypto_cpu_get_supported_level function
+ * Returns 1 if successful or 0 if not
+ */
+int fcrypto_test_cpu_get_supported_level(
+     void )
+{
+	int cpu_level = 0;
+
+	cpu_level = libfcrypto_cpu_get_supported_level();
+
+	FCRYPTO_TEST_ASSERT_GREATER_THAN_INT(
+	 "cpu_level",
+	 cpu_level,
+	 LIBFCRYPTO_CPU_LEVEL_SCALAR - 1 );
+
+	FCRYPTO_TEST_ASSERT_LESS_THAN_INT(
+	 "cpu_level",
+	 cpu_level,
+	 LIBFCRYPTO_CPU_LEVEL_AVX512 + 1 );
+
+	/* Test if the supported level is determined consistently
+	 */
+	FCRYPTO_TEST_ASSERT_EQUAL_INT(
+	 "cpu_level",
+	 libfcrypto_cpu_get_supported_level(),
+	 cpu_level );
+
+	return( 1 );
+
+on_error:
+	return( 0 );
+}
+
+/* Tests the libfcrypto_cpu_get_level_from_string function
+ * Returns 1 if successful or 0 if not
+ */
+int fcrypto_test_cpu_get_level_from_string(
+     void )
+{
+	libcerror_error_t *error = NULL;
+	int cpu_level            = 0;
+	int result               = 0;
+
+	/* Test regular cases
+	 */
+	result = libfcrypto_cpu_get_level_from_string(
+	          "avx2",
+	          4,
+	          &cpu_level,
+	          &error );
+
+	FCRYPTO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FCRYPTO_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FCRYPTO_TEST_ASSERT_EQUAL_INT(
+	 "cpu_level",
+	 cpu_level,
+	 LIBFCRYPTO_CPU_LEVEL_AVX2 );
+
+	result = libfcrypto_cpu_get_level_from_string(
+	          "scalar",
+	          6,
+	          &cpu_level,
+	          &error );
+
+	FCRYPTO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FCRYPTO_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FCRYPTO_TEST_ASSERT_EQUAL_INT(
+	 "cpu_level",
+	 cpu_level,
+	 LIBFCRYPTO_CPU_LEVEL_SCALAR );
+
+	result = libfcrypto_cpu_get_level_from_string(
+	          "ssse3",
+	          5,
+	          &cpu_level,
+	          &error );
+
+	FCRYPTO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FCRYPTO_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FCRYPTO_TEST_ASSERT_EQUAL_INT(
+	 "cpu_level",
+	 cpu_level,
+	 LIBFCRYPTO_CPU_LEVEL_SSSE3 );
+
+	result = libfcrypto_cpu_get_level_from_string(
+	          "avx512",
+	          6,
+	          &cpu_level,
+	          &error );
+
+	FCRYPTO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FCRYPTO_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FCRYPTO_TEST_ASSERT_EQUAL_INT(
+	 "cpu_level",
+	 cpu_level,
+	 LIBFCRYPTO_CPU_LEVEL_AVX512 );
+
+	/* Test with an unsupported string
+	 */
+	result = libfcrypto_cpu_get_level_from_string(
+	          "avx",
+	          3,
+	          &cpu_level,
+	          &error );
+
+	FCRYPTO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	FCRYPTO_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libfcrypto_cpu_get_level_from_string(
+	          NULL,
+	          4,
+	          &cpu_level,
+	          &error );
+
+	FCRYPTO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FCRYPTO_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfcrypto_cpu_get_level_from_string(
+	          "avx2",
+	          (size_t) SSIZE_MAX + 1,
+	          &cpu_level,
+	          &error );
+
+	FCRYPTO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FCRYPTO_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfcrypto_cpu_get_level_from_string(
+	          "avx2",
+	          4,
+	          NULL,
+	          &error );
+
+	FCRYPTO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FCRYPTO_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libfcrypto_cpu_set_level function
+ * Returns 1 if successful or 0 if not
+ */
+int fcrypto_test_cpu_set_level(
+     void )
+{
+	libcerror_error_t *error = NULL;
+	int cpu_level            = 0;
+	int result               = 0;
+	int supported_cpu_level  = 0;
+
+	/* Initialize test
+	 */
+	supported_cpu_level = libfcrypto_cpu_get_supported_level();
+
+	cpu_level = libfcrypto_cpu_get_level();
+
+	FCRYPTO_TEST_ASSERT_LESS_THAN_INT(
+	 "cpu_level",
+	 cpu_level,
+	 supported_cpu_level + 1 );
+
+	/* Test regular cases
+	 */
+	result = libfcrypto_cpu_set_level(
+	          LIBFCRYPTO_CPU_LEVEL_SCALAR,
+	          &error );
+
+	FCRYPTO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FCRYPTO_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FCRYPTO_TEST_ASSERT_EQUAL_INT(
+	 "cpu_level",
+	 libfcrypto_cpu_get_level(),
+	 LIBFCRYPTO_CPU_LEVEL_SCALAR );
+
+	result = libfcrypto_cpu_set_level(
+	          supported_cpu_level,
+	          &error );
+
+	FCRYPTO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FCRYPTO_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FCRYPTO_TEST_ASSERT_EQUAL_INT(
+	 "cpu_level",
+	 libfcrypto_cpu_get_level(),
+	 supported_cpu_level );
+
+	/* Test error cases
+	 */
+	result = libfcrypto_cpu_set_level(
+	          -1,
+	          &error );
+
+	FCRYPTO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FCRYPTO_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfcrypto_cpu_set_level(
+	          LIBFCRYPTO_CPU_LEVEL_AVX512 + 1,
+	          &error );
+
+	FCRYPTO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FCRYPTO_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libfcrypto_cpu_set_level(
+	          cpu_level,
+	          &error );
+
+	FCRYPTO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FCRYPTO_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+#endif /* if defined( __GNUC__ ) && !defined( LIBFCRYPTO_DLL_IMPORT ) */
+
+/* The main program
+ */
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+int wmain(
+     int argc FCRYPTO_TEST_ATTRIBUTE_UNUSED,
+     wchar_t * const argv[] FCRYPTO_TEST_ATTRIBUTE_UNUSED )
+#else
+int main(
+     int argc FCRYPTO_TEST_ATTRIBUTE_UNUSED,
+     char * const argv[] FCRYPTO_TEST_ATTRIBUTE_UNUSED )
+#endif
+{
+	FCRYPTO_TEST_UNREFERENCED_PARAMETER( argc )
+	FCRYPTO_TEST_UNREFERENCED_PARAMETER( argv )
+
+#if defined( __GNUC__ ) && !defined( LIBFCRYPTO_DLL_IMPORT )
+
+	FCRYPTO_TEST_RUN(
+	 "libfcrypto_cpu_get_supported_level",
+	 fcrypto_test_cpu_get_supported_level );
+
+	FCRYPTO_TEST_RUN(
+	 "libfcrypto_cpu_get_level_from_string",
+	 fcrypto_test_cpu_get_level_from_string );
+
+	FCRYPTO_TEST_RUN(
+	 "libfcrypto_cpu_set_level",
+	 fcrypto_test_cpu_set_level );
+
+#endif /* if defined( __GNUC__ ) && !defined( LIBFCRYPTO_DLL_IMPORT ) */
+
+	return( EXIT_SUCCESS );
+
+#if defined( __GNUC__ ) && !defined( LIBFCRYPTO_DLL_IMPORT )
+
+on_error:
+	return( EXIT_FAILURE );
+
+#endif /* if defined( __GNUC__ ) && !defined( LIBFCRYPTO_DLL_IMPORT ) */
+}
+
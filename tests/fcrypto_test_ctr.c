@@ -0,0 +1,1000 @@
+/*
+ * Library CTR functions test program
+ *
+ * Copyright (C) 2017-2024, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+
+#include <common.h>
+#include <file_stream.h>
+#include <memory.h>
+#include <types.h>
+
+#if defined( HAVE_STDLIB_H ) || defined( WINAPI )
+#include <stdlib.h>
+#endif
+
+#include "fcrypto_test_libcerror.h"
+#include "fcrypto_test_libfcrypto.h"
+#include "fcrypto_test_macros.h"
+#include "fcrypto_test_memory.h"
+#include "fcrypto_test_unused.h"
+
+#include "../libfcrypto/libfcrypto_ctr.h"
+
+#if defined( __GNUC__ ) && !defined( LIBFCRYPTO_DLL_IMPORT )
+
+/* Tests the libfcrypto_ctr_set_counter_block function
+ * Returns 1 if successful or 0 if not
+ */
+int fcrypto_test_ctr_set_counter_block(
+     void )
+{
+	uint8_t expected_big_endian_counter_block[ 8 ] = {
+		0x01, 0x02, 0x03, 0x04, 0x00, 0x00, 0x00, 0x01 };
+	uint8_t expected_little_endian_counter_block[ 8 ] = {
+		0x00, 0x00, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08 };
+	uint8_t initial_big_endian_counter_block[ 8 ] = {
+		0x01, 0x02, 0x03, 0x04, 0xff, 0xff, 0xff, 0xfe };
+	uint8_t initial_little_endian_counter_block[ 8 ] = {
+		0xfe, 0xff, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08 };
+	uint8_t counter_block[ 8 ];
+
+	libcerror_error_t *error = NULL;
+	int result               = 0;
+
+	/* Test big-endian counter that wraps around without affecting the nonce
+	 */
+	result = libfcrypto_ctr_set_counter_block(
+	          counter_block,
+	          initial_big_endian_counter_block,
+	          8,
+	          4,
+	          LIBFCRYPTO_ENDIAN_BIG,
+	          3,
+	          &error );
+
+	FCRYPTO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FCRYPTO_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = memory_compare(
+	          counter_block,
+	          expected_big_endian_counter_block,
+	          8 );
+
+	FCRYPTO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	/* Test little-endian counter that wraps around without affecting the nonce
+	 */
+	result = libfcrypto_ctr_set_counter_block(
+	          counter_block,
+	          initial_little_endian_counter_block,
+	          8,
+	          2,
+	          LIBFCRYPTO_ENDIAN_LITTLE,
+	          2,
+	          &error );
+
+	FCRYPTO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FCRYPTO_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = memory_compare(
+	          counter_block,
+	          expected_little_endian_counter_block,
+	          8 );
+
+	FCRYPTO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	/* Test error cases
+	 */
+	result = libfcrypto_ctr_set_counter_block(
+	          NULL,
+	          initial_big_endian_counter_block,
+	          8,
+	          4,
+	          LIBFCRYPTO_ENDIAN_BIG,
+	          0,
+	          &error );
+
+	FCRYPTO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FCRYPTO_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfcrypto_ctr_set_counter_block(
+	          counter_block,
+	          NULL,
+	          8,
+	          4,
+	          LIBFCRYPTO_ENDIAN_BIG,
+	          0,
+	          &error );
+
+	FCRYPTO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FCRYPTO_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfcrypto_ctr_set_counter_block(
+	          counter_block,
+	          initial_big_endian_counter_block,
+	          0,
+	          4,
+	          LIBFCRYPTO_ENDIAN_BIG,
+	          0,
+	          &error );
+
+	FCRYPTO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FCRYPTO_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfcrypto_ctr_set_counter_block(
+	          counter_block,
+	          initial_big_endian_counter_block,
+	          17,
+	          4,
+	          LIBFCRYPTO_ENDIAN_BIG,
+	          0,
+	          &error );
+
+	FCRYPTO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FCRYPTO_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfcrypto_ctr_set_counter_block(
+	          counter_block,
+	          initial_big_endian_counter_block,
+	          8,
+	          0,
+	          LIBFCRYPTO_ENDIAN_BIG,
+	          0,
+	          &error );
+
+	FCRYPTO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FCRYPTO_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfcrypto_ctr_set_counter_block(
+	          counter_block,
+	          initial_big_endian_counter_block,
+	          8,
+	          9,
+	          LIBFCRYPTO_ENDIAN_BIG,
+	          0,
+	          &error );
+
+	FCRYPTO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FCRYPTO_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfcrypto_ctr_set_counter_block(
+	          counter_block,
+	          initial_big_endian_counter_block,
+	          8,
+	          4,
+	          0,
+	          0,
+	          &error );
+
+	FCRYPTO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FCRYPTO_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libfcrypto_ctr_fill_counter_blocks function
+ * Returns 1 if successful or 0 if not
+ */
+int fcrypto_test_ctr_fill_counter_blocks(
+     void )
+{
+	uint8_t expected_big_endian_counter_blocks_data[ 12 ] = {
+		0xaa, 0x00, 0x00, 0xff, 0xaa, 0x00, 0x01, 0x00, 0xaa, 0x00, 0x01, 0x01 };
+	uint8_t expected_big_endian_counter_block[ 4 ] = {
+		0xaa, 0x00, 0x01, 0x02 };
+	uint8_t expected_little_endian_counter_blocks_data[ 12 ] = {
+		0xff, 0xff, 0xbb, 0xcc, 0x00, 0x00, 0xbb, 0xcc, 0x01, 0x00, 0xbb, 0xcc };
+	uint8_t expected_little_endian_counter_block[ 4 ] = {
+		0x02, 0x00, 0xbb, 0xcc };
+	uint8_t counter_block[ 4 ];
+	uint8_t counter_blocks_data[ 12 ];
+
+	libcerror_error_t *error = NULL;
+	int result               = 0;
+
+	/* Test big-endian counter that carries over multiple bytes
+	 */
+	counter_block[ 0 ] = 0xaa;
+	counter_block[ 1 ] = 0x00;
+	counter_block[ 2 ] = 0x00;
+	counter_block[ 3 ] = 0xff;
+
+	result = libfcrypto_ctr_fill_counter_blocks(
+	          counter_block,
+	          4,
+	          3,
+	          LIBFCRYPTO_ENDIAN_BIG,
+	          counter_blocks_data,
+	          12,
+	          &error );
+
+	FCRYPTO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FCRYPTO_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = memory_compare(
+	          counter_blocks_data,
+	          expected_big_endian_counter_blocks_data,
+	          12 );
+
+	FCRYPTO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	result = memory_compare(
+	          counter_block,
+	          expected_big_endian_counter_block,
+	          4 );
+
+	FCRYPTO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	/* Test little-endian counter that wraps around
+	 */
+	counter_block[ 0 ] = 0xff;
+	counter_block[ 1 ] = 0xff;
+	counter_block[ 2 ] = 0xbb;
+	counter_block[ 3 ] = 0xcc;
+
+	result = libfcrypto_ctr_fill_counter_blocks(
+	          counter_block,
+	          4,
+	          2,
+	          LIBFCRYPTO_ENDIAN_LITTLE,
+	          counter_blocks_data,
+	          12,
+	          &error );
+
+	FCRYPTO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FCRYPTO_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = memory_compare(
+	          counter_blocks_data,
+	          expected_little_endian_counter_blocks_data,
+	          12 );
+
+	FCRYPTO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	result = memory_compare(
+	          counter_block,
+	          expected_little_endian_counter_block,
+	          4 );
+
+	FCRYPTO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	/* Test error cases
+	 */
+	result = libfcrypto_ctr_fill_counter_blocks(
+	          NULL,
+	          4,
+	          4,
+	          LIBFCRYPTO_ENDIAN_BIG,
+	          counter_blocks_data,
+	          12,
+	          &error );
+
+	FCRYPTO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FCRYPTO_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfcrypto_ctr_fill_counter_blocks(
+	          counter_block,
+	          0,
+	          4,
+	          LIBFCRYPTO_ENDIAN_BIG,
+	          counter_blocks_data,
+	          12,
+	          &error );
+
+	FCRYPTO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FCRYPTO_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfcrypto_ctr_fill_counter_blocks(
+	          counter_block,
+	          17,
+	          4,
+	          LIBFCRYPTO_ENDIAN_BIG,
+	          counter_blocks_data,
+	          12,
+	          &error );
+
+	FCRYPTO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FCRYPTO_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfcrypto_ctr_fill_counter_blocks(
+	          counter_block,
+	          4,
+	          0,
+	          LIBFCRYPTO_ENDIAN_BIG,
+	          counter_blocks_data,
+	          12,
+	          &error );
+
+	FCRYPTO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FCRYPTO_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfcrypto_ctr_fill_counter_blocks(
+	          counter_block,
+	          4,
+	          5,
+	          LIBFCRYPTO_ENDIAN_BIG,
+	          counter_blocks_data,
+	          12,
+	          &error );
+
+	FCRYPTO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FCRYPTO_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfcrypto_ctr_fill_counter_blocks(
+	          counter_block,
+	          4,
+	          4,
+	          0,
+	          counter_blocks_data,
+	          12,
+	          &error );
+
+	FCRYPTO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FCRYPTO_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfcrypto_ctr_fill_counter_blocks(
+	          counter_block,
+	          4,
+	          4,
+	          LIBFCRYPTO_ENDIAN_BIG,
+	          NULL,
+	          12,
+	          &error );
+
+	FCRYPTO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FCRYPTO_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfcrypto_ctr_fill_counter_blocks(
+	          counter_block,
+	          4,
+	          4,
+	          LIBFCRYPTO_ENDIAN_BIG,
+	          counter_blocks_data,
+	          10,
+	          &error );
+
+	FCRYPTO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FCRYPTO_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfcrypto_ctr_fill_counter_blocks(
+	          counter_block,
+	          4,
+	          4,
+	          LIBFCRYPTO_ENDIAN_BIG,
+	          counter_blocks_data,
+	          (size_t) SSIZE_MAX + 1,
+	          &error );
+
+	FCRYPTO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FCRYPTO_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Test function that "encrypts" counter blocks by leaving them as-is
+ * Returns 1 if successful or -1 on error
+ */
+int fcrypto_test_ctr_encrypt_blocks(
+     intptr_t *context,
+     const uint8_t *input_data,
+     size_t input_data_size,
+     uint8_t *output_data,
+     size_t output_data_size FCRYPTO_TEST_ATTRIBUTE_UNUSED,
+     libcerror_error_t **error )
+{
+	static char *function = "fcrypto_test_ctr_encrypt_blocks";
+
+	FCRYPTO_TEST_UNREFERENCED_PARAMETER( output_data_size )
+
+	if( context == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid context.",
+		 function );
+
+		return( -1 );
+	}
+	if( *( (int *) context ) != 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ENCRYPTION,
+		 LIBCERROR_ENCRYPTION_ERROR_GENERIC,
+		 "%s: unable to encrypt blocks.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( input_data != output_data )
+	 && ( memory_copy(
+	       output_data,
+	       input_data,
+	       input_data_size ) == NULL ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+		 "%s: unable to copy blocks.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Tests the libfcrypto_ctr_crypt function
+ * Returns 1 if successful or 0 if not
+ */
+int fcrypto_test_ctr_crypt(
+     void )
+{
+	uint8_t expected_output_data[ 10 ] = {
+		0x00, 0xff, 0xaa, 0x00, 0x01, 0x00, 0xaa, 0x00, 0x01, 0x01 };
+	uint8_t initial_counter_block[ 4 ] = {
+		0xaa, 0x00, 0x00, 0xff };
+	uint8_t input_data[ 10 ];
+	uint8_t output_data[ 10 ];
+
+	libcerror_error_t *error = NULL;
+	int context              = 0;
+	int result               = 0;
+
+	/* Initialize test
+	 */
+	memory_set(
+	 input_data,
+	 0,
+	 10 );
+
+	/* Test regular cases where the key stream starts at an offset within the first counter block
+	 */
+	result = libfcrypto_ctr_crypt(
+	          (intptr_t *) &context,
+	          &fcrypto_test_ctr_encrypt_blocks,
+	          4,
+	          initial_counter_block,
+	          3,
+	          LIBFCRYPTO_ENDIAN_BIG,
+	          2,
+	          input_data,
+	          10,
+	          output_data,
+	          10,
+	          &error );
+
+	FCRYPTO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FCRYPTO_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = memory_compare(
+	          output_data,
+	          expected_output_data,
+	          10 );
+
+	FCRYPTO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	/* Test error cases
+	 */
+	result = libfcrypto_ctr_crypt(
+	          NULL,
+	          &fcrypto_test_ctr_encrypt_blocks,
+	          4,
+	          initial_counter_block,
+	          3,
+	          LIBFCRYPTO_ENDIAN_BIG,
+	          0,
+	          input_data,
+	          10,
+	          output_data,
+	          10,
+	          &error );
+
+	FCRYPTO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FCRYPTO_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfcrypto_ctr_crypt(
+	          (intptr_t *) &context,
+	          NULL,
+	          4,
+	          initial_counter_block,
+	          3,
+	          LIBFCRYPTO_ENDIAN_BIG,
+	          0,
+	          input_data,
+	          10,
+	          output_data,
+	          10,
+	          &error );
+
+	FCRYPTO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FCRYPTO_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfcrypto_ctr_crypt(
+	          (intptr_t *) &context,
+	          &fcrypto_test_ctr_encrypt_blocks,
+	          0,
+	          initial_counter_block,
+	          3,
+	          LIBFCRYPTO_ENDIAN_BIG,
+	          0,
+	          input_data,
+	          10,
+	          output_data,
+	          10,
+	          &error );
+
+	FCRYPTO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FCRYPTO_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfcrypto_ctr_crypt(
+	          (intptr_t *) &context,
+	          &fcrypto_test_ctr_encrypt_blocks,
+	          17,
+	          initial_counter_block,
+	          3,
+	          LIBFCRYPTO_ENDIAN_BIG,
+	          0,
+	          input_data,
+	          10,
+	          output_data,
+	          10,
+	          &error );
+
+	FCRYPTO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FCRYPTO_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfcrypto_ctr_crypt(
+	          (intptr_t *) &context,
+	          &fcrypto_test_ctr_encrypt_blocks,
+	          4,
+	          NULL,
+	          3,
+	          LIBFCRYPTO_ENDIAN_BIG,
+	          0,
+	          input_data,
+	          10,
+	          output_data,
+	          10,
+	          &error );
+
+	FCRYPTO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FCRYPTO_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfcrypto_ctr_crypt(
+	          (intptr_t *) &context,
+	          &fcrypto_test_ctr_encrypt_blocks,
+	          4,
+	          initial_counter_block,
+	          3,
+	          LIBFCRYPTO_ENDIAN_BIG,
+	          0,
+	          NULL,
+	          10,
+	          output_data,
+	          10,
+	          &error );
+
+	FCRYPTO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FCRYPTO_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfcrypto_ctr_crypt(
+	          (intptr_t *) &context,
+	          &fcrypto_test_ctr_encrypt_blocks,
+	          4,
+	          initial_counter_block,
+	          3,
+	          LIBFCRYPTO_ENDIAN_BIG,
+	          0,
+	          input_data,
+	          10,
+	          NULL,
+	          10,
+	          &error );
+
+	FCRYPTO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FCRYPTO_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfcrypto_ctr_crypt(
+	          (intptr_t *) &context,
+	          &fcrypto_test_ctr_encrypt_blocks,
+	          4,
+	          initial_counter_block,
+	          3,
+	          LIBFCRYPTO_ENDIAN_BIG,
+	          0,
+	          input_data,
+	          10,
+	          output_data,
+	          9,
+	          &error );
+
+	FCRYPTO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FCRYPTO_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Test libfcrypto_ctr_crypt with failing encrypt blocks function
+	 */
+	context = 1;
+
+	result = libfcrypto_ctr_crypt(
+	          (intptr_t *) &context,
+	          &fcrypto_test_ctr_encrypt_blocks,
+	          4,
+	          initial_counter_block,
+	          3,
+	          LIBFCRYPTO_ENDIAN_BIG,
+	          0,
+	          input_data,
+	          10,
+	          output_data,
+	          10,
+	          &error );
+
+	FCRYPTO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FCRYPTO_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+#endif /* if defined( __GNUC__ ) && !defined( LIBFCRYPTO_DLL_IMPORT ) */
+
+/* The main program
+ */
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+int wmain(
+     int argc FCRYPTO_TEST_ATTRIBUTE_UNUSED,
+     wchar_t * const argv[] FCRYPTO_TEST_ATTRIBUTE_UNUSED )
+#else
+int main(
+     int argc FCRYPTO_TEST_ATTRIBUTE_UNUSED,
+     char * const argv[] FCRYPTO_TEST_ATTRIBUTE_UNUSED )
+#endif
+{
+	FCRYPTO_TEST_UNREFERENCED_PARAMETER( argc )
+	FCRYPTO_TEST_UNREFERENCED_PARAMETER( argv )
+
+#if defined( __GNUC__ ) && !defined( LIBFCRYPTO_DLL_IMPORT )
+
+	FCRYPTO_TEST_RUN(
+	 "libfcrypto_ctr_set_counter_block",
+	 fcrypto_test_ctr_set_counter_block );
+
+	FCRYPTO_TEST_RUN(
+	 "libfcrypto_ctr_fill_counter_blocks",
+	 fcrypto_test_ctr_fill_counter_blocks );
+
+	FCRYPTO_TEST_RUN(
+	 "libfcrypto_ctr_crypt",
+	 fcrypto_test_ctr_crypt );
+
+#endif /* if defined( __GNUC__ ) && !defined( LIBFCRYPTO_DLL_IMPORT ) */
+
+	return( EXIT_SUCCESS );
+
+#if defined( __GNUC__ ) && !defined( LIBFCRYPTO_DLL_IMPORT )
+
+on_error:
+	return( EXIT_FAILURE );
+
+#endif /* if defined( __GNUC__ ) && !defined( LIBFCRYPTO_DLL_IMPORT ) */
+}
+
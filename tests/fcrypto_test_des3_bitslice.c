@@ -0,0 +1,844 @@
+/*
+ * Library bitsliced DES3 functions test program
+ *
+ * Copyright (C) 2017-2024, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <file_stream.h>
+#include <memory.h>
+#include <types.h>
+
+#if defined( HAVE_STDLIB_H ) || defined( WINAPI )
+#include <stdlib.h>
+#endif
+
+#include "fcrypto_test_libcerror.h"
+#include "fcrypto_test_libfcrypto.h"
+#include "fcrypto_test_macros.h"
+#include "fcrypto_test_memory.h"
+#include "fcrypto_test_unused.h"
+
+#include "../libfcrypto/libfcrypto_des3_bitslice.h"
+#include "../libfcrypto/libfcrypto_des3_context.h"
+
+#if defined( __GNUC__ ) && !defined( LIBFCRYPTO_DLL_IMPORT )
+
+/* Fills the values with a predictable sequence for testing
+ */
+void fcrypto_test_des3_bitslice_fill_values(
+      uint64_t *values,
+      size_t number_of_values )
+{
+	uint64_t value_64bit = 0x0123456789abcdefULL;
+	size_t value_index   = 0;
+
+	for( value_index = 0;
+	     value_index < number_of_values;
+	     value_index++ )
+	{
+		value_64bit ^= value_64bit << 13;
+		value_64bit ^= value_64bit >> 7;
+		value_64bit ^= value_64bit << 17;
+
+		values[ value_index ] = value_64bit;
+	}
+}
+
+/* De- or encrypts the values one at a time using DES3 for testing
+ * Returns 1 if successful or -1 on error
+ */
+int fcrypto_test_des3_bitslice_crypt_values(
+     libfcrypto_internal_des3_context_t *internal_context,
+     int mode,
+     uint64_t *values,
+     size_t number_of_values,
+     libcerror_error_t **error )
+{
+	const uint64_t *sub_keys[ 3 ];
+
+	size_t value_index     = 0;
+	int number_of_sub_keys = 0;
+
+	if( libfcrypto_internal_des3_context_get_sub_keys(
+	     internal_context,
+	     mode,
+	     sub_keys,
+	     &number_of_sub_keys,
+	     error ) != 1 )
+	{
+		return( -1 );
+	}
+	for( value_index = 0;
+	     value_index < number_of_values;
+	     value_index++ )
+	{
+		if( libfcrypto_internal_des3_context_crypt_block_ede(
+		     sub_keys,
+		     number_of_sub_keys,
+		     values[ value_index ],
+		     &( values[ value_index ] ),
+		     error ) != 1 )
+		{
+			return( -1 );
+		}
+	}
+	return( 1 );
+}
+
+/* Tests the libfcrypto_des3_bitslice_transpose function
+ * Returns 1 if successful or 0 if not
+ */
+int fcrypto_test_des3_bitslice_transpose(
+     void )
+{
+	uint64_t expected_values[ 64 ];
+	uint64_t values[ 64 ];
+
+	libcerror_error_t *error = NULL;
+	int result               = 0;
+
+	/* Test regular cases
+	 */
+	result = memory_set(
+	          values,
+	          0,
+	          sizeof( uint64_t ) * 64 ) != NULL;
+
+	FCRYPTO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	/* The most significant bit of the second value becomes the second most
+	 * significant bit of the first slice
+	 */
+	values[ 1 ]  = 0x8000000000000000ULL;
+	values[ 63 ] = 0x0000000000000003ULL;
+
+	result = libfcrypto_des3_bitslice_transpose(
+	          values,
+	          &error );
+
+	FCRYPTO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FCRYPTO_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FCRYPTO_TEST_ASSERT_EQUAL_UINT64(
+	 "values[ 0 ]",
+	 values[ 0 ],
+	 (uint64_t) 0x4000000000000000ULL );
+
+	FCRYPTO_TEST_ASSERT_EQUAL_UINT64(
+	 "values[ 62 ]",
+	 values[ 62 ],
+	 (uint64_t) 0x0000000000000001ULL );
+
+	FCRYPTO_TEST_ASSERT_EQUAL_UINT64(
+	 "values[ 63 ]",
+	 values[ 63 ],
+	 (uint64_t) 0x0000000000000001ULL );
+
+	/* Transposing twice results in the original values
+	 */
+	fcrypto_test_des3_bitslice_fill_values(
+	 values,
+	 64 );
+
+	result = memory_copy(
+	          expected_values,
+	          values,
+	          sizeof( uint64_t ) * 64 ) != NULL;
+
+	FCRYPTO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	result = libfcrypto_des3_bitslice_transpose(
+	          values,
+	          &error );
+
+	FCRYPTO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FCRYPTO_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfcrypto_des3_bitslice_transpose(
+	          values,
+	          &error );
+
+	FCRYPTO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FCRYPTO_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = memory_compare(
+	          values,
+	          expected_values,
+	          sizeof( uint64_t ) * 64 );
+
+	FCRYPTO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	/* Test error cases
+	 */
+	result = libfcrypto_des3_bitslice_transpose(
+	          NULL,
+	          &error );
+
+	FCRYPTO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FCRYPTO_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libfcrypto_des3_bitslice_crypt_slices function
+ * Returns 1 if successful or 0 if not
+ */
+int fcrypto_test_des3_bitslice_crypt_slices(
+     void )
+{
+	uint8_t key[ 24 ] = {
+		0x01, 0x23, 0x45, 0x67, 0x89, 0xab, 0xcd, 0xef, 0x23, 0x45, 0x67, 0x89, 0xab, 0xcd, 0xef, 0x01,
+		0x45, 0x67, 0x89, 0xab, 0xcd, 0xef, 0x01, 0x23 };
+
+	const uint64_t *sub_keys[ 3 ];
+	uint64_t expected_values[ LIBFCRYPTO_DES3_BITSLICE_MAXIMUM_NUMBER_OF_BLOCKS ];
+	uint64_t values[ LIBFCRYPTO_DES3_BITSLICE_MAXIMUM_NUMBER_OF_BLOCKS ];
+
+	libcerror_error_t *error                             = NULL;
+	libfcrypto_des3_context_t *des3_context              = NULL;
+	libfcrypto_internal_des3_context_t *internal_context = NULL;
+	int group_index                                      = 0;
+	int result                                           = 0;
+
+	/* Initialize test
+	 */
+	result = libfcrypto_des3_context_initialize(
+	          &des3_context,
+	          &error );
+
+	FCRYPTO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FCRYPTO_TEST_ASSERT_IS_NOT_NULL(
+	 "des3_context",
+	 des3_context );
+
+	FCRYPTO_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfcrypto_des3_context_set_key(
+	          des3_context,
+	          key,
+	          192,
+	          &error );
+
+	FCRYPTO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FCRYPTO_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	internal_context = (libfcrypto_internal_des3_context_t *) des3_context;
+
+	sub_keys[ 0 ] = internal_context->encryption_sub_keys[ 0 ];
+	sub_keys[ 1 ] = internal_context->decryption_sub_keys[ 1 ];
+	sub_keys[ 2 ] = internal_context->encryption_sub_keys[ 2 ];
+
+	fcrypto_test_des3_bitslice_fill_values(
+	 values,
+	 LIBFCRYPTO_DES3_BITSLICE_MAXIMUM_NUMBER_OF_BLOCKS );
+
+	result = memory_copy(
+	          expected_values,
+	          values,
+	          sizeof( uint64_t ) * LIBFCRYPTO_DES3_BITSLICE_MAXIMUM_NUMBER_OF_BLOCKS ) != NULL;
+
+	FCRYPTO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	result = fcrypto_test_des3_bitslice_crypt_values(
+	          internal_context,
+	          LIBFCRYPTO_DES3_CRYPT_MODE_ENCRYPT,
+	          expected_values,
+	          LIBFCRYPTO_DES3_BITSLICE_MAXIMUM_NUMBER_OF_BLOCKS,
+	          &error );
+
+	FCRYPTO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FCRYPTO_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libfcrypto_des3_bitslice_transpose(
+	          values,
+	          &error );
+
+	FCRYPTO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FCRYPTO_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfcrypto_des3_bitslice_crypt_slices(
+	          sub_keys,
+	          3,
+	          values,
+	          &error );
+
+	FCRYPTO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FCRYPTO_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfcrypto_des3_bitslice_transpose(
+	          values,
+	          &error );
+
+	FCRYPTO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FCRYPTO_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = memory_compare(
+	          values,
+	          expected_values,
+	          sizeof( uint64_t ) * LIBFCRYPTO_DES3_BITSLICE_NUMBER_OF_BLOCKS );
+
+	FCRYPTO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+#if defined( LIBFCRYPTO_DES3_BITSLICE_HAVE_AVX2 )
+	if( __builtin_cpu_supports( "avx2" ) )
+	{
+		fcrypto_test_des3_bitslice_fill_values(
+		 values,
+		 LIBFCRYPTO_DES3_BITSLICE_MAXIMUM_NUMBER_OF_BLOCKS );
+
+		for( group_index = 0;
+		     group_index < 4;
+		     group_index++ )
+		{
+			result = libfcrypto_des3_bitslice_transpose(
+			          &( values[ group_index * 64 ] ),
+			          &error );
+
+			FCRYPTO_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 1 );
+
+			FCRYPTO_TEST_ASSERT_IS_NULL(
+			 "error",
+			 error );
+		}
+		result = libfcrypto_des3_bitslice_crypt_slices_avx2(
+		          sub_keys,
+		          3,
+		          values,
+		          &error );
+
+		FCRYPTO_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		FCRYPTO_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		for( group_index = 0;
+		     group_index < 4;
+		     group_index++ )
+		{
+			result = libfcrypto_des3_bitslice_transpose(
+			          &( values[ group_index * 64 ] ),
+			          &error );
+
+			FCRYPTO_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 1 );
+
+			FCRYPTO_TEST_ASSERT_IS_NULL(
+			 "error",
+			 error );
+		}
+		result = memory_compare(
+		          values,
+		          expected_values,
+		          sizeof( uint64_t ) * LIBFCRYPTO_DES3_BITSLICE_MAXIMUM_NUMBER_OF_BLOCKS );
+
+		FCRYPTO_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 0 );
+	}
+#endif /* defined( LIBFCRYPTO_DES3_BITSLICE_HAVE_AVX2 ) */
+
+	/* Test error cases
+	 */
+	result = libfcrypto_des3_bitslice_crypt_slices(
+	          NULL,
+	          3,
+	          values,
+	          &error );
+
+	FCRYPTO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FCRYPTO_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfcrypto_des3_bitslice_crypt_slices(
+	          sub_keys,
+	          2,
+	          values,
+	          &error );
+
+	FCRYPTO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FCRYPTO_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfcrypto_des3_bitslice_crypt_slices(
+	          sub_keys,
+	          3,
+	          NULL,
+	          &error );
+
+	FCRYPTO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FCRYPTO_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libfcrypto_des3_context_free(
+	          &des3_context,
+	          &error );
+
+	FCRYPTO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FCRYPTO_TEST_ASSERT_IS_NULL(
+	 "des3_context",
+	 des3_context );
+
+	FCRYPTO_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( des3_context != NULL )
+	{
+		libfcrypto_des3_context_free(
+		 &des3_context,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libfcrypto_des3_bitslice_crypt_blocks function
+ * Returns 1 if successful or 0 if not
+ */
+int fcrypto_test_des3_bitslice_crypt_blocks(
+     void )
+{
+	uint8_t key[ 24 ] = {
+		0x01, 0x23, 0x45, 0x67, 0x89, 0xab, 0xcd, 0xef, 0x23, 0x45, 0x67, 0x89, 0xab, 0xcd, 0xef, 0x01,
+		0x45, 0x67, 0x89, 0xab, 0xcd, 0xef, 0x01, 0x23 };
+
+	uint64_t expected_values[ 320 ];
+	uint64_t values[ 320 ];
+
+	libcerror_error_t *error                             = NULL;
+	libfcrypto_des3_context_t *des3_context              = NULL;
+	libfcrypto_internal_des3_context_t *internal_context = NULL;
+	int result                                           = 0;
+
+	/* Initialize test
+	 */
+	result = libfcrypto_des3_context_initialize(
+	          &des3_context,
+	          &error );
+
+	FCRYPTO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FCRYPTO_TEST_ASSERT_IS_NOT_NULL(
+	 "des3_context",
+	 des3_context );
+
+	FCRYPTO_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfcrypto_des3_context_set_key(
+	          des3_context,
+	          key,
+	          192,
+	          &error );
+
+	FCRYPTO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FCRYPTO_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	internal_context = (libfcrypto_internal_des3_context_t *) des3_context;
+
+	fcrypto_test_des3_bitslice_fill_values(
+	 values,
+	 320 );
+
+	result = memory_copy(
+	          expected_values,
+	          values,
+	          sizeof( uint64_t ) * 320 ) != NULL;
+
+	FCRYPTO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	result = fcrypto_test_des3_bitslice_crypt_values(
+	          internal_context,
+	          LIBFCRYPTO_DES3_CRYPT_MODE_DECRYPT,
+	          expected_values,
+	          320,
+	          &error );
+
+	FCRYPTO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FCRYPTO_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libfcrypto_des3_bitslice_crypt_blocks(
+	          internal_context,
+	          LIBFCRYPTO_DES3_CRYPT_MODE_DECRYPT,
+	          values,
+	          320,
+	          &error );
+
+	FCRYPTO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FCRYPTO_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = memory_compare(
+	          values,
+	          expected_values,
+	          sizeof( uint64_t ) * 320 );
+
+	FCRYPTO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	result = libfcrypto_des3_bitslice_crypt_blocks(
+	          internal_context,
+	          LIBFCRYPTO_DES3_CRYPT_MODE_ENCRYPT,
+	          values,
+	          320,
+	          &error );
+
+	FCRYPTO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FCRYPTO_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	fcrypto_test_des3_bitslice_fill_values(
+	 expected_values,
+	 320 );
+
+	result = memory_compare(
+	          values,
+	          expected_values,
+	          sizeof( uint64_t ) * 320 );
+
+	FCRYPTO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	/* Test error cases
+	 */
+	result = libfcrypto_des3_bitslice_crypt_blocks(
+	          NULL,
+	          LIBFCRYPTO_DES3_CRYPT_MODE_ENCRYPT,
+	          values,
+	          320,
+	          &error );
+
+	FCRYPTO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FCRYPTO_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfcrypto_des3_bitslice_crypt_blocks(
+	          internal_context,
+	          -1,
+	          values,
+	          320,
+	          &error );
+
+	FCRYPTO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FCRYPTO_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfcrypto_des3_bitslice_crypt_blocks(
+	          internal_context,
+	          LIBFCRYPTO_DES3_CRYPT_MODE_ENCRYPT,
+	          NULL,
+	          320,
+	          &error );
+
+	FCRYPTO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FCRYPTO_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfcrypto_des3_bitslice_crypt_blocks(
+	          internal_context,
+	          LIBFCRYPTO_DES3_CRYPT_MODE_ENCRYPT,
+	          values,
+	          63,
+	          &error );
+
+	FCRYPTO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FCRYPTO_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libfcrypto_des3_context_free(
+	          &des3_context,
+	          &error );
+
+	FCRYPTO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FCRYPTO_TEST_ASSERT_IS_NULL(
+	 "des3_context",
+	 des3_context );
+
+	FCRYPTO_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( des3_context != NULL )
+	{
+		libfcrypto_des3_context_free(
+		 &des3_context,
+		 NULL );
+	}
+	return( 0 );
+}
+
+#endif /* if defined( __GNUC__ ) && !defined( LIBFCRYPTO_DLL_IMPORT ) */
+
+/* The main program
+ */
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+int wmain(
+     int argc FCRYPTO_TEST_ATTRIBUTE_UNUSED,
+     wchar_t * const argv[] FCRYPTO_TEST_ATTRIBUTE_UNUSED )
+#else
+int main(
+     int argc FCRYPTO_TEST_ATTRIBUTE_UNUSED,
+     char * const argv[] FCRYPTO_TEST_ATTRIBUTE_UNUSED )
+#endif
+{
+	FCRYPTO_TEST_UNREFERENCED_PARAMETER( argc )
+	FCRYPTO_TEST_UNREFERENCED_PARAMETER( argv )
+
+#if defined( __GNUC__ ) && !defined( LIBFCRYPTO_DLL_IMPORT )
+
+	FCRYPTO_TEST_RUN(
+	 "libfcrypto_des3_bitslice_transpose",
+	 fcrypto_test_des3_bitslice_transpose );
+
+	FCRYPTO_TEST_RUN(
+	 "libfcrypto_des3_bitslice_crypt_slices",
+	 fcrypto_test_des3_bitslice_crypt_slices );
+
+	FCRYPTO_TEST_RUN(
+	 "libfcrypto_des3_bitslice_crypt_blocks",
+	 fcrypto_test_des3_bitslice_crypt_blocks );
+
+#endif /* if defined( __GNUC__ ) && !defined( LIBFCRYPTO_DLL_IMPORT ) */
+
+	return( EXIT_SUCCESS );
+
+#if defined( __GNUC__ ) && !defined( LIBFCRYPTO_DLL_IMPORT )
+
+on_error:
+	return( EXIT_FAILURE );
+
+#endif /* if defined( __GNUC__ ) && !defined( LIBFCRYPTO_DLL_IMPORT ) */
+}
+
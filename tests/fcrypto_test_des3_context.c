@@ -491,15 +491,14 @@ on_error:
 
 #if defined( __GNUC__ ) && !defined( LIBFCRYPTO_DLL_IMPORT )
 
-/* Tests the libfcrypto_internal_des3_context_crypt_block function
+/* Tests the libfcrypto_internal_des3_context_expand_key function
  * Returns 1 if successful or 0 if not
  */
-int fcrypto_test_internal_des3_context_crypt_block(
+int fcrypto_test_internal_des3_context_expand_key(
      void )
 {
 	libcerror_error_t *error                = NULL;
 	libfcrypto_des3_context_t *des3_context = NULL;
-	uint64_t output_value                   = 0;
 	int result                              = 0;
 
 	/* Initialize test
@@ -523,12 +522,1448 @@ int fcrypto_test_internal_des3_context_crypt_block(
 
 	/* Test regular case
 	 */
-	result = libfcrypto_internal_des3_context_crypt_block(
+	( (libfcrypto_internal_des3_context_t *) des3_context )->keys[ 0 ] = 0x9837239487ULL;
+
+	result = libfcrypto_internal_des3_context_expand_key(
+	          (libfcrypto_internal_des3_context_t *) des3_context,
+	          0,
+	          &error );
+
+	FCRYPTO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FCRYPTO_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FCRYPTO_TEST_ASSERT_EQUAL_UINT64(
+	 "encryption_sub_keys[ 0 ][ 15 ]",
+	 ( (libfcrypto_internal_des3_context_t *) des3_context )->encryption_sub_keys[ 0 ][ 15 ],
+	 ( (libfcrypto_internal_des3_context_t *) des3_context )->decryption_sub_keys[ 0 ][ 0 ] );
+
+	/* Test error cases
+	 */
+	result = libfcrypto_internal_des3_context_expand_key(
+	          NULL,
+	          0,
+	          &error );
+
+	FCRYPTO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FCRYPTO_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfcrypto_internal_des3_context_expand_key(
 	          (libfcrypto_internal_des3_context_t *) des3_context,
-	          0x9837239487ULL,
+	          -1,
+	          &error );
+
+	FCRYPTO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FCRYPTO_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfcrypto_internal_des3_context_expand_key(
+	          (libfcrypto_internal_des3_context_t *) des3_context,
+	          3,
+	          &error );
+
+	FCRYPTO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FCRYPTO_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libfcrypto_des3_context_free(
+	          &des3_context,
+	          &error );
+
+	FCRYPTO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FCRYPTO_TEST_ASSERT_IS_NULL(
+	 "des3_context",
+	 des3_context );
+
+	FCRYPTO_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( des3_context != NULL )
+	{
+		libfcrypto_des3_context_free(
+		 &des3_context,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libfcrypto_internal_des3_context_get_sub_keys function
+ * Returns 1 if successful or 0 if not
+ */
+int fcrypto_test_internal_des3_context_get_sub_keys(
+     void )
+{
+	uint8_t key[ 24 ] = {
+		0x01, 0x23, 0x45, 0x67, 0x89, 0xab, 0xcd, 0xef, 0x23, 0x45, 0x67, 0x89, 0xab, 0xcd, 0xef, 0x01,
+		0x23, 0x45, 0x67, 0x89, 0xab, 0xcd, 0xef, 0x01 };
+
+	const uint64_t *sub_keys[ 3 ];
+
+	libcerror_error_t *error                             = NULL;
+	libfcrypto_des3_context_t *des3_context              = NULL;
+	libfcrypto_internal_des3_context_t *internal_context = NULL;
+	int number_of_sub_keys                               = 0;
+	int result                                           = 0;
+
+	/* Initialize test
+	 */
+	result = libfcrypto_des3_context_initialize(
+	          &des3_context,
+	          &error );
+
+	FCRYPTO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FCRYPTO_TEST_ASSERT_IS_NOT_NULL(
+	 "des3_context",
+	 des3_context );
+
+	FCRYPTO_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	internal_context = (libfcrypto_internal_des3_context_t *) des3_context;
+
+	/* Test regular cases
+	 */
+	result = libfcrypto_des3_context_set_key(
+	          des3_context,
+	          key,
+	          128,
+	          &error );
+
+	FCRYPTO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FCRYPTO_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfcrypto_internal_des3_context_get_sub_keys(
+	          internal_context,
 	          LIBFCRYPTO_DES3_CRYPT_MODE_ENCRYPT,
-	          0x2983123819080ac1ULL,
-	          &output_value,
+	          sub_keys,
+	          &number_of_sub_keys,
+	          &error );
+
+	FCRYPTO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FCRYPTO_TEST_ASSERT_EQUAL_INT(
+	 "number_of_sub_keys",
+	 number_of_sub_keys,
+	 3 );
+
+	FCRYPTO_TEST_ASSERT_EQUAL_UINT64(
+	 "sub_keys[ 1 ][ 0 ]",
+	 sub_keys[ 1 ][ 0 ],
+	 internal_context->decryption_sub_keys[ 1 ][ 0 ] );
+
+	FCRYPTO_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test a key where the second and third key are the same
+	 */
+	result = libfcrypto_des3_context_set_key(
+	          des3_context,
+	          key,
+	          192,
+	          &error );
+
+	FCRYPTO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FCRYPTO_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfcrypto_internal_des3_context_get_sub_keys(
+	          internal_context,
+	          LIBFCRYPTO_DES3_CRYPT_MODE_DECRYPT,
+	          sub_keys,
+	          &number_of_sub_keys,
+	          &error );
+
+	FCRYPTO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FCRYPTO_TEST_ASSERT_EQUAL_INT(
+	 "number_of_sub_keys",
+	 number_of_sub_keys,
+	 1 );
+
+	FCRYPTO_TEST_ASSERT_EQUAL_UINT64(
+	 "sub_keys[ 0 ][ 0 ]",
+	 sub_keys[ 0 ][ 0 ],
+	 internal_context->decryption_sub_keys[ 0 ][ 0 ] );
+
+	FCRYPTO_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test a key where the first and second key are the same
+	 */
+	result = libfcrypto_des3_context_set_key(
+	          des3_context,
+	          &( key[ 8 ] ),
+	          128,
+	          &error );
+
+	FCRYPTO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FCRYPTO_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfcrypto_internal_des3_context_get_sub_keys(
+	          internal_context,
+	          LIBFCRYPTO_DES3_CRYPT_MODE_ENCRYPT,
+	          sub_keys,
+	          &number_of_sub_keys,
+	          &error );
+
+	FCRYPTO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FCRYPTO_TEST_ASSERT_EQUAL_INT(
+	 "number_of_sub_keys",
+	 number_of_sub_keys,
+	 1 );
+
+	FCRYPTO_TEST_ASSERT_EQUAL_UINT64(
+	 "sub_keys[ 0 ][ 0 ]",
+	 sub_keys[ 0 ][ 0 ],
+	 internal_context->encryption_sub_keys[ 2 ][ 0 ] );
+
+	FCRYPTO_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libfcrypto_internal_des3_context_get_sub_keys(
+	          NULL,
+	          LIBFCRYPTO_DES3_CRYPT_MODE_ENCRYPT,
+	          sub_keys,
+	          &number_of_sub_keys,
+	          &error );
+
+	FCRYPTO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FCRYPTO_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfcrypto_internal_des3_context_get_sub_keys(
+	          internal_context,
+	          -1,
+	          sub_keys,
+	          &number_of_sub_keys,
+	          &error );
+
+	FCRYPTO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FCRYPTO_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfcrypto_internal_des3_context_get_sub_keys(
+	          internal_context,
+	          LIBFCRYPTO_DES3_CRYPT_MODE_ENCRYPT,
+	          NULL,
+	          &number_of_sub_keys,
+	          &error );
+
+	FCRYPTO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FCRYPTO_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfcrypto_internal_des3_context_get_sub_keys(
+	          internal_context,
+	          LIBFCRYPTO_DES3_CRYPT_MODE_ENCRYPT,
+	          sub_keys,
+	          NULL,
+	          &error );
+
+	FCRYPTO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FCRYPTO_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libfcrypto_des3_context_free(
+	          &des3_context,
+	          &error );
+
+	FCRYPTO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FCRYPTO_TEST_ASSERT_IS_NULL(
+	 "des3_context",
+	 des3_context );
+
+	FCRYPTO_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( des3_context != NULL )
+	{
+		libfcrypto_des3_context_free(
+		 &des3_context,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libfcrypto_internal_des3_context_crypt_block_ede function
+ * Returns 1 if successful or 0 if not
+ */
+int fcrypto_test_internal_des3_context_crypt_block_ede(
+     void )
+{
+	uint8_t key[ 24 ] = {
+		0x01, 0x23, 0x45, 0x67, 0x89, 0xab, 0xcd, 0xef, 0x23, 0x45, 0x67, 0x89, 0xab, 0xcd, 0xef, 0x01,
+		0x45, 0x67, 0x89, 0xab, 0xcd, 0xef, 0x01, 0x23 };
+
+	const uint64_t *sub_keys[ 3 ];
+
+	libcerror_error_t *error                             = NULL;
+	libfcrypto_des3_context_t *des3_context              = NULL;
+	libfcrypto_internal_des3_context_t *internal_context = NULL;
+	uint64_t output_value                                = 0;
+	int number_of_sub_keys                               = 0;
+	int result                                           = 0;
+
+	/* Initialize test
+	 */
+	result = libfcrypto_des3_context_initialize(
+	          &des3_context,
+	          &error );
+
+	FCRYPTO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FCRYPTO_TEST_ASSERT_IS_NOT_NULL(
+	 "des3_context",
+	 des3_context );
+
+	FCRYPTO_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfcrypto_des3_context_set_key(
+	          des3_context,
+	          key,
+	          192,
+	          &error );
+
+	FCRYPTO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FCRYPTO_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	internal_context = (libfcrypto_internal_des3_context_t *) des3_context;
+
+	/* Test regular cases
+	 */
+	result = libfcrypto_internal_des3_context_get_sub_keys(
+	          internal_context,
+	          LIBFCRYPTO_DES3_CRYPT_MODE_ENCRYPT,
+	          sub_keys,
+	          &number_of_sub_keys,
+	          &error );
+
+	FCRYPTO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FCRYPTO_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfcrypto_internal_des3_context_crypt_block_ede(
+	          sub_keys,
+	          number_of_sub_keys,
+	          0x2983123819080ac1ULL,
+	          &output_value,
+	          &error );
+
+	FCRYPTO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FCRYPTO_TEST_ASSERT_EQUAL_UINT64(
+	 "output_value",
+	 output_value,
+	 (uint64_t) 0xc3cc60a4e09bff05ULL );
+
+	FCRYPTO_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfcrypto_internal_des3_context_get_sub_keys(
+	          internal_context,
+	          LIBFCRYPTO_DES3_CRYPT_MODE_DECRYPT,
+	          sub_keys,
+	          &number_of_sub_keys,
+	          &error );
+
+	FCRYPTO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FCRYPTO_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfcrypto_internal_des3_context_crypt_block_ede(
+	          sub_keys,
+	          number_of_sub_keys,
+	          output_value,
+	          &output_value,
+	          &error );
+
+	FCRYPTO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FCRYPTO_TEST_ASSERT_EQUAL_UINT64(
+	 "output_value",
+	 output_value,
+	 (uint64_t) 0x2983123819080ac1ULL );
+
+	FCRYPTO_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test a key that reduces to single DES
+	 */
+	result = libfcrypto_des3_context_set_key(
+	          des3_context,
+	          key,
+	          64,
+	          &error );
+
+	FCRYPTO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FCRYPTO_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfcrypto_internal_des3_context_get_sub_keys(
+	          internal_context,
+	          LIBFCRYPTO_DES3_CRYPT_MODE_ENCRYPT,
+	          sub_keys,
+	          &number_of_sub_keys,
+	          &error );
+
+	FCRYPTO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FCRYPTO_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfcrypto_internal_des3_context_crypt_block_ede(
+	          sub_keys,
+	          number_of_sub_keys,
+	          0x4e6f772069732074ULL,
+	          &output_value,
+	          &error );
+
+	FCRYPTO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FCRYPTO_TEST_ASSERT_EQUAL_UINT64(
+	 "output_value",
+	 output_value,
+	 (uint64_t) 0x3fa40e8a984d4815ULL );
+
+	FCRYPTO_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfcrypto_internal_des3_context_get_sub_keys(
+	          internal_context,
+	          LIBFCRYPTO_DES3_CRYPT_MODE_DECRYPT,
+	          sub_keys,
+	          &number_of_sub_keys,
+	          &error );
+
+	FCRYPTO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FCRYPTO_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfcrypto_internal_des3_context_crypt_block_ede(
+	          sub_keys,
+	          number_of_sub_keys,
+	          output_value,
+	          &output_value,
+	          &error );
+
+	FCRYPTO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FCRYPTO_TEST_ASSERT_EQUAL_UINT64(
+	 "output_value",
+	 output_value,
+	 (uint64_t) 0x4e6f772069732074ULL );
+
+	FCRYPTO_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libfcrypto_internal_des3_context_crypt_block_ede(
+	          NULL,
+	          number_of_sub_keys,
+	          0x2983123819080ac1ULL,
+	          &output_value,
+	          &error );
+
+	FCRYPTO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FCRYPTO_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfcrypto_internal_des3_context_crypt_block_ede(
+	          sub_keys,
+	          2,
+	          0x2983123819080ac1ULL,
+	          &output_value,
+	          &error );
+
+	FCRYPTO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FCRYPTO_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfcrypto_internal_des3_context_crypt_block_ede(
+	          sub_keys,
+	          number_of_sub_keys,
+	          0x2983123819080ac1ULL,
+	          NULL,
+	          &error );
+
+	FCRYPTO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FCRYPTO_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libfcrypto_des3_context_free(
+	          &des3_context,
+	          &error );
+
+	FCRYPTO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FCRYPTO_TEST_ASSERT_IS_NULL(
+	 "des3_context",
+	 des3_context );
+
+	FCRYPTO_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( des3_context != NULL )
+	{
+		libfcrypto_des3_context_free(
+		 &des3_context,
+		 NULL );
+	}
+	return( 0 );
+}
+
+#endif /* if defined( __GNUC__ ) && !defined( LIBFCRYPTO_DLL_IMPORT ) */
+
+/* Tests the libfcrypto_des3_crypt_cbc function
+ * Returns 1 if successful or 0 if not
+ */
+int fcrypto_test_des3_crypt_cbc(
+     void )
+{
+	uint8_t initialization_vector[ 8 ] = {
+		0x03, 0x14, 0x25, 0x36, 0x47, 0x58, 0x69, 0x7a };
+
+	uint8_t key[ 24 ] = {
+		0x07, 0x24, 0x41, 0x5e, 0x7b, 0x98, 0xb5, 0xd2, 0xef, 0x0c, 0x29, 0x46, 0x63, 0x80, 0x9d, 0xba,
+		0xd7, 0xf4, 0x11, 0x2e, 0x4b, 0x68, 0x85, 0xa2 };
+
+	uint8_t block_data[ 8 ];
+	uint8_t expected_output_data[ 528 ];
+	uint8_t input_data[ 528 ];
+	uint8_t output_data[ 528 ];
+
+	libcerror_error_t *error                = NULL;
+	libfcrypto_des3_context_t *des3_context = NULL;
+	size_t byte_index                       = 0;
+	size_t data_offset                      = 0;
+	int result                              = 0;
+
+	/* Initialize test
+	 */
+	for( data_offset = 0;
+	     data_offset < 528;
+	     data_offset++ )
+	{
+		input_data[ data_offset ] = (uint8_t) ( ( data_offset * 13 ) + 5 );
+	}
+	result = libfcrypto_des3_context_initialize(
+	          &des3_context,
+	          &error );
+
+	FCRYPTO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FCRYPTO_TEST_ASSERT_IS_NOT_NULL(
+	 "des3_context",
+	 des3_context );
+
+	FCRYPTO_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfcrypto_des3_context_set_key(
+	          des3_context,
+	          key,
+	          192,
+	          &error );
+
+	FCRYPTO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FCRYPTO_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Calculate the expected output data using DES3-ECB, where each block is XOR-ed
+	 * with the preceding encrypted block
+	 */
+	for( data_offset = 0;
+	     data_offset < 528;
+	     data_offset += 8 )
+	{
+		for( byte_index = 0;
+		     byte_index < 8;
+		     byte_index++ )
+		{
+			if( data_offset == 0 )
+			{
+				block_data[ byte_index ] = input_data[ byte_index ] ^ initialization_vector[ byte_index ];
+			}
+			else
+			{
+				block_data[ byte_index ] = input_data[ data_offset + byte_index ] ^ expected_output_data[ data_offset - 8 + byte_index ];
+			}
+		}
+		result = libfcrypto_des3_crypt_ecb(
+		          des3_context,
+		          LIBFCRYPTO_DES3_CRYPT_MODE_ENCRYPT,
+		          block_data,
+		          8,
+		          &( expected_output_data[ data_offset ] ),
+		          8,
+		          &error );
+
+		FCRYPTO_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		FCRYPTO_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+	}
+	/* Test encrypting a buffer of data
+	 */
+	result = libfcrypto_des3_crypt_cbc(
+	          des3_context,
+	          LIBFCRYPTO_DES3_CRYPT_MODE_ENCRYPT,
+	          initialization_vector,
+	          8,
+	          input_data,
+	          528,
+	          output_data,
+	          528,
+	          &error );
+
+	FCRYPTO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FCRYPTO_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = memory_compare(
+	          output_data,
+	          expected_output_data,
+	          528 );
+
+	FCRYPTO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	/* Test decrypting a buffer of data, which uses the bitsliced functions for the first 64 blocks
+	 */
+	result = libfcrypto_des3_crypt_cbc(
+	          des3_context,
+	          LIBFCRYPTO_DES3_CRYPT_MODE_DECRYPT,
+	          initialization_vector,
+	          8,
+	          expected_output_data,
+	          528,
+	          output_data,
+	          528,
+	          &error );
+
+	FCRYPTO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FCRYPTO_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = memory_compare(
+	          output_data,
+	          input_data,
+	          528 );
+
+	FCRYPTO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	/* Test encrypting data in-place
+	 */
+	memory_copy(
+	 output_data,
+	 input_data,
+	 528 );
+
+	result = libfcrypto_des3_crypt_cbc(
+	          des3_context,
+	          LIBFCRYPTO_DES3_CRYPT_MODE_ENCRYPT,
+	          initialization_vector,
+	          8,
+	          output_data,
+	          528,
+	          output_data,
+	          528,
+	          &error );
+
+	FCRYPTO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FCRYPTO_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = memory_compare(
+	          output_data,
+	          expected_output_data,
+	          528 );
+
+	FCRYPTO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	/* Test decrypting data in-place
+	 */
+	result = libfcrypto_des3_crypt_cbc(
+	          des3_context,
+	          LIBFCRYPTO_DES3_CRYPT_MODE_DECRYPT,
+	          initialization_vector,
+	          8,
+	          output_data,
+	          528,
+	          output_data,
+	          528,
+	          &error );
+
+	FCRYPTO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FCRYPTO_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = memory_compare(
+	          output_data,
+	          input_data,
+	          528 );
+
+	FCRYPTO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	/* Test decrypting data in-place without the bitsliced functions
+	 */
+	memory_copy(
+	 output_data,
+	 expected_output_data,
+	 24 );
+
+	result = libfcrypto_des3_crypt_cbc(
+	          des3_context,
+	          LIBFCRYPTO_DES3_CRYPT_MODE_DECRYPT,
+	          initialization_vector,
+	          8,
+	          output_data,
+	          24,
+	          output_data,
+	          24,
+	          &error );
+
+	FCRYPTO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FCRYPTO_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = memory_compare(
+	          output_data,
+	          input_data,
+	          24 );
+
+	FCRYPTO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	/* Test error cases
+	 */
+	result = libfcrypto_des3_crypt_cbc(
+	          NULL,
+	          LIBFCRYPTO_DES3_CRYPT_MODE_DECRYPT,
+	          initialization_vector,
+	          8,
+	          expected_output_data,
+	          528,
+	          output_data,
+	          528,
+	          &error );
+
+	FCRYPTO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FCRYPTO_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfcrypto_des3_crypt_cbc(
+	          des3_context,
+	          LIBFCRYPTO_DES3_CRYPT_MODE_DECRYPT,
+	          NULL,
+	          8,
+	          expected_output_data,
+	          528,
+	          output_data,
+	          528,
+	          &error );
+
+	FCRYPTO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FCRYPTO_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfcrypto_des3_crypt_cbc(
+	          des3_context,
+	          LIBFCRYPTO_DES3_CRYPT_MODE_DECRYPT,
+	          initialization_vector,
+	          7,
+	          expected_output_data,
+	          528,
+	          output_data,
+	          528,
+	          &error );
+
+	FCRYPTO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FCRYPTO_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfcrypto_des3_crypt_cbc(
+	          des3_context,
+	          -1,
+	          initialization_vector,
+	          8,
+	          expected_output_data,
+	          528,
+	          output_data,
+	          528,
+	          &error );
+
+	FCRYPTO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FCRYPTO_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfcrypto_des3_crypt_cbc(
+	          des3_context,
+	          LIBFCRYPTO_DES3_CRYPT_MODE_DECRYPT,
+	          initialization_vector,
+	          8,
+	          NULL,
+	          528,
+	          output_data,
+	          528,
+	          &error );
+
+	FCRYPTO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FCRYPTO_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfcrypto_des3_crypt_cbc(
+	          des3_context,
+	          LIBFCRYPTO_DES3_CRYPT_MODE_DECRYPT,
+	          initialization_vector,
+	          8,
+	          expected_output_data,
+	          527,
+	          output_data,
+	          528,
+	          &error );
+
+	FCRYPTO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FCRYPTO_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfcrypto_des3_crypt_cbc(
+	          des3_context,
+	          LIBFCRYPTO_DES3_CRYPT_MODE_DECRYPT,
+	          initialization_vector,
+	          8,
+	          expected_output_data,
+	          (size_t) SSIZE_MAX + 1,
+	          output_data,
+	          528,
+	          &error );
+
+	FCRYPTO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FCRYPTO_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfcrypto_des3_crypt_cbc(
+	          des3_context,
+	          LIBFCRYPTO_DES3_CRYPT_MODE_DECRYPT,
+	          initialization_vector,
+	          8,
+	          expected_output_data,
+	          528,
+	          NULL,
+	          528,
+	          &error );
+
+	FCRYPTO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FCRYPTO_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfcrypto_des3_crypt_cbc(
+	          des3_context,
+	          LIBFCRYPTO_DES3_CRYPT_MODE_DECRYPT,
+	          initialization_vector,
+	          8,
+	          expected_output_data,
+	          528,
+	          output_data,
+	          520,
+	          &error );
+
+	FCRYPTO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FCRYPTO_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfcrypto_des3_crypt_cbc(
+	          des3_context,
+	          LIBFCRYPTO_DES3_CRYPT_MODE_DECRYPT,
+	          initialization_vector,
+	          8,
+	          expected_output_data,
+	          528,
+	          output_data,
+	          (size_t) SSIZE_MAX + 1,
+	          &error );
+
+	FCRYPTO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FCRYPTO_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libfcrypto_des3_context_free(
+	          &des3_context,
+	          &error );
+
+	FCRYPTO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FCRYPTO_TEST_ASSERT_IS_NULL(
+	 "des3_context",
+	 des3_context );
+
+	FCRYPTO_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( des3_context != NULL )
+	{
+		libfcrypto_des3_context_free(
+		 &des3_context,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libfcrypto_des3_crypt_ctr function
+ * Returns 1 if successful or 0 if not
+ */
+int fcrypto_test_des3_crypt_ctr(
+     void )
+{
+	uint8_t initial_counter_block[ 8 ] = {
+		0x03, 0x14, 0x25, 0x36, 0x00, 0x00, 0xff, 0xf0 };
+
+	uint8_t key[ 24 ] = {
+		0x07, 0x24, 0x41, 0x5e, 0x7b, 0x98, 0xb5, 0xd2, 0xef, 0x0c, 0x29, 0x46, 0x63, 0x80, 0x9d, 0xba,
+		0xd7, 0xf4, 0x11, 0x2e, 0x4b, 0x68, 0x85, 0xa2 };
+
+	uint8_t counter_blocks_data[ 3008 ];
+	uint8_t expected_output_data[ 3000 ];
+	uint8_t input_data[ 3000 ];
+	uint8_t output_data[ 3000 ];
+
+	libcerror_error_t *error                = NULL;
+	libfcrypto_des3_context_t *des3_context = NULL;
+	size_t block_index                      = 0;
+	size_t byte_index                       = 0;
+	size_t data_offset                      = 0;
+	uint32_t counter_value                  = 0;
+	int result                              = 0;
+
+	/* Initialize test
+	 */
+	for( data_offset = 0;
+	     data_offset < 3000;
+	     data_offset++ )
+	{
+		input_data[ data_offset ] = (uint8_t) ( ( data_offset * 13 ) + 5 );
+	}
+	result = libfcrypto_des3_context_initialize(
+	          &des3_context,
+	          &error );
+
+	FCRYPTO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FCRYPTO_TEST_ASSERT_IS_NOT_NULL(
+	 "des3_context",
+	 des3_context );
+
+	FCRYPTO_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfcrypto_des3_context_set_key(
+	          des3_context,
+	          key,
+	          192,
+	          &error );
+
+	FCRYPTO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FCRYPTO_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Calculate the expected output data using DES3-ECB with a 32-bit big-endian counter
+	 * that carries over into the third byte from the end of the counter block
+	 */
+	for( block_index = 0;
+	     block_index < 376;
+	     block_index++ )
+	{
+		for( byte_index = 0;
+		     byte_index < 8;
+		     byte_index++ )
+		{
+			counter_blocks_data[ ( block_index * 8 ) + byte_index ] = initial_counter_block[ byte_index ];
+		}
+		counter_value = (uint32_t) ( 0x0000fff0UL + block_index );
+
+		counter_blocks_data[ ( block_index * 8 ) + 4 ] = (uint8_t) ( counter_value >> 24 );
+		counter_blocks_data[ ( block_index * 8 ) + 5 ] = (uint8_t) ( counter_value >> 16 );
+		counter_blocks_data[ ( block_index * 8 ) + 6 ] = (uint8_t) ( counter_value >> 8 );
+		counter_blocks_data[ ( block_index * 8 ) + 7 ] = (uint8_t) counter_value;
+	}
+	result = libfcrypto_des3_crypt_ecb(
+	          des3_context,
+	          LIBFCRYPTO_DES3_CRYPT_MODE_ENCRYPT,
+	          counter_blocks_data,
+	          3008,
+	          counter_blocks_data,
+	          3008,
+	          &error );
+
+	FCRYPTO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FCRYPTO_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	for( data_offset = 0;
+	     data_offset < 3000;
+	     data_offset++ )
+	{
+		expected_output_data[ data_offset ] = input_data[ data_offset ] ^ counter_blocks_data[ data_offset ];
+	}
+	/* Test encrypting a buffer of data that spans multiple key stream buffers
+	 */
+	result = libfcrypto_des3_crypt_ctr(
+	          des3_context,
+	          initial_counter_block,
+	          8,
+	          4,
+	          LIBFCRYPTO_ENDIAN_BIG,
+	          0,
+	          input_data,
+	          3000,
+	          output_data,
+	          3000,
+	          &error );
+
+	FCRYPTO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FCRYPTO_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = memory_compare(
+	          output_data,
+	          expected_output_data,
+	          3000 );
+
+	FCRYPTO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	/* Test decrypting the data
+	 */
+	result = libfcrypto_des3_crypt_ctr(
+	          des3_context,
+	          initial_counter_block,
+	          8,
+	          4,
+	          LIBFCRYPTO_ENDIAN_BIG,
+	          0,
+	          output_data,
+	          3000,
+	          output_data,
+	          3000,
+	          &error );
+
+	FCRYPTO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FCRYPTO_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = memory_compare(
+	          output_data,
+	          input_data,
+	          3000 );
+
+	FCRYPTO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	/* Test encrypting data at an offset that is not a multiple of the block size
+	 */
+	result = libfcrypto_des3_crypt_ctr(
+	          des3_context,
+	          initial_counter_block,
+	          8,
+	          4,
+	          LIBFCRYPTO_ENDIAN_BIG,
+	          1029,
+	          &( input_data[ 1029 ] ),
+	          1500,
+	          output_data,
+	          1500,
 	          &error );
 
 	FCRYPTO_TEST_ASSERT_EQUAL_INT(
@@ -536,21 +1971,73 @@ int fcrypto_test_internal_des3_context_crypt_block(
 	 result,
 	 1 );
 
-	FCRYPTO_TEST_ASSERT_EQUAL_UINT64(
-	 "output_value",
-	 output_value,
-	 (uint64_t) 0xa9494d9bbdc2873fULL );
+	FCRYPTO_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = memory_compare(
+	          output_data,
+	          &( expected_output_data[ 1029 ] ),
+	          1500 );
+
+	FCRYPTO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	/* Test encrypting data in-place
+	 */
+	for( data_offset = 0;
+	     data_offset < 3000;
+	     data_offset++ )
+	{
+		output_data[ data_offset ] = input_data[ data_offset ];
+	}
+	result = libfcrypto_des3_crypt_ctr(
+	          des3_context,
+	          initial_counter_block,
+	          8,
+	          4,
+	          LIBFCRYPTO_ENDIAN_BIG,
+	          0,
+	          output_data,
+	          3000,
+	          output_data,
+	          3000,
+	          &error );
+
+	FCRYPTO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
 
 	FCRYPTO_TEST_ASSERT_IS_NULL(
 	 "error",
 	 error );
 
-	result = libfcrypto_internal_des3_context_crypt_block(
-	          (libfcrypto_internal_des3_context_t *) des3_context,
-	          0x3719827398ULL,
-	          LIBFCRYPTO_DES3_CRYPT_MODE_DECRYPT,
-	          0x344720e90cdc908fULL,
-	          &output_value,
+	result = memory_compare(
+	          output_data,
+	          expected_output_data,
+	          3000 );
+
+	FCRYPTO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	/* Test encrypting data with a little-endian counter at an offset
+	 */
+	result = libfcrypto_des3_crypt_ctr(
+	          des3_context,
+	          initial_counter_block,
+	          8,
+	          4,
+	          LIBFCRYPTO_ENDIAN_LITTLE,
+	          0,
+	          input_data,
+	          3000,
+	          expected_output_data,
+	          3000,
 	          &error );
 
 	FCRYPTO_TEST_ASSERT_EQUAL_INT(
@@ -558,23 +2045,55 @@ int fcrypto_test_internal_des3_context_crypt_block(
 	 result,
 	 1 );
 
-	FCRYPTO_TEST_ASSERT_EQUAL_UINT64(
-	 "output_value",
-	 output_value,
-	 (uint64_t) 0x6d0ee7e5792e2a93ULL );
+	FCRYPTO_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfcrypto_des3_crypt_ctr(
+	          des3_context,
+	          initial_counter_block,
+	          8,
+	          4,
+	          LIBFCRYPTO_ENDIAN_LITTLE,
+	          77,
+	          &( input_data[ 77 ] ),
+	          2000,
+	          output_data,
+	          2000,
+	          &error );
+
+	FCRYPTO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
 
 	FCRYPTO_TEST_ASSERT_IS_NULL(
 	 "error",
 	 error );
 
+	result = memory_compare(
+	          output_data,
+	          &( expected_output_data[ 77 ] ),
+	          2000 );
+
+	FCRYPTO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
 	/* Test error cases
 	 */
-	result = libfcrypto_internal_des3_context_crypt_block(
+	result = libfcrypto_des3_crypt_ctr(
 	          NULL,
-	          0x9837239487ULL,
-	          LIBFCRYPTO_DES3_CRYPT_MODE_ENCRYPT,
-	          0x2983123819080ac1ULL,
-	          &output_value,
+	          initial_counter_block,
+	          8,
+	          4,
+	          LIBFCRYPTO_ENDIAN_BIG,
+	          0,
+	          input_data,
+	          3000,
+	          output_data,
+	          3000,
 	          &error );
 
 	FCRYPTO_TEST_ASSERT_EQUAL_INT(
@@ -589,12 +2108,17 @@ int fcrypto_test_internal_des3_context_crypt_block(
 	libcerror_error_free(
 	 &error );
 
-	result = libfcrypto_internal_des3_context_crypt_block(
-	          (libfcrypto_internal_des3_context_t *) des3_context,
-	          0x9837239487ULL,
-	          -1,
-	          0x2983123819080ac1ULL,
-	          &output_value,
+	result = libfcrypto_des3_crypt_ctr(
+	          des3_context,
+	          NULL,
+	          8,
+	          4,
+	          LIBFCRYPTO_ENDIAN_BIG,
+	          0,
+	          input_data,
+	          3000,
+	          output_data,
+	          3000,
 	          &error );
 
 	FCRYPTO_TEST_ASSERT_EQUAL_INT(
@@ -609,12 +2133,217 @@ int fcrypto_test_internal_des3_context_crypt_block(
 	libcerror_error_free(
 	 &error );
 
-	result = libfcrypto_internal_des3_context_crypt_block(
-	          (libfcrypto_internal_des3_context_t *) des3_context,
-	          0x9837239487ULL,
-	          LIBFCRYPTO_DES3_CRYPT_MODE_ENCRYPT,
-	          0x2983123819080ac1ULL,
+	result = libfcrypto_des3_crypt_ctr(
+	          des3_context,
+	          initial_counter_block,
+	          7,
+	          4,
+	          LIBFCRYPTO_ENDIAN_BIG,
+	          0,
+	          input_data,
+	          3000,
+	          output_data,
+	          3000,
+	          &error );
+
+	FCRYPTO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FCRYPTO_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfcrypto_des3_crypt_ctr(
+	          des3_context,
+	          initial_counter_block,
+	          8,
+	          0,
+	          LIBFCRYPTO_ENDIAN_BIG,
+	          0,
+	          input_data,
+	          3000,
+	          output_data,
+	          3000,
+	          &error );
+
+	FCRYPTO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FCRYPTO_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfcrypto_des3_crypt_ctr(
+	          des3_context,
+	          initial_counter_block,
+	          8,
+	          9,
+	          LIBFCRYPTO_ENDIAN_BIG,
+	          0,
+	          input_data,
+	          3000,
+	          output_data,
+	          3000,
+	          &error );
+
+	FCRYPTO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FCRYPTO_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfcrypto_des3_crypt_ctr(
+	          des3_context,
+	          initial_counter_block,
+	          8,
+	          4,
+	          0,
+	          0,
+	          input_data,
+	          3000,
+	          output_data,
+	          3000,
+	          &error );
+
+	FCRYPTO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FCRYPTO_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfcrypto_des3_crypt_ctr(
+	          des3_context,
+	          initial_counter_block,
+	          8,
+	          4,
+	          LIBFCRYPTO_ENDIAN_BIG,
+	          0,
+	          NULL,
+	          3000,
+	          output_data,
+	          3000,
+	          &error );
+
+	FCRYPTO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FCRYPTO_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfcrypto_des3_crypt_ctr(
+	          des3_context,
+	          initial_counter_block,
+	          8,
+	          4,
+	          LIBFCRYPTO_ENDIAN_BIG,
+	          0,
+	          input_data,
+	          (size_t) SSIZE_MAX + 1,
+	          output_data,
+	          3000,
+	          &error );
+
+	FCRYPTO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FCRYPTO_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfcrypto_des3_crypt_ctr(
+	          des3_context,
+	          initial_counter_block,
+	          8,
+	          4,
+	          LIBFCRYPTO_ENDIAN_BIG,
+	          0,
+	          input_data,
+	          3000,
 	          NULL,
+	          3000,
+	          &error );
+
+	FCRYPTO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FCRYPTO_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfcrypto_des3_crypt_ctr(
+	          des3_context,
+	          initial_counter_block,
+	          8,
+	          4,
+	          LIBFCRYPTO_ENDIAN_BIG,
+	          0,
+	          input_data,
+	          3000,
+	          output_data,
+	          2999,
+	          &error );
+
+	FCRYPTO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FCRYPTO_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfcrypto_des3_crypt_ctr(
+	          des3_context,
+	          initial_counter_block,
+	          8,
+	          4,
+	          LIBFCRYPTO_ENDIAN_BIG,
+	          0,
+	          input_data,
+	          3000,
+	          output_data,
+	          (size_t) SSIZE_MAX + 1,
 	          &error );
 
 	FCRYPTO_TEST_ASSERT_EQUAL_INT(
@@ -665,8 +2394,6 @@ on_error:
 	return( 0 );
 }
 
-#endif /* if defined( __GNUC__ ) && !defined( LIBFCRYPTO_DLL_IMPORT ) */
-
 /* Tests the libfcrypto_des3_crypt_ecb function
  * Returns 1 if successful or 0 if not
  */
@@ -967,12 +2694,26 @@ int main(
 #if defined( __GNUC__ ) && !defined( LIBFCRYPTO_DLL_IMPORT )
 
 	FCRYPTO_TEST_RUN(
-	 "libfcrypto_internal_des3_context_crypt_block",
-	 fcrypto_test_internal_des3_context_crypt_block );
+	 "libfcrypto_internal_des3_context_expand_key",
+	 fcrypto_test_internal_des3_context_expand_key );
+
+	FCRYPTO_TEST_RUN(
+	 "libfcrypto_internal_des3_context_get_sub_keys",
+	 fcrypto_test_internal_des3_context_get_sub_keys );
+
+	FCRYPTO_TEST_RUN(
+	 "libfcrypto_internal_des3_context_crypt_block_ede",
+	 fcrypto_test_internal_des3_context_crypt_block_ede );
 
 #endif /* if defined( __GNUC__ ) && !defined( LIBFCRYPTO_DLL_IMPORT ) */
 
-	/* TODO add tests for libfcrypto_des3_crypt_cbc */
+	FCRYPTO_TEST_RUN(
+	 "libfcrypto_des3_crypt_cbc",
+	 fcrypto_test_des3_crypt_cbc );
+
+	FCRYPTO_TEST_RUN(
+	 "libfcrypto_des3_crypt_ctr",
+	 fcrypto_test_des3_crypt_ctr );
 
 	FCRYPTO_TEST_RUN(
 	 "libfcrypto_des3_crypt_ecb",
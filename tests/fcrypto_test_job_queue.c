@@ -0,0 +1,1502 @@
+/*
+ * Library Job queue type test program
+ *
+ * Copyright (C) 2017-2024, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <file_stream.h>
+#include <memory.h>
+#include <types.h>
+
+#if defined( HAVE_STDLIB_H ) || defined( WINAPI )
+#include <stdlib.h>
+#endif
+
+#include "fcrypto_test_libcerror.h"
+#include "fcrypto_test_libfcrypto.h"
+#include "fcrypto_test_macros.h"
+#include "fcrypto_test_memory.h"
+#include "fcrypto_test_unused.h"
+
+#include "../libfcrypto/libfcrypto_job_queue.h"
+
+/* Test completion function that stores the result of a job
+ * The result is stored as 3 if the job error does not match the result
+ */
+void fcrypto_test_job_queue_completion_function(
+      intptr_t *callback_data,
+      uint64_t job_identifier,
+      int result,
+      libcerror_error_t *job_error )
+{
+	int *results = (int *) callback_data;
+
+	if( ( results != NULL )
+	 && ( job_identifier >= 1 ) )
+	{
+		if( ( result == -1 ) != ( job_error != NULL ) )
+		{
+			result = 3;
+		}
+		results[ ( job_identifier - 1 ) % 32 ] = result;
+	}
+}
+
+/* Tests the libfcrypto_job_queue_initialize function
+ * Returns 1 if successful or 0 if not
+ */
+int fcrypto_test_job_queue_initialize(
+     void )
+{
+	libcerror_error_t *error         = NULL;
+	libfcrypto_job_queue_t *job_queue = NULL;
+	int result                        = 0;
+
+#if defined( HAVE_FCRYPTO_TEST_MEMORY )
+	int number_of_malloc_fail_tests   = 2;
+	int number_of_memset_fail_tests   = 1;
+	int test_number                   = 0;
+#endif
+
+	/* Test regular cases
+	 */
+	result = libfcrypto_job_queue_initialize(
+	          &job_queue,
+	          0,
+	          1,
+	          &error );
+
+	FCRYPTO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FCRYPTO_TEST_ASSERT_IS_NOT_NULL(
+	 "job_queue",
+	 job_queue );
+
+	FCRYPTO_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfcrypto_job_queue_free(
+	          &job_queue,
+	          &error );
+
+	FCRYPTO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FCRYPTO_TEST_ASSERT_IS_NULL(
+	 "job_queue",
+	 job_queue );
+
+	FCRYPTO_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfcrypto_job_queue_initialize(
+	          &job_queue,
+	          4,
+	          64,
+	          &error );
+
+	FCRYPTO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FCRYPTO_TEST_ASSERT_IS_NOT_NULL(
+	 "job_queue",
+	 job_queue );
+
+	FCRYPTO_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libfcrypto_job_queue_initialize(
+	          NULL,
+	          4,
+	          64,
+	          &error );
+
+	FCRYPTO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FCRYPTO_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfcrypto_job_queue_initialize(
+	          &job_queue,
+	          4,
+	          64,
+	          &error );
+
+	FCRYPTO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FCRYPTO_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfcrypto_job_queue_free(
+	          &job_queue,
+	          &error );
+
+	FCRYPTO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FCRYPTO_TEST_ASSERT_IS_NULL(
+	 "job_queue",
+	 job_queue );
+
+	FCRYPTO_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfcrypto_job_queue_initialize(
+	          &job_queue,
+	          -1,
+	          64,
+	          &error );
+
+	FCRYPTO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FCRYPTO_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfcrypto_job_queue_initialize(
+	          &job_queue,
+	          257,
+	          64,
+	          &error );
+
+	FCRYPTO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FCRYPTO_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfcrypto_job_queue_initialize(
+	          &job_queue,
+	          4,
+	          0,
+	          &error );
+
+	FCRYPTO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FCRYPTO_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfcrypto_job_queue_initialize(
+	          &job_queue,
+	          4,
+	          65537,
+	          &error );
+
+	FCRYPTO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FCRYPTO_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+#if defined( HAVE_FCRYPTO_TEST_MEMORY )
+
+	for( test_number = 0;
+	     test_number < number_of_malloc_fail_tests;
+	     test_number++ )
+	{
+		/* Test libfcrypto_job_queue_initialize with malloc failing
+		 */
+		fcrypto_test_malloc_attempts_before_fail = test_number;
+
+		result = libfcrypto_job_queue_initialize(
+		          &job_queue,
+		          0,
+		          64,
+		          &error );
+
+		if( fcrypto_test_malloc_attempts_before_fail != -1 )
+		{
+			fcrypto_test_malloc_attempts_before_fail = -1;
+
+			if( job_queue != NULL )
+			{
+				libfcrypto_job_queue_free(
+				 &job_queue,
+				 NULL );
+			}
+		}
+		else
+		{
+			FCRYPTO_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 -1 );
+
+			FCRYPTO_TEST_ASSERT_IS_NULL(
+			 "job_queue",
+			 job_queue );
+
+			FCRYPTO_TEST_ASSERT_IS_NOT_NULL(
+			 "error",
+			 error );
+
+			libcerror_error_free(
+			 &error );
+		}
+	}
+	for( test_number = 0;
+	     test_number < number_of_memset_fail_tests;
+	     test_number++ )
+	{
+		/* Test libfcrypto_job_queue_initialize with memset failing
+		 */
+		fcrypto_test_memset_attempts_before_fail = test_number;
+
+		result = libfcrypto_job_queue_initialize(
+		          &job_queue,
+		          0,
+		          64,
+		          &error );
+
+		if( fcrypto_test_memset_attempts_before_fail != -1 )
+		{
+			fcrypto_test_memset_attempts_before_fail = -1;
+
+			if( job_queue != NULL )
+			{
+				libfcrypto_job_queue_free(
+				 &job_queue,
+				 NULL );
+			}
+		}
+		else
+		{
+			FCRYPTO_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 -1 );
+
+			FCRYPTO_TEST_ASSERT_IS_NULL(
+			 "job_queue",
+			 job_queue );
+
+			FCRYPTO_TEST_ASSERT_IS_NOT_NULL(
+			 "error",
+			 error );
+
+			libcerror_error_free(
+			 &error );
+		}
+	}
+#endif /* defined( HAVE_FCRYPTO_TEST_MEMORY ) */
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( job_queue != NULL )
+	{
+		libfcrypto_job_queue_free(
+		 &job_queue,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libfcrypto_job_queue_free function
+ * Returns 1 if successful or 0 if not
+ */
+int fcrypto_test_job_queue_free(
+     void )
+{
+	libcerror_error_t *error = NULL;
+	int result               = 0;
+
+	/* Test error cases
+	 */
+	result = libfcrypto_job_queue_free(
+	          NULL,
+	          &error );
+
+	FCRYPTO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FCRYPTO_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libfcrypto_job_queue_submit_crypt and libfcrypto_job_queue_wait functions
+ * Returns 1 if successful or 0 if not
+ */
+int fcrypto_test_job_queue_submit_crypt(
+     void )
+{
+	uint8_t key[ 32 ] = {
+		0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09, 0x0a, 0x0b, 0x0c, 0x0d, 0x0e, 0x0f,
+		0x10, 0x11, 0x12, 0x13, 0x14, 0x15, 0x16, 0x17, 0x18, 0x19, 0x1a, 0x1b, 0x1c, 0x1d, 0x1e, 0x1f };
+
+	uint8_t expected_output_data[ 32 * 512 ];
+	uint8_t initialization_vectors[ 32 * 16 ];
+	uint8_t input_data[ 32 * 512 ];
+	uint8_t output_data[ 32 * 512 ];
+	int results[ 32 ];
+
+	libcerror_error_t *error          = NULL;
+	libfcrypto_cipher_t *cipher       = NULL;
+	libfcrypto_cipher_t *rc4_cipher   = NULL;
+	libfcrypto_job_queue_t *job_queue = NULL;
+	size_t data_offset                = 0;
+	uint64_t job_identifier           = 0;
+	int job_index                     = 0;
+	int number_of_jobs                = 0;
+	int result                        = 0;
+
+	/* Initialize test
+	 */
+	for( data_offset = 0;
+	     data_offset < 32 * 512;
+	     data_offset++ )
+	{
+		input_data[ data_offset ] = (uint8_t) ( ( data_offset * 13 ) + 5 );
+	}
+	for( data_offset = 0;
+	     data_offset < 32 * 16;
+	     data_offset++ )
+	{
+		initialization_vectors[ data_offset ] = (uint8_t) ( data_offset * 7 );
+	}
+	for( job_index = 0;
+	     job_index < 32;
+	     job_index++ )
+	{
+		results[ job_index ] = 2;
+	}
+	result = libfcrypto_cipher_initialize(
+	          &cipher,
+	          LIBFCRYPTO_CIPHER_ALGORITHM_SERPENT,
+	          LIBFCRYPTO_CIPHER_MODE_CBC,
+	          &error );
+
+	FCRYPTO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FCRYPTO_TEST_ASSERT_IS_NOT_NULL(
+	 "cipher",
+	 cipher );
+
+	FCRYPTO_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfcrypto_cipher_set_key(
+	          cipher,
+	          key,
+	          256,
+	          &error );
+
+	FCRYPTO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FCRYPTO_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfcrypto_job_queue_initialize(
+	          &job_queue,
+	          4,
+	          8,
+	          &error );
+
+	FCRYPTO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FCRYPTO_TEST_ASSERT_IS_NOT_NULL(
+	 "job_queue",
+	 job_queue );
+
+	FCRYPTO_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Calculate the expected output data without the job queue
+	 */
+	for( job_index = 0;
+	     job_index < 32;
+	     job_index++ )
+	{
+		result = libfcrypto_cipher_crypt(
+		          cipher,
+		          LIBFCRYPTO_CRYPT_MODE_ENCRYPT,
+		          &( initialization_vectors[ job_index * 16 ] ),
+		          16,
+		          &( input_data[ job_index * 512 ] ),
+		          512,
+		          &( expected_output_data[ job_index * 512 ] ),
+		          512,
+		          &error );
+
+		FCRYPTO_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		FCRYPTO_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+	}
+	/* Test regular cases
+	 */
+	for( job_index = 0;
+	     job_index < 32;
+	     job_index++ )
+	{
+		do
+		{
+			result = libfcrypto_job_queue_submit_crypt(
+			          job_queue,
+			          cipher,
+			          LIBFCRYPTO_CRYPT_MODE_ENCRYPT,
+			          &( initialization_vectors[ job_index * 16 ] ),
+			          16,
+			          &( input_data[ job_index * 512 ] ),
+			          512,
+			          &( output_data[ job_index * 512 ] ),
+			          512,
+			          &fcrypto_test_job_queue_completion_function,
+			          (intptr_t *) results,
+			          &job_identifier,
+			          &error );
+
+			FCRYPTO_TEST_ASSERT_NOT_EQUAL_INT(
+			 "result",
+			 result,
+			 -1 );
+
+			FCRYPTO_TEST_ASSERT_IS_NULL(
+			 "error",
+			 error );
+
+			/* Wait for the queued jobs to complete when the queue is full
+			 */
+			if( result == 0 )
+			{
+				result = libfcrypto_job_queue_wait(
+				          job_queue,
+				          &error );
+
+				FCRYPTO_TEST_ASSERT_EQUAL_INT(
+				 "result",
+				 result,
+				 1 );
+
+				FCRYPTO_TEST_ASSERT_IS_NULL(
+				 "error",
+				 error );
+
+				result = 0;
+			}
+		}
+		while( result == 0 );
+
+		FCRYPTO_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		FCRYPTO_TEST_ASSERT_EQUAL_UINT64(
+		 "job_identifier",
+		 job_identifier,
+		 (uint64_t) job_index + 1 );
+	}
+	result = libfcrypto_job_queue_wait(
+	          job_queue,
+	          &error );
+
+	FCRYPTO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FCRYPTO_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfcrypto_job_queue_get_number_of_jobs(
+	          job_queue,
+	          &number_of_jobs,
+	          &error );
+
+	FCRYPTO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FCRYPTO_TEST_ASSERT_EQUAL_INT(
+	 "number_of_jobs",
+	 number_of_jobs,
+	 0 );
+
+	FCRYPTO_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	for( job_index = 0;
+	     job_index < 32;
+	     job_index++ )
+	{
+		FCRYPTO_TEST_ASSERT_EQUAL_INT(
+		 "results[ job_index ]",
+		 results[ job_index ],
+		 1 );
+	}
+	result = memory_compare(
+	          output_data,
+	          expected_output_data,
+	          32 * 512 );
+
+	FCRYPTO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	/* Test a job that fails, since the data size is not a multiple of the block size
+	 */
+	results[ 0 ] = 2;
+
+	result = libfcrypto_job_queue_submit_crypt(
+	          job_queue,
+	          cipher,
+	          LIBFCRYPTO_CRYPT_MODE_ENCRYPT,
+	          initialization_vectors,
+	          16,
+	          input_data,
+	          100,
+	          output_data,
+	          100,
+	          &fcrypto_test_job_queue_completion_function,
+	          (intptr_t *) results,
+	          &job_identifier,
+	          &error );
+
+	FCRYPTO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FCRYPTO_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfcrypto_job_queue_wait(
+	          job_queue,
+	          &error );
+
+	FCRYPTO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FCRYPTO_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FCRYPTO_TEST_ASSERT_EQUAL_INT(
+	 "results[ 0 ]",
+	 results[ 0 ],
+	 -1 );
+
+	/* Test error cases
+	 */
+	result = libfcrypto_job_queue_submit_crypt(
+	          NULL,
+	          cipher,
+	          LIBFCRYPTO_CRYPT_MODE_ENCRYPT,
+	          initialization_vectors,
+	          16,
+	          input_data,
+	          512,
+	          output_data,
+	          512,
+	          &fcrypto_test_job_queue_completion_function,
+	          (intptr_t *) results,
+	          &job_identifier,
+	          &error );
+
+	FCRYPTO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FCRYPTO_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfcrypto_job_queue_submit_crypt(
+	          job_queue,
+	          NULL,
+	          LIBFCRYPTO_CRYPT_MODE_ENCRYPT,
+	          initialization_vectors,
+	          16,
+	          input_data,
+	          512,
+	          output_data,
+	          512,
+	          &fcrypto_test_job_queue_completion_function,
+	          (intptr_t *) results,
+	          &job_identifier,
+	          &error );
+
+	FCRYPTO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FCRYPTO_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfcrypto_cipher_initialize(
+	          &rc4_cipher,
+	          LIBFCRYPTO_CIPHER_ALGORITHM_RC4,
+	          LIBFCRYPTO_CIPHER_MODE_STREAM,
+	          &error );
+
+	FCRYPTO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FCRYPTO_TEST_ASSERT_IS_NOT_NULL(
+	 "rc4_cipher",
+	 rc4_cipher );
+
+	FCRYPTO_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfcrypto_job_queue_submit_crypt(
+	          job_queue,
+	          rc4_cipher,
+	          LIBFCRYPTO_CRYPT_MODE_ENCRYPT,
+	          initialization_vectors,
+	          16,
+	          input_data,
+	          512,
+	          output_data,
+	          512,
+	          &fcrypto_test_job_queue_completion_function,
+	          (intptr_t *) results,
+	          &job_identifier,
+	          &error );
+
+	FCRYPTO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FCRYPTO_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfcrypto_cipher_free(
+	          &rc4_cipher,
+	          &error );
+
+	FCRYPTO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FCRYPTO_TEST_ASSERT_IS_NULL(
+	 "rc4_cipher",
+	 rc4_cipher );
+
+	FCRYPTO_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfcrypto_job_queue_submit_crypt(
+	          job_queue,
+	          cipher,
+	          -1,
+	          initialization_vectors,
+	          16,
+	          input_data,
+	          512,
+	          output_data,
+	          512,
+	          &fcrypto_test_job_queue_completion_function,
+	          (intptr_t *) results,
+	          &job_identifier,
+	          &error );
+
+	FCRYPTO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FCRYPTO_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfcrypto_job_queue_submit_crypt(
+	          job_queue,
+	          cipher,
+	          LIBFCRYPTO_CRYPT_MODE_ENCRYPT,
+	          NULL,
+	          16,
+	          input_data,
+	          512,
+	          output_data,
+	          512,
+	          &fcrypto_test_job_queue_completion_function,
+	          (intptr_t *) results,
+	          &job_identifier,
+	          &error );
+
+	FCRYPTO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FCRYPTO_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfcrypto_job_queue_submit_crypt(
+	          job_queue,
+	          cipher,
+	          LIBFCRYPTO_CRYPT_MODE_ENCRYPT,
+	          initialization_vectors,
+	          17,
+	          input_data,
+	          512,
+	          output_data,
+	          512,
+	          &fcrypto_test_job_queue_completion_function,
+	          (intptr_t *) results,
+	          &job_identifier,
+	          &error );
+
+	FCRYPTO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FCRYPTO_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfcrypto_job_queue_submit_crypt(
+	          job_queue,
+	          cipher,
+	          LIBFCRYPTO_CRYPT_MODE_ENCRYPT,
+	          initialization_vectors,
+	          16,
+	          NULL,
+	          512,
+	          output_data,
+	          512,
+	          &fcrypto_test_job_queue_completion_function,
+	          (intptr_t *) results,
+	          &job_identifier,
+	          &error );
+
+	FCRYPTO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FCRYPTO_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfcrypto_job_queue_submit_crypt(
+	          job_queue,
+	          cipher,
+	          LIBFCRYPTO_CRYPT_MODE_ENCRYPT,
+	          initialization_vectors,
+	          16,
+	          input_data,
+	          (size_t) SSIZE_MAX + 1,
+	          output_data,
+	          512,
+	          &fcrypto_test_job_queue_completion_function,
+	          (intptr_t *) results,
+	          &job_identifier,
+	          &error );
+
+	FCRYPTO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FCRYPTO_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfcrypto_job_queue_submit_crypt(
+	          job_queue,
+	          cipher,
+	          LIBFCRYPTO_CRYPT_MODE_ENCRYPT,
+	          initialization_vectors,
+	          16,
+	          input_data,
+	          512,
+	          NULL,
+	          512,
+	          &fcrypto_test_job_queue_completion_function,
+	          (intptr_t *) results,
+	          &job_identifier,
+	          &error );
+
+	FCRYPTO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FCRYPTO_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfcrypto_job_queue_submit_crypt(
+	          job_queue,
+	          cipher,
+	          LIBFCRYPTO_CRYPT_MODE_ENCRYPT,
+	          initialization_vectors,
+	          16,
+	          input_data,
+	          512,
+	          output_data,
+	          (size_t) SSIZE_MAX + 1,
+	          &fcrypto_test_job_queue_completion_function,
+	          (intptr_t *) results,
+	          &job_identifier,
+	          &error );
+
+	FCRYPTO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FCRYPTO_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfcrypto_job_queue_submit_crypt(
+	          job_queue,
+	          cipher,
+	          LIBFCRYPTO_CRYPT_MODE_ENCRYPT,
+	          initialization_vectors,
+	          16,
+	          input_data,
+	          512,
+	          output_data,
+	          512,
+	          &fcrypto_test_job_queue_completion_function,
+	          (intptr_t *) results,
+	          NULL,
+	          &error );
+
+	FCRYPTO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FCRYPTO_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfcrypto_job_queue_wait(
+	          NULL,
+	          &error );
+
+	FCRYPTO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FCRYPTO_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfcrypto_job_queue_get_number_of_jobs(
+	          NULL,
+	          &number_of_jobs,
+	          &error );
+
+	FCRYPTO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FCRYPTO_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfcrypto_job_queue_get_number_of_jobs(
+	          job_queue,
+	          NULL,
+	          &error );
+
+	FCRYPTO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FCRYPTO_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libfcrypto_job_queue_free(
+	          &job_queue,
+	          &error );
+
+	FCRYPTO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FCRYPTO_TEST_ASSERT_IS_NULL(
+	 "job_queue",
+	 job_queue );
+
+	FCRYPTO_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfcrypto_cipher_free(
+	          &cipher,
+	          &error );
+
+	FCRYPTO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FCRYPTO_TEST_ASSERT_IS_NULL(
+	 "cipher",
+	 cipher );
+
+	FCRYPTO_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( job_queue != NULL )
+	{
+		libfcrypto_job_queue_free(
+		 &job_queue,
+		 NULL );
+	}
+	if( rc4_cipher != NULL )
+	{
+		libfcrypto_cipher_free(
+		 &rc4_cipher,
+		 NULL );
+	}
+	if( cipher != NULL )
+	{
+		libfcrypto_cipher_free(
+		 &cipher,
+		 NULL );
+	}
+	return( 0 );
+}
+
+#if defined( __GNUC__ ) && !defined( LIBFCRYPTO_DLL_IMPORT ) && defined( LIBFCRYPTO_THREAD_POOL_HAVE_PTHREAD )
+
+/* Tests the libfcrypto_job_queue_cancel_job function
+ * Returns 1 if successful or 0 if not
+ */
+int fcrypto_test_job_queue_cancel_job(
+     void )
+{
+	uint8_t initialization_vector[ 16 ];
+	uint8_t input_data[ 64 ];
+	uint8_t output_data[ 64 ];
+	int results[ 32 ];
+
+	libcerror_error_t *error          = NULL;
+	libfcrypto_cipher_t *cipher       = NULL;
+	libfcrypto_job_queue_t *job_queue = NULL;
+	uint64_t job_identifier           = 0;
+	int job_index                     = 0;
+	int number_of_jobs                = 0;
+	int result                        = 0;
+
+	/* Initialize test
+	 */
+	memory_set(
+	 initialization_vector,
+	 0,
+	 16 );
+
+	memory_set(
+	 input_data,
+	 0,
+	 64 );
+
+	for( job_index = 0;
+	     job_index < 32;
+	     job_index++ )
+	{
+		results[ job_index ] = 2;
+	}
+	result = libfcrypto_cipher_initialize(
+	          &cipher,
+	          LIBFCRYPTO_CIPHER_ALGORITHM_SERPENT,
+	          LIBFCRYPTO_CIPHER_MODE_ECB,
+	          &error );
+
+	FCRYPTO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FCRYPTO_TEST_ASSERT_IS_NOT_NULL(
+	 "cipher",
+	 cipher );
+
+	FCRYPTO_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfcrypto_job_queue_initialize(
+	          &job_queue,
+	          0,
+	          4,
+	          &error );
+
+	FCRYPTO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FCRYPTO_TEST_ASSERT_IS_NOT_NULL(
+	 "job_queue",
+	 job_queue );
+
+	FCRYPTO_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Make the job queue behave as if it has a worker thread that does not run
+	 * the jobs so that they remain queued
+	 */
+	( (libfcrypto_internal_job_queue_t *) job_queue )->number_of_threads = 1;
+
+	for( job_index = 0;
+	     job_index < 4;
+	     job_index++ )
+	{
+		result = libfcrypto_job_queue_submit_crypt(
+		          job_queue,
+		          cipher,
+		          LIBFCRYPTO_CRYPT_MODE_ENCRYPT,
+		          initialization_vector,
+		          16,
+		          input_data,
+		          64,
+		          output_data,
+		          64,
+		          &fcrypto_test_job_queue_completion_function,
+		          (intptr_t *) results,
+		          &job_identifier,
+		          &error );
+
+		FCRYPTO_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		FCRYPTO_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+	}
+	/* Test regular cases
+	 */
+	result = libfcrypto_job_queue_submit_crypt(
+	          job_queue,
+	          cipher,
+	          LIBFCRYPTO_CRYPT_MODE_ENCRYPT,
+	          initialization_vector,
+	          16,
+	          input_data,
+	          64,
+	          output_data,
+	          64,
+	          &fcrypto_test_job_queue_completion_function,
+	          (intptr_t *) results,
+	          &job_identifier,
+	          &error );
+
+	FCRYPTO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	FCRYPTO_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfcrypto_job_queue_get_number_of_jobs(
+	          job_queue,
+	          &number_of_jobs,
+	          &error );
+
+	FCRYPTO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FCRYPTO_TEST_ASSERT_EQUAL_INT(
+	 "number_of_jobs",
+	 number_of_jobs,
+	 4 );
+
+	FCRYPTO_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfcrypto_job_queue_cancel_job(
+	          job_queue,
+	          2,
+	          &error );
+
+	FCRYPTO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FCRYPTO_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FCRYPTO_TEST_ASSERT_EQUAL_INT(
+	 "results[ 1 ]",
+	 results[ 1 ],
+	 0 );
+
+	result = libfcrypto_job_queue_get_number_of_jobs(
+	          job_queue,
+	          &number_of_jobs,
+	          &error );
+
+	FCRYPTO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FCRYPTO_TEST_ASSERT_EQUAL_INT(
+	 "number_of_jobs",
+	 number_of_jobs,
+	 3 );
+
+	FCRYPTO_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test cancelling a job that is no longer queued
+	 */
+	result = libfcrypto_job_queue_cancel_job(
+	          job_queue,
+	          2,
+	          &error );
+
+	FCRYPTO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	FCRYPTO_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfcrypto_job_queue_cancel_job(
+	          job_queue,
+	          99,
+	          &error );
+
+	FCRYPTO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	FCRYPTO_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libfcrypto_job_queue_cancel_job(
+	          NULL,
+	          1,
+	          &error );
+
+	FCRYPTO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FCRYPTO_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	( (libfcrypto_internal_job_queue_t *) job_queue )->number_of_threads = 0;
+
+	result = libfcrypto_job_queue_free(
+	          &job_queue,
+	          &error );
+
+	FCRYPTO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FCRYPTO_TEST_ASSERT_IS_NULL(
+	 "job_queue",
+	 job_queue );
+
+	FCRYPTO_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* The jobs that were still queued are cancelled when the job queue is freed
+	 */
+	for( job_index = 0;
+	     job_index < 4;
+	     job_index++ )
+	{
+		FCRYPTO_TEST_ASSERT_EQUAL_INT(
+		 "results[ job_index ]",
+		 results[ job_index ],
+		 0 );
+	}
+	result = libfcrypto_cipher_free(
+	          &cipher,
+	          &error );
+
+	FCRYPTO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FCRYPTO_TEST_ASSERT_IS_NULL(
+	 "cipher",
+	 cipher );
+
+	FCRYPTO_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( job_queue != NULL )
+	{
+		( (libfcrypto_internal_job_queue_t *) job_queue )->number_of_threads = 0;
+
+		libfcrypto_job_queue_free(
+		 &job_queue,
+		 NULL );
+	}
+	if( cipher != NULL )
+	{
+		libfcrypto_cipher_free(
+		 &cipher,
+		 NULL );
+	}
+	return( 0 );
+}
+
+#endif /* defined( __GNUC__ ) && !defined( LIBFCRYPTO_DLL_IMPORT ) && defined( LIBFCRYPTO_THREAD_POOL_HAVE_PTHREAD ) */
+
+/* The main program
+ */
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+int wmain(
+     int argc FCRYPTO_TEST_ATTRIBUTE_UNUSED,
+     wchar_t * const argv[] FCRYPTO_TEST_ATTRIBUTE_UNUSED )
+#else
+int main(
+     int argc FCRYPTO_TEST_ATTRIBUTE_UNUSED,
+     char * const argv[] FCRYPTO_TEST_ATTRIBUTE_UNUSED )
+#endif
+{
+	FCRYPTO_TEST_UNREFERENCED_PARAMETER( argc )
+	FCRYPTO_TEST_UNREFERENCED_PARAMETER( argv )
+
+	FCRYPTO_TEST_RUN(
+	 "libfcrypto_job_queue_initialize",
+	 fcrypto_test_job_queue_initialize );
+
+	FCRYPTO_TEST_RUN(
+	 "libfcrypto_job_queue_free",
+	 fcrypto_test_job_queue_free );
+
+	FCRYPTO_TEST_RUN(
+	 "libfcrypto_job_queue_submit_crypt",
+	 fcrypto_test_job_queue_submit_crypt );
+
+#if defined( __GNUC__ ) && !defined( LIBFCRYPTO_DLL_IMPORT ) && defined( LIBFCRYPTO_THREAD_POOL_HAVE_PTHREAD )
+
+	FCRYPTO_TEST_RUN(
+	 "libfcrypto_job_queue_cancel_job",
+	 fcrypto_test_job_queue_cancel_job );
+
+#endif /* defined( __GNUC__ ) && !defined( LIBFCRYPTO_DLL_IMPORT ) && defined( LIBFCRYPTO_THREAD_POOL_HAVE_PTHREAD ) */
+
+	return( EXIT_SUCCESS );
+
+on_error:
+	return( EXIT_FAILURE );
+}
+
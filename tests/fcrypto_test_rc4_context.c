@@ -486,23 +486,1831 @@ on_error:
 	return( 0 );
 }
 
+/* Tests the libfcrypto_rc4_context_set_checkpoints function
+ * Returns 1 if successful or 0 if not
+ */
+int fcrypto_test_rc4_context_set_checkpoints(
+     void )
+{
+	libcerror_error_t *error              = NULL;
+	libfcrypto_rc4_context_t *rc4_context = NULL;
+	int result                            = 0;
+
+	/* Initialize test
+	 */
+	result = libfcrypto_rc4_context_initialize(
+	          &rc4_context,
+	          &error );
+
+	FCRYPTO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FCRYPTO_TEST_ASSERT_IS_NOT_NULL(
+	 "rc4_context",
+	 rc4_context );
+
+	FCRYPTO_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libfcrypto_rc4_context_set_checkpoints(
+	          rc4_context,
+	          512,
+	          16,
+	          &error );
+
+	FCRYPTO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FCRYPTO_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfcrypto_rc4_context_set_checkpoints(
+	          rc4_context,
+	          0,
+	          0,
+	          &error );
+
+	FCRYPTO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FCRYPTO_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libfcrypto_rc4_context_set_checkpoints(
+	          NULL,
+	          512,
+	          16,
+	          &error );
+
+	FCRYPTO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FCRYPTO_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfcrypto_rc4_context_set_checkpoints(
+	          rc4_context,
+	          (size_t) SSIZE_MAX + 1,
+	          16,
+	          &error );
+
+	FCRYPTO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FCRYPTO_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfcrypto_rc4_context_set_checkpoints(
+	          rc4_context,
+	          512,
+	          0,
+	          &error );
+
+	FCRYPTO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FCRYPTO_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfcrypto_rc4_context_set_checkpoints(
+	          rc4_context,
+	          512,
+	          -1,
+	          &error );
+
+	FCRYPTO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FCRYPTO_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libfcrypto_rc4_context_free(
+	          &rc4_context,
+	          &error );
+
+	FCRYPTO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FCRYPTO_TEST_ASSERT_IS_NULL(
+	 "rc4_context",
+	 rc4_context );
+
+	FCRYPTO_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( rc4_context != NULL )
+	{
+		libfcrypto_rc4_context_free(
+		 &rc4_context,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libfcrypto_rc4_context_seek_offset function
+ * Returns 1 if successful or 0 if not
+ */
+int fcrypto_test_rc4_context_seek_offset(
+     void )
+{
+	uint8_t *key = (uint8_t *) "test1";
+
+	uint8_t input_data[ 2000 ];
+	uint8_t key_stream_data[ 2000 ];
+	uint8_t output_data[ 2000 ];
+
+	libcerror_error_t *error              = NULL;
+	libfcrypto_rc4_context_t *rc4_context = NULL;
+	size_t data_offset                    = 0;
+	int result                            = 0;
+
+	/* Initialize test
+	 */
+	result = libfcrypto_rc4_context_initialize(
+	          &rc4_context,
+	          &error );
+
+	FCRYPTO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FCRYPTO_TEST_ASSERT_IS_NOT_NULL(
+	 "rc4_context",
+	 rc4_context );
+
+	FCRYPTO_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfcrypto_rc4_context_set_key(
+	          rc4_context,
+	          key,
+	          40,
+	          &error );
+
+	FCRYPTO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FCRYPTO_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	for( data_offset = 0;
+	     data_offset < 2000;
+	     data_offset++ )
+	{
+		input_data[ data_offset ] = 0;
+	}
+	/* Determine the key stream without checkpoints
+	 */
+	result = libfcrypto_rc4_crypt(
+	          rc4_context,
+	          input_data,
+	          2000,
+	          key_stream_data,
+	          2000,
+	          &error );
+
+	FCRYPTO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FCRYPTO_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test seeking forwards without checkpoints
+	 */
+	result = libfcrypto_rc4_context_set_key(
+	          rc4_context,
+	          key,
+	          40,
+	          &error );
+
+	FCRYPTO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FCRYPTO_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfcrypto_rc4_context_seek_offset(
+	          rc4_context,
+	          1029,
+	          &error );
+
+	FCRYPTO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FCRYPTO_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfcrypto_rc4_crypt(
+	          rc4_context,
+	          input_data,
+	          300,
+	          output_data,
+	          300,
+	          &error );
+
+	FCRYPTO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FCRYPTO_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = memory_compare(
+	          output_data,
+	          &( key_stream_data[ 1029 ] ),
+	          300 );
+
+	FCRYPTO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	/* Test seeking backwards without checkpoints
+	 */
+	result = libfcrypto_rc4_context_seek_offset(
+	          rc4_context,
+	          17,
+	          &error );
+
+	FCRYPTO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FCRYPTO_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Test seeking with checkpoints, where the checkpoints only cover the first 800 bytes
+	 */
+	result = libfcrypto_rc4_context_set_checkpoints(
+	          rc4_context,
+	          100,
+	          8,
+	          &error );
+
+	FCRYPTO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FCRYPTO_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfcrypto_rc4_context_set_key(
+	          rc4_context,
+	          key,
+	          40,
+	          &error );
+
+	FCRYPTO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FCRYPTO_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfcrypto_rc4_context_seek_offset(
+	          rc4_context,
+	          1500,
+	          &error );
+
+	FCRYPTO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FCRYPTO_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfcrypto_rc4_crypt(
+	          rc4_context,
+	          input_data,
+	          300,
+	          output_data,
+	          300,
+	          &error );
+
+	FCRYPTO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FCRYPTO_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = memory_compare(
+	          output_data,
+	          &( key_stream_data[ 1500 ] ),
+	          300 );
+
+	FCRYPTO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	result = libfcrypto_rc4_context_seek_offset(
+	          rc4_context,
+	          250,
+	          &error );
+
+	FCRYPTO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FCRYPTO_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfcrypto_rc4_crypt(
+	          rc4_context,
+	          input_data,
+	          100,
+	          output_data,
+	          100,
+	          &error );
+
+	FCRYPTO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FCRYPTO_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = memory_compare(
+	          output_data,
+	          &( key_stream_data[ 250 ] ),
+	          100 );
+
+	FCRYPTO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	result = libfcrypto_rc4_context_seek_offset(
+	          rc4_context,
+	          1999,
+	          &error );
+
+	FCRYPTO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FCRYPTO_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfcrypto_rc4_crypt(
+	          rc4_context,
+	          input_data,
+	          1,
+	          output_data,
+	          1,
+	          &error );
+
+	FCRYPTO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FCRYPTO_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = memory_compare(
+	          output_data,
+	          &( key_stream_data[ 1999 ] ),
+	          1 );
+
+	FCRYPTO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	result = libfcrypto_rc4_context_seek_offset(
+	          rc4_context,
+	          0,
+	          &error );
+
+	FCRYPTO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FCRYPTO_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfcrypto_rc4_crypt(
+	          rc4_context,
+	          input_data,
+	          50,
+	          output_data,
+	          50,
+	          &error );
+
+	FCRYPTO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FCRYPTO_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = memory_compare(
+	          output_data,
+	          &( key_stream_data[ 0 ] ),
+	          50 );
+
+	FCRYPTO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	result = libfcrypto_rc4_context_seek_offset(
+	          rc4_context,
+	          799,
+	          &error );
+
+	FCRYPTO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FCRYPTO_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfcrypto_rc4_crypt(
+	          rc4_context,
+	          input_data,
+	          2,
+	          output_data,
+	          2,
+	          &error );
+
+	FCRYPTO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FCRYPTO_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = memory_compare(
+	          output_data,
+	          &( key_stream_data[ 799 ] ),
+	          2 );
+
+	FCRYPTO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	result = libfcrypto_rc4_context_seek_offset(
+	          rc4_context,
+	          1234,
+	          &error );
+
+	FCRYPTO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FCRYPTO_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfcrypto_rc4_crypt(
+	          rc4_context,
+	          input_data,
+	          500,
+	          output_data,
+	          500,
+	          &error );
+
+	FCRYPTO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FCRYPTO_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = memory_compare(
+	          output_data,
+	          &( key_stream_data[ 1234 ] ),
+	          500 );
+
+	FCRYPTO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	/* Test error cases
+	 */
+	result = libfcrypto_rc4_context_seek_offset(
+	          NULL,
+	          0,
+	          &error );
+
+	FCRYPTO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FCRYPTO_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libfcrypto_rc4_context_free(
+	          &rc4_context,
+	          &error );
+
+	FCRYPTO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FCRYPTO_TEST_ASSERT_IS_NULL(
+	 "rc4_context",
+	 rc4_context );
+
+	FCRYPTO_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( rc4_context != NULL )
+	{
+		libfcrypto_rc4_context_free(
+		 &rc4_context,
+		 NULL );
+	}
+	return( 0 );
+}
+
 /* Tests the libfcrypto_rc4_crypt function
  * Returns 1 if successful or 0 if not
  */
-int fcrypto_test_rc4_crypt(
+int fcrypto_test_rc4_crypt(
+     void )
+{
+	uint8_t *key = (uint8_t *) "test1";
+
+	uint8_t input_data[ 48 ];
+	uint8_t output_data[ 48 ];
+
+	libcerror_error_t *error              = NULL;
+	libfcrypto_rc4_context_t *rc4_context = NULL;
+	int result                            = 0;
+
+	/* Initialize test
+	 */
+	result = libfcrypto_rc4_context_initialize(
+	          &rc4_context,
+	          &error );
+
+	FCRYPTO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FCRYPTO_TEST_ASSERT_IS_NOT_NULL(
+	 "rc4_context",
+	 rc4_context );
+
+	FCRYPTO_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfcrypto_rc4_context_set_key(
+	          rc4_context,
+	          key,
+	          40,
+	          &error );
+
+	FCRYPTO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FCRYPTO_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test de- or encrypting a buffer of data
+	 */
+	result = libfcrypto_rc4_crypt(
+	          rc4_context,
+	          input_data,
+	          48,
+	          output_data,
+	          48,
+	          &error );
+
+	FCRYPTO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FCRYPTO_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libfcrypto_rc4_crypt(
+	          NULL,
+	          input_data,
+	          48,
+	          output_data,
+	          48,
+	          &error );
+
+	FCRYPTO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FCRYPTO_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfcrypto_rc4_crypt(
+	          rc4_context,
+	          NULL,
+	          48,
+	          output_data,
+	          48,
+	          &error );
+
+	FCRYPTO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FCRYPTO_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfcrypto_rc4_crypt(
+	          rc4_context,
+	          input_data,
+	          (size_t) SSIZE_MAX + 1,
+	          output_data,
+	          48,
+	          &error );
+
+	FCRYPTO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FCRYPTO_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfcrypto_rc4_crypt(
+	          rc4_context,
+	          input_data,
+	          48,
+	          NULL,
+	          48,
+	          &error );
+
+	FCRYPTO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FCRYPTO_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfcrypto_rc4_crypt(
+	          rc4_context,
+	          input_data,
+	          48,
+	          output_data,
+	          (size_t) SSIZE_MAX + 1,
+	          &error );
+
+	FCRYPTO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FCRYPTO_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfcrypto_rc4_crypt(
+	          rc4_context,
+	          input_data,
+	          48,
+	          output_data,
+	          32,
+	          &error );
+
+	FCRYPTO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FCRYPTO_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libfcrypto_rc4_context_free(
+	          &rc4_context,
+	          &error );
+
+	FCRYPTO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FCRYPTO_TEST_ASSERT_IS_NULL(
+	 "rc4_context",
+	 rc4_context );
+
+	FCRYPTO_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( rc4_context != NULL )
+	{
+		libfcrypto_rc4_context_free(
+		 &rc4_context,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libfcrypto_rc4_skip_key_stream function
+ * Returns 1 if successful or 0 if not
+ */
+int fcrypto_test_rc4_skip_key_stream(
+     void )
+{
+	uint8_t *key = (uint8_t *) "test1";
+
+	uint8_t input_data[ 2000 ];
+	uint8_t key_stream_data[ 2000 ];
+	uint8_t output_data[ 2000 ];
+
+	libcerror_error_t *error              = NULL;
+	libfcrypto_rc4_context_t *rc4_context = NULL;
+	size_t data_offset                    = 0;
+	int result                            = 0;
+
+	/* Initialize test
+	 */
+	result = libfcrypto_rc4_context_initialize(
+	          &rc4_context,
+	          &error );
+
+	FCRYPTO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FCRYPTO_TEST_ASSERT_IS_NOT_NULL(
+	 "rc4_context",
+	 rc4_context );
+
+	FCRYPTO_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	for( data_offset = 0;
+	     data_offset < 2000;
+	     data_offset++ )
+	{
+		input_data[ data_offset ] = 0;
+	}
+	/* Determine the key stream by encrypting zero bytes
+	 */
+	result = libfcrypto_rc4_context_set_key(
+	          rc4_context,
+	          key,
+	          40,
+	          &error );
+
+	FCRYPTO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FCRYPTO_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfcrypto_rc4_crypt(
+	          rc4_context,
+	          input_data,
+	          2000,
+	          key_stream_data,
+	          2000,
+	          &error );
+
+	FCRYPTO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FCRYPTO_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfcrypto_rc4_context_set_key(
+	          rc4_context,
+	          key,
+	          40,
+	          &error );
+
+	FCRYPTO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FCRYPTO_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test advancing the key stream
+	 */
+	result = libfcrypto_rc4_skip_key_stream(
+	          rc4_context,
+	          1029,
+	          &error );
+
+	FCRYPTO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FCRYPTO_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfcrypto_rc4_crypt(
+	          rc4_context,
+	          input_data,
+	          300,
+	          output_data,
+	          300,
+	          &error );
+
+	FCRYPTO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FCRYPTO_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = memory_compare(
+	          output_data,
+	          &( key_stream_data[ 1029 ] ),
+	          300 );
+
+	FCRYPTO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	result = libfcrypto_rc4_skip_key_stream(
+	          rc4_context,
+	          0,
+	          &error );
+
+	FCRYPTO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FCRYPTO_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfcrypto_rc4_skip_key_stream(
+	          rc4_context,
+	          71,
+	          &error );
+
+	FCRYPTO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FCRYPTO_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfcrypto_rc4_crypt(
+	          rc4_context,
+	          input_data,
+	          600,
+	          output_data,
+	          600,
+	          &error );
+
+	FCRYPTO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FCRYPTO_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = memory_compare(
+	          output_data,
+	          &( key_stream_data[ 1400 ] ),
+	          600 );
+
+	FCRYPTO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	/* Test error cases
+	 */
+	result = libfcrypto_rc4_skip_key_stream(
+	          NULL,
+	          1,
+	          &error );
+
+	FCRYPTO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FCRYPTO_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfcrypto_rc4_skip_key_stream(
+	          rc4_context,
+	          (size_t) SSIZE_MAX + 1,
+	          &error );
+
+	FCRYPTO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FCRYPTO_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libfcrypto_rc4_context_free(
+	          &rc4_context,
+	          &error );
+
+	FCRYPTO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FCRYPTO_TEST_ASSERT_IS_NULL(
+	 "rc4_context",
+	 rc4_context );
+
+	FCRYPTO_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( rc4_context != NULL )
+	{
+		libfcrypto_rc4_context_free(
+		 &rc4_context,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libfcrypto_rc4_get_key_stream function
+ * Returns 1 if successful or 0 if not
+ */
+int fcrypto_test_rc4_get_key_stream(
+     void )
+{
+	uint8_t *key = (uint8_t *) "test1";
+
+	uint8_t input_data[ 2000 ];
+	uint8_t key_stream_data[ 2000 ];
+	uint8_t output_data[ 2000 ];
+
+	libcerror_error_t *error              = NULL;
+	libfcrypto_rc4_context_t *rc4_context = NULL;
+	size_t data_offset                    = 0;
+	int result                            = 0;
+
+	/* Initialize test
+	 */
+	result = libfcrypto_rc4_context_initialize(
+	          &rc4_context,
+	          &error );
+
+	FCRYPTO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FCRYPTO_TEST_ASSERT_IS_NOT_NULL(
+	 "rc4_context",
+	 rc4_context );
+
+	FCRYPTO_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	for( data_offset = 0;
+	     data_offset < 2000;
+	     data_offset++ )
+	{
+		input_data[ data_offset ] = 0;
+	}
+	/* Determine the key stream by encrypting zero bytes
+	 */
+	result = libfcrypto_rc4_context_set_key(
+	          rc4_context,
+	          key,
+	          40,
+	          &error );
+
+	FCRYPTO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FCRYPTO_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfcrypto_rc4_crypt(
+	          rc4_context,
+	          input_data,
+	          2000,
+	          key_stream_data,
+	          2000,
+	          &error );
+
+	FCRYPTO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FCRYPTO_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfcrypto_rc4_context_set_key(
+	          rc4_context,
+	          key,
+	          40,
+	          &error );
+
+	FCRYPTO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FCRYPTO_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test retrieving key stream data
+	 */
+	result = libfcrypto_rc4_get_key_stream(
+	          rc4_context,
+	          output_data,
+	          1029,
+	          &error );
+
+	FCRYPTO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FCRYPTO_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = memory_compare(
+	          output_data,
+	          key_stream_data,
+	          1029 );
+
+	FCRYPTO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	result = libfcrypto_rc4_get_key_stream(
+	          rc4_context,
+	          output_data,
+	          971,
+	          &error );
+
+	FCRYPTO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FCRYPTO_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = memory_compare(
+	          output_data,
+	          &( key_stream_data[ 1029 ] ),
+	          971 );
+
+	FCRYPTO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	/* Test error cases
+	 */
+	result = libfcrypto_rc4_get_key_stream(
+	          NULL,
+	          output_data,
+	          1,
+	          &error );
+
+	FCRYPTO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FCRYPTO_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfcrypto_rc4_get_key_stream(
+	          rc4_context,
+	          NULL,
+	          1,
+	          &error );
+
+	FCRYPTO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FCRYPTO_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfcrypto_rc4_get_key_stream(
+	          rc4_context,
+	          output_data,
+	          (size_t) SSIZE_MAX + 1,
+	          &error );
+
+	FCRYPTO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FCRYPTO_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libfcrypto_rc4_context_free(
+	          &rc4_context,
+	          &error );
+
+	FCRYPTO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FCRYPTO_TEST_ASSERT_IS_NULL(
+	 "rc4_context",
+	 rc4_context );
+
+	FCRYPTO_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( rc4_context != NULL )
+	{
+		libfcrypto_rc4_context_free(
+		 &rc4_context,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libfcrypto_rc4_crypt_multiple function
+ * Returns 1 if successful or 0 if not
+ */
+int fcrypto_test_rc4_crypt_multiple(
+     void )
+{
+	const uint8_t *input_data_array[ 7 ];
+	const uint8_t *keys[ 7 ];
+	uint8_t *output_data_array[ 7 ];
+
+	size_t data_sizes[ 7 ] = {
+		300, 17, 256, 1, 299, 0, 100 };
+
+	size_t key_bit_sizes[ 7 ] = {
+		40, 128, 256, 56, 64, 80, 192 };
+
+	uint8_t expected_output_data[ 7 ][ 300 ];
+	uint8_t input_data[ 7 ][ 300 ];
+	uint8_t key_data[ 7 ][ 32 ];
+	uint8_t output_data[ 7 ][ 300 ];
+
+	libcerror_error_t *error              = NULL;
+	libfcrypto_rc4_context_t *rc4_context = NULL;
+	size_t data_offset                    = 0;
+	int result                            = 0;
+	int stream_index                      = 0;
+
+	/* Initialize test
+	 */
+	result = libfcrypto_rc4_context_initialize(
+	          &rc4_context,
+	          &error );
+
+	FCRYPTO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FCRYPTO_TEST_ASSERT_IS_NOT_NULL(
+	 "rc4_context",
+	 rc4_context );
+
+	FCRYPTO_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	for( stream_index = 0;
+	     stream_index < 7;
+	     stream_index++ )
+	{
+		for( data_offset = 0;
+		     data_offset < 32;
+		     data_offset++ )
+		{
+			key_data[ stream_index ][ data_offset ] = (uint8_t) ( ( stream_index * 31 ) + ( data_offset * 7 ) + 1 );
+		}
+		for( data_offset = 0;
+		     data_offset < 300;
+		     data_offset++ )
+		{
+			input_data[ stream_index ][ data_offset ] = (uint8_t) ( ( stream_index * 11 ) + ( data_offset * 13 ) + 5 );
+		}
+		keys[ stream_index ]              = key_data[ stream_index ];
+		input_data_array[ stream_index ]  = input_data[ stream_index ];
+		output_data_array[ stream_index ] = output_data[ stream_index ];
+
+		/* Calculate the expected output data with a separate context per stream
+		 */
+		result = libfcrypto_rc4_context_set_key(
+		          rc4_context,
+		          key_data[ stream_index ],
+		          key_bit_sizes[ stream_index ],
+		          &error );
+
+		FCRYPTO_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		FCRYPTO_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		result = libfcrypto_rc4_crypt(
+		          rc4_context,
+		          input_data[ stream_index ],
+		          data_sizes[ stream_index ],
+		          expected_output_data[ stream_index ],
+		          300,
+		          &error );
+
+		FCRYPTO_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		FCRYPTO_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+	}
+	/* Test de- or encrypting multiple buffers of data
+	 */
+	result = libfcrypto_rc4_crypt_multiple(
+	          keys,
+	          key_bit_sizes,
+	          input_data_array,
+	          data_sizes,
+	          output_data_array,
+	          data_sizes,
+	          7,
+	          &error );
+
+	FCRYPTO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FCRYPTO_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	for( stream_index = 0;
+	     stream_index < 7;
+	     stream_index++ )
+	{
+		result = memory_compare(
+		          output_data[ stream_index ],
+		          expected_output_data[ stream_index ],
+		          data_sizes[ stream_index ] );
+
+		FCRYPTO_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 0 );
+	}
+	/* Test de- or encrypting multiple buffers of data in-place
+	 */
+	result = libfcrypto_rc4_crypt_multiple(
+	          keys,
+	          key_bit_sizes,
+	          (const uint8_t **) output_data_array,
+	          data_sizes,
+	          output_data_array,
+	          data_sizes,
+	          7,
+	          &error );
+
+	FCRYPTO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FCRYPTO_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	for( stream_index = 0;
+	     stream_index < 7;
+	     stream_index++ )
+	{
+		result = memory_compare(
+		          output_data[ stream_index ],
+		          input_data[ stream_index ],
+		          data_sizes[ stream_index ] );
+
+		FCRYPTO_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 0 );
+	}
+	/* Test error cases
+	 */
+	result = libfcrypto_rc4_crypt_multiple(
+	          NULL,
+	          key_bit_sizes,
+	          input_data_array,
+	          data_sizes,
+	          output_data_array,
+	          data_sizes,
+	          7,
+	          &error );
+
+	FCRYPTO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FCRYPTO_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfcrypto_rc4_crypt_multiple(
+	          keys,
+	          NULL,
+	          input_data_array,
+	          data_sizes,
+	          output_data_array,
+	          data_sizes,
+	          7,
+	          &error );
+
+	FCRYPTO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FCRYPTO_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfcrypto_rc4_crypt_multiple(
+	          keys,
+	          key_bit_sizes,
+	          NULL,
+	          data_sizes,
+	          output_data_array,
+	          data_sizes,
+	          7,
+	          &error );
+
+	FCRYPTO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FCRYPTO_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfcrypto_rc4_crypt_multiple(
+	          keys,
+	          key_bit_sizes,
+	          input_data_array,
+	          NULL,
+	          output_data_array,
+	          data_sizes,
+	          7,
+	          &error );
+
+	FCRYPTO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FCRYPTO_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfcrypto_rc4_crypt_multiple(
+	          keys,
+	          key_bit_sizes,
+	          input_data_array,
+	          data_sizes,
+	          NULL,
+	          data_sizes,
+	          7,
+	          &error );
+
+	FCRYPTO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FCRYPTO_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfcrypto_rc4_crypt_multiple(
+	          keys,
+	          key_bit_sizes,
+	          input_data_array,
+	          data_sizes,
+	          output_data_array,
+	          NULL,
+	          7,
+	          &error );
+
+	FCRYPTO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FCRYPTO_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfcrypto_rc4_crypt_multiple(
+	          keys,
+	          key_bit_sizes,
+	          input_data_array,
+	          data_sizes,
+	          output_data_array,
+	          data_sizes,
+	          -1,
+	          &error );
+
+	FCRYPTO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FCRYPTO_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	key_bit_sizes[ 6 ] = 0;
+
+	result = libfcrypto_rc4_crypt_multiple(
+	          keys,
+	          key_bit_sizes,
+	          input_data_array,
+	          data_sizes,
+	          output_data_array,
+	          data_sizes,
+	          7,
+	          &error );
+
+	FCRYPTO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FCRYPTO_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	key_bit_sizes[ 6 ] = 192;
+
+	keys[ 6 ] = NULL;
+
+	result = libfcrypto_rc4_crypt_multiple(
+	          keys,
+	          key_bit_sizes,
+	          input_data_array,
+	          data_sizes,
+	          output_data_array,
+	          data_sizes,
+	          7,
+	          &error );
+
+	FCRYPTO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FCRYPTO_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	keys[ 6 ] = key_data[ 6 ];
+
+	/* Clean up
+	 */
+	result = libfcrypto_rc4_context_free(
+	          &rc4_context,
+	          &error );
+
+	FCRYPTO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FCRYPTO_TEST_ASSERT_IS_NULL(
+	 "rc4_context",
+	 rc4_context );
+
+	FCRYPTO_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( rc4_context != NULL )
+	{
+		libfcrypto_rc4_context_free(
+		 &rc4_context,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libfcrypto_rc4_crypt_with_block_keys function
+ * Returns 1 if successful or 0 if not
+ */
+int fcrypto_test_rc4_crypt_with_block_keys(
      void )
 {
-	uint8_t *key = (uint8_t *) "test1";
-
-	uint8_t input_data[ 48 ];
-	uint8_t output_data[ 48 ];
+	uint8_t block_keys[ 6 * 16 ];
+	uint8_t expected_output_data[ 2660 ];
+	uint8_t input_data[ 2660 ];
+	uint8_t output_data[ 2660 ];
 
 	libcerror_error_t *error              = NULL;
 	libfcrypto_rc4_context_t *rc4_context = NULL;
+	size_t block_index                    = 0;
+	size_t data_offset                    = 0;
+	size_t data_size                      = 0;
 	int result                            = 0;
 
 	/* Initialize test
 	 */
+	for( data_offset = 0;
+	     data_offset < 6 * 16;
+	     data_offset++ )
+	{
+		block_keys[ data_offset ] = (uint8_t) ( ( data_offset * 7 ) + 1 );
+	}
+	for( data_offset = 0;
+	     data_offset < 2660;
+	     data_offset++ )
+	{
+		input_data[ data_offset ] = (uint8_t) ( ( data_offset * 13 ) + 5 );
+	}
 	result = libfcrypto_rc4_context_initialize(
 	          &rc4_context,
 	          &error );
@@ -520,10 +2328,121 @@ int fcrypto_test_rc4_crypt(
 	 "error",
 	 error );
 
+	/* Calculate the expected output data by setting the key for every block of 512 bytes
+	 */
+	for( block_index = 0;
+	     block_index < 6;
+	     block_index++ )
+	{
+		data_offset = block_index * 512;
+		data_size   = 2660 - data_offset;
+
+		if( data_size > 512 )
+		{
+			data_size = 512;
+		}
+		result = libfcrypto_rc4_context_set_key(
+		          rc4_context,
+		          &( block_keys[ block_index * 16 ] ),
+		          128,
+		          &error );
+
+		FCRYPTO_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		FCRYPTO_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		result = libfcrypto_rc4_crypt(
+		          rc4_context,
+		          &( input_data[ data_offset ] ),
+		          data_size,
+		          &( expected_output_data[ data_offset ] ),
+		          data_size,
+		          &error );
+
+		FCRYPTO_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		FCRYPTO_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+	}
+	/* Test de- or encrypting a buffer of data
+	 */
+	result = libfcrypto_rc4_crypt_with_block_keys(
+	          block_keys,
+	          6 * 16,
+	          128,
+	          512,
+	          input_data,
+	          2660,
+	          output_data,
+	          2660,
+	          &error );
+
+	FCRYPTO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FCRYPTO_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = memory_compare(
+	          output_data,
+	          expected_output_data,
+	          2660 );
+
+	FCRYPTO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	/* Test de- or encrypting a buffer of data in-place
+	 */
+	result = libfcrypto_rc4_crypt_with_block_keys(
+	          block_keys,
+	          6 * 16,
+	          128,
+	          512,
+	          output_data,
+	          2660,
+	          output_data,
+	          2660,
+	          &error );
+
+	FCRYPTO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FCRYPTO_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = memory_compare(
+	          output_data,
+	          input_data,
+	          2660 );
+
+	FCRYPTO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	/* Calculate the expected output data of a single block that is larger than the data
+	 */
 	result = libfcrypto_rc4_context_set_key(
 	          rc4_context,
-	          key,
-	          40,
+	          block_keys,
+	          128,
 	          &error );
 
 	FCRYPTO_TEST_ASSERT_EQUAL_INT(
@@ -535,14 +2454,34 @@ int fcrypto_test_rc4_crypt(
 	 "error",
 	 error );
 
-	/* Test de- or encrypting a buffer of data
-	 */
 	result = libfcrypto_rc4_crypt(
 	          rc4_context,
 	          input_data,
-	          48,
+	          2660,
+	          expected_output_data,
+	          2660,
+	          &error );
+
+	FCRYPTO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FCRYPTO_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test de- or encrypting a buffer of data that is smaller than the block size
+	 */
+	result = libfcrypto_rc4_crypt_with_block_keys(
+	          block_keys,
+	          6 * 16,
+	          128,
+	          2661,
+	          input_data,
+	          2660,
 	          output_data,
-	          48,
+	          2660,
 	          &error );
 
 	FCRYPTO_TEST_ASSERT_EQUAL_INT(
@@ -554,14 +2493,27 @@ int fcrypto_test_rc4_crypt(
 	 "error",
 	 error );
 
+	result = memory_compare(
+	          output_data,
+	          expected_output_data,
+	          2660 );
+
+	FCRYPTO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
 	/* Test error cases
 	 */
-	result = libfcrypto_rc4_crypt(
+	result = libfcrypto_rc4_crypt_with_block_keys(
 	          NULL,
+	          6 * 16,
+	          128,
+	          512,
 	          input_data,
-	          48,
+	          2660,
 	          output_data,
-	          48,
+	          2660,
 	          &error );
 
 	FCRYPTO_TEST_ASSERT_EQUAL_INT(
@@ -576,12 +2528,15 @@ int fcrypto_test_rc4_crypt(
 	libcerror_error_free(
 	 &error );
 
-	result = libfcrypto_rc4_crypt(
-	          rc4_context,
-	          NULL,
-	          48,
+	result = libfcrypto_rc4_crypt_with_block_keys(
+	          block_keys,
+	          (size_t) SSIZE_MAX + 1,
+	          128,
+	          512,
+	          input_data,
+	          2660,
 	          output_data,
-	          48,
+	          2660,
 	          &error );
 
 	FCRYPTO_TEST_ASSERT_EQUAL_INT(
@@ -596,12 +2551,15 @@ int fcrypto_test_rc4_crypt(
 	libcerror_error_free(
 	 &error );
 
-	result = libfcrypto_rc4_crypt(
-	          rc4_context,
+	result = libfcrypto_rc4_crypt_with_block_keys(
+	          block_keys,
+	          5 * 16,
+	          128,
+	          512,
 	          input_data,
-	          (size_t) SSIZE_MAX + 1,
+	          2660,
 	          output_data,
-	          48,
+	          2660,
 	          &error );
 
 	FCRYPTO_TEST_ASSERT_EQUAL_INT(
@@ -616,12 +2574,15 @@ int fcrypto_test_rc4_crypt(
 	libcerror_error_free(
 	 &error );
 
-	result = libfcrypto_rc4_crypt(
-	          rc4_context,
+	result = libfcrypto_rc4_crypt_with_block_keys(
+	          block_keys,
+	          6 * 16,
+	          0,
+	          512,
 	          input_data,
-	          48,
-	          NULL,
-	          48,
+	          2660,
+	          output_data,
+	          2660,
 	          &error );
 
 	FCRYPTO_TEST_ASSERT_EQUAL_INT(
@@ -636,12 +2597,61 @@ int fcrypto_test_rc4_crypt(
 	libcerror_error_free(
 	 &error );
 
-	result = libfcrypto_rc4_crypt(
-	          rc4_context,
+	result = libfcrypto_rc4_crypt_with_block_keys(
+	          block_keys,
+	          6 * 16,
+	          127,
+	          512,
 	          input_data,
-	          48,
+	          2660,
+	          output_data,
+	          2660,
+	          &error );
+
+	FCRYPTO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FCRYPTO_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfcrypto_rc4_crypt_with_block_keys(
+	          block_keys,
+	          6 * 16,
+	          128,
+	          0,
+	          input_data,
+	          2660,
 	          output_data,
+	          2660,
+	          &error );
+
+	FCRYPTO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FCRYPTO_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfcrypto_rc4_crypt_with_block_keys(
+	          block_keys,
+	          6 * 16,
+	          128,
 	          (size_t) SSIZE_MAX + 1,
+	          input_data,
+	          2660,
+	          output_data,
+	          2660,
 	          &error );
 
 	FCRYPTO_TEST_ASSERT_EQUAL_INT(
@@ -656,12 +2666,84 @@ int fcrypto_test_rc4_crypt(
 	libcerror_error_free(
 	 &error );
 
-	result = libfcrypto_rc4_crypt(
-	          rc4_context,
+	result = libfcrypto_rc4_crypt_with_block_keys(
+	          block_keys,
+	          6 * 16,
+	          128,
+	          512,
+	          NULL,
+	          2660,
+	          output_data,
+	          2660,
+	          &error );
+
+	FCRYPTO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FCRYPTO_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfcrypto_rc4_crypt_with_block_keys(
+	          block_keys,
+	          6 * 16,
+	          128,
+	          512,
 	          input_data,
-	          48,
+	          (size_t) SSIZE_MAX + 1,
 	          output_data,
-	          32,
+	          2660,
+	          &error );
+
+	FCRYPTO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FCRYPTO_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfcrypto_rc4_crypt_with_block_keys(
+	          block_keys,
+	          6 * 16,
+	          128,
+	          512,
+	          input_data,
+	          2660,
+	          NULL,
+	          2660,
+	          &error );
+
+	FCRYPTO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FCRYPTO_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfcrypto_rc4_crypt_with_block_keys(
+	          block_keys,
+	          6 * 16,
+	          128,
+	          512,
+	          input_data,
+	          2660,
+	          output_data,
+	          2659,
 	          &error );
 
 	FCRYPTO_TEST_ASSERT_EQUAL_INT(
@@ -1543,10 +3625,34 @@ int main(
 	 "libfcrypto_rc4_context_set_key",
 	 fcrypto_test_rc4_context_set_key );
 
+	FCRYPTO_TEST_RUN(
+	 "libfcrypto_rc4_context_set_checkpoints",
+	 fcrypto_test_rc4_context_set_checkpoints );
+
+	FCRYPTO_TEST_RUN(
+	 "libfcrypto_rc4_context_seek_offset",
+	 fcrypto_test_rc4_context_seek_offset );
+
 	FCRYPTO_TEST_RUN(
 	 "libfcrypto_rc4_crypt",
 	 fcrypto_test_rc4_crypt );
 
+	FCRYPTO_TEST_RUN(
+	 "libfcrypto_rc4_skip_key_stream",
+	 fcrypto_test_rc4_skip_key_stream );
+
+	FCRYPTO_TEST_RUN(
+	 "libfcrypto_rc4_get_key_stream",
+	 fcrypto_test_rc4_get_key_stream );
+
+	FCRYPTO_TEST_RUN(
+	 "libfcrypto_rc4_crypt_multiple",
+	 fcrypto_test_rc4_crypt_multiple );
+
+	FCRYPTO_TEST_RUN(
+	 "libfcrypto_rc4_crypt_with_block_keys",
+	 fcrypto_test_rc4_crypt_with_block_keys );
+
 	FCRYPTO_TEST_RUN(
 	 "libfcrypto_rc4_crypt with RFC 6229 test vector and 40-bit key",
 	 fcrypto_test_rc4_crypt_rfc6229_40bit );
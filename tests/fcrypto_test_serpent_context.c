@@ -34,6 +34,8 @@
 #include "fcrypto_test_memory.h"
 #include "fcrypto_test_unused.h"
 
+#include "../libfcrypto/libfcrypto_serpent_context.h"
+
 /* Tests the libfcrypto_serpent_context_initialize function
  * Returns 1 if successful or 0 if not
  */
@@ -487,24 +489,37 @@ on_error:
 	return( 0 );
 }
 
-/* Tests the libfcrypto_serpent_crypt_ecb function
+/* Tests the libfcrypto_serpent_crypt_cbc function
  * Returns 1 if successful or 0 if not
  */
-int fcrypto_test_serpent_crypt_ecb(
+int fcrypto_test_serpent_crypt_cbc(
      void )
 {
-	uint8_t key[ 16 ] = {
-		0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 };
+	uint8_t key[ 32 ] = {
+		0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09, 0x0a, 0x0b, 0x0c, 0x0d, 0x0e, 0x0f,
+		0x10, 0x11, 0x12, 0x13, 0x14, 0x15, 0x16, 0x17, 0x18, 0x19, 0x1a, 0x1b, 0x1c, 0x1d, 0x1e, 0x1f };
 
-	uint8_t input_data[ 16 ];
-	uint8_t output_data[ 16 ];
+	uint8_t initialization_vector[ 16 ] = {
+		0xf0, 0xe1, 0xd2, 0xc3, 0xb4, 0xa5, 0x96, 0x87, 0x78, 0x69, 0x5a, 0x4b, 0x3c, 0x2d, 0x1e, 0x0f };
+
+	uint8_t encrypted_data[ 1200 ];
+	uint8_t expected_data[ 1200 ];
+	uint8_t input_data[ 1200 ];
+	uint8_t output_data[ 1200 ];
 
 	libcerror_error_t *error                      = NULL;
 	libfcrypto_serpent_context_t *serpent_context = NULL;
+	size_t data_offset                            = 0;
 	int result                                    = 0;
 
 	/* Initialize test
 	 */
+	for( data_offset = 0;
+	     data_offset < 1200;
+	     data_offset++ )
+	{
+		input_data[ data_offset ] = (uint8_t) ( ( data_offset * 13 ) + 5 );
+	}
 	result = libfcrypto_serpent_context_initialize(
 	          &serpent_context,
 	          &error );
@@ -525,7 +540,7 @@ int fcrypto_test_serpent_crypt_ecb(
 	result = libfcrypto_serpent_context_set_key(
 	          serpent_context,
 	          key,
-	          128,
+	          256,
 	          &error );
 
 	FCRYPTO_TEST_ASSERT_EQUAL_INT(
@@ -537,15 +552,52 @@ int fcrypto_test_serpent_crypt_ecb(
 	 "error",
 	 error );
 
-	/* Test decrypting a buffer of data
+	/* Calculate the expected encrypted data using Serpent-ECB
 	 */
-	result = libfcrypto_serpent_crypt_ecb(
+	for( data_offset = 0;
+	     data_offset < 1200;
+	     data_offset++ )
+	{
+		if( data_offset < 16 )
+		{
+			expected_data[ data_offset ] = input_data[ data_offset ] ^ initialization_vector[ data_offset ];
+		}
+		else
+		{
+			expected_data[ data_offset ] = input_data[ data_offset ] ^ expected_data[ data_offset - 16 ];
+		}
+		if( ( data_offset % 16 ) == 15 )
+		{
+			result = libfcrypto_serpent_crypt_ecb(
+			          serpent_context,
+			          LIBFCRYPTO_SERPENT_CRYPT_MODE_ENCRYPT,
+			          &( expected_data[ data_offset - 15 ] ),
+			          16,
+			          &( expected_data[ data_offset - 15 ] ),
+			          16,
+			          &error );
+
+			FCRYPTO_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 1 );
+
+			FCRYPTO_TEST_ASSERT_IS_NULL(
+			 "error",
+			 error );
+		}
+	}
+	/* Test encrypting a buffer of data
+	 */
+	result = libfcrypto_serpent_crypt_cbc(
 	          serpent_context,
-	          LIBFCRYPTO_SERPENT_CRYPT_MODE_DECRYPT,
-	          input_data,
-	          16,
-	          output_data,
+	          LIBFCRYPTO_SERPENT_CRYPT_MODE_ENCRYPT,
+	          initialization_vector,
 	          16,
+	          input_data,
+	          1200,
+	          encrypted_data,
+	          1200,
 	          &error );
 
 	FCRYPTO_TEST_ASSERT_EQUAL_INT(
@@ -557,15 +609,59 @@ int fcrypto_test_serpent_crypt_ecb(
 	 "error",
 	 error );
 
-	/* Test encrypting a buffer of data
+	result = memory_compare(
+	          encrypted_data,
+	          expected_data,
+	          1200 );
+
+	FCRYPTO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	/* Test decrypting a buffer of data that is larger than the decryption buffer
 	 */
-	result = libfcrypto_serpent_crypt_ecb(
+	result = libfcrypto_serpent_crypt_cbc(
 	          serpent_context,
-	          LIBFCRYPTO_SERPENT_CRYPT_MODE_ENCRYPT,
-	          input_data,
+	          LIBFCRYPTO_SERPENT_CRYPT_MODE_DECRYPT,
+	          initialization_vector,
 	          16,
+	          encrypted_data,
+	          1200,
+	          output_data,
+	          1200,
+	          &error );
+
+	FCRYPTO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FCRYPTO_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = memory_compare(
 	          output_data,
+	          input_data,
+	          1200 );
+
+	FCRYPTO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	/* Test decrypting a buffer of data in-place
+	 */
+	result = libfcrypto_serpent_crypt_cbc(
+	          serpent_context,
+	          LIBFCRYPTO_SERPENT_CRYPT_MODE_DECRYPT,
+	          initialization_vector,
 	          16,
+	          encrypted_data,
+	          1200,
+	          encrypted_data,
+	          1200,
 	          &error );
 
 	FCRYPTO_TEST_ASSERT_EQUAL_INT(
@@ -577,15 +673,50 @@ int fcrypto_test_serpent_crypt_ecb(
 	 "error",
 	 error );
 
+	result = memory_compare(
+	          encrypted_data,
+	          input_data,
+	          1200 );
+
+	FCRYPTO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
 	/* Test error cases
 	 */
-	result = libfcrypto_serpent_crypt_ecb(
+	result = libfcrypto_serpent_crypt_cbc(
 	          NULL,
 	          LIBFCRYPTO_SERPENT_CRYPT_MODE_DECRYPT,
-	          input_data,
+	          initialization_vector,
 	          16,
+	          input_data,
+	          1200,
 	          output_data,
+	          1200,
+	          &error );
+
+	FCRYPTO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FCRYPTO_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfcrypto_serpent_crypt_cbc(
+	          serpent_context,
+	          LIBFCRYPTO_SERPENT_CRYPT_MODE_DECRYPT,
+	          NULL,
 	          16,
+	          input_data,
+	          1200,
+	          output_data,
+	          1200,
 	          &error );
 
 	FCRYPTO_TEST_ASSERT_EQUAL_INT(
@@ -600,13 +731,38 @@ int fcrypto_test_serpent_crypt_ecb(
 	libcerror_error_free(
 	 &error );
 
-	result = libfcrypto_serpent_crypt_ecb(
+	result = libfcrypto_serpent_crypt_cbc(
 	          serpent_context,
-	          -1,
+	          LIBFCRYPTO_SERPENT_CRYPT_MODE_DECRYPT,
+	          initialization_vector,
+	          8,
 	          input_data,
-	          16,
+	          1200,
 	          output_data,
+	          1200,
+	          &error );
+
+	FCRYPTO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FCRYPTO_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfcrypto_serpent_crypt_cbc(
+	          serpent_context,
+	          -1,
+	          initialization_vector,
 	          16,
+	          input_data,
+	          1200,
+	          output_data,
+	          1200,
 	          &error );
 
 	FCRYPTO_TEST_ASSERT_EQUAL_INT(
@@ -621,13 +777,15 @@ int fcrypto_test_serpent_crypt_ecb(
 	libcerror_error_free(
 	 &error );
 
-	result = libfcrypto_serpent_crypt_ecb(
+	result = libfcrypto_serpent_crypt_cbc(
 	          serpent_context,
 	          LIBFCRYPTO_SERPENT_CRYPT_MODE_DECRYPT,
-	          NULL,
+	          initialization_vector,
 	          16,
+	          NULL,
+	          1200,
 	          output_data,
-	          16,
+	          1200,
 	          &error );
 
 	FCRYPTO_TEST_ASSERT_EQUAL_INT(
@@ -642,13 +800,15 @@ int fcrypto_test_serpent_crypt_ecb(
 	libcerror_error_free(
 	 &error );
 
-	result = libfcrypto_serpent_crypt_ecb(
+	result = libfcrypto_serpent_crypt_cbc(
 	          serpent_context,
 	          LIBFCRYPTO_SERPENT_CRYPT_MODE_DECRYPT,
+	          initialization_vector,
+	          16,
 	          input_data,
-	          (size_t) SSIZE_MAX + 1,
+	          1199,
 	          output_data,
-	          16,
+	          1200,
 	          &error );
 
 	FCRYPTO_TEST_ASSERT_EQUAL_INT(
@@ -663,13 +823,15 @@ int fcrypto_test_serpent_crypt_ecb(
 	libcerror_error_free(
 	 &error );
 
-	result = libfcrypto_serpent_crypt_ecb(
+	result = libfcrypto_serpent_crypt_cbc(
 	          serpent_context,
 	          LIBFCRYPTO_SERPENT_CRYPT_MODE_DECRYPT,
-	          input_data,
+	          initialization_vector,
 	          16,
+	          input_data,
+	          1200,
 	          NULL,
-	          16,
+	          1200,
 	          &error );
 
 	FCRYPTO_TEST_ASSERT_EQUAL_INT(
@@ -684,13 +846,15 @@ int fcrypto_test_serpent_crypt_ecb(
 	libcerror_error_free(
 	 &error );
 
-	result = libfcrypto_serpent_crypt_ecb(
+	result = libfcrypto_serpent_crypt_cbc(
 	          serpent_context,
 	          LIBFCRYPTO_SERPENT_CRYPT_MODE_DECRYPT,
-	          input_data,
+	          initialization_vector,
 	          16,
+	          input_data,
+	          1200,
 	          output_data,
-	          (size_t) SSIZE_MAX + 1,
+	          1184,
 	          &error );
 
 	FCRYPTO_TEST_ASSERT_EQUAL_INT(
@@ -741,24 +905,40 @@ on_error:
 	return( 0 );
 }
 
-/* Tests the libfcrypto_serpent_crypt function with a NESSIE test vector
+/* Tests the libfcrypto_serpent_crypt_ctr function
  * Returns 1 if successful or 0 if not
  */
-int fcrypto_test_serpent_crypt_ecb_with_nessie_test_vector(
-     const uint8_t *key, 
-     size_t key_size,
-     uint8_t *input_data,
-     uint8_t *expected_output_data_iterations_1,
-     uint8_t *expected_output_data_iterations_100,
-     uint8_t *expected_output_data_iterations_1000 )
+int fcrypto_test_serpent_crypt_ctr(
+     void )
 {
+	uint8_t initial_counter_block[ 16 ] = {
+		0x03, 0x14, 0x25, 0x36, 0x47, 0x58, 0x69, 0x7a, 0x8b, 0x9c, 0xad, 0xbe, 0x00, 0x00, 0xff, 0xf0 };
+
+	uint8_t key[ 32 ] = {
+		0x07, 0x24, 0x41, 0x5e, 0x7b, 0x98, 0xb5, 0xd2, 0xef, 0x0c, 0x29, 0x46, 0x63, 0x80, 0x9d, 0xba,
+		0xd7, 0xf4, 0x11, 0x2e, 0x4b, 0x68, 0x85, 0xa2, 0xbf, 0xdc, 0xf9, 0x16, 0x33, 0x50, 0x6d, 0x8a };
+
+	uint8_t counter_blocks_data[ 3008 ];
+	uint8_t expected_output_data[ 3000 ];
+	uint8_t input_data[ 3000 ];
+	uint8_t output_data[ 3000 ];
+
 	libcerror_error_t *error                      = NULL;
 	libfcrypto_serpent_context_t *serpent_context = NULL;
-	int iteration                                 = 0;
+	size_t block_index                            = 0;
+	size_t byte_index                             = 0;
+	size_t data_offset                            = 0;
+	uint32_t counter_value                        = 0;
 	int result                                    = 0;
 
 	/* Initialize test
 	 */
+	for( data_offset = 0;
+	     data_offset < 3000;
+	     data_offset++ )
+	{
+		input_data[ data_offset ] = (uint8_t) ( ( data_offset * 13 ) + 5 );
+	}
 	result = libfcrypto_serpent_context_initialize(
 	          &serpent_context,
 	          &error );
@@ -779,7 +959,7 @@ int fcrypto_test_serpent_crypt_ecb_with_nessie_test_vector(
 	result = libfcrypto_serpent_context_set_key(
 	          serpent_context,
 	          key,
-	          key_size,
+	          256,
 	          &error );
 
 	FCRYPTO_TEST_ASSERT_EQUAL_INT(
@@ -791,95 +971,2420 @@ int fcrypto_test_serpent_crypt_ecb_with_nessie_test_vector(
 	 "error",
 	 error );
 
-	/* Test encrypting a buffer of data
+	/* Calculate the expected output data using Serpent-ECB with a 32-bit big-endian counter
+	 * that carries over into the third byte from the end of the counter block
 	 */
-	for( iteration = 1;
-	     iteration <= 1000;
-	     iteration++ )
+	for( block_index = 0;
+	     block_index < 188;
+	     block_index++ )
 	{
-		result = libfcrypto_serpent_crypt_ecb(
-		          serpent_context,
-		          LIBFCRYPTO_SERPENT_CRYPT_MODE_ENCRYPT,
-		          input_data,
-		          16,
-		          input_data,
-		          16,
-		          &error );
-
-		FCRYPTO_TEST_ASSERT_EQUAL_INT(
-		 "result",
-		 result,
-		 1 );
-
-		FCRYPTO_TEST_ASSERT_IS_NULL(
-		 "error",
-		 error );
-
-		if( iteration == 1 )
+		for( byte_index = 0;
+		     byte_index < 16;
+		     byte_index++ )
 		{
-			result = memory_compare(
-			          input_data,
-			          expected_output_data_iterations_1,
-			          16 );
-
-			FCRYPTO_TEST_ASSERT_EQUAL_INT(
-			 "result",
-			 result,
-			 0 );
+			counter_blocks_data[ ( block_index * 16 ) + byte_index ] = initial_counter_block[ byte_index ];
 		}
-		else if( iteration == 100 )
-		{
-			result = memory_compare(
-			          input_data,
-			          expected_output_data_iterations_100,
-			          16 );
+		counter_value = (uint32_t) ( 0x0000fff0UL + block_index );
 
-			FCRYPTO_TEST_ASSERT_EQUAL_INT(
-			 "result",
-			 result,
-			 0 );
-		}
+		counter_blocks_data[ ( block_index * 16 ) + 12 ] = (uint8_t) ( counter_value >> 24 );
+		counter_blocks_data[ ( block_index * 16 ) + 13 ] = (uint8_t) ( counter_value >> 16 );
+		counter_blocks_data[ ( block_index * 16 ) + 14 ] = (uint8_t) ( counter_value >> 8 );
+		counter_blocks_data[ ( block_index * 16 ) + 15 ] = (uint8_t) counter_value;
 	}
-	result = memory_compare(
-	          input_data,
-	          expected_output_data_iterations_1000,
-	          16 );
+	result = libfcrypto_serpent_crypt_ecb(
+	          serpent_context,
+	          LIBFCRYPTO_SERPENT_CRYPT_MODE_ENCRYPT,
+	          counter_blocks_data,
+	          3008,
+	          counter_blocks_data,
+	          3008,
+	          &error );
 
 	FCRYPTO_TEST_ASSERT_EQUAL_INT(
 	 "result",
 	 result,
-	 0 );
+	 1 );
 
-	/* Test decrypting a buffer of data
-	 */
-	for( iteration = 999;
-	     iteration >= 1;
-	     iteration-- )
+	FCRYPTO_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	for( data_offset = 0;
+	     data_offset < 3000;
+	     data_offset++ )
 	{
-		result = libfcrypto_serpent_crypt_ecb(
-		          serpent_context,
-		          LIBFCRYPTO_SERPENT_CRYPT_MODE_DECRYPT,
-		          input_data,
-		          16,
-		          input_data,
-		          16,
-		          &error );
+		expected_output_data[ data_offset ] = input_data[ data_offset ] ^ counter_blocks_data[ data_offset ];
+	}
+	/* Test encrypting a buffer of data that spans multiple key stream buffers
+	 */
+	result = libfcrypto_serpent_crypt_ctr(
+	          serpent_context,
+	          initial_counter_block,
+	          16,
+	          4,
+	          LIBFCRYPTO_ENDIAN_BIG,
+	          0,
+	          input_data,
+	          3000,
+	          output_data,
+	          3000,
+	          &error );
 
-		FCRYPTO_TEST_ASSERT_EQUAL_INT(
-		 "result",
-		 result,
-		 1 );
+	FCRYPTO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
 
-		FCRYPTO_TEST_ASSERT_IS_NULL(
-		 "error",
-		 error );
+	FCRYPTO_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
 
-		if( iteration == 1 )
-		{
-			result = memory_compare(
-			          input_data,
-			          expected_output_data_iterations_1,
-			          16 );
+	result = memory_compare(
+	          output_data,
+	          expected_output_data,
+	          3000 );
+
+	FCRYPTO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	/* Test decrypting the data
+	 */
+	result = libfcrypto_serpent_crypt_ctr(
+	          serpent_context,
+	          initial_counter_block,
+	          16,
+	          4,
+	          LIBFCRYPTO_ENDIAN_BIG,
+	          0,
+	          output_data,
+	          3000,
+	          output_data,
+	          3000,
+	          &error );
+
+	FCRYPTO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FCRYPTO_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = memory_compare(
+	          output_data,
+	          input_data,
+	          3000 );
+
+	FCRYPTO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	/* Test encrypting data at an offset that is not a multiple of the block size
+	 */
+	result = libfcrypto_serpent_crypt_ctr(
+	          serpent_context,
+	          initial_counter_block,
+	          16,
+	          4,
+	          LIBFCRYPTO_ENDIAN_BIG,
+	          1029,
+	          &( input_data[ 1029 ] ),
+	          1500,
+	          output_data,
+	          1500,
+	          &error );
+
+	FCRYPTO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FCRYPTO_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = memory_compare(
+	          output_data,
+	          &( expected_output_data[ 1029 ] ),
+	          1500 );
+
+	FCRYPTO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	/* Test encrypting data in-place
+	 */
+	for( data_offset = 0;
+	     data_offset < 3000;
+	     data_offset++ )
+	{
+		output_data[ data_offset ] = input_data[ data_offset ];
+	}
+	result = libfcrypto_serpent_crypt_ctr(
+	          serpent_context,
+	          initial_counter_block,
+	          16,
+	          4,
+	          LIBFCRYPTO_ENDIAN_BIG,
+	          0,
+	          output_data,
+	          3000,
+	          output_data,
+	          3000,
+	          &error );
+
+	FCRYPTO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FCRYPTO_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = memory_compare(
+	          output_data,
+	          expected_output_data,
+	          3000 );
+
+	FCRYPTO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	/* Test encrypting data with a little-endian counter at an offset
+	 */
+	result = libfcrypto_serpent_crypt_ctr(
+	          serpent_context,
+	          initial_counter_block,
+	          16,
+	          4,
+	          LIBFCRYPTO_ENDIAN_LITTLE,
+	          0,
+	          input_data,
+	          3000,
+	          expected_output_data,
+	          3000,
+	          &error );
+
+	FCRYPTO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FCRYPTO_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfcrypto_serpent_crypt_ctr(
+	          serpent_context,
+	          initial_counter_block,
+	          16,
+	          4,
+	          LIBFCRYPTO_ENDIAN_LITTLE,
+	          77,
+	          &( input_data[ 77 ] ),
+	          2000,
+	          output_data,
+	          2000,
+	          &error );
+
+	FCRYPTO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FCRYPTO_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = memory_compare(
+	          output_data,
+	          &( expected_output_data[ 77 ] ),
+	          2000 );
+
+	FCRYPTO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	/* Test error cases
+	 */
+	result = libfcrypto_serpent_crypt_ctr(
+	          NULL,
+	          initial_counter_block,
+	          16,
+	          4,
+	          LIBFCRYPTO_ENDIAN_BIG,
+	          0,
+	          input_data,
+	          3000,
+	          output_data,
+	          3000,
+	          &error );
+
+	FCRYPTO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FCRYPTO_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfcrypto_serpent_crypt_ctr(
+	          serpent_context,
+	          NULL,
+	          16,
+	          4,
+	          LIBFCRYPTO_ENDIAN_BIG,
+	          0,
+	          input_data,
+	          3000,
+	          output_data,
+	          3000,
+	          &error );
+
+	FCRYPTO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FCRYPTO_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfcrypto_serpent_crypt_ctr(
+	          serpent_context,
+	          initial_counter_block,
+	          15,
+	          4,
+	          LIBFCRYPTO_ENDIAN_BIG,
+	          0,
+	          input_data,
+	          3000,
+	          output_data,
+	          3000,
+	          &error );
+
+	FCRYPTO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FCRYPTO_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfcrypto_serpent_crypt_ctr(
+	          serpent_context,
+	          initial_counter_block,
+	          16,
+	          0,
+	          LIBFCRYPTO_ENDIAN_BIG,
+	          0,
+	          input_data,
+	          3000,
+	          output_data,
+	          3000,
+	          &error );
+
+	FCRYPTO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FCRYPTO_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfcrypto_serpent_crypt_ctr(
+	          serpent_context,
+	          initial_counter_block,
+	          16,
+	          17,
+	          LIBFCRYPTO_ENDIAN_BIG,
+	          0,
+	          input_data,
+	          3000,
+	          output_data,
+	          3000,
+	          &error );
+
+	FCRYPTO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FCRYPTO_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfcrypto_serpent_crypt_ctr(
+	          serpent_context,
+	          initial_counter_block,
+	          16,
+	          4,
+	          0,
+	          0,
+	          input_data,
+	          3000,
+	          output_data,
+	          3000,
+	          &error );
+
+	FCRYPTO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FCRYPTO_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfcrypto_serpent_crypt_ctr(
+	          serpent_context,
+	          initial_counter_block,
+	          16,
+	          4,
+	          LIBFCRYPTO_ENDIAN_BIG,
+	          0,
+	          NULL,
+	          3000,
+	          output_data,
+	          3000,
+	          &error );
+
+	FCRYPTO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FCRYPTO_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfcrypto_serpent_crypt_ctr(
+	          serpent_context,
+	          initial_counter_block,
+	          16,
+	          4,
+	          LIBFCRYPTO_ENDIAN_BIG,
+	          0,
+	          input_data,
+	          (size_t) SSIZE_MAX + 1,
+	          output_data,
+	          3000,
+	          &error );
+
+	FCRYPTO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FCRYPTO_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfcrypto_serpent_crypt_ctr(
+	          serpent_context,
+	          initial_counter_block,
+	          16,
+	          4,
+	          LIBFCRYPTO_ENDIAN_BIG,
+	          0,
+	          input_data,
+	          3000,
+	          NULL,
+	          3000,
+	          &error );
+
+	FCRYPTO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FCRYPTO_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfcrypto_serpent_crypt_ctr(
+	          serpent_context,
+	          initial_counter_block,
+	          16,
+	          4,
+	          LIBFCRYPTO_ENDIAN_BIG,
+	          0,
+	          input_data,
+	          3000,
+	          output_data,
+	          2999,
+	          &error );
+
+	FCRYPTO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FCRYPTO_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfcrypto_serpent_crypt_ctr(
+	          serpent_context,
+	          initial_counter_block,
+	          16,
+	          4,
+	          LIBFCRYPTO_ENDIAN_BIG,
+	          0,
+	          input_data,
+	          3000,
+	          output_data,
+	          (size_t) SSIZE_MAX + 1,
+	          &error );
+
+	FCRYPTO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FCRYPTO_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libfcrypto_serpent_context_free(
+	          &serpent_context,
+	          &error );
+
+	FCRYPTO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FCRYPTO_TEST_ASSERT_IS_NULL(
+	 "serpent_context",
+	 serpent_context );
+
+	FCRYPTO_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( serpent_context != NULL )
+	{
+		libfcrypto_serpent_context_free(
+		 &serpent_context,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libfcrypto_serpent_crypt_ecb function
+ * Returns 1 if successful or 0 if not
+ */
+int fcrypto_test_serpent_crypt_ecb(
+     void )
+{
+	uint8_t key[ 16 ] = {
+		0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 };
+
+	uint8_t input_data[ 16 ];
+	uint8_t output_data[ 16 ];
+
+	libcerror_error_t *error                      = NULL;
+	libfcrypto_serpent_context_t *serpent_context = NULL;
+	int result                                    = 0;
+
+	/* Initialize test
+	 */
+	result = libfcrypto_serpent_context_initialize(
+	          &serpent_context,
+	          &error );
+
+	FCRYPTO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FCRYPTO_TEST_ASSERT_IS_NOT_NULL(
+	 "serpent_context",
+	 serpent_context );
+
+	FCRYPTO_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfcrypto_serpent_context_set_key(
+	          serpent_context,
+	          key,
+	          128,
+	          &error );
+
+	FCRYPTO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FCRYPTO_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test decrypting a buffer of data
+	 */
+	result = libfcrypto_serpent_crypt_ecb(
+	          serpent_context,
+	          LIBFCRYPTO_SERPENT_CRYPT_MODE_DECRYPT,
+	          input_data,
+	          16,
+	          output_data,
+	          16,
+	          &error );
+
+	FCRYPTO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FCRYPTO_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test encrypting a buffer of data
+	 */
+	result = libfcrypto_serpent_crypt_ecb(
+	          serpent_context,
+	          LIBFCRYPTO_SERPENT_CRYPT_MODE_ENCRYPT,
+	          input_data,
+	          16,
+	          output_data,
+	          16,
+	          &error );
+
+	FCRYPTO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FCRYPTO_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libfcrypto_serpent_crypt_ecb(
+	          NULL,
+	          LIBFCRYPTO_SERPENT_CRYPT_MODE_DECRYPT,
+	          input_data,
+	          16,
+	          output_data,
+	          16,
+	          &error );
+
+	FCRYPTO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FCRYPTO_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfcrypto_serpent_crypt_ecb(
+	          serpent_context,
+	          -1,
+	          input_data,
+	          16,
+	          output_data,
+	          16,
+	          &error );
+
+	FCRYPTO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FCRYPTO_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfcrypto_serpent_crypt_ecb(
+	          serpent_context,
+	          LIBFCRYPTO_SERPENT_CRYPT_MODE_DECRYPT,
+	          NULL,
+	          16,
+	          output_data,
+	          16,
+	          &error );
+
+	FCRYPTO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FCRYPTO_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfcrypto_serpent_crypt_ecb(
+	          serpent_context,
+	          LIBFCRYPTO_SERPENT_CRYPT_MODE_DECRYPT,
+	          input_data,
+	          (size_t) SSIZE_MAX + 1,
+	          output_data,
+	          16,
+	          &error );
+
+	FCRYPTO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FCRYPTO_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfcrypto_serpent_crypt_ecb(
+	          serpent_context,
+	          LIBFCRYPTO_SERPENT_CRYPT_MODE_DECRYPT,
+	          input_data,
+	          16,
+	          NULL,
+	          16,
+	          &error );
+
+	FCRYPTO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FCRYPTO_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfcrypto_serpent_crypt_ecb(
+	          serpent_context,
+	          LIBFCRYPTO_SERPENT_CRYPT_MODE_DECRYPT,
+	          input_data,
+	          16,
+	          output_data,
+	          (size_t) SSIZE_MAX + 1,
+	          &error );
+
+	FCRYPTO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FCRYPTO_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libfcrypto_serpent_context_free(
+	          &serpent_context,
+	          &error );
+
+	FCRYPTO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FCRYPTO_TEST_ASSERT_IS_NULL(
+	 "serpent_context",
+	 serpent_context );
+
+	FCRYPTO_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( serpent_context != NULL )
+	{
+		libfcrypto_serpent_context_free(
+		 &serpent_context,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Calculates the expected Serpent-XTS encrypted data of a data unit using Serpent-ECB
+ * Only the full blocks are calculated
+ * Returns 1 if successful or 0 if not
+ */
+int fcrypto_test_serpent_calculate_xts_expected_data(
+     libfcrypto_serpent_context_t *serpent_context,
+     libfcrypto_serpent_context_t *tweak_context,
+     uint64_t data_unit_number,
+     const uint8_t *input_data,
+     uint8_t *expected_data,
+     size_t data_size )
+{
+	uint8_t block_data[ 16 ];
+	uint8_t tweak_value[ 16 ];
+
+	libcerror_error_t *error = NULL;
+	size_t data_offset       = 0;
+	uint8_t byte_index       = 0;
+	uint8_t carry_value      = 0;
+	uint8_t next_carry_value = 0;
+	int result               = 0;
+
+	for( byte_index = 0;
+	     byte_index < 16;
+	     byte_index++ )
+	{
+		tweak_value[ byte_index ] = (uint8_t) ( data_unit_number & 0xff );
+
+		data_unit_number >>= 8;
+	}
+	result = libfcrypto_serpent_crypt_ecb(
+	          tweak_context,
+	          LIBFCRYPTO_SERPENT_CRYPT_MODE_ENCRYPT,
+	          tweak_value,
+	          16,
+	          tweak_value,
+	          16,
+	          &error );
+
+	FCRYPTO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FCRYPTO_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	for( data_offset = 0;
+	     data_offset < data_size;
+	     data_offset += 16 )
+	{
+		for( byte_index = 0;
+		     byte_index < 16;
+		     byte_index++ )
+		{
+			block_data[ byte_index ] = input_data[ data_offset + byte_index ] ^ tweak_value[ byte_index ];
+		}
+		result = libfcrypto_serpent_crypt_ecb(
+		          serpent_context,
+		          LIBFCRYPTO_SERPENT_CRYPT_MODE_ENCRYPT,
+		          block_data,
+		          16,
+		          block_data,
+		          16,
+		          &error );
+
+		FCRYPTO_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		FCRYPTO_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		carry_value = 0;
+
+		for( byte_index = 0;
+		     byte_index < 16;
+		     byte_index++ )
+		{
+			expected_data[ data_offset + byte_index ] = block_data[ byte_index ] ^ tweak_value[ byte_index ];
+
+			next_carry_value          = tweak_value[ byte_index ] >> 7;
+			tweak_value[ byte_index ] = (uint8_t) ( ( tweak_value[ byte_index ] << 1 ) | carry_value );
+			carry_value               = next_carry_value;
+		}
+		if( carry_value != 0 )
+		{
+			tweak_value[ 0 ] ^= 0x87;
+		}
+	}
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libfcrypto_serpent_crypt_xts function
+ * Returns 1 if successful or 0 if not
+ */
+int fcrypto_test_serpent_crypt_xts(
+     void )
+{
+	uint8_t key[ 32 ] = {
+		0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09, 0x0a, 0x0b, 0x0c, 0x0d, 0x0e, 0x0f,
+		0x10, 0x11, 0x12, 0x13, 0x14, 0x15, 0x16, 0x17, 0x18, 0x19, 0x1a, 0x1b, 0x1c, 0x1d, 0x1e, 0x1f };
+
+	uint8_t tweak_key[ 32 ] = {
+		0xf0, 0xe1, 0xd2, 0xc3, 0xb4, 0xa5, 0x96, 0x87, 0x78, 0x69, 0x5a, 0x4b, 0x3c, 0x2d, 0x1e, 0x0f,
+		0x0f, 0x1e, 0x2d, 0x3c, 0x4b, 0x5a, 0x69, 0x78, 0x87, 0x96, 0xa5, 0xb4, 0xc3, 0xd2, 0xe1, 0xf0 };
+
+	uint8_t expected_data[ 512 ];
+	uint8_t input_data[ 512 ];
+	uint8_t output_data[ 512 ];
+
+	libcerror_error_t *error                      = NULL;
+	libfcrypto_serpent_context_t *serpent_context = NULL;
+	libfcrypto_serpent_context_t *tweak_context   = NULL;
+	size_t data_offset                            = 0;
+	int result                                    = 0;
+
+	/* Initialize test
+	 */
+	for( data_offset = 0;
+	     data_offset < 512;
+	     data_offset++ )
+	{
+		input_data[ data_offset ] = (uint8_t) ( ( data_offset * 13 ) + 5 );
+	}
+	result = libfcrypto_serpent_context_initialize(
+	          &serpent_context,
+	          &error );
+
+	FCRYPTO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FCRYPTO_TEST_ASSERT_IS_NOT_NULL(
+	 "serpent_context",
+	 serpent_context );
+
+	FCRYPTO_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfcrypto_serpent_context_set_key(
+	          serpent_context,
+	          key,
+	          256,
+	          &error );
+
+	FCRYPTO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FCRYPTO_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfcrypto_serpent_context_initialize(
+	          &tweak_context,
+	          &error );
+
+	FCRYPTO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FCRYPTO_TEST_ASSERT_IS_NOT_NULL(
+	 "tweak_context",
+	 tweak_context );
+
+	FCRYPTO_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfcrypto_serpent_context_set_key(
+	          tweak_context,
+	          tweak_key,
+	          256,
+	          &error );
+
+	FCRYPTO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FCRYPTO_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = fcrypto_test_serpent_calculate_xts_expected_data(
+	          serpent_context,
+	          tweak_context,
+	          5,
+	          input_data,
+	          expected_data,
+	          512 );
+
+	FCRYPTO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	/* Test encrypting a data unit
+	 */
+	result = libfcrypto_serpent_crypt_xts(
+	          serpent_context,
+	          tweak_context,
+	          LIBFCRYPTO_SERPENT_CRYPT_MODE_ENCRYPT,
+	          5,
+	          input_data,
+	          512,
+	          output_data,
+	          512,
+	          &error );
+
+	FCRYPTO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FCRYPTO_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = memory_compare(
+	          output_data,
+	          expected_data,
+	          512 );
+
+	FCRYPTO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	/* Test decrypting a data unit in-place
+	 */
+	result = libfcrypto_serpent_crypt_xts(
+	          serpent_context,
+	          tweak_context,
+	          LIBFCRYPTO_SERPENT_CRYPT_MODE_DECRYPT,
+	          5,
+	          output_data,
+	          512,
+	          output_data,
+	          512,
+	          &error );
+
+	FCRYPTO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FCRYPTO_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = memory_compare(
+	          output_data,
+	          input_data,
+	          512 );
+
+	FCRYPTO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	/* Test encrypting a data unit that is not a multitude of the block size using ciphertext stealing
+	 */
+	result = libfcrypto_serpent_crypt_xts(
+	          serpent_context,
+	          tweak_context,
+	          LIBFCRYPTO_SERPENT_CRYPT_MODE_ENCRYPT,
+	          5,
+	          input_data,
+	          100,
+	          output_data,
+	          100,
+	          &error );
+
+	FCRYPTO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FCRYPTO_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* The blocks before the last full block are not affected by ciphertext stealing
+	 */
+	result = memory_compare(
+	          output_data,
+	          expected_data,
+	          80 );
+
+	FCRYPTO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	/* The partial block contains the start of the encrypted last full block
+	 */
+	result = memory_compare(
+	          &( output_data[ 96 ] ),
+	          &( expected_data[ 80 ] ),
+	          4 );
+
+	FCRYPTO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	/* Test decrypting a data unit that is not a multitude of the block size in-place
+	 */
+	result = libfcrypto_serpent_crypt_xts(
+	          serpent_context,
+	          tweak_context,
+	          LIBFCRYPTO_SERPENT_CRYPT_MODE_DECRYPT,
+	          5,
+	          output_data,
+	          100,
+	          output_data,
+	          100,
+	          &error );
+
+	FCRYPTO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FCRYPTO_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = memory_compare(
+	          output_data,
+	          input_data,
+	          100 );
+
+	FCRYPTO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	/* Test error cases
+	 */
+	result = libfcrypto_serpent_crypt_xts(
+	          NULL,
+	          tweak_context,
+	          LIBFCRYPTO_SERPENT_CRYPT_MODE_ENCRYPT,
+	          5,
+	          input_data,
+	          512,
+	          output_data,
+	          512,
+	          &error );
+
+	FCRYPTO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FCRYPTO_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfcrypto_serpent_crypt_xts(
+	          serpent_context,
+	          NULL,
+	          LIBFCRYPTO_SERPENT_CRYPT_MODE_ENCRYPT,
+	          5,
+	          input_data,
+	          512,
+	          output_data,
+	          512,
+	          &error );
+
+	FCRYPTO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FCRYPTO_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfcrypto_serpent_crypt_xts(
+	          serpent_context,
+	          tweak_context,
+	          -1,
+	          5,
+	          input_data,
+	          512,
+	          output_data,
+	          512,
+	          &error );
+
+	FCRYPTO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FCRYPTO_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfcrypto_serpent_crypt_xts(
+	          serpent_context,
+	          tweak_context,
+	          LIBFCRYPTO_SERPENT_CRYPT_MODE_ENCRYPT,
+	          5,
+	          NULL,
+	          512,
+	          output_data,
+	          512,
+	          &error );
+
+	FCRYPTO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FCRYPTO_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfcrypto_serpent_crypt_xts(
+	          serpent_context,
+	          tweak_context,
+	          LIBFCRYPTO_SERPENT_CRYPT_MODE_ENCRYPT,
+	          5,
+	          input_data,
+	          15,
+	          output_data,
+	          512,
+	          &error );
+
+	FCRYPTO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FCRYPTO_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfcrypto_serpent_crypt_xts(
+	          serpent_context,
+	          tweak_context,
+	          LIBFCRYPTO_SERPENT_CRYPT_MODE_ENCRYPT,
+	          5,
+	          input_data,
+	          (size_t) SSIZE_MAX + 1,
+	          output_data,
+	          512,
+	          &error );
+
+	FCRYPTO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FCRYPTO_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfcrypto_serpent_crypt_xts(
+	          serpent_context,
+	          tweak_context,
+	          LIBFCRYPTO_SERPENT_CRYPT_MODE_ENCRYPT,
+	          5,
+	          input_data,
+	          512,
+	          NULL,
+	          512,
+	          &error );
+
+	FCRYPTO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FCRYPTO_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfcrypto_serpent_crypt_xts(
+	          serpent_context,
+	          tweak_context,
+	          LIBFCRYPTO_SERPENT_CRYPT_MODE_ENCRYPT,
+	          5,
+	          input_data,
+	          512,
+	          output_data,
+	          256,
+	          &error );
+
+	FCRYPTO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FCRYPTO_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libfcrypto_serpent_context_free(
+	          &tweak_context,
+	          &error );
+
+	FCRYPTO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FCRYPTO_TEST_ASSERT_IS_NULL(
+	 "tweak_context",
+	 tweak_context );
+
+	FCRYPTO_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfcrypto_serpent_context_free(
+	          &serpent_context,
+	          &error );
+
+	FCRYPTO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FCRYPTO_TEST_ASSERT_IS_NULL(
+	 "serpent_context",
+	 serpent_context );
+
+	FCRYPTO_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( tweak_context != NULL )
+	{
+		libfcrypto_serpent_context_free(
+		 &tweak_context,
+		 NULL );
+	}
+	if( serpent_context != NULL )
+	{
+		libfcrypto_serpent_context_free(
+		 &serpent_context,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libfcrypto_serpent_crypt_xts_data_units function
+ * Returns 1 if successful or 0 if not
+ */
+int fcrypto_test_serpent_crypt_xts_data_units(
+     void )
+{
+	uint8_t key[ 32 ] = {
+		0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09, 0x0a, 0x0b, 0x0c, 0x0d, 0x0e, 0x0f,
+		0x10, 0x11, 0x12, 0x13, 0x14, 0x15, 0x16, 0x17, 0x18, 0x19, 0x1a, 0x1b, 0x1c, 0x1d, 0x1e, 0x1f };
+
+	uint8_t tweak_key[ 32 ] = {
+		0xf0, 0xe1, 0xd2, 0xc3, 0xb4, 0xa5, 0x96, 0x87, 0x78, 0x69, 0x5a, 0x4b, 0x3c, 0x2d, 0x1e, 0x0f,
+		0x0f, 0x1e, 0x2d, 0x3c, 0x4b, 0x5a, 0x69, 0x78, 0x87, 0x96, 0xa5, 0xb4, 0xc3, 0xd2, 0xe1, 0xf0 };
+
+	uint8_t expected_data[ 1280 ];
+	uint8_t input_data[ 1280 ];
+	uint8_t output_data[ 1280 ];
+
+	libcerror_error_t *error                      = NULL;
+	libfcrypto_serpent_context_t *serpent_context = NULL;
+	libfcrypto_serpent_context_t *tweak_context   = NULL;
+	size_t data_offset                            = 0;
+	uint64_t data_unit_number                     = 0;
+	int result                                    = 0;
+
+	/* Initialize test
+	 */
+	for( data_offset = 0;
+	     data_offset < 1280;
+	     data_offset++ )
+	{
+		input_data[ data_offset ] = (uint8_t) ( ( data_offset * 13 ) + 5 );
+	}
+	result = libfcrypto_serpent_context_initialize(
+	          &serpent_context,
+	          &error );
+
+	FCRYPTO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FCRYPTO_TEST_ASSERT_IS_NOT_NULL(
+	 "serpent_context",
+	 serpent_context );
+
+	FCRYPTO_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfcrypto_serpent_context_set_key(
+	          serpent_context,
+	          key,
+	          256,
+	          &error );
+
+	FCRYPTO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FCRYPTO_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfcrypto_serpent_context_initialize(
+	          &tweak_context,
+	          &error );
+
+	FCRYPTO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FCRYPTO_TEST_ASSERT_IS_NOT_NULL(
+	 "tweak_context",
+	 tweak_context );
+
+	FCRYPTO_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfcrypto_serpent_context_set_key(
+	          tweak_context,
+	          tweak_key,
+	          256,
+	          &error );
+
+	FCRYPTO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FCRYPTO_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* The 20 data units require more tweak values than are encrypted at once
+	 */
+	for( data_unit_number = 0;
+	     data_unit_number < 20;
+	     data_unit_number++ )
+	{
+		result = fcrypto_test_serpent_calculate_xts_expected_data(
+		          serpent_context,
+		          tweak_context,
+		          5 + data_unit_number,
+		          &( input_data[ data_unit_number * 64 ] ),
+		          &( expected_data[ data_unit_number * 64 ] ),
+		          64 );
+
+		FCRYPTO_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+	}
+	/* Test encrypting multiple data units
+	 */
+	result = libfcrypto_serpent_crypt_xts_data_units(
+	          serpent_context,
+	          tweak_context,
+	          LIBFCRYPTO_SERPENT_CRYPT_MODE_ENCRYPT,
+	          5,
+	          64,
+	          input_data,
+	          1280,
+	          output_data,
+	          1280,
+	          &error );
+
+	FCRYPTO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FCRYPTO_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = memory_compare(
+	          output_data,
+	          expected_data,
+	          1280 );
+
+	FCRYPTO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	/* Test decrypting multiple data units in-place
+	 */
+	result = libfcrypto_serpent_crypt_xts_data_units(
+	          serpent_context,
+	          tweak_context,
+	          LIBFCRYPTO_SERPENT_CRYPT_MODE_DECRYPT,
+	          5,
+	          64,
+	          output_data,
+	          1280,
+	          output_data,
+	          1280,
+	          &error );
+
+	FCRYPTO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FCRYPTO_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = memory_compare(
+	          output_data,
+	          input_data,
+	          1280 );
+
+	FCRYPTO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	/* Test error cases
+	 */
+	result = libfcrypto_serpent_crypt_xts_data_units(
+	          NULL,
+	          tweak_context,
+	          LIBFCRYPTO_SERPENT_CRYPT_MODE_ENCRYPT,
+	          5,
+	          64,
+	          input_data,
+	          1280,
+	          output_data,
+	          1280,
+	          &error );
+
+	FCRYPTO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FCRYPTO_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfcrypto_serpent_crypt_xts_data_units(
+	          serpent_context,
+	          NULL,
+	          LIBFCRYPTO_SERPENT_CRYPT_MODE_ENCRYPT,
+	          5,
+	          64,
+	          input_data,
+	          1280,
+	          output_data,
+	          1280,
+	          &error );
+
+	FCRYPTO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FCRYPTO_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfcrypto_serpent_crypt_xts_data_units(
+	          serpent_context,
+	          tweak_context,
+	          -1,
+	          5,
+	          64,
+	          input_data,
+	          1280,
+	          output_data,
+	          1280,
+	          &error );
+
+	FCRYPTO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FCRYPTO_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfcrypto_serpent_crypt_xts_data_units(
+	          serpent_context,
+	          tweak_context,
+	          LIBFCRYPTO_SERPENT_CRYPT_MODE_ENCRYPT,
+	          5,
+	          100,
+	          input_data,
+	          1280,
+	          output_data,
+	          1280,
+	          &error );
+
+	FCRYPTO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FCRYPTO_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfcrypto_serpent_crypt_xts_data_units(
+	          serpent_context,
+	          tweak_context,
+	          LIBFCRYPTO_SERPENT_CRYPT_MODE_ENCRYPT,
+	          5,
+	          64,
+	          NULL,
+	          1280,
+	          output_data,
+	          1280,
+	          &error );
+
+	FCRYPTO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FCRYPTO_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfcrypto_serpent_crypt_xts_data_units(
+	          serpent_context,
+	          tweak_context,
+	          LIBFCRYPTO_SERPENT_CRYPT_MODE_ENCRYPT,
+	          5,
+	          64,
+	          input_data,
+	          1000,
+	          output_data,
+	          1280,
+	          &error );
+
+	FCRYPTO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FCRYPTO_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfcrypto_serpent_crypt_xts_data_units(
+	          serpent_context,
+	          tweak_context,
+	          LIBFCRYPTO_SERPENT_CRYPT_MODE_ENCRYPT,
+	          5,
+	          64,
+	          input_data,
+	          1280,
+	          NULL,
+	          1280,
+	          &error );
+
+	FCRYPTO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FCRYPTO_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfcrypto_serpent_crypt_xts_data_units(
+	          serpent_context,
+	          tweak_context,
+	          LIBFCRYPTO_SERPENT_CRYPT_MODE_ENCRYPT,
+	          5,
+	          64,
+	          input_data,
+	          1280,
+	          output_data,
+	          640,
+	          &error );
+
+	FCRYPTO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FCRYPTO_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libfcrypto_serpent_context_free(
+	          &tweak_context,
+	          &error );
+
+	FCRYPTO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FCRYPTO_TEST_ASSERT_IS_NULL(
+	 "tweak_context",
+	 tweak_context );
+
+	FCRYPTO_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfcrypto_serpent_context_free(
+	          &serpent_context,
+	          &error );
+
+	FCRYPTO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FCRYPTO_TEST_ASSERT_IS_NULL(
+	 "serpent_context",
+	 serpent_context );
+
+	FCRYPTO_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( tweak_context != NULL )
+	{
+		libfcrypto_serpent_context_free(
+		 &tweak_context,
+		 NULL );
+	}
+	if( serpent_context != NULL )
+	{
+		libfcrypto_serpent_context_free(
+		 &serpent_context,
+		 NULL );
+	}
+	return( 0 );
+}
+
+#if defined( __GNUC__ ) && !defined( LIBFCRYPTO_DLL_IMPORT )
+
+/* Tests a function that de- or encrypts multiple blocks of data using Serpent
+ * The block size is the number of bytes the function processes at once
+ * Returns 1 if successful or 0 if not
+ */
+int fcrypto_test_serpent_context_crypt_blocks_with_function(
+     int (*crypt_blocks)(
+           libfcrypto_internal_serpent_context_t *internal_context,
+           int mode,
+           const uint8_t *input_data,
+           size_t input_data_size,
+           uint8_t *output_data,
+           size_t output_data_size,
+           libcerror_error_t **error ),
+     size_t block_size )
+{
+	uint8_t key[ 32 ] = {
+		0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09, 0x0a, 0x0b, 0x0c, 0x0d, 0x0e, 0x0f,
+		0x10, 0x11, 0x12, 0x13, 0x14, 0x15, 0x16, 0x17, 0x18, 0x19, 0x1a, 0x1b, 0x1c, 0x1d, 0x1e, 0x1f };
+
+	uint8_t expected_data[ 512 ];
+	uint8_t input_data[ 512 ];
+	uint8_t output_data[ 512 ];
+
+	libcerror_error_t *error                      = NULL;
+	libfcrypto_serpent_context_t *serpent_context = NULL;
+	size_t data_offset                            = 0;
+	int result                                    = 0;
+
+	/* Initialize test
+	 */
+	for( data_offset = 0;
+	     data_offset < 512;
+	     data_offset++ )
+	{
+		input_data[ data_offset ] = (uint8_t) ( ( data_offset * 13 ) + 5 );
+	}
+	result = libfcrypto_serpent_context_initialize(
+	          &serpent_context,
+	          &error );
+
+	FCRYPTO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FCRYPTO_TEST_ASSERT_IS_NOT_NULL(
+	 "serpent_context",
+	 serpent_context );
+
+	FCRYPTO_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfcrypto_serpent_context_set_key(
+	          serpent_context,
+	          key,
+	          256,
+	          &error );
+
+	FCRYPTO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FCRYPTO_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	for( data_offset = 0;
+	     data_offset < 512;
+	     data_offset += 16 )
+	{
+		result = libfcrypto_internal_serpent_context_encrypt_block(
+		          (libfcrypto_internal_serpent_context_t *) serpent_context,
+		          &( input_data[ data_offset ] ),
+		          16,
+		          &( expected_data[ data_offset ] ),
+		          16,
+		          &error );
+
+		FCRYPTO_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		FCRYPTO_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+	}
+	/* Test encrypting multiple blocks
+	 */
+	result = crypt_blocks(
+	          (libfcrypto_internal_serpent_context_t *) serpent_context,
+	          LIBFCRYPTO_SERPENT_CRYPT_MODE_ENCRYPT,
+	          input_data,
+	          512,
+	          output_data,
+	          512,
+	          &error );
+
+	FCRYPTO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FCRYPTO_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = memory_compare(
+	          output_data,
+	          expected_data,
+	          512 );
+
+	FCRYPTO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	/* Test decrypting multiple blocks in-place
+	 */
+	result = crypt_blocks(
+	          (libfcrypto_internal_serpent_context_t *) serpent_context,
+	          LIBFCRYPTO_SERPENT_CRYPT_MODE_DECRYPT,
+	          output_data,
+	          512,
+	          output_data,
+	          512,
+	          &error );
+
+	FCRYPTO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FCRYPTO_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = memory_compare(
+	          output_data,
+	          input_data,
+	          512 );
+
+	FCRYPTO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	/* Test de- or encrypting a number of blocks that is not a multitude of the block size
+	 */
+	result = crypt_blocks(
+	          (libfcrypto_internal_serpent_context_t *) serpent_context,
+	          LIBFCRYPTO_SERPENT_CRYPT_MODE_ENCRYPT,
+	          input_data,
+	          512 - block_size + 16,
+	          output_data,
+	          512,
+	          &error );
+
+	if( block_size == 16 )
+	{
+		FCRYPTO_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		FCRYPTO_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		result = memory_compare(
+		          output_data,
+		          expected_data,
+		          512 - block_size + 16 );
+
+		FCRYPTO_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 0 );
+	}
+	else
+	{
+		FCRYPTO_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 -1 );
+
+		FCRYPTO_TEST_ASSERT_IS_NOT_NULL(
+		 "error",
+		 error );
+
+		libcerror_error_free(
+		 &error );
+	}
+	/* Test error cases
+	 */
+	result = crypt_blocks(
+	          NULL,
+	          LIBFCRYPTO_SERPENT_CRYPT_MODE_ENCRYPT,
+	          input_data,
+	          512,
+	          output_data,
+	          512,
+	          &error );
+
+	FCRYPTO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FCRYPTO_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = crypt_blocks(
+	          (libfcrypto_internal_serpent_context_t *) serpent_context,
+	          -1,
+	          input_data,
+	          512,
+	          output_data,
+	          512,
+	          &error );
+
+	FCRYPTO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FCRYPTO_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = crypt_blocks(
+	          (libfcrypto_internal_serpent_context_t *) serpent_context,
+	          LIBFCRYPTO_SERPENT_CRYPT_MODE_ENCRYPT,
+	          NULL,
+	          512,
+	          output_data,
+	          512,
+	          &error );
+
+	FCRYPTO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FCRYPTO_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = crypt_blocks(
+	          (libfcrypto_internal_serpent_context_t *) serpent_context,
+	          LIBFCRYPTO_SERPENT_CRYPT_MODE_ENCRYPT,
+	          input_data,
+	          (size_t) SSIZE_MAX + 1,
+	          output_data,
+	          512,
+	          &error );
+
+	FCRYPTO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FCRYPTO_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = crypt_blocks(
+	          (libfcrypto_internal_serpent_context_t *) serpent_context,
+	          LIBFCRYPTO_SERPENT_CRYPT_MODE_ENCRYPT,
+	          input_data,
+	          512,
+	          NULL,
+	          512,
+	          &error );
+
+	FCRYPTO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FCRYPTO_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = crypt_blocks(
+	          (libfcrypto_internal_serpent_context_t *) serpent_context,
+	          LIBFCRYPTO_SERPENT_CRYPT_MODE_ENCRYPT,
+	          input_data,
+	          512,
+	          output_data,
+	          256,
+	          &error );
+
+	FCRYPTO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FCRYPTO_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libfcrypto_serpent_context_free(
+	          &serpent_context,
+	          &error );
+
+	FCRYPTO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FCRYPTO_TEST_ASSERT_IS_NULL(
+	 "serpent_context",
+	 serpent_context );
+
+	FCRYPTO_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( serpent_context != NULL )
+	{
+		libfcrypto_serpent_context_free(
+		 &serpent_context,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libfcrypto_internal_serpent_context_crypt_blocks function
+ * Returns 1 if successful or 0 if not
+ */
+int fcrypto_test_serpent_context_crypt_blocks(
+     void )
+{
+	return( fcrypto_test_serpent_context_crypt_blocks_with_function(
+	         libfcrypto_internal_serpent_context_crypt_blocks,
+	         16 ) );
+}
+
+#if defined( LIBFCRYPTO_SERPENT_CONTEXT_HAVE_SSE2 )
+
+/* Tests the libfcrypto_internal_serpent_context_crypt_blocks_sse2 function
+ * Returns 1 if successful or 0 if not
+ */
+int fcrypto_test_serpent_context_crypt_blocks_sse2(
+     void )
+{
+	if( __builtin_cpu_supports( "sse2" ) == 0 )
+	{
+		return( 1 );
+	}
+	return( fcrypto_test_serpent_context_crypt_blocks_with_function(
+	         libfcrypto_internal_serpent_context_crypt_blocks_sse2,
+	         64 ) );
+}
+
+#endif /* defined( LIBFCRYPTO_SERPENT_CONTEXT_HAVE_SSE2 ) */
+
+#if defined( LIBFCRYPTO_SERPENT_CONTEXT_HAVE_AVX2 )
+
+/* Tests the libfcrypto_internal_serpent_context_crypt_blocks_avx2 function
+ * Returns 1 if successful or 0 if not
+ */
+int fcrypto_test_serpent_context_crypt_blocks_avx2(
+     void )
+{
+	if( __builtin_cpu_supports( "avx2" ) == 0 )
+	{
+		return( 1 );
+	}
+	return( fcrypto_test_serpent_context_crypt_blocks_with_function(
+	         libfcrypto_internal_serpent_context_crypt_blocks_avx2,
+	         128 ) );
+}
+
+#endif /* defined( LIBFCRYPTO_SERPENT_CONTEXT_HAVE_AVX2 ) */
+
+#if defined( LIBFCRYPTO_SERPENT_CONTEXT_HAVE_AVX512 )
+
+/* Tests the libfcrypto_internal_serpent_context_crypt_blocks_avx512 function
+ * Returns 1 if successful or 0 if not
+ */
+int fcrypto_test_serpent_context_crypt_blocks_avx512(
+     void )
+{
+	if( __builtin_cpu_supports( "avx512f" ) == 0 )
+	{
+		return( 1 );
+	}
+	return( fcrypto_test_serpent_context_crypt_blocks_with_function(
+	         libfcrypto_internal_serpent_context_crypt_blocks_avx512,
+	         256 ) );
+}
+
+#endif /* defined( LIBFCRYPTO_SERPENT_CONTEXT_HAVE_AVX512 ) */
+
+#endif /* if defined( __GNUC__ ) && !defined( LIBFCRYPTO_DLL_IMPORT ) */
+
+/* Tests the libfcrypto_serpent_crypt function with a NESSIE test vector
+ * Returns 1 if successful or 0 if not
+ */
+int fcrypto_test_serpent_crypt_ecb_with_nessie_test_vector(
+     const uint8_t *key, 
+     size_t key_size,
+     uint8_t *input_data,
+     uint8_t *expected_output_data_iterations_1,
+     uint8_t *expected_output_data_iterations_100,
+     uint8_t *expected_output_data_iterations_1000 )
+{
+	libcerror_error_t *error                      = NULL;
+	libfcrypto_serpent_context_t *serpent_context = NULL;
+	int iteration                                 = 0;
+	int result                                    = 0;
+
+	/* Initialize test
+	 */
+	result = libfcrypto_serpent_context_initialize(
+	          &serpent_context,
+	          &error );
+
+	FCRYPTO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FCRYPTO_TEST_ASSERT_IS_NOT_NULL(
+	 "serpent_context",
+	 serpent_context );
+
+	FCRYPTO_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfcrypto_serpent_context_set_key(
+	          serpent_context,
+	          key,
+	          key_size,
+	          &error );
+
+	FCRYPTO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FCRYPTO_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test encrypting a buffer of data
+	 */
+	for( iteration = 1;
+	     iteration <= 1000;
+	     iteration++ )
+	{
+		result = libfcrypto_serpent_crypt_ecb(
+		          serpent_context,
+		          LIBFCRYPTO_SERPENT_CRYPT_MODE_ENCRYPT,
+		          input_data,
+		          16,
+		          input_data,
+		          16,
+		          &error );
+
+		FCRYPTO_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		FCRYPTO_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		if( iteration == 1 )
+		{
+			result = memory_compare(
+			          input_data,
+			          expected_output_data_iterations_1,
+			          16 );
+
+			FCRYPTO_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 0 );
+		}
+		else if( iteration == 100 )
+		{
+			result = memory_compare(
+			          input_data,
+			          expected_output_data_iterations_100,
+			          16 );
+
+			FCRYPTO_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 0 );
+		}
+	}
+	result = memory_compare(
+	          input_data,
+	          expected_output_data_iterations_1000,
+	          16 );
+
+	FCRYPTO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	/* Test decrypting a buffer of data
+	 */
+	for( iteration = 999;
+	     iteration >= 1;
+	     iteration-- )
+	{
+		result = libfcrypto_serpent_crypt_ecb(
+		          serpent_context,
+		          LIBFCRYPTO_SERPENT_CRYPT_MODE_DECRYPT,
+		          input_data,
+		          16,
+		          input_data,
+		          16,
+		          &error );
+
+		FCRYPTO_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		FCRYPTO_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		if( iteration == 1 )
+		{
+			result = memory_compare(
+			          input_data,
+			          expected_output_data_iterations_1,
+			          16 );
 
 			FCRYPTO_TEST_ASSERT_EQUAL_INT(
 			 "result",
@@ -1028,9 +3533,43 @@ int main(
 
 	/* TODO add tests for libfcrypto_internal_serpent_context_decrypt_block */
 
+	FCRYPTO_TEST_RUN(
+	 "libfcrypto_internal_serpent_context_crypt_blocks",
+	 fcrypto_test_serpent_context_crypt_blocks );
+
+#if defined( LIBFCRYPTO_SERPENT_CONTEXT_HAVE_SSE2 )
+
+	FCRYPTO_TEST_RUN(
+	 "libfcrypto_internal_serpent_context_crypt_blocks_sse2",
+	 fcrypto_test_serpent_context_crypt_blocks_sse2 );
+
+#endif /* defined( LIBFCRYPTO_SERPENT_CONTEXT_HAVE_SSE2 ) */
+
+#if defined( LIBFCRYPTO_SERPENT_CONTEXT_HAVE_AVX2 )
+
+	FCRYPTO_TEST_RUN(
+	 "libfcrypto_internal_serpent_context_crypt_blocks_avx2",
+	 fcrypto_test_serpent_context_crypt_blocks_avx2 );
+
+#endif /* defined( LIBFCRYPTO_SERPENT_CONTEXT_HAVE_AVX2 ) */
+
+#if defined( LIBFCRYPTO_SERPENT_CONTEXT_HAVE_AVX512 )
+
+	FCRYPTO_TEST_RUN(
+	 "libfcrypto_internal_serpent_context_crypt_blocks_avx512",
+	 fcrypto_test_serpent_context_crypt_blocks_avx512 );
+
+#endif /* defined( LIBFCRYPTO_SERPENT_CONTEXT_HAVE_AVX512 ) */
+
 #endif /* if defined( __GNUC__ ) && !defined( LIBFCRYPTO_DLL_IMPORT ) */
 
-	/* TODO add tests for libfcrypto_serpent_crypt_cbc */
+	FCRYPTO_TEST_RUN(
+	 "libfcrypto_serpent_crypt_cbc",
+	 fcrypto_test_serpent_crypt_cbc );
+
+	FCRYPTO_TEST_RUN(
+	 "libfcrypto_serpent_crypt_ctr",
+	 fcrypto_test_serpent_crypt_ctr );
 
 	FCRYPTO_TEST_RUN(
 	 "libfcrypto_serpent_crypt_ecb",
@@ -1040,6 +3579,14 @@ int main(
 	 "libfcrypto_serpent_crypt_ecb with NESSIE test vector and 128-bit key",
 	 fcrypto_test_serpent_crypt_ecb_nessie_128bit );
 
+	FCRYPTO_TEST_RUN(
+	 "libfcrypto_serpent_crypt_xts",
+	 fcrypto_test_serpent_crypt_xts );
+
+	FCRYPTO_TEST_RUN(
+	 "libfcrypto_serpent_crypt_xts_data_units",
+	 fcrypto_test_serpent_crypt_xts_data_units );
+
 	return( EXIT_SUCCESS );
 
 on_error:
@@ -59,6 +59,216 @@ on_error:
 	return( 0 );
 }
 
+/* Tests the libfcrypto_get_supported_cpu_level function
+ * Returns 1 if successful or 0 if not
+ */
+int fcrypto_test_get_supported_cpu_level(
+     void )
+{
+	libfcrypto_error_t *error = NULL;
+	int cpu_level             = -1;
+	int result                = 0;
+
+	/* Test regular cases
+	 */
+	result = libfcrypto_get_supported_cpu_level(
+	          &cpu_level,
+	          &error );
+
+	FCRYPTO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FCRYPTO_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FCRYPTO_TEST_ASSERT_GREATER_THAN_INT(
+	 "cpu_level",
+	 cpu_level,
+	 LIBFCRYPTO_CPU_LEVEL_SCALAR - 1 );
+
+	FCRYPTO_TEST_ASSERT_LESS_THAN_INT(
+	 "cpu_level",
+	 cpu_level,
+	 LIBFCRYPTO_CPU_LEVEL_AVX512 + 1 );
+
+	/* Test error cases
+	 */
+	result = libfcrypto_get_supported_cpu_level(
+	          NULL,
+	          &error );
+
+	FCRYPTO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FCRYPTO_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libfcrypto_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libfcrypto_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libfcrypto_get_cpu_level function
+ * Returns 1 if successful or 0 if not
+ */
+int fcrypto_test_get_cpu_level(
+     void )
+{
+	libfcrypto_error_t *error = NULL;
+	int cpu_level             = -1;
+	int result                = 0;
+
+	/* Test regular cases
+	 */
+	result = libfcrypto_get_cpu_level(
+	          &cpu_level,
+	          &error );
+
+	FCRYPTO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FCRYPTO_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FCRYPTO_TEST_ASSERT_GREATER_THAN_INT(
+	 "cpu_level",
+	 cpu_level,
+	 LIBFCRYPTO_CPU_LEVEL_SCALAR - 1 );
+
+	FCRYPTO_TEST_ASSERT_LESS_THAN_INT(
+	 "cpu_level",
+	 cpu_level,
+	 LIBFCRYPTO_CPU_LEVEL_AVX512 + 1 );
+
+	/* Test error cases
+	 */
+	result = libfcrypto_get_cpu_level(
+	          NULL,
+	          &error );
+
+	FCRYPTO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FCRYPTO_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libfcrypto_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libfcrypto_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libfcrypto_set_cpu_level function
+ * Returns 1 if successful or 0 if not
+ */
+int fcrypto_test_set_cpu_level(
+     void )
+{
+	libfcrypto_error_t *error = NULL;
+	int cpu_level             = 0;
+	int result                = 0;
+
+	/* Initialize test
+	 */
+	result = libfcrypto_get_cpu_level(
+	          &cpu_level,
+	          &error );
+
+	FCRYPTO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FCRYPTO_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libfcrypto_set_cpu_level(
+	          LIBFCRYPTO_CPU_LEVEL_SCALAR,
+	          &error );
+
+	FCRYPTO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FCRYPTO_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfcrypto_set_cpu_level(
+	          cpu_level,
+	          &error );
+
+	FCRYPTO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FCRYPTO_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libfcrypto_set_cpu_level(
+	          -1,
+	          &error );
+
+	FCRYPTO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FCRYPTO_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libfcrypto_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libfcrypto_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
 /* The main program
  */
 #if defined( HAVE_WIDE_SYSTEM_CHARACTER )
@@ -78,6 +288,18 @@ int main(
 	 "libfcrypto_get_version",
 	 fcrypto_test_get_version );
 
+	FCRYPTO_TEST_RUN(
+	 "libfcrypto_get_supported_cpu_level",
+	 fcrypto_test_get_supported_cpu_level );
+
+	FCRYPTO_TEST_RUN(
+	 "libfcrypto_get_cpu_level",
+	 fcrypto_test_get_cpu_level );
+
+	FCRYPTO_TEST_RUN(
+	 "libfcrypto_set_cpu_level",
+	 fcrypto_test_set_cpu_level );
+
 	return( EXIT_SUCCESS );
 
 on_error:
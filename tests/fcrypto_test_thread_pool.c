@@ -0,0 +1,782 @@
+/*
+ * Library Thread pool type test program
+ *
+ * Copyright (C) 2017-2024, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <file_stream.h>
+#include <memory.h>
+#include <types.h>
+
+#if defined( HAVE_STDLIB_H ) || defined( WINAPI )
+#include <stdlib.h>
+#endif
+
+#include "fcrypto_test_libcerror.h"
+#include "fcrypto_test_libfcrypto.h"
+#include "fcrypto_test_macros.h"
+#include "fcrypto_test_memory.h"
+#include "fcrypto_test_unused.h"
+
+#include "../libfcrypto/libfcrypto_thread_pool.h"
+
+#if defined( HAVE_MULTI_THREAD_SUPPORT ) && defined( HAVE_PTHREAD_H ) && !defined( WINAPI )
+#define FCRYPTO_TEST_THREAD_POOL_NUMBER_OF_THREADS	4
+#else
+#define FCRYPTO_TEST_THREAD_POOL_NUMBER_OF_THREADS	0
+#endif
+
+/* Tests the libfcrypto_thread_pool_initialize function
+ * Returns 1 if successful or 0 if not
+ */
+int fcrypto_test_thread_pool_initialize(
+     void )
+{
+	libcerror_error_t *error               = NULL;
+	libfcrypto_thread_pool_t *thread_pool = NULL;
+	int result                             = 0;
+
+#if defined( HAVE_FCRYPTO_TEST_MEMORY )
+	int number_of_malloc_fail_tests        = 2;
+	int number_of_memset_fail_tests        = 1;
+	int test_number                        = 0;
+#endif
+
+	/* Test regular cases
+	 */
+	result = libfcrypto_thread_pool_initialize(
+	          &thread_pool,
+	          0,
+	          &error );
+
+	FCRYPTO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FCRYPTO_TEST_ASSERT_IS_NOT_NULL(
+	 "thread_pool",
+	 thread_pool );
+
+	FCRYPTO_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfcrypto_thread_pool_free(
+	          &thread_pool,
+	          &error );
+
+	FCRYPTO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FCRYPTO_TEST_ASSERT_IS_NULL(
+	 "thread_pool",
+	 thread_pool );
+
+	FCRYPTO_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfcrypto_thread_pool_initialize(
+	          &thread_pool,
+	          4,
+	          &error );
+
+	FCRYPTO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FCRYPTO_TEST_ASSERT_IS_NOT_NULL(
+	 "thread_pool",
+	 thread_pool );
+
+	FCRYPTO_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libfcrypto_thread_pool_initialize(
+	          NULL,
+	          4,
+	          &error );
+
+	FCRYPTO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FCRYPTO_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfcrypto_thread_pool_initialize(
+	          &thread_pool,
+	          4,
+	          &error );
+
+	FCRYPTO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FCRYPTO_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfcrypto_thread_pool_free(
+	          &thread_pool,
+	          &error );
+
+	FCRYPTO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FCRYPTO_TEST_ASSERT_IS_NULL(
+	 "thread_pool",
+	 thread_pool );
+
+	FCRYPTO_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfcrypto_thread_pool_initialize(
+	          &thread_pool,
+	          -1,
+	          &error );
+
+	FCRYPTO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FCRYPTO_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfcrypto_thread_pool_initialize(
+	          &thread_pool,
+	          257,
+	          &error );
+
+	FCRYPTO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FCRYPTO_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+#if defined( HAVE_FCRYPTO_TEST_MEMORY )
+
+	for( test_number = 0;
+	     test_number < number_of_malloc_fail_tests;
+	     test_number++ )
+	{
+		/* Test libfcrypto_thread_pool_initialize with malloc failing
+		 */
+		fcrypto_test_malloc_attempts_before_fail = test_number;
+
+		result = libfcrypto_thread_pool_initialize(
+		          &thread_pool,
+		          FCRYPTO_TEST_THREAD_POOL_NUMBER_OF_THREADS,
+		          &error );
+
+		if( fcrypto_test_malloc_attempts_before_fail != -1 )
+		{
+			fcrypto_test_malloc_attempts_before_fail = -1;
+
+			if( thread_pool != NULL )
+			{
+				libfcrypto_thread_pool_free(
+				 &thread_pool,
+				 NULL );
+			}
+		}
+		else
+		{
+			FCRYPTO_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 -1 );
+
+			FCRYPTO_TEST_ASSERT_IS_NULL(
+			 "thread_pool",
+			 thread_pool );
+
+			FCRYPTO_TEST_ASSERT_IS_NOT_NULL(
+			 "error",
+			 error );
+
+			libcerror_error_free(
+			 &error );
+		}
+	}
+	for( test_number = 0;
+	     test_number < number_of_memset_fail_tests;
+	     test_number++ )
+	{
+		/* Test libfcrypto_thread_pool_initialize with memset failing
+		 */
+		fcrypto_test_memset_attempts_before_fail = test_number;
+
+		result = libfcrypto_thread_pool_initialize(
+		          &thread_pool,
+		          FCRYPTO_TEST_THREAD_POOL_NUMBER_OF_THREADS,
+		          &error );
+
+		if( fcrypto_test_memset_attempts_before_fail != -1 )
+		{
+			fcrypto_test_memset_attempts_before_fail = -1;
+
+			if( thread_pool != NULL )
+			{
+				libfcrypto_thread_pool_free(
+				 &thread_pool,
+				 NULL );
+			}
+		}
+		else
+		{
+			FCRYPTO_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 -1 );
+
+			FCRYPTO_TEST_ASSERT_IS_NULL(
+			 "thread_pool",
+			 thread_pool );
+
+			FCRYPTO_TEST_ASSERT_IS_NOT_NULL(
+			 "error",
+			 error );
+
+			libcerror_error_free(
+			 &error );
+		}
+	}
+#endif /* defined( HAVE_FCRYPTO_TEST_MEMORY ) */
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( thread_pool != NULL )
+	{
+		libfcrypto_thread_pool_free(
+		 &thread_pool,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libfcrypto_thread_pool_free function
+ * Returns 1 if successful or 0 if not
+ */
+int fcrypto_test_thread_pool_free(
+     void )
+{
+	libcerror_error_t *error = NULL;
+	int result               = 0;
+
+	/* Test error cases
+	 */
+	result = libfcrypto_thread_pool_free(
+	          NULL,
+	          &error );
+
+	FCRYPTO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FCRYPTO_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libfcrypto_thread_pool_get_number_of_threads function
+ * Returns 1 if successful or 0 if not
+ */
+int fcrypto_test_thread_pool_get_number_of_threads(
+     void )
+{
+	libcerror_error_t *error               = NULL;
+	libfcrypto_thread_pool_t *thread_pool = NULL;
+	int number_of_threads                  = 0;
+	int result                             = 0;
+
+	/* Initialize test
+	 */
+	result = libfcrypto_thread_pool_initialize(
+	          &thread_pool,
+	          4,
+	          &error );
+
+	FCRYPTO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FCRYPTO_TEST_ASSERT_IS_NOT_NULL(
+	 "thread_pool",
+	 thread_pool );
+
+	FCRYPTO_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libfcrypto_thread_pool_get_number_of_threads(
+	          thread_pool,
+	          &number_of_threads,
+	          &error );
+
+	FCRYPTO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FCRYPTO_TEST_ASSERT_EQUAL_INT(
+	 "number_of_threads",
+	 number_of_threads,
+	 FCRYPTO_TEST_THREAD_POOL_NUMBER_OF_THREADS );
+
+	FCRYPTO_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libfcrypto_thread_pool_get_number_of_threads(
+	          NULL,
+	          &number_of_threads,
+	          &error );
+
+	FCRYPTO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FCRYPTO_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfcrypto_thread_pool_get_number_of_threads(
+	          thread_pool,
+	          NULL,
+	          &error );
+
+	FCRYPTO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FCRYPTO_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libfcrypto_thread_pool_free(
+	          &thread_pool,
+	          &error );
+
+	FCRYPTO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FCRYPTO_TEST_ASSERT_IS_NULL(
+	 "thread_pool",
+	 thread_pool );
+
+	FCRYPTO_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( thread_pool != NULL )
+	{
+		libfcrypto_thread_pool_free(
+		 &thread_pool,
+		 NULL );
+	}
+	return( 0 );
+}
+
+#if defined( __GNUC__ ) && !defined( LIBFCRYPTO_DLL_IMPORT )
+
+/* Test job function that doubles the value of the job
+ * Returns 1 if successful or -1 on error
+ */
+int fcrypto_test_thread_pool_job_function(
+     intptr_t *job,
+     libcerror_error_t **error )
+{
+	static char *function = "fcrypto_test_thread_pool_job_function";
+	uint32_t *value       = NULL;
+
+	value = (uint32_t *) job;
+
+	/* A value of 0 is used to test a failing job
+	 */
+	if( *value == 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported value.",
+		 function );
+
+		return( -1 );
+	}
+	*value *= 2;
+
+	return( 1 );
+}
+
+/* Tests the libfcrypto_internal_thread_pool_run_jobs function
+ * Returns 1 if successful or 0 if not
+ */
+int fcrypto_test_internal_thread_pool_run_jobs(
+     void )
+{
+	uint32_t jobs[ 100 ];
+
+	libcerror_error_t *error               = NULL;
+	libfcrypto_thread_pool_t *thread_pool = NULL;
+	int job_index                          = 0;
+	int result                             = 0;
+	int run_index                          = 0;
+
+	/* Initialize test
+	 */
+	for( job_index = 0;
+	     job_index < 100;
+	     job_index++ )
+	{
+		jobs[ job_index ] = (uint32_t) job_index + 1;
+	}
+	result = libfcrypto_thread_pool_initialize(
+	          &thread_pool,
+	          4,
+	          &error );
+
+	FCRYPTO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FCRYPTO_TEST_ASSERT_IS_NOT_NULL(
+	 "thread_pool",
+	 thread_pool );
+
+	FCRYPTO_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	for( run_index = 0;
+	     run_index < 8;
+	     run_index++ )
+	{
+		result = libfcrypto_internal_thread_pool_run_jobs(
+		          (libfcrypto_internal_thread_pool_t *) thread_pool,
+		          &fcrypto_test_thread_pool_job_function,
+		          (uint8_t *) jobs,
+		          sizeof( uint32_t ),
+		          100,
+		          &error );
+
+		FCRYPTO_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		FCRYPTO_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+	}
+	for( job_index = 0;
+	     job_index < 100;
+	     job_index++ )
+	{
+		FCRYPTO_TEST_ASSERT_EQUAL_UINT32(
+		 "jobs[ job_index ]",
+		 jobs[ job_index ],
+		 (uint32_t) ( job_index + 1 ) << 8 );
+	}
+	/* Test a run where multiple jobs fail
+	 */
+	jobs[ 25 ] = 0;
+	jobs[ 50 ] = 0;
+	jobs[ 75 ] = 0;
+
+	result = libfcrypto_internal_thread_pool_run_jobs(
+	          (libfcrypto_internal_thread_pool_t *) thread_pool,
+	          &fcrypto_test_thread_pool_job_function,
+	          (uint8_t *) jobs,
+	          sizeof( uint32_t ),
+	          100,
+	          &error );
+
+	FCRYPTO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FCRYPTO_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Test error cases
+	 */
+	result = libfcrypto_internal_thread_pool_run_jobs(
+	          NULL,
+	          &fcrypto_test_thread_pool_job_function,
+	          (uint8_t *) jobs,
+	          sizeof( uint32_t ),
+	          100,
+	          &error );
+
+	FCRYPTO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FCRYPTO_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfcrypto_internal_thread_pool_run_jobs(
+	          (libfcrypto_internal_thread_pool_t *) thread_pool,
+	          NULL,
+	          (uint8_t *) jobs,
+	          sizeof( uint32_t ),
+	          100,
+	          &error );
+
+	FCRYPTO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FCRYPTO_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfcrypto_internal_thread_pool_run_jobs(
+	          (libfcrypto_internal_thread_pool_t *) thread_pool,
+	          &fcrypto_test_thread_pool_job_function,
+	          NULL,
+	          sizeof( uint32_t ),
+	          100,
+	          &error );
+
+	FCRYPTO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FCRYPTO_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfcrypto_internal_thread_pool_run_jobs(
+	          (libfcrypto_internal_thread_pool_t *) thread_pool,
+	          &fcrypto_test_thread_pool_job_function,
+	          (uint8_t *) jobs,
+	          0,
+	          100,
+	          &error );
+
+	FCRYPTO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FCRYPTO_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfcrypto_internal_thread_pool_run_jobs(
+	          (libfcrypto_internal_thread_pool_t *) thread_pool,
+	          &fcrypto_test_thread_pool_job_function,
+	          (uint8_t *) jobs,
+	          sizeof( uint32_t ),
+	          -1,
+	          &error );
+
+	FCRYPTO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FCRYPTO_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libfcrypto_thread_pool_free(
+	          &thread_pool,
+	          &error );
+
+	FCRYPTO_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FCRYPTO_TEST_ASSERT_IS_NULL(
+	 "thread_pool",
+	 thread_pool );
+
+	FCRYPTO_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( thread_pool != NULL )
+	{
+		libfcrypto_thread_pool_free(
+		 &thread_pool,
+		 NULL );
+	}
+	return( 0 );
+}
+
+#endif /* defined( __GNUC__ ) && !defined( LIBFCRYPTO_DLL_IMPORT ) */
+
+/* The main program
+ */
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+int wmain(
+     int argc FCRYPTO_TEST_ATTRIBUTE_UNUSED,
+     wchar_t * const argv[] FCRYPTO_TEST_ATTRIBUTE_UNUSED )
+#else
+int main(
+     int argc FCRYPTO_TEST_ATTRIBUTE_UNUSED,
+     char * const argv[] FCRYPTO_TEST_ATTRIBUTE_UNUSED )
+#endif
+{
+	FCRYPTO_TEST_UNREFERENCED_PARAMETER( argc )
+	FCRYPTO_TEST_UNREFERENCED_PARAMETER( argv )
+
+	FCRYPTO_TEST_RUN(
+	 "libfcrypto_thread_pool_initialize",
+	 fcrypto_test_thread_pool_initialize );
+
+	FCRYPTO_TEST_RUN(
+	 "libfcrypto_thread_pool_free",
+	 fcrypto_test_thread_pool_free );
+
+	FCRYPTO_TEST_RUN(
+	 "libfcrypto_thread_pool_get_number_of_threads",
+	 fcrypto_test_thread_pool_get_number_of_threads );
+
+#if defined( __GNUC__ ) && !defined( LIBFCRYPTO_DLL_IMPORT )
+
+	FCRYPTO_TEST_RUN(
+	 "libfcrypto_internal_thread_pool_run_jobs",
+	 fcrypto_test_internal_thread_pool_run_jobs );
+
+#endif /* defined( __GNUC__ ) && !defined( LIBFCRYPTO_DLL_IMPORT ) */
+
+	return( EXIT_SUCCESS );
+
+on_error:
+	return( EXIT_FAILURE );
+}
+
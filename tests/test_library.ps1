@@ -6,7 +6,7 @@ $ExitSuccess = 0
 $ExitFailure = 1
 $ExitIgnore = 77
 
-$LibraryTests = "blowfish_context des3_context error rc4_context serpent_context support"
+$LibraryTests = "blowfish_context cbc_stream cipher cpu ctr des3_bitslice des3_context error job_queue rc4_context serpent_context support thread_pool"
 $LibraryTestsWithInput = ""
 $OptionSets = ""
 
@@ -7,7 +7,7 @@ EXIT_SUCCESS=0;
 EXIT_FAILURE=1;
 EXIT_IGNORE=77;
 
-LIBRARY_TESTS="blowfish_context des3_context error rc4_context serpent_context support";
+LIBRARY_TESTS="blowfish_context cbc_stream cipher cpu ctr des3_bitslice des3_context error job_queue rc4_context serpent_context support thread_pool";
 LIBRARY_TESTS_WITH_INPUT="";
 OPTION_SETS=();
 